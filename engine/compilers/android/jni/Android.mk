@@ -170,6 +170,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../lib/lpng/pngwutil.c \
 					../../../source/2d/assets/AnimationAsset.cc \
 					../../../source/2d/assets/ImageAsset.cc \
+					../../../source/2d/assets/ImageAtlas.cc \
 					../../../source/2d/assets/ParticleAsset.cc \
 					../../../source/2d/assets/ParticleAssetEmitter.cc \
 					../../../source/2d/assets/ParticleAssetField.cc \
@@ -181,6 +182,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/2d/controllers/core/PickingSceneController.cc \
 					../../../source/2d/controllers/PointForceController.cc \
 					../../../source/2d/core/BatchRender.cc \
+					../../../source/2d/core/AtlasPacker.cc \
 					../../../source/2d/core/CoreMath.cc \
 					../../../source/2d/core/ImageFrameProvider.cc \
 					../../../source/2d/core/ImageFrameProviderCore.cc \
@@ -209,8 +211,10 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/2d/sceneobject/Sprite.cc \
 					../../../source/2d/sceneobject/Trigger.cc \
 					../../../source/2d/scene/ContactFilter.cc \
+					../../../source/2d/scene/ContactBatch.cc \
 					../../../source/2d/scene/DebugDraw.cc \
 					../../../source/2d/scene/Scene.cc \
+					../../../source/2d/scene/SceneBenchmark.cc \
 					../../../source/2d/scene/SceneRenderFactories.cpp \
 					../../../source/2d/scene/SceneRenderQueue.cpp \
 					../../../source/2d/scene/WorldQuery.cc \
@@ -219,6 +223,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/assets/assetBase.cc \
 					../../../source/assets/assetFieldTypes.cc \
 					../../../source/assets/assetManager.cc \
+					../../../source/assets/assetLoader.cc \
 					../../../source/assets/assetQuery.cc \
 					../../../source/assets/assetTagsManifest.cc \
 					../../../source/assets/declaredAssets.cc \
@@ -282,6 +287,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/console/ConsoleTypeValidators.cc \
 					../../../source/console/metaScripting_ScriptBinding.cc \
 					../../../source/debug/profiler.cc \
+					../../../source/debug/telemetry.cc \
 					../../../source/debug/remote/RemoteDebugger1.cc \
 					../../../source/debug/remote/RemoteDebuggerBase.cc \
 					../../../source/debug/remote/RemoteDebuggerBridge.cc \
@@ -294,6 +300,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/graphics/bitmapPng.cc \
 					../../../source/graphics/color.cc \
 					../../../source/graphics/dgl.cc \
+					../../../source/graphics/renderCommands.cc \
 					../../../source/graphics/dglMatrix.cc \
 					../../../source/graphics/DynamicTexture.cc \
 					../../../source/graphics/gBitmap.cc \
@@ -304,6 +311,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/graphics/TextureDictionary.cc \
 					../../../source/graphics/TextureHandle.cc \
 					../../../source/graphics/TextureManager.cc \
+					../../../source/graphics/bitmapDecoder.cc \
 					../../../source/gui/containers/guiGridCtrl.cc \
 					../../../source/gui/guiArrayCtrl.cc \
 					../../../source/gui/guiBackgroundCtrl.cc \
@@ -422,6 +430,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/console/cmdgram.cc \
 					../../../source/console/CMDscan.cc \
 					../../../source/console/codeBlock.cc \
+					../../../source/console/scriptCache.cc \
 					../../../source/console/compiledEval.cc \
 					../../../source/console/compiler.cc \
 					../../../source/console/console.cc \
@@ -466,6 +475,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/platform/menus/popupMenu.cc \
 					../../../source/platform/nativeDialogs/msgBox.cpp \
 					../../../source/platform/Tickable.cc \
+					../../../source/platform/threads/threadPool.cc \
 					../../../source/platformAndroid/AndroidAlerts.cpp \
 					../../../source/platformAndroid/AndroidAudio.cpp \
 					../../../source/platformAndroid/AndroidConsole.cpp \
@@ -505,6 +515,7 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 					../../../source/sim/simDictionary.cc \
 					../../../source/sim/simFieldDictionary.cc \
 					../../../source/sim/simManager.cc \
+					../../../source/sim/simEventQueue.cc \
 					../../../source/sim/simObject.cc \
 					../../../source/sim/SimObjectList.cc \
 					../../../source/sim/simSerialize.cpp \
@@ -570,6 +581,21 @@ LOCAL_SRC_FILES :=  ../../../lib/ljpeg/jcapimin.c \
 #					../../../source/testing/tests/platformFileIoTests.cc \
 #					../../../source/testing/tests/platformMemoryTests.cc \
 #					../../../source/testing/tests/platformStringTests.cc \
+#					../../../source/testing/tests/stringTableTests.cc \
+#					../../../source/testing/tests/consoleObjectTests.cc \
+#					../../../source/testing/tests/bitmapDecoderTests.cc \
+#					../../../source/testing/tests/textureManagerTests.cc \
+#					../../../source/testing/tests/imageAtlasTests.cc \
+#					../../../source/testing/tests/batchRenderTests.cc \
+#					../../../source/testing/tests/telemetryTests.cc \
+#					../../../source/testing/tests/simDictionaryTests.cc \
+#					../../../source/testing/tests/simFieldDictionaryTests.cc \
+#					../../../source/testing/tests/scriptTierTests.cc \
+#					../../../source/testing/tests/codeBlockTests.cc \
+#					../../../source/testing/tests/simEventQueueTests.cc \
+#					../../../source/testing/tests/sceneLayerTests.cc \
+#					../../../source/testing/tests/particleAssetFieldTests.cc \
+#					../../../source/testing/tests/assetManagerTests.cc \
 #					../../../source/testing/unitTesting.cc
  
 ifeq ($(APP_OPTIM),debug)
@@ -162,6 +162,7 @@ const char* ImageAsset::getFilterModeDescription( ImageAsset::TextureFilterMode
 ImageAsset::ImageAsset() :  mImageFile(StringTable->EmptyString),
                             mForce16Bit(false),
                             mLocalFilterMode(FILTER_INVALID),
+                            mAtlas(true),
                             mExplicitMode(false),
                             mCellRowOrder(true),
                             mCellOffsetX(0),
@@ -173,7 +174,9 @@ ImageAsset::ImageAsset() :  mImageFile(StringTable->EmptyString),
                             mCellWidth(0),
                             mCellHeight(0),
 
-                            mImageTextureHandle(NULL)
+                            mImageTextureHandle(NULL),
+                            mImageWidth(0),
+                            mImageHeight(0)
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mFrames );
@@ -184,6 +187,8 @@ ImageAsset::ImageAsset() :  mImageFile(StringTable->EmptyString),
 
 ImageAsset::~ImageAsset()
 {
+    // Remove from any atlas page.
+    removeFromAtlas();
 }
 
 //------------------------------------------------------------------------------
@@ -197,6 +202,7 @@ void ImageAsset::initPersistFields()
     addProtectedField("ImageFile", TypeAssetLooseFilePath, Offset(mImageFile, ImageAsset), &setImageFile, &getImageFile, &defaultProtectedWriteFn, "");
     addProtectedField("Force16bit", TypeBool, Offset(mForce16Bit, ImageAsset), &setForce16Bit, &defaultProtectedGetFn, &writeForce16Bit, "");
     addProtectedField("FilterMode", TypeEnum, Offset(mLocalFilterMode, ImageAsset), &setFilterMode, &defaultProtectedGetFn, &writeFilterMode, 1, &textureFilterTable);   
+    addProtectedField("Atlas", TypeBool, Offset(mAtlas, ImageAsset), &setAtlas, &defaultProtectedGetFn, &writeAtlas, "");
     addProtectedField("ExplicitMode", TypeBool, Offset(mExplicitMode, ImageAsset), &setExplicitMode, &defaultProtectedGetFn, &defaultProtectedNotWriteFn, "");
 
     addProtectedField("CellRowOrder", TypeBool, Offset(mCellRowOrder, ImageAsset), &setCellRowOrder, &defaultProtectedGetFn, &writeCellRowOrder, "");
@@ -267,6 +273,7 @@ void ImageAsset::copyTo(SimObject* object)
     pAsset->setImageFile( getImageFile() );
     pAsset->setForce16Bit( getForce16Bit() );
     pAsset->setFilterMode( getFilterMode() );
+    pAsset->setAtlas( getAtlas() );
     pAsset->setExplicitMode( getExplicitMode() );
     pAsset->setCellRowOrder( getCellRowOrder() );
     pAsset->setCellOffsetX( getCellCountX() );
@@ -294,7 +301,8 @@ void ImageAsset::copyTo(SimObject* object)
     for( S32 index = 0; index < explicitCellCount; ++index )
     {
         // Fetch the cell pixel area.
-        const FrameArea::PixelArea& pixelArea = getImageFrameArea( index ).mPixelArea;
+        // NOTE: The explicit cells are used as the frames are offset when atlased.
+        const FrameArea::PixelArea& pixelArea = mExplicitFrames[index];
 
         // Add the explicit cell.
         pAsset->addExplicitCell( pixelArea.mPixelOffset.x, pixelArea.mPixelOffset.y, pixelArea.mPixelWidth, pixelArea.mPixelHeight, pixelArea.mRegionName );
@@ -341,6 +349,21 @@ void ImageAsset::setFilterMode( const ImageAsset::TextureFilterMode filterMode )
 
 //------------------------------------------------------------------------------
 
+void ImageAsset::setAtlas( const bool atlas )
+{
+    // Ignore no change,
+    if ( atlas == mAtlas )
+        return;
+
+    // Update.
+    mAtlas = atlas;
+
+    // Refresh the asset.
+    refreshAsset();
+}
+
+//------------------------------------------------------------------------------
+
 void ImageAsset::setExplicitMode( const bool explicitMode )
 {
     // Ignore no change,
@@ -1027,8 +1050,8 @@ ImageAsset::FrameArea& ImageAsset::getCellByName( const char* cellName)
 
 void ImageAsset::setTextureFilter( const TextureFilterMode filterMode )
 {
-    // Finish if no texture.
-    if ( mImageTextureHandle.IsNull() )
+    // Finish if no texture or the texture is a shared atlas page.
+    if ( mImageTextureHandle.IsNull() || isAtlased() )
         return;
 
     // Select Hardware Filter Mode.
@@ -1121,32 +1144,13 @@ void ImageAsset::calculateImage( void )
     // Clear frames.
     mFrames.clear();
 
-    // If we have an existing texture and we're setting to the same bitmap then force the texture manager
-    // to refresh the texture itself.
-    if ( !mImageTextureHandle.IsNull() && dStricmp(mImageTextureHandle.getTextureKey(), mImageFile) == 0 )
-        TextureManager::refresh( mImageFile );
-
-    // Get image texture.
-    mImageTextureHandle.set( mImageFile, TextureHandle::BitmapTexture, true, getForce16Bit() );
-
-    // Is the texture valid?
-    if ( mImageTextureHandle.IsNull() )
-    {
-        // No, so warn.
-        Con::warnf( "Image '%s' could not load texture '%s'.", getAssetId(), mImageFile );
-        return;
-    }
+    // Remove from any atlas page.
+    removeFromAtlas();
 
     // Is the local filter mode specified?
-    if ( mLocalFilterMode != FILTER_INVALID )
-    {
-        // Yes, so set filter mode.
-        setTextureFilter( mLocalFilterMode );
-    }
-    else
+    TextureFilterMode filterMode = mLocalFilterMode;
+    if ( filterMode == FILTER_INVALID )
     {
-        TextureFilterMode filterMode = FILTER_NEAREST;
-
         // No, so fetch the global filter.
         const char* pGlobalFilter = Con::getVariable( "$pref::T2D::imageAssetGlobalFilterMode" );
 
@@ -1157,9 +1161,35 @@ void ImageAsset::calculateImage( void )
         // If global filter mode is invalid then use local filter mode.
         if ( filterMode == FILTER_INVALID )
             filterMode = FILTER_NEAREST;
+    }
+
+    // Use an atlas page if the image can be packed.
+    if ( !addToAtlas( filterMode ) )
+    {
+        // If we have an existing texture and we're setting to the same bitmap then force the texture manager
+        // to refresh the texture itself.
+        if ( !mImageTextureHandle.IsNull() && dStricmp(mImageTextureHandle.getTextureKey(), mImageFile) == 0 )
+            TextureManager::refresh( mImageFile );
+
+        // Get image texture.
+        mImageTextureHandle.set( mImageFile, TextureHandle::BitmapTexture, true, getForce16Bit() );
+
+        // Is the texture valid?
+        if ( mImageTextureHandle.IsNull() )
+        {
+            // No, so warn.
+            Con::warnf( "Image '%s' could not load texture '%s'.", getAssetId(), mImageFile );
+            mImageWidth = 0;
+            mImageHeight = 0;
+            return;
+        }
 
         // Set filter mode.
         setTextureFilter( filterMode );
+
+        // Set the image dimensions.
+        mImageWidth = mImageTextureHandle.getWidth();
+        mImageHeight = mImageTextureHandle.getHeight();
     }
 
     // Calculate according to mode.
@@ -1171,6 +1201,56 @@ void ImageAsset::calculateImage( void )
     {
         calculateImplicitMode();
     }
+
+    // Finish if not atlased.
+    if ( !isAtlased() )
+        return;
+
+    // Fetch the texture object.
+    TextureObject* pTextureObject = ((TextureObject*)mImageTextureHandle);
+
+    // Calculate texel scales.
+    const F32 texelWidthScale = 1.0f / (F32)pTextureObject->getTextureWidth();
+    const F32 texelHeightScale = 1.0f / (F32)pTextureObject->getTextureHeight();
+
+    // Offset the frames to the atlas region.
+    for( typeFrameAreaVector::iterator frameItr = mFrames.begin(); frameItr != mFrames.end(); ++frameItr )
+    {
+        frameItr->mPixelArea.mPixelOffset += mAtlasRegion.mOffset;
+        frameItr->mTexelArea.setArea( frameItr->mPixelArea, texelWidthScale, texelHeightScale );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+bool ImageAsset::addToAtlas( const TextureFilterMode filterMode )
+{
+    // Finish if the image cannot be packed.
+    if ( !mAtlas || mForce16Bit || !ImageAtlas::getEnabled() )
+        return false;
+
+    // Pack the image.
+    if ( !ImageAtlas::addImage( mImageFile, filterMode == FILTER_NEAREST ? GL_NEAREST : GL_LINEAR, mAtlasRegion ) )
+        return false;
+
+    // Use the atlas page.
+    mImageTextureHandle = mAtlasRegion.mTexture;
+    mImageWidth = mAtlasRegion.mWidth;
+    mImageHeight = mAtlasRegion.mHeight;
+
+    return true;
+}
+
+//------------------------------------------------------------------------------
+
+void ImageAsset::removeFromAtlas( void )
+{
+    // Finish if not atlased.
+    if ( !isAtlased() )
+        return;
+
+    ImageAtlas::removeImage( mAtlasRegion );
+    mAtlasRegion = ImageAtlas::Region();
 }
 
 //------------------------------------------------------------------------------
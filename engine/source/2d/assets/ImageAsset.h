@@ -39,6 +39,10 @@
 #include "graphics/TextureManager.h"
 #endif
 
+#ifndef _IMAGE_ATLAS_H_
+#include "2d/assets/ImageAtlas.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 DefineConsoleType( TypeImageAssetPtr )
@@ -165,6 +169,7 @@ private:
     StringTableEntry            mImageFile;
     bool                        mForce16Bit;
     TextureFilterMode           mLocalFilterMode;
+    bool                        mAtlas;
     bool                        mExplicitMode;
     bool                        mCellRowOrder;
     S32                         mCellOffsetX;
@@ -180,6 +185,9 @@ private:
     typeFrameAreaVector         mFrames;
     typeExplicitFrameAreaVector mExplicitFrames;
     TextureHandle               mImageTextureHandle;
+    S32                         mImageWidth;
+    S32                         mImageHeight;
+    ImageAtlas::Region          mAtlasRegion;
 
 public:
     ImageAsset();
@@ -200,6 +208,12 @@ public:
     void                    setFilterMode( const TextureFilterMode filterMode );
     TextureFilterMode       getFilterMode( void ) const                     { return mLocalFilterMode; }
 
+    /// Sets whether the image can be packed into a shared image atlas page.
+    /// Images whose frames are rendered beyond their frame areas should not be packed.
+    void                    setAtlas( const bool atlas );
+    inline bool             getAtlas( void ) const                          { return mAtlas; }
+    inline bool             isAtlased( void ) const                         { return mAtlasRegion.mPage >= 0; }
+
     void                    setExplicitMode( const bool explicitMode );
     bool                    getExplicitMode( void ) const                   { return mExplicitMode; }
 
@@ -239,8 +253,8 @@ public:
     bool                    containsNamedRegion(const char* regionName);
 
     inline TextureHandle&   getImageTexture( void )                         { return mImageTextureHandle; }
-    inline S32              getImageWidth( void ) const                     { return mImageTextureHandle.getWidth(); }
-    inline S32              getImageHeight( void ) const                    { return mImageTextureHandle.getHeight(); }
+    inline S32              getImageWidth( void ) const                     { return mImageWidth; }
+    inline S32              getImageHeight( void ) const                    { return mImageHeight; }
     inline U32              getFrameCount( void ) const                     { return (U32)mFrames.size(); };
     inline bool             containsFrame( const char* namedFrame )         { return containsNamedRegion(namedFrame); };
     
@@ -275,6 +289,8 @@ private:
     void calculateImplicitMode( void );
     void calculateExplicitMode( void );
     void setTextureFilter( const TextureFilterMode filterMode );
+    bool addToAtlas( const TextureFilterMode filterMode );
+    void removeFromAtlas( void );
 
 protected:
     virtual void initializeAsset( void );
@@ -300,6 +316,9 @@ protected:
     static bool setFilterMode( void* obj, const char* data );
     static bool writeFilterMode( void* obj, StringTableEntry pFieldName )   { return static_cast<ImageAsset*>(obj)->getFilterMode() != FILTER_BILINEAR; }
 
+    static bool setAtlas( void* obj, const char* data )                     { static_cast<ImageAsset*>(obj)->setAtlas(dAtob(data)); return false; }
+    static bool writeAtlas( void* obj, StringTableEntry pFieldName )        { return static_cast<ImageAsset*>(obj)->getAtlas() == false; }
+
     static bool setExplicitMode( void* obj, const char* data )              { static_cast<ImageAsset*>(obj)->setExplicitMode(dAtob(data)); return false; }
 
     static bool setCellRowOrder( void* obj, const char* data )              { static_cast<ImageAsset*>(obj)->setCellRowOrder(dAtob(data)); return false; }
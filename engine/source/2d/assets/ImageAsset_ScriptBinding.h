@@ -498,11 +498,11 @@ ConsoleMethodWithDocs(ImageAsset, getExplicitCellOffset, ConsoleString, 3, 3, (c
     else
     {
         // Using cell name.
-        ImageAsset::FrameArea& frameRegion = object->getCellByName(argv[2]);
-        
-        const Vector2 offset = frameRegion.mPixelArea.mPixelOffset;
-        
-        return offset.scriptThis();
+        // NOTE: The explicit cell is used as the frames are offset when atlased.
+        if ( !object->containsNamedRegion(argv[2]) )
+            return Vector2::getZero().scriptThis();
+
+        return object->getExplicitCellOffset(object->getExplicitCellIndex(argv[2])).scriptThis();
     }
 }
 
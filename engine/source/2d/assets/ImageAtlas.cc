@@ -0,0 +1,419 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _IMAGE_ATLAS_H_
+#include "2d/assets/ImageAtlas.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _BITMAP_DECODER_H_
+#include "graphics/bitmapDecoder.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+#include "rapidjson/prettywriter.h"
+
+// Script bindings.
+#include "ImageAtlas_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+Vector<ImageAtlas::Page*> ImageAtlas::smPages;
+
+//-----------------------------------------------------------------------------
+
+bool ImageAtlas::getEnabled( void )
+{
+    return Con::getBoolVariable( "$pref::T2D::imageAssetAtlas", false );
+}
+
+//-----------------------------------------------------------------------------
+
+bool ImageAtlas::addImage( const char* pImageFile, const GLuint filter, Region& region )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ImageAtlas_AddImage);
+
+    // Fetch image file.
+    StringTableEntry imageFile = StringTable->insert( pImageFile );
+
+    // Reference the image if it is already packed with the filter.
+    for ( S32 pageIndex = 0; pageIndex < smPages.size(); ++pageIndex )
+    {
+        Page* pPage = smPages[pageIndex];
+        if ( pPage == NULL || pPage->mFilter != filter )
+            continue;
+
+        for ( Vector<Image>::iterator imageItr = pPage->mImages.begin(); imageItr != pPage->mImages.end(); ++imageItr )
+        {
+            if ( imageItr->mImageFile != imageFile )
+                continue;
+
+            imageItr->mReferenceCount++;
+
+            region.mPage = pageIndex;
+            region.mOffset = imageItr->mOffset;
+            region.mWidth = imageItr->mWidth;
+            region.mHeight = imageItr->mHeight;
+            region.mTexture = pPage->mTexture;
+            return true;
+        }
+    }
+
+    // Keep using a standalone texture that is already loaded.
+    // NOTE: The texture load would find it so a decoded bitmap would never be used.
+    if ( TextureDictionary::find( imageFile ) != NULL )
+        return false;
+
+    // Read the image header so images that cannot be packed are not decoded here.
+    char fileNameBuffer[1024];
+    Con::expandPath( fileNameBuffer, sizeof(fileNameBuffer), imageFile );
+    U32 headerWidth, headerHeight;
+    GBitmap::BitmapFormat headerFormat;
+    if ( BitmapDecoder::readImageInfo( fileNameBuffer, headerWidth, headerHeight, headerFormat ) && !canPack( headerWidth, headerHeight, headerFormat ) )
+        return false;
+
+    // Load the bitmap.
+    GBitmap* pBitmap = TextureManager::loadBitmap( imageFile );
+    if ( pBitmap == NULL )
+        return false;
+
+    const S32 imageWidth = pBitmap->getImageWidth();
+    const S32 imageHeight = pBitmap->getImageHeight();
+
+    // Check images whose header could not be read.
+    if ( !canPack( imageWidth, imageHeight, pBitmap->getFormat() ) )
+    {
+        // Keep the bitmap for the texture load, which will use it as there is no texture yet.
+        TextureManager::addPreloadedBitmap( imageFile, pBitmap );
+        return false;
+    }
+
+    // Find a page with the filter and space for the image and its padding.
+    Point2I packedPosition;
+    S32 pageIndex;
+    for ( pageIndex = 0; pageIndex < smPages.size(); ++pageIndex )
+    {
+        Page* pPage = smPages[pageIndex];
+        if ( pPage != NULL && pPage->mFilter == filter && pPage->mPacker.pack( imageWidth + Padding * 2, imageHeight + Padding * 2, packedPosition ) )
+            break;
+    }
+
+    // Create a page if none has space.
+    if ( pageIndex == smPages.size() )
+    {
+        Page* pPage = createPage( filter );
+
+        // Keep a standalone texture if the image does not fit an empty page.
+        if ( !pPage->mPacker.pack( imageWidth + Padding * 2, imageHeight + Padding * 2, packedPosition ) )
+        {
+            // Warn.
+            Con::warnf( "ImageAtlas::addImage() - Could not pack image '%s' into an empty page.", imageFile );
+
+            delete pPage;
+
+            // Keep the bitmap for the texture load.
+            TextureManager::addPreloadedBitmap( imageFile, pBitmap );
+            return false;
+        }
+
+        // Use an empty slot if there is one.
+        for ( pageIndex = 0; pageIndex < smPages.size(); ++pageIndex )
+        {
+            if ( smPages[pageIndex] == NULL )
+                break;
+        }
+        if ( pageIndex == smPages.size() )
+            smPages.push_back( pPage );
+        else
+            smPages[pageIndex] = pPage;
+    }
+
+    Page* pPage = smPages[pageIndex];
+    const Point2I offset( packedPosition.x + Padding, packedPosition.y + Padding );
+
+    // Copy the image to the page.
+    convertBitmap( pBitmap, pPage, offset );
+    delete pBitmap;
+
+    // Upload the updated rows.
+    // NOTE: Whole rows are contiguous in the page bitmap so this does not need an unpack row length.
+    if ( TextureManager::mDGLRender && !TextureManager::mDisableTextureSubImageUpdates )
+    {
+        glBindTexture( GL_TEXTURE_2D, pPage->mTexture.getGLName() );
+        glTexSubImage2D( GL_TEXTURE_2D, 0, 0, packedPosition.y, PageSize, imageHeight + Padding * 2, GL_RGBA, GL_UNSIGNED_BYTE, pPage->mpBitmap->getAddress( 0, packedPosition.y ) );
+    }
+    else
+    {
+        pPage->mTexture.refresh();
+    }
+
+    // Store the image.
+    pPage->mImages.increment();
+    Image& image = pPage->mImages.last();
+    image.mImageFile = imageFile;
+    image.mOffset = offset;
+    image.mWidth = imageWidth;
+    image.mHeight = imageHeight;
+    image.mReferenceCount = 1;
+
+    region.mPage = pageIndex;
+    region.mOffset = offset;
+    region.mWidth = imageWidth;
+    region.mHeight = imageHeight;
+    region.mTexture = pPage->mTexture;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ImageAtlas::canPack( const S32 width, const S32 height, const GBitmap::BitmapFormat format )
+{
+    // Only pack small images with a format we can convert.
+    return width <= MaxImageSize && height <= MaxImageSize &&
+        (format == GBitmap::RGB || format == GBitmap::RGBA || format == GBitmap::Alpha || format == GBitmap::Intensity || format == GBitmap::Luminance || format == GBitmap::LuminanceAlpha);
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageAtlas::removeImage( const Region& region )
+{
+    // Finish if the region is not on a page.
+    if ( region.mPage < 0 || region.mPage >= smPages.size() || smPages[region.mPage] == NULL )
+        return;
+
+    Page* pPage = smPages[region.mPage];
+
+    // Find the image.
+    for ( S32 imageIndex = 0; imageIndex < pPage->mImages.size(); ++imageIndex )
+    {
+        Image& image = pPage->mImages[imageIndex];
+        if ( image.mOffset != region.mOffset )
+            continue;
+
+        // Finish if the image is still referenced.
+        if ( --image.mReferenceCount > 0 )
+            return;
+
+        pPage->mImages.erase( imageIndex );
+        break;
+    }
+
+    // Finish if the page still has images.
+    if ( pPage->mImages.size() > 0 )
+        return;
+
+    // Destroy the page.
+    // NOTE: The bitmap is owned by the texture and destroyed with it.
+    delete pPage;
+    smPages[region.mPage] = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ImageAtlas::writePages( const char* pDirectory )
+{
+    // Expand the directory path.
+    char directoryBuffer[1024];
+    Con::expandPath( directoryBuffer, sizeof(directoryBuffer), pDirectory );
+
+    char filePathBuffer[1024];
+
+    // Write each page.
+    for ( S32 pageIndex = 0; pageIndex < smPages.size(); ++pageIndex )
+    {
+        const Page* pPage = smPages[pageIndex];
+        if ( pPage == NULL )
+            continue;
+
+        dSprintf( filePathBuffer, sizeof(filePathBuffer), "%s/imageAtlas%d.png", directoryBuffer, pageIndex );
+
+        FileStream stream;
+        if ( !stream.open( filePathBuffer, FileStream::Write ) || !pPage->mpBitmap->writePNG( stream ) )
+        {
+            // Warn.
+            Con::warnf( "ImageAtlas::writePages() - Could not write page file '%s'.", filePathBuffer );
+            return false;
+        }
+    }
+
+    // Write the description.
+    dSprintf( filePathBuffer, sizeof(filePathBuffer), "%s/imageAtlas.json", directoryBuffer );
+
+    FileStream stream;
+    if ( !stream.open( filePathBuffer, FileStream::Write ) )
+    {
+        // Warn.
+        Con::warnf( "ImageAtlas::writePages() - Could not write description file '%s'.", filePathBuffer );
+        return false;
+    }
+
+    rapidjson::PrettyWriter<FileStream> writer( stream );
+    writer.StartObject();
+    writer.String( "pageSize" );
+    writer.Uint( PageSize );
+    writer.String( "pages" );
+    writer.StartArray();
+    for ( S32 pageIndex = 0; pageIndex < smPages.size(); ++pageIndex )
+    {
+        const Page* pPage = smPages[pageIndex];
+        if ( pPage == NULL )
+            continue;
+
+        writer.StartObject();
+        writer.String( "page" );
+        writer.Int( pageIndex );
+        writer.String( "filter" );
+        writer.String( pPage->mFilter == GL_NEAREST ? "NEAREST" : "BILINEAR" );
+        writer.String( "images" );
+        writer.StartArray();
+        for ( Vector<Image>::const_iterator imageItr = pPage->mImages.begin(); imageItr != pPage->mImages.end(); ++imageItr )
+        {
+            writer.StartObject();
+            writer.String( "file" );
+            writer.String( imageItr->mImageFile );
+            writer.String( "x" );
+            writer.Int( imageItr->mOffset.x );
+            writer.String( "y" );
+            writer.Int( imageItr->mOffset.y );
+            writer.String( "width" );
+            writer.Int( imageItr->mWidth );
+            writer.String( "height" );
+            writer.Int( imageItr->mHeight );
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.EndObject();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ImageAtlas::getPageCount( void )
+{
+    U32 pageCount = 0;
+    for ( S32 pageIndex = 0; pageIndex < smPages.size(); ++pageIndex )
+    {
+        if ( smPages[pageIndex] != NULL )
+            pageCount++;
+    }
+
+    return pageCount;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 ImageAtlas::getPageOccupancy( const U32 page )
+{
+    if ( page >= (U32)smPages.size() || smPages[page] == NULL )
+        return 0.0f;
+
+    return smPages[page]->mPacker.getOccupancy();
+}
+
+//-----------------------------------------------------------------------------
+
+bool ImageAtlas::convertBitmap( const GBitmap* pBitmap, Page* pPage, const Point2I& offset )
+{
+    const S32 imageWidth = pBitmap->getImageWidth();
+    const S32 imageHeight = pBitmap->getImageHeight();
+    const GBitmap::BitmapFormat format = pBitmap->getFormat();
+
+    // Copy the image and a border of its edge pixels as RGBA.
+    for ( S32 y = -Padding; y < imageHeight + Padding; ++y )
+    {
+        const S32 sourceY = mClamp( y, 0, imageHeight - 1 );
+        U8* pDestination = pPage->mpBitmap->getAddress( offset.x - Padding, offset.y + y );
+
+        for ( S32 x = -Padding; x < imageWidth + Padding; ++x, pDestination += 4 )
+        {
+            const U8* pSource = pBitmap->getAddress( mClamp( x, 0, imageWidth - 1 ), sourceY );
+
+            switch( format )
+            {
+                case GBitmap::RGB:
+                    pDestination[0] = pSource[0]; pDestination[1] = pSource[1]; pDestination[2] = pSource[2]; pDestination[3] = 255;
+                    break;
+
+                case GBitmap::RGBA:
+                    pDestination[0] = pSource[0]; pDestination[1] = pSource[1]; pDestination[2] = pSource[2]; pDestination[3] = pSource[3];
+                    break;
+
+                case GBitmap::Alpha:
+                    pDestination[0] = pDestination[1] = pDestination[2] = 255; pDestination[3] = pSource[0];
+                    break;
+
+                case GBitmap::Intensity:
+                    pDestination[0] = pDestination[1] = pDestination[2] = pDestination[3] = pSource[0];
+                    break;
+
+                case GBitmap::Luminance:
+                    pDestination[0] = pDestination[1] = pDestination[2] = pSource[0]; pDestination[3] = 255;
+                    break;
+
+                case GBitmap::LuminanceAlpha:
+                    pDestination[0] = pDestination[1] = pDestination[2] = pSource[0]; pDestination[3] = pSource[1];
+                    break;
+
+                default:
+                    // Sanity!
+                    AssertFatal( false, "ImageAtlas::convertBitmap() - Unsupported bitmap format." );
+                    return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+ImageAtlas::Page* ImageAtlas::createPage( const GLuint filter )
+{
+    Page* pPage = new Page();
+    pPage->mFilter = filter;
+    pPage->mPacker.reset( PageSize, PageSize );
+
+    // Create a transparent bitmap.
+    pPage->mpBitmap = new GBitmap( PageSize, PageSize, false, GBitmap::RGBA );
+    dMemset( pPage->mpBitmap->getWritableBits(), 0, pPage->mpBitmap->byteSize );
+
+    // Create the texture keeping the bitmap so the page can be restored.
+    pPage->mTexture.set( TextureManager::getUniqueTextureKey(), pPage->mpBitmap, TextureHandle::BitmapKeepTexture, true );
+    pPage->mTexture.setFilter( filter );
+
+    return pPage;
+}
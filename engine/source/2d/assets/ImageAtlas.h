@@ -0,0 +1,116 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _IMAGE_ATLAS_H_
+#define _IMAGE_ATLAS_H_
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
+#ifndef _ATLAS_PACKER_H_
+#include "2d/core/AtlasPacker.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Packs small image files into shared texture pages so that images using the
+/// same filter mode can be batched together.
+///
+/// Images are packed as they are loaded when "$pref::T2D::imageAssetAtlas" is set.
+/// Each image is surrounded by a border of its own edge pixels so filtering does
+/// not sample neighbouring images. Space is only reclaimed when all the images on
+/// a page have been removed.
+class ImageAtlas
+{
+public:
+    enum Constants
+    {
+        PageSize        = 1024,
+        MaxImageSize    = 256,
+        Padding         = 1,
+    };
+
+    /// An image region on a page.
+    struct Region
+    {
+        Region() : mPage( -1 ), mWidth( 0 ), mHeight( 0 ) {}
+
+        S32             mPage;
+        Point2I         mOffset;
+        S32             mWidth;
+        S32             mHeight;
+        TextureHandle   mTexture;
+    };
+
+private:
+    struct Image
+    {
+        StringTableEntry    mImageFile;
+        Point2I             mOffset;
+        S32                 mWidth;
+        S32                 mHeight;
+        U32                 mReferenceCount;
+    };
+
+    struct Page
+    {
+        TextureHandle       mTexture;
+        GBitmap*            mpBitmap;
+        GLuint              mFilter;
+        AtlasPacker         mPacker;
+        Vector<Image>       mImages;
+    };
+
+    static Vector<Page*>    smPages;
+
+public:
+    /// Gets whether images should be packed as they are loaded.
+    static bool getEnabled( void );
+
+    /// Packs an image file into a page with the filter, or references it if it is
+    /// already packed. Returns false if the image cannot be packed.
+    static bool addImage( const char* pImageFile, const GLuint filter, Region& region );
+
+    /// Removes a reference to an image added with addImage().
+    static void removeImage( const Region& region );
+
+    /// Writes each page as a PNG and a JSON description of the packed images to a directory.
+    static bool writePages( const char* pDirectory );
+
+    /// Gets the number of pages in use.
+    static U32 getPageCount( void );
+
+    /// Gets the fraction of a page used by images or zero if the page is not in use.
+    static F32 getPageOccupancy( const U32 page );
+
+private:
+    static bool canPack( const S32 width, const S32 height, const GBitmap::BitmapFormat format );
+    static bool convertBitmap( const GBitmap* pBitmap, Page* pPage, const Point2I& offset );
+    static Page* createPage( const GLuint filter );
+};
+
+#endif // _IMAGE_ATLAS_H_
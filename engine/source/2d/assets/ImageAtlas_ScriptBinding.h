@@ -0,0 +1,55 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin( ImageAtlas, "Image atlas functionality.");
+
+/*! Writes the image atlas pages as PNG files and a JSON description of the packed images.
+    @param directory The directory to write the "imageAtlas<page>.png" and "imageAtlas.json" files to.
+    @return Whether the pages were written or not.
+*/
+ConsoleFunctionWithDocs( writeImageAtlas, ConsoleBool, 2, 2, (directory))
+{
+    return ImageAtlas::writePages( argv[1] );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of image atlas pages in use.
+    @return The number of image atlas pages in use.
+*/
+ConsoleFunctionWithDocs( getImageAtlasPageCount, ConsoleInt, 1, 1, ())
+{
+    return ImageAtlas::getPageCount();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the fraction of an image atlas page used by images.
+    @param page The page index.
+    @return The fraction of the page used by images or zero if the page is not in use.
+*/
+ConsoleFunctionWithDocs( getImageAtlasPageOccupancy, ConsoleFloat, 2, 2, (page))
+{
+    return ImageAtlas::getPageOccupancy( dAtoi(argv[1]) );
+}
+
+ConsoleFunctionGroupEnd( ImageAtlas );
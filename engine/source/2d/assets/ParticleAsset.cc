@@ -279,7 +279,14 @@ void ParticleAsset::initializeAsset( void )
     // Call parent.
     Parent::initializeAsset();
 
-    // Currently there is no specific initialization required.
+    // Compile the field lookups.
+    mParticleFields.compileLookups();
+
+    // Compile the emitter field lookups.
+    for( typeEmitterVector::iterator emitterItr = mEmitters.begin(); emitterItr != mEmitters.end(); ++emitterItr )
+    {
+        (*emitterItr)->getParticleFields().compileLookups();
+    }
 }
 
 //-----------------------------------------------------------------------------
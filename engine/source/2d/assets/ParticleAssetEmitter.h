@@ -247,6 +247,7 @@ public:
     inline const Vector2& getLocalPivotAABB1( void ) { return mLocalPivotAABB[1]; }
     inline const Vector2& getLocalPivotAABB2( void ) { return mLocalPivotAABB[2]; }
     inline const Vector2& getLocalPivotAABB3( void ) { return mLocalPivotAABB[3]; }
+    inline const Vector2* getLocalPivotAABB( void ) { return mLocalPivotAABB; }
 
     static EmitterType getEmitterTypeEnum(const char* label);
     static const char* getEmitterTypeDescription( const EmitterType emitterType );
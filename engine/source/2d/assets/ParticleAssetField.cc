@@ -38,6 +38,13 @@
 #include "string/stringUnit.h"
 #endif
 
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+// Script bindings.
+#include "ParticleAssetField_ScriptBinding.h"
+
 //-----------------------------------------------------------------------------
 
 static StringTableEntry particleAssetFieldRepeatTimeName   = StringTable->insert( "RepeatTime" );
@@ -64,10 +71,13 @@ ParticleAssetField::ParticleAssetField() :
                         mMaxValue( 0.0f ),
                         mDefaultValue( 1.0f ),
                         mValueScale( 1.0f ),
-                        mValueBoundsDirty( true )
+                        mValueBoundsDirty( true ),
+                        mLookupScale( 0.0f ),
+                        mLookupDirty( true )
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mDataKeys );
+    VECTOR_SET_ASSOCIATION( mLookupTable );
 }
 
 //-----------------------------------------------------------------------------
@@ -88,6 +98,7 @@ void ParticleAssetField::copyTo( ParticleAssetField& field )
     field.mMaxValue = mMaxValue;
     field.mDefaultValue = mDefaultValue;
     field.mValueScale = mValueScale;
+    field.mLookupDirty = true;
 
     // Copy data keys.    
     field.clearDataKeys();
@@ -170,6 +181,9 @@ void ParticleAssetField::setValueBounds( F32 maxTime, F32 minValue, F32 maxValue
 
     // Flag the value bounds as dirty.
     mValueBoundsDirty = true;
+
+    // Flag the lookup as dirty.
+    mLookupDirty = true;
 }
 
 //-----------------------------------------------------------------------------
@@ -223,6 +237,9 @@ bool ParticleAssetField::setValueScale( const F32 valueScale )
     // Set Value Scale/
     mValueScale = valueScale;
 
+    // Flag the lookup as dirty.
+    mLookupDirty = true;
+
     // Return Okay.
     return true;
 }
@@ -234,6 +251,9 @@ void ParticleAssetField::resetDataKeys(void)
     // Clear Data Keys.
     mDataKeys.clear();
 
+    // Flag the lookup as dirty.
+    mLookupDirty = true;
+
     // Add default value Data-Key.
     addDataKey( 0.0f, mDefaultValue );
 }
@@ -245,6 +265,9 @@ S32 ParticleAssetField::setSingleDataKey( const F32 value )
     // Clear Data Keys.
     mDataKeys.clear();
 
+    // Flag the lookup as dirty.
+    mLookupDirty = true;
+
     // Add a single key with the specified value.
     return addDataKey( 0.0f, value );
 }
@@ -273,6 +296,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
             // Yes, so set time.
             mDataKeys[index].mValue = value;
 
+            // Flag the lookup as dirty.
+            mLookupDirty = true;
+
             // Return Index.
             return index;
         }
@@ -289,6 +315,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
     mDataKeys[index].mTime = time;
     mDataKeys[index].mValue = value;
 
+    // Flag the lookup as dirty.
+    mLookupDirty = true;
+
     // Return Index.
     return index;
 }
@@ -316,6 +345,9 @@ bool ParticleAssetField::removeDataKey( const U32 index )
     // Remove Index.
     mDataKeys.erase(index);
 
+    // Flag the lookup as dirty.
+    mLookupDirty = true;
+
     // Return Okay.
     return true;
 }
@@ -343,6 +375,9 @@ bool ParticleAssetField::setDataKeyValue( const U32 index, const F32 value )
     // Set Data Key Value.
     mDataKeys[index].mValue = value;
 
+    // Flag the lookup as dirty.
+    mLookupDirty = true;
+
     // Return Okay.
     return true;
 }
@@ -398,6 +433,41 @@ const ParticleAssetField::DataKey& ParticleAssetField::getDataKey( const U32 ind
 //-----------------------------------------------------------------------------
 
 F32 ParticleAssetField::getFieldValue( F32 time ) const
+{
+    // Return First Entry if it's the only one or we're using zero time.
+    if ( mIsZero(time) || getDataKeyCount() < 2)
+        return mDataKeys[0].mValue * mValueScale;
+
+    // Compile the lookup if the data keys have changed.
+    if ( mLookupDirty )
+        compileLookup();
+
+    // Use the exact evaluation if there is no lookup.
+    if ( mLookupTable.size() == 0 )
+        return getFieldValueExact( time );
+
+    // Clamp Key-Time.
+    time = getMin(getMax( 0.0f, time ), mMaxTime);
+
+    // Repeat Time.
+    // NOTE:-   Without a repeat the clamped time is already in range so we can skip the modulo.
+    if ( mRepeatTime != 1.0f )
+        time = mFmod( time * mRepeatTime, mMaxTime + FLT_EPSILON );
+
+    // Fetch the lookup position.
+    const U32 resolution = (U32)mLookupTable.size()-1;
+    const F32 position = getMin( time * mLookupScale, (F32)resolution );
+    const U32 index = getMin( (U32)position, resolution-1 );
+
+    // Return lerped Value.
+    const F32 value1 = mLookupTable[index];
+    const F32 value2 = mLookupTable[index+1];
+    return value1 + ((value2 - value1) * (position - (F32)index));
+}
+
+//-----------------------------------------------------------------------------
+
+F32 ParticleAssetField::getFieldValueExact( F32 time ) const
 {
     // Return First Entry if it's the only one or we're using zero time.
     if ( mIsZero(time) || getDataKeyCount() < 2)
@@ -409,12 +479,20 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
     // Repeat Time.
     time = mFmod( time * mRepeatTime, mMaxTime + FLT_EPSILON );
 
+    // Return the Value.
+    return evaluateDataKeys( time ) * mValueScale;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 ParticleAssetField::evaluateDataKeys( const F32 time ) const
+{
     // Fetch Max Key Index.
     const U32 maxKeyIndex = getDataKeyCount()-1;
 
     // Return Last Value if we're on/past the last time.
     if ( time >= mDataKeys[maxKeyIndex].mTime )
-        return mDataKeys[maxKeyIndex].mValue * mValueScale;
+        return mDataKeys[maxKeyIndex].mValue;
 
     // Find Data-Key Indexes.
     U32 index1;
@@ -424,8 +502,8 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
             break;
 
     // If we're exactly on a Data-Key then return that key.
-    if ( mIsEqual( mDataKeys[index1].mTime, time) )
-        return mDataKeys[index1].mValue * mValueScale;
+    if ( index1 == 0 || mIsEqual( mDataKeys[index1].mTime, time) )
+        return mDataKeys[index1].mValue;
 
     // Set Adjacent Indexes.
     index2 = index1--;
@@ -437,7 +515,75 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
     const F32 dTime = (time-time1)/(time2-time1);
 
     // Return lerped Value.
-    return ((mDataKeys[index1].mValue * (1.0f-dTime)) + (mDataKeys[index2].mValue * dTime)) * mValueScale;
+    return (mDataKeys[index1].mValue * (1.0f-dTime)) + (mDataKeys[index2].mValue * dTime);
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleAssetField::compileLookup( void ) const
+{
+    // Reset the lookup.
+    mLookupDirty = false;
+    mLookupTable.clear();
+    mLookupScale = 0.0f;
+
+    // Finish if there's nothing to interpolate.
+    if ( getDataKeyCount() < 2 )
+        return;
+
+    // Fetch the lookup tolerance.
+    // NOTE:-   The tolerance is relative to the value range.  Zero or less disables the lookup.
+    const F32 tolerance = Con::getFloatVariable( PARTICLE_ASSET_FIELD_LOOKUP_TOLERANCE, 0.001f );
+
+    // Finish if the lookup is disabled.
+    if ( tolerance <= 0.0f )
+        return;
+
+    // Calculate the maximum error allowed.
+    const F32 maxError = tolerance * (mMaxValue - mMinValue) * mValueScale;
+
+    // Find the lowest resolution that meets the tolerance.
+    // NOTE:-   The lookup and the data keys are both piecewise linear so the error is largest at the data keys.
+    for ( U32 resolution = 1; resolution <= PARTICLE_ASSET_FIELD_LOOKUP_MAX_RESOLUTION; resolution *= 2 )
+    {
+        // Calculate the lookup scale.
+        const F32 lookupScale = (F32)resolution / mMaxTime;
+
+        // Sample the data keys.
+        mLookupTable.setSize( resolution+1 );
+        for ( U32 index = 0; index <= resolution; ++index )
+            mLookupTable[index] = evaluateDataKeys( (F32)index / lookupScale ) * mValueScale;
+
+        // Check the error at the data keys.
+        bool withinTolerance = true;
+        for ( U32 keyIndex = 0; keyIndex < getDataKeyCount(); ++keyIndex )
+        {
+            // Fetch the lookup position.
+            const F32 position = getMin( getMax( 0.0f, mDataKeys[keyIndex].mTime ) * lookupScale, (F32)resolution );
+            const U32 index = getMin( (U32)position, resolution-1 );
+
+            // Calculate the lookup value.
+            const F32 value = mLookupTable[index] + ((mLookupTable[index+1] - mLookupTable[index]) * (position - (F32)index));
+
+            // Is the error within tolerance?
+            if ( mFabs( value - (mDataKeys[keyIndex].mValue * mValueScale) ) > maxError )
+            {
+                // No, so try a higher resolution.
+                withinTolerance = false;
+                break;
+            }
+        }
+
+        // Use this resolution if it's within tolerance.
+        if ( withinTolerance )
+        {
+            mLookupScale = lookupScale;
+            return;
+        }
+    }
+
+    // We could not meet the tolerance so use the exact evaluation.
+    mLookupTable.clear();
 }
 
 //-----------------------------------------------------------------------------
@@ -33,6 +33,11 @@
 
 ///-----------------------------------------------------------------------------
 
+#define PARTICLE_ASSET_FIELD_LOOKUP_TOLERANCE       "$pref::T2D::ParticleFieldLookupTolerance"
+#define PARTICLE_ASSET_FIELD_LOOKUP_MAX_RESOLUTION  1024
+
+///-----------------------------------------------------------------------------
+
 class ParticleAssetField
 {
 public:
@@ -71,6 +76,13 @@ private:
 
     Vector<DataKey> mDataKeys;
 
+    /// Baked lookup.
+    mutable Vector<F32> mLookupTable;
+    mutable F32 mLookupScale;
+    mutable bool mLookupDirty;
+
+    F32 evaluateDataKeys( const F32 time ) const;
+
 public:
     ParticleAssetField();
     virtual ~ParticleAssetField();
@@ -104,6 +116,10 @@ public:
     inline U32 getDataKeyCount( void ) const { return (U32)mDataKeys.size(); }
     const DataKey& getDataKey( const U32 index ) const;
     F32 getFieldValue( F32 time ) const;
+    F32 getFieldValueExact( F32 time ) const;
+
+    void compileLookup( void ) const;
+    inline U32 getLookupResolution( void ) const { return mLookupTable.size() > 0 ? (U32)mLookupTable.size()-1 : 0; }
 
     static F32 calculateFieldBV( const ParticleAssetField& base, const ParticleAssetField& variation, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
     static F32 calculateFieldBVE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& effect, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
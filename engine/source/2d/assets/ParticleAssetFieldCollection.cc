@@ -130,6 +130,17 @@ ParticleAssetField* ParticleAssetFieldCollection::findField( const char* pFieldN
 
 //-----------------------------------------------------------------------------
 
+void ParticleAssetFieldCollection::compileLookups( void )
+{
+    // Compile all the fields.
+    for( typeFieldHash::iterator fieldItr = mFields.begin(); fieldItr != mFields.end(); ++fieldItr )
+    {
+        fieldItr->value->compileLookup();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 S32 ParticleAssetFieldCollection::setSingleDataKey( F32 value )
 {
     // Have we got a valid field selected?
@@ -60,6 +60,7 @@ public:
 
     inline const typeFieldHash& getFields( void ) const { return mFields; }
     ParticleAssetField* findField( const char* pFieldName );
+    void compileLookups( void );
 
     S32 setSingleDataKey( const F32 value );
     S32 addDataKey( F32 time, F32 value );
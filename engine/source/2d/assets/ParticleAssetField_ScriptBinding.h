@@ -0,0 +1,76 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+ConsoleFunctionGroupBegin( ParticleAssetField, "Particle asset field functionality.");
+
+/*! Times evaluating a particle asset field using its baked lookup against evaluating its data keys directly.
+    The field has a handful of data keys spread unevenly over its lifetime and is sampled across its whole lifetime.
+    @param evaluations The number of evaluations to time for each method, defaults to 10000000.
+    @return The times taken in milliseconds formatted as "exactTime lookupTime".
+*/
+ConsoleFunctionWithDocs( runParticleFieldBenchmark, ConsoleString, 1, 2, ([evaluations]))
+{
+    // Fetch the evaluation count.
+    const U32 evaluations = argc < 2 ? 10000000 : getMax( dAtoi(argv[1]), 1 );
+
+    // Configure the field.
+    ParticleAssetField field;
+    field.initialize( 1.0f, 0.0f, 100.0f, 1.0f );
+    field.addDataKey( 0.0f, 10.0f );
+    field.addDataKey( 0.1f, 80.0f );
+    field.addDataKey( 0.25f, 35.0f );
+    field.addDataKey( 0.5f, 60.0f );
+    field.addDataKey( 0.6f, 5.0f );
+    field.addDataKey( 0.9f, 95.0f );
+    field.addDataKey( 1.0f, 0.0f );
+    field.compileLookup();
+
+    // Time the data key evaluation.
+    // NOTE: The values are summed so the evaluations cannot be optimized away.
+    F32 exactSum = 0.0f;
+    const U32 exactStartTime = Platform::getRealMilliseconds();
+    for ( U32 index = 0; index < evaluations; ++index )
+    {
+        exactSum += field.getFieldValueExact( (F32)(index & 1023) / 1023.0f );
+    }
+    const U32 exactTime = Platform::getRealMilliseconds() - exactStartTime;
+
+    // Time the lookup evaluation.
+    F32 lookupSum = 0.0f;
+    const U32 lookupStartTime = Platform::getRealMilliseconds();
+    for ( U32 index = 0; index < evaluations; ++index )
+    {
+        lookupSum += field.getFieldValue( (F32)(index & 1023) / 1023.0f );
+    }
+    const U32 lookupTime = Platform::getRealMilliseconds() - lookupStartTime;
+
+    // Report.
+    Con::printf( "ParticleAssetField benchmark: %d evaluations, exact %dms, lookup %dms (resolution %d, mean values %g/%g).",
+        evaluations, exactTime, lookupTime, field.getLookupResolution(), exactSum / evaluations, lookupSum / evaluations );
+
+    char* pBuffer = Con::getReturnBuffer( 32 );
+    dSprintf( pBuffer, 32, "%d %d", exactTime, lookupTime );
+    return pBuffer;
+}
+
+ConsoleFunctionGroupEnd( ParticleAssetField );
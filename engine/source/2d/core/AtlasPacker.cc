@@ -0,0 +1,165 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ATLAS_PACKER_H_
+#include "2d/core/AtlasPacker.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+AtlasPacker::AtlasPacker() :
+    mWidth( 0 ),
+    mHeight( 0 ),
+    mUsedArea( 0 )
+{
+    // Set Vector Associations.
+    VECTOR_SET_ASSOCIATION( mSkyline );
+}
+
+//-----------------------------------------------------------------------------
+
+void AtlasPacker::reset( const S32 width, const S32 height )
+{
+    mWidth = width;
+    mHeight = height;
+    mUsedArea = 0;
+
+    // Start with a single node along the bottom.
+    mSkyline.clear();
+    mSkyline.increment();
+    mSkyline.last().mX = 0;
+    mSkyline.last().mY = 0;
+    mSkyline.last().mWidth = width;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AtlasPacker::pack( const S32 width, const S32 height, Point2I& position )
+{
+    // Finish if the rectangle is invalid.
+    if ( width <= 0 || height <= 0 || width > mWidth || height > mHeight )
+        return false;
+
+    // Find the lowest placement, preferring the narrowest node when tied.
+    S32 bestIndex = -1;
+    S32 bestTop = mHeight + 1;
+    S32 bestWidth = mWidth + 1;
+    for ( S32 nodeIndex = 0; nodeIndex < mSkyline.size(); ++nodeIndex )
+    {
+        const S32 y = findPlacement( nodeIndex, width, height );
+        if ( y < 0 )
+            continue;
+
+        const S32 top = y + height;
+        if ( top < bestTop || (top == bestTop && mSkyline[nodeIndex].mWidth < bestWidth) )
+        {
+            bestIndex = nodeIndex;
+            bestTop = top;
+            bestWidth = mSkyline[nodeIndex].mWidth;
+            position.set( mSkyline[nodeIndex].mX, y );
+        }
+    }
+
+    // Finish if the rectangle does not fit.
+    if ( bestIndex < 0 )
+        return false;
+
+    // Add the node for the rectangle top.
+    mSkyline.insert( bestIndex );
+    mSkyline[bestIndex].mX = position.x;
+    mSkyline[bestIndex].mY = bestTop;
+    mSkyline[bestIndex].mWidth = width;
+
+    // Shrink or remove the nodes now under the rectangle.
+    const S32 right = position.x + width;
+    while ( bestIndex + 1 < mSkyline.size() )
+    {
+        SkylineNode& node = mSkyline[bestIndex + 1];
+        if ( node.mX >= right )
+            break;
+
+        const S32 shrink = right - node.mX;
+        if ( node.mWidth > shrink )
+        {
+            node.mX += shrink;
+            node.mWidth -= shrink;
+            break;
+        }
+
+        mSkyline.erase( bestIndex + 1 );
+    }
+
+    // Merge neighbouring nodes at the same height.
+    for ( S32 nodeIndex = 0; nodeIndex < mSkyline.size() - 1; )
+    {
+        if ( mSkyline[nodeIndex].mY == mSkyline[nodeIndex + 1].mY )
+        {
+            mSkyline[nodeIndex].mWidth += mSkyline[nodeIndex + 1].mWidth;
+            mSkyline.erase( nodeIndex + 1 );
+        }
+        else
+        {
+            ++nodeIndex;
+        }
+    }
+
+    mUsedArea += (U32)(width * height);
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 AtlasPacker::getOccupancy( void ) const
+{
+    if ( mWidth <= 0 || mHeight <= 0 )
+        return 0.0f;
+
+    return (F32)mUsedArea / ((F32)mWidth * (F32)mHeight);
+}
+
+//-----------------------------------------------------------------------------
+
+S32 AtlasPacker::findPlacement( const S32 nodeIndex, const S32 width, const S32 height ) const
+{
+    // Finish if the rectangle would be off the right-hand-side.
+    const S32 x = mSkyline[nodeIndex].mX;
+    if ( x + width > mWidth )
+        return -1;
+
+    // Rest the rectangle on the highest node it spans.
+    S32 y = 0;
+    S32 widthLeft = width;
+    for ( S32 index = nodeIndex; widthLeft > 0; ++index )
+    {
+        // Sanity!
+        AssertFatal( index < mSkyline.size(), "AtlasPacker::findPlacement() - The skyline does not span the area." );
+
+        y = getMax( y, mSkyline[index].mY );
+        if ( y + height > mHeight )
+            return -1;
+
+        widthLeft -= mSkyline[index].mWidth;
+    }
+
+    return y;
+}
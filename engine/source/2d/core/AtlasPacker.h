@@ -0,0 +1,72 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ATLAS_PACKER_H_
+#define _ATLAS_PACKER_H_
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _MPOINT_H_
+#include "math/mPoint.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Packs rectangles into a fixed size area using a bottom-left skyline.
+class AtlasPacker
+{
+private:
+    struct SkylineNode
+    {
+        S32 mX;
+        S32 mY;
+        S32 mWidth;
+    };
+
+    Vector<SkylineNode> mSkyline;
+    S32                 mWidth;
+    S32                 mHeight;
+    U32                 mUsedArea;
+
+public:
+    AtlasPacker();
+
+    /// Resets to an empty area.
+    void reset( const S32 width, const S32 height );
+
+    /// Packs a rectangle returning its position or false if it does not fit.
+    bool pack( const S32 width, const S32 height, Point2I& position );
+
+    /// Gets the fraction of the area used by packed rectangles.
+    F32 getOccupancy( void ) const;
+
+    inline S32 getWidth( void ) const { return mWidth; }
+    inline S32 getHeight( void ) const { return mHeight; }
+
+private:
+    /// Finds the height a rectangle would be placed at on a skyline node or -1 if it does not fit.
+    S32 findPlacement( const S32 nodeIndex, const S32 width, const S32 height ) const;
+};
+
+#endif // _ATLAS_PACKER_H_
@@ -26,17 +26,67 @@
 #include "2d/sceneobject/SceneObject.h"
 #endif
 
+#ifndef _DGL_H_
+#include "graphics/dgl.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
+#if defined(__SSE__) || defined(_M_IX86) || defined(_M_AMD64) || defined(_M_X64)
+#define TORQUE_BATCHRENDER_SSE
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define TORQUE_BATCHRENDER_NEON
+#include <arm_neon.h>
+#endif
+
+//-----------------------------------------------------------------------------
+
+U16 BatchRender::smQuadIndices[ BATCHRENDER_MAXQUADS * 6 ];
+bool BatchRender::smQuadIndicesBuilt = false;
+
+//-----------------------------------------------------------------------------
+
+static inline U32 packColor( const ColorF& color )
+{
+    // Pack as RGBA8 in memory order.
+    const U8 packed[4] =
+    {
+        U8( mClampF( color.red, 0.0f, 1.0f ) * 255.0f + 0.5f ),
+        U8( mClampF( color.green, 0.0f, 1.0f ) * 255.0f + 0.5f ),
+        U8( mClampF( color.blue, 0.0f, 1.0f ) * 255.0f + 0.5f ),
+        U8( mClampF( color.alpha, 0.0f, 1.0f ) * 255.0f + 0.5f )
+    };
+
+    U32 packedColor;
+    dMemcpy( &packedColor, packed, sizeof(packedColor) );
+    return packedColor;
+}
+
+//-----------------------------------------------------------------------------
+
+template<class VertexType> static inline void writeVertex( VertexType* pVertex, const Vector2& position, const Vector2& texture, const U32 color )
+{
+    // Write the position and texture coordinate as a single vector.
+#if defined(TORQUE_BATCHRENDER_SSE)
+    _mm_storeu_ps( &pVertex->mPosition.x, _mm_loadh_pi( _mm_loadl_pi( _mm_setzero_ps(), (const __m64*)&position.x ), (const __m64*)&texture.x ) );
+#elif defined(TORQUE_BATCHRENDER_NEON)
+    vst1q_f32( &pVertex->mPosition.x, vcombine_f32( vld1_f32( &position.x ), vld1_f32( &texture.x ) ) );
+#else
+    pVertex->mPosition = position;
+    pVertex->mTexture = texture;
+#endif
+    pVertex->mColor = color;
+}
+
 //-----------------------------------------------------------------------------
 
 BatchRender::BatchRender() :
     mTriangleCount( 0 ),
     mVertexCount( 0 ),
-    mTextureCoordCount( 0 ),
     mIndexCount( 0 ),
-    mColorCount( 0 ),
+    mColorsUsed( false ),
     NoColor( -1.0f, -1.0f, -1.0f ),
     mStrictOrderMode( false ),
     mpDebugStats( NULL ),
@@ -46,8 +96,27 @@ BatchRender::BatchRender() :
     mBlendColor( ColorF(1.0f,1.0f,1.0f,1.0f) ),
     mAlphaTestMode( -1.0f ),
     mWireframeMode( false ),
-    mBatchEnabled( true )
+    mBatchEnabled( true ),
+    mNullRender( false ),
+    mpRenderCommandExecutor( NULL )
 {
+    // Build the quad indices once.
+    // NOTE: The quad vertices are stored with #2/#3 swapped.
+    if ( !smQuadIndicesBuilt )
+    {
+        U16* pQuadIndices = smQuadIndices;
+        for ( U16 vertexIndex = 0; vertexIndex < BATCHRENDER_MAXQUADS * 4; vertexIndex += 4 )
+        {
+            *(pQuadIndices++) = vertexIndex;
+            *(pQuadIndices++) = vertexIndex + 1;
+            *(pQuadIndices++) = vertexIndex + 2;
+            *(pQuadIndices++) = vertexIndex + 3;
+            *(pQuadIndices++) = vertexIndex + 2;
+            *(pQuadIndices++) = vertexIndex + 1;
+        }
+
+        smQuadIndicesBuilt = true;
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -127,7 +196,7 @@ void BatchRender::SubmitTriangles(
     else if ( mTriangleCount > 0 )
     {
         // Yes, so do we have any existing colors?
-        if ( mColorCount == 0 )
+        if ( !mColorsUsed )
         {
             // No, so flush if color is specified.
             if ( color != NoColor  )
@@ -151,48 +220,24 @@ void BatchRender::SubmitTriangles(
             flush( mpDebugStats->batchTextureChangeFlush );
         }
 
-        // Fetch vertex index.
-        U16 vertexIndex = (U16)mVertexCount;
-
-        // Add new indices.
-        for( U32 n = 0; n < triangleCount; ++n )
-        {
-            mIndexBuffer[mIndexCount++] = vertexIndex++;
-            mIndexBuffer[mIndexCount++] = vertexIndex++;
-            mIndexBuffer[mIndexCount++] = vertexIndex++;
-        }
-
         // Set strict order mode texture handle.
         mStrictOrderTextureHandle = texture;
     }
-    else
-    {
-        // No, so add triangle run.
-        findTextureBatch( texture )->push_back( TriangleRun( TriangleRun::TRIANGLE, triangleCount, mVertexCount ) );
-    }
+
+    // Add triangle run.
+    addTriangleRun( texture, TriangleRun::TRIANGLE, triangleCount );
 
     // Is a color specified?
-    if ( color != NoColor )
-    {
-        // Yes, so add colors.
-        for( U32 n = 0; n < triangleCount; ++n )
-        {
-            mColorBuffer[mColorCount++] = color;
-            mColorBuffer[mColorCount++] = color;
-            mColorBuffer[mColorCount++] = color;
-        }
-    }
+    mColorsUsed = color != NoColor;
+    const U32 packedColor = mColorsUsed ? packColor( color ) : 0xFFFFFFFF;
 
     // Add textured vertices.
-    for( U32 n = 0; n < triangleCount; ++n )
+    Vertex* pVertex = mVertexBuffer + mVertexCount;
+    for( U32 n = 0; n < vertexCount; ++n )
     {
-        mVertexBuffer[mVertexCount++]   = *(pVertexArray++);
-        mVertexBuffer[mVertexCount++]   = *(pVertexArray++);
-        mVertexBuffer[mVertexCount++]   = *(pVertexArray++);
-        mTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
-        mTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
-        mTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
+        writeVertex( pVertex++, *(pVertexArray++), *(pTextureArray++), packedColor );
     }
+    mVertexCount += vertexCount;
 
     // Stats.
     mpDebugStats->batchTrianglesSubmitted += triangleCount;
@@ -246,7 +291,7 @@ void BatchRender::SubmitQuad(
     else if ( mTriangleCount > 0 )
     {
         // Yes, so do we have any existing colors?
-        if ( mColorCount == 0 )
+        if ( !mColorsUsed )
         {
             // No, so flush if color is specified.
             if ( color != NoColor  )
@@ -270,43 +315,25 @@ void BatchRender::SubmitQuad(
             flush( mpDebugStats->batchTextureChangeFlush );
         }
 
-        // Add new indices.
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount++;
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount++;
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount++;
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount--;
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount--;
-        mIndexBuffer[mIndexCount++] = (U16)mVertexCount--;
-
         // Set strict order mode texture handle.
         mStrictOrderTextureHandle = texture;
     }
-    else
-    {
-        // No, so add triangle run.
-        findTextureBatch( texture )->push_back( TriangleRun( TriangleRun::QUAD, 1, mVertexCount ) );
-    }
+
+    // Add triangle run.
+    addTriangleRun( texture, TriangleRun::QUAD, 1 );
 
     // Is a color specified?
-    if ( color != NoColor )
-    {
-        // Yes, so add colors.
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-    }
+    mColorsUsed = color != NoColor;
+    const U32 packedColor = mColorsUsed ? packColor( color ) : 0xFFFFFFFF;
 
     // Add textured vertices.
     // NOTE: We swap #2/#3 here.
-    mVertexBuffer[mVertexCount++]   = vertexPos0;
-    mVertexBuffer[mVertexCount++]   = vertexPos1;
-    mVertexBuffer[mVertexCount++]   = vertexPos3;
-    mVertexBuffer[mVertexCount++]   = vertexPos2;
-    mTextureBuffer[mTextureCoordCount++] = texturePos0;
-    mTextureBuffer[mTextureCoordCount++] = texturePos1;
-    mTextureBuffer[mTextureCoordCount++] = texturePos3;
-    mTextureBuffer[mTextureCoordCount++] = texturePos2;
+    Vertex* pVertex = mVertexBuffer + mVertexCount;
+    writeVertex( pVertex++, vertexPos0, texturePos0, packedColor );
+    writeVertex( pVertex++, vertexPos1, texturePos1, packedColor );
+    writeVertex( pVertex++, vertexPos3, texturePos3, packedColor );
+    writeVertex( pVertex, vertexPos2, texturePos2, packedColor );
+    mVertexCount += 4;
 
     // Stats.
     mpDebugStats->batchTrianglesSubmitted+=2;
@@ -374,97 +401,57 @@ void BatchRender::flushInternal( void )
     // Stats.
     mpDebugStats->batchFlushes++;
 
-    if ( mWireframeMode )
-    {
-        // Disable texturing.    
-        glDisable( GL_TEXTURE_2D );
+    // Record the render state.
+    recordRenderState();
 
-        // Set the polygon mode to line.
-        glPolygonMode( GL_FRONT_AND_BACK, GL_LINE );
-    }
-    else
-    {
-        // Enable texturing.    
-        glEnable( GL_TEXTURE_2D );
-        glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE );
-
-        // Set the polygon mode to fill.
-        glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
-    }
-
-    // Set blend mode.
-    if ( mBlendMode )
-    {
-        glEnable( GL_BLEND );
-        glBlendFunc( mSrcBlendFactor, mDstBlendFactor );
-        glColor4f(mBlendColor.red, mBlendColor.green, mBlendColor.blue, mBlendColor.alpha );
-    }
-    else
-    {
-        glDisable( GL_BLEND );
-        glColor4f( 1.0f, 1.0f, 1.0f, 1.0f );
-    }
+    // Reset index count.
+    // NOTE: Indices for all texture batches are kept until the commands are executed.
+    mIndexCount = 0;
 
-    // Set alpha-blend mode.
-    if ( mAlphaTestMode >= 0.0f )
+    // Iterate texture batch map.
+    // NOTE: In strict order mode there is only ever a single texture batch.
+    for( textureBatchType::iterator batchItr = mTextureBatchMap.begin(); batchItr != mTextureBatchMap.end(); ++batchItr )
     {
-        glEnable( GL_ALPHA_TEST );
-        glAlphaFunc( GL_GREATER, mAlphaTestMode );
-    }
-    else
-    {
-        glDisable( GL_ALPHA_TEST );
-    }
+        // Fetch index vector.
+        indexVectorType* pIndexVector = batchItr->value;
 
-    // Enable vertex and texture arrays.
-    glEnableClientState( GL_VERTEX_ARRAY );
-    glVertexPointer( 2, GL_FLOAT, 0, mVertexBuffer );
-    glTexCoordPointer( 2, GL_FLOAT, 0, mTextureBuffer );
+        // Sanity!
+        AssertFatal( pIndexVector->size() > 0, "No triangle runs are present." );
 
-    // Use the texture coordinates if not in wireframe mode.
-    if ( !mWireframeMode )
-        glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+        U32 trianglesDrawn = 0;
 
-    // Do we have any colors?
-    if ( mColorCount > 0 )
-    {
-        // Yes, so enable color array.
-        glEnableClientState( GL_COLOR_ARRAY );
-        glColorPointer( 4, GL_FLOAT, 0, mColorBuffer );
-    }
-
-    // Strict order mode?
-    if ( mStrictOrderMode )
-    {
-        // Bind the texture if not in wireframe mode.
-        if ( !mWireframeMode )
-            glBindTexture( GL_TEXTURE_2D, mStrictOrderTextureHandle.getGLName() );
+        // Is there a single triangle run?
+        if ( pIndexVector->size() == 1 )
+        {
+            // Yes, so fetch triangle run.
+            const TriangleRun& triangleRun = pIndexVector->first();
 
-        // Draw the triangles
-        glDrawElements( GL_TRIANGLES, mIndexCount, GL_UNSIGNED_SHORT, mIndexBuffer );
+            // Fetch primitive count.
+            const U32 primitiveCount = triangleRun.mPrimitiveCount;
 
-        // Stats.
-        mpDebugStats->batchDrawCallsStrict++;
+            // Bind the texture if not in wireframe mode.
+            if ( !mWireframeMode )
+                mRenderCommands.bindTexture( batchItr->key );
 
-        // Stats.
-        const U32 trianglesDrawn = mIndexCount / 3;
-        if ( trianglesDrawn > mpDebugStats->batchMaxTriangleDrawn )
-            mpDebugStats->batchMaxTriangleDrawn = trianglesDrawn;
+            // Draw the triangles without building indices.
+            if ( triangleRun.mPrimitiveMode == TriangleRun::QUAD )
+            {
+                // Quads use the quad indices from the start of the run.
+                recordVertexArrays( triangleRun.mStartIndex );
+                mRenderCommands.drawIndexed( GL_TRIANGLES, primitiveCount * 6, smQuadIndices );
+            }
+            else
+            {
+                recordVertexArrays( 0 );
+                mRenderCommands.draw( GL_TRIANGLES, triangleRun.mStartIndex, primitiveCount * 3 );
+            }
 
-        // Stats.
-        if ( mVertexCount > mpDebugStats->batchMaxVertexBuffer )
-            mpDebugStats->batchMaxVertexBuffer = mVertexCount;
-    }
-    else
-    {
-        // No, so iterate texture batch map.
-        for( textureBatchType::iterator batchItr = mTextureBatchMap.begin(); batchItr != mTextureBatchMap.end(); ++batchItr )
+            trianglesDrawn = triangleRun.mPrimitiveMode == TriangleRun::QUAD ? primitiveCount * 2 : primitiveCount;
+        }
+        else
         {
-            // Reset index count.
-            mIndexCount = 0;
-
-            // Fetch index vector.
-            indexVectorType* pIndexVector = batchItr->value;
+            // No, so fetch the index start.
+            const U32 indexStart = mIndexCount;
 
             // Iterate indexes.
             for( indexVectorType::iterator indexItr = pIndexVector->begin(); indexItr != pIndexVector->end(); ++indexItr )
@@ -476,7 +463,7 @@ void BatchRender::flushInternal( void )
                 const U32 primitiveCount = triangleRun.mPrimitiveCount;
 
                 // Fetch triangle index start.
-                U16 triangleIndex = (U16)triangleRun.mStartIndex;
+                const U16 triangleIndex = (U16)triangleRun.mStartIndex;
 
                 // Fetch primitive mode.
                 const TriangleRun::PrimitiveMode& primitiveMode = triangleRun.mPrimitiveMode;
@@ -484,28 +471,25 @@ void BatchRender::flushInternal( void )
                 // Handle primitive mode.
                 if ( primitiveMode == TriangleRun::QUAD )
                 {
-                    // Add triangle run for quad.
-                    for( U32 n = 0; n < primitiveCount; ++n )
+                    // Add triangle run for quads offsetting the quad indices.
+                    const U32 indexCount = primitiveCount * 6;
+                    U16* pIndex = mIndexBuffer + mIndexCount;
+                    for( U32 n = 0; n < indexCount; ++n )
                     {
-                        // Add new indices.
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                        mIndexBuffer[mIndexCount++] = triangleIndex--;
-                        mIndexBuffer[mIndexCount++] = triangleIndex--;
-                        mIndexBuffer[mIndexCount++] = triangleIndex--;
+                        pIndex[n] = smQuadIndices[n] + triangleIndex;
                     }
+                    mIndexCount += indexCount;
                 }
                 else if ( primitiveMode == TriangleRun::TRIANGLE )
                 {
                     // Add triangle run for triangles.
-                    for( U32 n = 0; n < primitiveCount; ++n )
+                    const U32 indexCount = primitiveCount * 3;
+                    U16* pIndex = mIndexBuffer + mIndexCount;
+                    for( U32 n = 0; n < indexCount; ++n )
                     {
-                        // Add new indices.
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
+                        pIndex[n] = (U16)(triangleIndex + n);
                     }
+                    mIndexCount += indexCount;
                 }
                 else
                 {
@@ -514,52 +498,105 @@ void BatchRender::flushInternal( void )
                 }
             }
 
+            // Fetch the index count.
+            const U32 indexCount = mIndexCount - indexStart;
+
             // Sanity!
-            AssertFatal( mIndexCount > 0, "No batching indexes are present." );
+            AssertFatal( indexCount > 0, "No batching indexes are present." );
 
             // Bind the texture if not in wireframe mode.
             if ( !mWireframeMode )
-                glBindTexture( GL_TEXTURE_2D, batchItr->key );
+                mRenderCommands.bindTexture( batchItr->key );
 
             // Draw the triangles.
-            glDrawElements( GL_TRIANGLES, mIndexCount, GL_UNSIGNED_SHORT, mIndexBuffer );
+            recordVertexArrays( 0 );
+            mRenderCommands.drawIndexed( GL_TRIANGLES, indexCount, mIndexBuffer + indexStart );
 
-            // Stats.
-            mpDebugStats->batchDrawCallsSorted++;
+            trianglesDrawn = indexCount / 3;
+        }
 
-            // Stats.
-            if ( mVertexCount > mpDebugStats->batchMaxVertexBuffer )
-                mpDebugStats->batchMaxVertexBuffer = mVertexCount;
+        // Stats.
+        if ( mStrictOrderMode )
+            mpDebugStats->batchDrawCallsStrict++;
+        else
+            mpDebugStats->batchDrawCallsSorted++;
 
-            // Stats.
-            const U32 trianglesDrawn = mIndexCount / 3;
-            if ( trianglesDrawn > mpDebugStats->batchMaxTriangleDrawn )
-                mpDebugStats->batchMaxTriangleDrawn = trianglesDrawn;
+        // Stats.
+        if ( mVertexCount > mpDebugStats->batchMaxVertexBuffer )
+            mpDebugStats->batchMaxVertexBuffer = mVertexCount;
 
-            // Return index vector to pool.
-            pIndexVector->clear();
-            mIndexVectorPool.push_back( pIndexVector );
-        }
+        // Stats.
+        if ( trianglesDrawn > mpDebugStats->batchMaxTriangleDrawn )
+            mpDebugStats->batchMaxTriangleDrawn = trianglesDrawn;
 
-        // Clear texture batch map.
-        mTextureBatchMap.clear();
+        // Return index vector to pool.
+        pIndexVector->clear();
+        mIndexVectorPool.push_back( pIndexVector );
     }
 
-    // Reset common render state.
-    glDisableClientState( GL_VERTEX_ARRAY );
-    glDisableClientState( GL_TEXTURE_COORD_ARRAY );
-    glDisableClientState( GL_COLOR_ARRAY );
-    glDisable( GL_ALPHA_TEST );
-    glDisable( GL_BLEND );
-    glDisable( GL_TEXTURE_2D );
-    glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
+    // Clear texture batch map.
+    mTextureBatchMap.clear();
+
+    // Reset the render state.
+    mRenderCommands.resetState();
+
+    // Execute the commands unless this is a null render.
+    if ( !mNullRender )
+        getRenderCommandExecutor()->execute( mRenderCommands );
+
+    mRenderCommands.clear();
 
     // Reset batch state.
     mTriangleCount = 0;
     mVertexCount = 0;
-    mTextureCoordCount = 0;
     mIndexCount = 0;
-    mColorCount = 0;
+    mColorsUsed = false;
+}
+
+//-----------------------------------------------------------------------------
+
+RenderCommandExecutor* BatchRender::getRenderCommandExecutor( void ) const
+{
+    // Use the dgl executor if none is set.
+    return mpRenderCommandExecutor != NULL ? mpRenderCommandExecutor : dglGetRenderCommandExecutor();
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::recordRenderState( void )
+{
+    RenderStateBlock state;
+
+    // Set wireframe mode, texturing otherwise.
+    state.mWireframe = mWireframeMode;
+    state.mTexture = !mWireframeMode;
+
+    // Set blend mode.
+    state.mBlend = mBlendMode;
+    state.mSrcBlendFactor = mSrcBlendFactor;
+    state.mDstBlendFactor = mDstBlendFactor;
+    state.mColor = mBlendMode ? mBlendColor : ColorF( 1.0f, 1.0f, 1.0f, 1.0f );
+
+    // Set alpha-test mode.
+    state.mAlphaTest = mAlphaTestMode;
+
+    mRenderCommands.setState( state );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::recordVertexArrays( const U32 startVertex )
+{
+    // Fetch the start vertex.
+    const Vertex* pVertex = mVertexBuffer + startVertex;
+
+    // Point the arrays into the interleaved vertices.
+    // NOTE: The texture coordinates are not used in wireframe mode and the colors only if we have any.
+    mRenderCommands.setVertexArrays(
+        &pVertex->mPosition.x,
+        mWireframeMode ? NULL : &pVertex->mTexture.x,
+        mColorsUsed ? (const U8*)&pVertex->mColor : NULL,
+        sizeof(Vertex) );
 }
 
 //-----------------------------------------------------------------------------
@@ -605,4 +642,29 @@ BatchRender::indexVectorType* BatchRender::findTextureBatch( TextureHandle& hand
     return pIndexVector;
 }
 
+//-----------------------------------------------------------------------------
+
+void BatchRender::addTriangleRun( TextureHandle& texture, const TriangleRun::PrimitiveMode primitiveMode, const U32 primitiveCount )
+{
+    // Fetch texture batch.
+    indexVectorType* pIndexVector = findTextureBatch( texture );
+
+    // Does the last triangle run end at the current vertex with the same primitive?
+    if ( pIndexVector->size() > 0 )
+    {
+        TriangleRun& lastTriangleRun = pIndexVector->last();
+
+        if ( lastTriangleRun.mPrimitiveMode == primitiveMode &&
+             lastTriangleRun.mStartIndex + lastTriangleRun.getVertexCount() == mVertexCount )
+        {
+            // Yes, so extend it.
+            lastTriangleRun.mPrimitiveCount += primitiveCount;
+            return;
+        }
+    }
+
+    // No, so add triangle run.
+    pIndexVector->push_back( TriangleRun( primitiveMode, primitiveCount, mVertexCount ) );
+}
+
 
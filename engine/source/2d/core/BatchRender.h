@@ -47,10 +47,15 @@
 #include "graphics/color.h"
 #endif
 
+#ifndef _RENDER_COMMANDS_H_
+#include "graphics/renderCommands.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 #define BATCHRENDER_BUFFERSIZE      (65535)
 #define BATCHRENDER_MAXTRIANGLES    (BATCHRENDER_BUFFERSIZE/3)
+#define BATCHRENDER_MAXQUADS        (BATCHRENDER_MAXTRIANGLES/2)
 
 //-----------------------------------------------------------------------------
 
@@ -75,11 +80,21 @@ private:
             mStartIndex( startIndex )
         { }
 
+        inline U32 getVertexCount( void ) const { return mPrimitiveCount * (mPrimitiveMode == QUAD ? 4 : 3); }
+
         PrimitiveMode mPrimitiveMode;
         U32 mPrimitiveCount;
         U32 mStartIndex;
     };
 
+    /// Interleaved vertex with the color packed as RGBA8.
+    struct Vertex
+    {
+        Vector2 mPosition;
+        Vector2 mTexture;
+        U32     mColor;
+    };
+
     typedef Vector<TriangleRun> indexVectorType;
     typedef HashMap<U32, indexVectorType*> textureBatchType;
 
@@ -88,16 +103,17 @@ private:
 
     const ColorF        NoColor;
 
-    Vector2             mVertexBuffer[ BATCHRENDER_BUFFERSIZE ];
-    Vector2             mTextureBuffer[ BATCHRENDER_BUFFERSIZE ];
+    /// Indices for consecutive quads shared by all batch renderers.
+    static U16          smQuadIndices[ BATCHRENDER_MAXQUADS * 6 ];
+    static bool         smQuadIndicesBuilt;
+
+    Vertex              mVertexBuffer[ BATCHRENDER_BUFFERSIZE ];
     U16                 mIndexBuffer[ BATCHRENDER_BUFFERSIZE ];
-    ColorF              mColorBuffer[ BATCHRENDER_BUFFERSIZE ];
    
     U32                 mTriangleCount;
     U32                 mVertexCount;
-    U32                 mTextureCoordCount;
     U32                 mIndexCount;
-    U32                 mColorCount;
+    bool                mColorsUsed;
 
     bool                mBlendMode;
     GLenum              mSrcBlendFactor;
@@ -111,6 +127,10 @@ private:
 
     bool                mWireframeMode;
     bool                mBatchEnabled;
+    bool                mNullRender;
+
+    RenderCommandBuffer     mRenderCommands;
+    RenderCommandExecutor*  mpRenderCommandExecutor;
 
 public:
     BatchRender();
@@ -216,6 +236,40 @@ public:
     /// Gets the batch enabled mode.
     inline bool getBatchEnabled( void ) const { return mBatchEnabled; }
 
+    /// Sets the null render mode.
+    /// When enabled, batches are built and flushed as normal but nothing is sent to the GPU.
+    inline void setNullRender( const bool nullRender )
+    {
+        // Ignore no change.
+        if ( mNullRender == nullRender )
+            return;
+
+        // Flush.
+        flushInternal();
+
+        mNullRender = nullRender;
+    }
+
+    /// Gets the null render mode.
+    inline bool getNullRender( void ) const { return mNullRender; }
+
+    /// Sets the executor the recorded render commands are replayed with.
+    /// When NULL, the current dgl executor is used.
+    inline void setRenderCommandExecutor( RenderCommandExecutor* pExecutor )
+    {
+        // Ignore no change.
+        if ( mpRenderCommandExecutor == pExecutor )
+            return;
+
+        // Flush.
+        flushInternal();
+
+        mpRenderCommandExecutor = pExecutor;
+    }
+
+    /// Gets the executor the recorded render commands are replayed with.
+    RenderCommandExecutor* getRenderCommandExecutor( void ) const;
+
     /// Sets the debug stats to use.
     inline void setDebugStats( DebugStats* pDebugStats ) { mpDebugStats = pDebugStats; }
 
@@ -289,8 +343,17 @@ private:
     /// Flush (render) any pending batches.
     void flushInternal( void );
 
+    /// Record the render state used when flushing.
+    void recordRenderState( void );
+
+    /// Record the vertex arrays pointing at a vertex in the buffer.
+    void recordVertexArrays( const U32 startVertex );
+
     /// Find texture batch.
     indexVectorType* findTextureBatch( TextureHandle& handle );
+
+    /// Add a triangle run starting at the current vertex, extending the last run of the texture batch if it is contiguous.
+    void addTriangleRun( TextureHandle& texture, const TriangleRun::PrimitiveMode primitiveMode, const U32 primitiveCount );
 };
 
 #endif
\ No newline at end of file
@@ -22,10 +22,43 @@
 
 #include "2d/core/ParticleSystem.h"
 
+#if defined(TORQUE_PARTICLE_SSE)
+#include <xmmintrin.h>
+#elif defined(TORQUE_PARTICLE_NEON)
+#include <arm_neon.h>
+#endif
+
 //------------------------------------------------------------------------------
 
 ParticleSystem* ParticleSystem::Instance = NULL;
 
+// Particle buffer float arrays.
+static F32* ParticleSystem::ParticleBuffer::* const particleBufferFloatArrays[] =
+{
+    &ParticleSystem::ParticleBuffer::mPositionX,
+    &ParticleSystem::ParticleBuffer::mPositionY,
+    &ParticleSystem::ParticleBuffer::mVelocityX,
+    &ParticleSystem::ParticleBuffer::mVelocityY,
+    &ParticleSystem::ParticleBuffer::mRenderSpeed,
+    &ParticleSystem::ParticleBuffer::mAge,
+    &ParticleSystem::ParticleBuffer::mLifetime,
+    &ParticleSystem::ParticleBuffer::mRotationCos,
+    &ParticleSystem::ParticleBuffer::mRotationSin,
+    &ParticleSystem::ParticleBuffer::mRenderSizeX,
+    &ParticleSystem::ParticleBuffer::mRenderSizeY,
+    &ParticleSystem::ParticleBuffer::mPreTickX,
+    &ParticleSystem::ParticleBuffer::mPreTickY,
+    &ParticleSystem::ParticleBuffer::mPostTickX,
+    &ParticleSystem::ParticleBuffer::mPostTickY,
+    &ParticleSystem::ParticleBuffer::mRenderTickX,
+    &ParticleSystem::ParticleBuffer::mRenderTickY,
+};
+
+static const U32 particleBufferFloatArrayCount = sizeof(particleBufferFloatArrays) / sizeof(particleBufferFloatArrays[0]);
+
+// Particle buffer minimum capacity.
+static const U32 particleBufferMinimumCapacity = 64;
+
 //------------------------------------------------------------------------------
 
 void ParticleSystem::Init( void )
@@ -48,8 +81,8 @@ void ParticleSystem::destroy( void )
 ParticleSystem::ParticleSystem() :
                     mParticlePoolBlockSize(512)
 {
-    // Reset the free particle head.
-    mpFreeParticleNodes = NULL;
+    VECTOR_SET_ASSOCIATION( mParticlePool );
+    VECTOR_SET_ASSOCIATION( mFreeParticleNodes );
 
     // Reset the active particle count.
     mActiveParticleCount = 0;
@@ -66,8 +99,8 @@ ParticleSystem::~ParticleSystem()
     // Clear the particle pool.
     mParticlePool.clear();
 
-    // Reset the free particle head.
-    mpFreeParticleNodes = NULL;
+    // Clear the free particle nodes.
+    mFreeParticleNodes.clear();
 }
 
 //------------------------------------------------------------------------------
@@ -75,7 +108,7 @@ ParticleSystem::~ParticleSystem()
 ParticleSystem::ParticleNode* ParticleSystem::createParticle( void )
 {
     // Have we got any free particle nodes?
-    if ( mpFreeParticleNodes == NULL )
+    if ( mFreeParticleNodes.size() == 0 )
     {
         // No, so generate a new free pool block.
         ParticleNode* pFreePoolBlock = new ParticleNode[mParticlePoolBlockSize];
@@ -83,30 +116,18 @@ ParticleSystem::ParticleNode* ParticleSystem::createParticle( void )
         // Store new free pool block.
         mParticlePool.push_back( pFreePoolBlock );
 
-        // Initialise Free Pool Block.
-        for ( U32 n = 0; n < (mParticlePoolBlockSize-1); n++ )
+        // Insert the free pool block nodes into the free nodes.
+        // NOTE:-   We insert these in reverse so that nodes are handed out in memory order.
+        mFreeParticleNodes.reserve( mFreeParticleNodes.size() + mParticlePoolBlockSize );
+        for ( S32 n = (S32)mParticlePoolBlockSize-1; n >= 0; n-- )
         {
-            pFreePoolBlock[n].mPreviousNode = NULL;
-            pFreePoolBlock[n].mNextNode     = pFreePoolBlock+n+1;
+            mFreeParticleNodes.push_back( pFreePoolBlock+n );
         }
-
-        // Insert Last Node Preceding any existing free nodes.
-        pFreePoolBlock[mParticlePoolBlockSize-1].mPreviousNode = NULL;
-        pFreePoolBlock[mParticlePoolBlockSize-1].mNextNode = mpFreeParticleNodes;
-
-        // Set Free References.
-        mpFreeParticleNodes = pFreePoolBlock;
     }
 
     // Fetch a free node,
-    ParticleNode* pFreeParticleNode = mpFreeParticleNodes;
-
-    // Set the new free node reference.
-    mpFreeParticleNodes = mpFreeParticleNodes->mNextNode;
-
-    // Reset any previous or next node references.
-    pFreeParticleNode->mNextNode        = NULL;
-    pFreeParticleNode->mPreviousNode    = NULL;
+    ParticleNode* pFreeParticleNode = mFreeParticleNodes.last();
+    mFreeParticleNodes.pop_back();
 
     // Increase the active particle count.
     mActiveParticleCount++;
@@ -121,14 +142,406 @@ void ParticleSystem::freeParticle( ParticleNode* pParticleNode )
     // Reset the particle.
     pParticleNode->resetState();
 
-    // Remove the previous node reference.
-    pParticleNode->mPreviousNode = NULL;
-    
     // Insert the node into the free pool.
-    pParticleNode->mNextNode = mpFreeParticleNodes;
-    mpFreeParticleNodes = pParticleNode;
+    mFreeParticleNodes.push_back( pParticleNode );
 
     // Decrease the active particle count.
     mActiveParticleCount--;
 }
 
+//------------------------------------------------------------------------------
+
+ParticleSystem::ParticleBuffer::ParticleBuffer() :
+                    mRenderOOBB( NULL ),
+                    mColor( NULL ),
+                    mNodes( NULL ),
+                    mCount( 0 ),
+                    mCapacity( 0 ),
+                    mpBlock( NULL )
+{
+    // Reset the float arrays.
+    for ( U32 n = 0; n < particleBufferFloatArrayCount; ++n )
+        this->*particleBufferFloatArrays[n] = NULL;
+}
+
+//------------------------------------------------------------------------------
+
+ParticleSystem::ParticleBuffer::~ParticleBuffer()
+{
+    // Free the block.
+    if ( mpBlock != NULL )
+        dFree( mpBlock );
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::ParticleBuffer::reserve( const U32 capacity )
+{
+    // Finish if we've already got the capacity.
+    if ( capacity <= mCapacity )
+        return;
+
+    // Calculate the new capacity (always a multiple of the SIMD width).
+    U32 newCapacity = getMax( mCapacity * 2, particleBufferMinimumCapacity );
+    while ( newCapacity < capacity )
+        newCapacity *= 2;
+
+    // Calculate the block size.
+    // NOTE:-   Each array is a multiple of 16-bytes so every array stays aligned within the block.
+    const U32 floatArraysSize = newCapacity * sizeof(F32) * particleBufferFloatArrayCount;
+    const U32 oobbSize = newCapacity * sizeof(Vector2) * 4;
+    const U32 colorSize = newCapacity * sizeof(ColorF);
+    const U32 nodesSize = newCapacity * sizeof(ParticleNode*);
+    const U32 blockSize = floatArraysSize + oobbSize + colorSize + nodesSize + 15;
+
+    // Allocate the new block.
+    void* pNewBlock = dMalloc( blockSize );
+    dMemset( pNewBlock, 0, blockSize );
+
+    // Align the block.
+    U8* pAligned = (U8*)( ((dsize_t)pNewBlock + 15) & ~((dsize_t)15) );
+
+    // Bind and copy the float arrays.
+    for ( U32 n = 0; n < particleBufferFloatArrayCount; ++n )
+    {
+        F32* pArray = (F32*)pAligned;
+        pAligned += newCapacity * sizeof(F32);
+
+        if ( mCount > 0 )
+            dMemcpy( pArray, this->*particleBufferFloatArrays[n], mCount * sizeof(F32) );
+
+        this->*particleBufferFloatArrays[n] = pArray;
+    }
+
+    // Bind and copy the render OOBB.
+    Vector2* pRenderOOBB = (Vector2*)pAligned;
+    pAligned += oobbSize;
+    if ( mCount > 0 )
+        dMemcpy( pRenderOOBB, mRenderOOBB, mCount * sizeof(Vector2) * 4 );
+    mRenderOOBB = pRenderOOBB;
+
+    // Bind and copy the color.
+    ColorF* pColor = (ColorF*)pAligned;
+    pAligned += colorSize;
+    if ( mCount > 0 )
+        dMemcpy( pColor, mColor, mCount * sizeof(ColorF) );
+    mColor = pColor;
+
+    // Bind and copy the nodes.
+    ParticleNode** pNodes = (ParticleNode**)pAligned;
+    if ( mCount > 0 )
+        dMemcpy( pNodes, mNodes, mCount * sizeof(ParticleNode*) );
+    mNodes = pNodes;
+
+    // Free the old block.
+    if ( mpBlock != NULL )
+        dFree( mpBlock );
+
+    // Set the new block.
+    mpBlock = pNewBlock;
+    mCapacity = newCapacity;
+}
+
+//------------------------------------------------------------------------------
+
+U32 ParticleSystem::ParticleBuffer::append( ParticleNode* pParticleNode )
+{
+    // Sanity!
+    AssertFatal( pParticleNode != NULL, "ParticleBuffer::append() - Cannot append a NULL particle node." );
+
+    // Ensure we've got capacity.
+    reserve( mCount + 1 );
+
+    // Fetch the particle index.
+    const U32 particleIndex = mCount++;
+
+    // Reset the particle state.
+    for ( U32 n = 0; n < particleBufferFloatArrayCount; ++n )
+        (this->*particleBufferFloatArrays[n])[particleIndex] = 0.0f;
+
+    // Reset the rotation.
+    mRotationCos[particleIndex] = 1.0f;
+
+    // Set the node.
+    mNodes[particleIndex] = pParticleNode;
+
+    return particleIndex;
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::ParticleBuffer::move( const U32 fromIndex, const U32 toIndex )
+{
+    // Sanity!
+    AssertFatal( fromIndex < mCount && toIndex < mCount, "ParticleBuffer::move() - Particle index is out of bounds." );
+
+    // Move the float arrays.
+    for ( U32 n = 0; n < particleBufferFloatArrayCount; ++n )
+    {
+        F32* pArray = this->*particleBufferFloatArrays[n];
+        pArray[toIndex] = pArray[fromIndex];
+    }
+
+    // Move the render OOBB.
+    dMemcpy( mRenderOOBB + (toIndex*4), mRenderOOBB + (fromIndex*4), sizeof(Vector2) * 4 );
+
+    // Move the color and node.
+    mColor[toIndex] = mColor[fromIndex];
+    mNodes[toIndex] = mNodes[fromIndex];
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::integrateAge( ParticleBuffer& buffer, const F32 elapsedTime )
+{
+    // Fetch the padded particle count.
+    const U32 count = (buffer.getCount() + 3) & ~3;
+
+    F32* pAge = buffer.mAge;
+
+#if defined(TORQUE_PARTICLE_SSE)
+    const __m128 time = _mm_set1_ps( elapsedTime );
+    for ( U32 n = 0; n < count; n += 4 )
+        _mm_store_ps( pAge+n, _mm_add_ps( _mm_load_ps( pAge+n ), time ) );
+#elif defined(TORQUE_PARTICLE_NEON)
+    const float32x4_t time = vdupq_n_f32( elapsedTime );
+    for ( U32 n = 0; n < count; n += 4 )
+        vst1q_f32( pAge+n, vaddq_f32( vld1q_f32( pAge+n ), time ) );
+#else
+    for ( U32 n = 0; n < count; ++n )
+        pAge[n] += elapsedTime;
+#endif
+}
+
+//------------------------------------------------------------------------------
+
+static inline void integrateMotionScalar( ParticleSystem::ParticleBuffer& buffer, const U32 n, const F32 elapsedTime, const bool applyVelocity )
+{
+    // Copy old tick position.
+    buffer.mRenderTickX[n] = buffer.mPreTickX[n] = buffer.mPostTickX[n];
+    buffer.mRenderTickY[n] = buffer.mPreTickY[n] = buffer.mPostTickY[n];
+
+    // Adjust particle position.
+    if ( applyVelocity )
+    {
+        const F32 scale = buffer.mRenderSpeed[n] * elapsedTime;
+        buffer.mPositionX[n] += buffer.mVelocityX[n] * scale;
+        buffer.mPositionY[n] += buffer.mVelocityY[n] * scale;
+    }
+
+    // Set post tick position.
+    buffer.mPostTickX[n] = buffer.mPositionX[n];
+    buffer.mPostTickY[n] = buffer.mPositionY[n];
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::integrateMotion( ParticleBuffer& buffer, const U32 start, const U32 end, const F32 elapsedTime, const bool applyVelocity )
+{
+    // Sanity!
+    AssertFatal( start <= end && end <= buffer.getCount(), "ParticleSystem::integrateMotion() - Particle range is out of bounds." );
+
+    U32 n = start;
+
+#if defined(TORQUE_PARTICLE_SSE) || defined(TORQUE_PARTICLE_NEON)
+    // Integrate up to a SIMD boundary.
+    for ( ; n < end && (n & 3) != 0; ++n )
+        integrateMotionScalar( buffer, n, elapsedTime, applyVelocity );
+
+#if defined(TORQUE_PARTICLE_SSE)
+    const __m128 time = _mm_set1_ps( elapsedTime );
+    for ( ; n + 4 <= end; n += 4 )
+    {
+        // Copy old tick position.
+        const __m128 postX = _mm_load_ps( buffer.mPostTickX+n );
+        const __m128 postY = _mm_load_ps( buffer.mPostTickY+n );
+        _mm_store_ps( buffer.mPreTickX+n, postX );
+        _mm_store_ps( buffer.mPreTickY+n, postY );
+        _mm_store_ps( buffer.mRenderTickX+n, postX );
+        _mm_store_ps( buffer.mRenderTickY+n, postY );
+
+        // Fetch particle position.
+        __m128 positionX = _mm_load_ps( buffer.mPositionX+n );
+        __m128 positionY = _mm_load_ps( buffer.mPositionY+n );
+
+        // Adjust particle position.
+        if ( applyVelocity )
+        {
+            const __m128 scale = _mm_mul_ps( _mm_load_ps( buffer.mRenderSpeed+n ), time );
+            positionX = _mm_add_ps( positionX, _mm_mul_ps( _mm_load_ps( buffer.mVelocityX+n ), scale ) );
+            positionY = _mm_add_ps( positionY, _mm_mul_ps( _mm_load_ps( buffer.mVelocityY+n ), scale ) );
+            _mm_store_ps( buffer.mPositionX+n, positionX );
+            _mm_store_ps( buffer.mPositionY+n, positionY );
+        }
+
+        // Set post tick position.
+        _mm_store_ps( buffer.mPostTickX+n, positionX );
+        _mm_store_ps( buffer.mPostTickY+n, positionY );
+    }
+#else
+    const float32x4_t time = vdupq_n_f32( elapsedTime );
+    for ( ; n + 4 <= end; n += 4 )
+    {
+        // Copy old tick position.
+        const float32x4_t postX = vld1q_f32( buffer.mPostTickX+n );
+        const float32x4_t postY = vld1q_f32( buffer.mPostTickY+n );
+        vst1q_f32( buffer.mPreTickX+n, postX );
+        vst1q_f32( buffer.mPreTickY+n, postY );
+        vst1q_f32( buffer.mRenderTickX+n, postX );
+        vst1q_f32( buffer.mRenderTickY+n, postY );
+
+        // Fetch particle position.
+        float32x4_t positionX = vld1q_f32( buffer.mPositionX+n );
+        float32x4_t positionY = vld1q_f32( buffer.mPositionY+n );
+
+        // Adjust particle position.
+        if ( applyVelocity )
+        {
+            const float32x4_t scale = vmulq_f32( vld1q_f32( buffer.mRenderSpeed+n ), time );
+            positionX = vmlaq_f32( positionX, vld1q_f32( buffer.mVelocityX+n ), scale );
+            positionY = vmlaq_f32( positionY, vld1q_f32( buffer.mVelocityY+n ), scale );
+            vst1q_f32( buffer.mPositionX+n, positionX );
+            vst1q_f32( buffer.mPositionY+n, positionY );
+        }
+
+        // Set post tick position.
+        vst1q_f32( buffer.mPostTickX+n, positionX );
+        vst1q_f32( buffer.mPostTickY+n, positionY );
+    }
+#endif
+#endif
+
+    // Integrate the remainder.
+    for ( ; n < end; ++n )
+        integrateMotionScalar( buffer, n, elapsedTime, applyVelocity );
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::interpolateTick( ParticleBuffer& buffer, const F32 timeDelta )
+{
+    // Fetch the padded particle count.
+    const U32 count = (buffer.getCount() + 3) & ~3;
+
+#if defined(TORQUE_PARTICLE_SSE)
+    const __m128 preScale = _mm_set1_ps( timeDelta );
+    const __m128 postScale = _mm_set1_ps( 1.0f - timeDelta );
+    for ( U32 n = 0; n < count; n += 4 )
+    {
+        _mm_store_ps( buffer.mRenderTickX+n, _mm_add_ps( _mm_mul_ps( _mm_load_ps( buffer.mPreTickX+n ), preScale ), _mm_mul_ps( _mm_load_ps( buffer.mPostTickX+n ), postScale ) ) );
+        _mm_store_ps( buffer.mRenderTickY+n, _mm_add_ps( _mm_mul_ps( _mm_load_ps( buffer.mPreTickY+n ), preScale ), _mm_mul_ps( _mm_load_ps( buffer.mPostTickY+n ), postScale ) ) );
+    }
+#elif defined(TORQUE_PARTICLE_NEON)
+    const float32x4_t preScale = vdupq_n_f32( timeDelta );
+    const float32x4_t postScale = vdupq_n_f32( 1.0f - timeDelta );
+    for ( U32 n = 0; n < count; n += 4 )
+    {
+        vst1q_f32( buffer.mRenderTickX+n, vmlaq_f32( vmulq_f32( vld1q_f32( buffer.mPreTickX+n ), preScale ), vld1q_f32( buffer.mPostTickX+n ), postScale ) );
+        vst1q_f32( buffer.mRenderTickY+n, vmlaq_f32( vmulq_f32( vld1q_f32( buffer.mPreTickY+n ), preScale ), vld1q_f32( buffer.mPostTickY+n ), postScale ) );
+    }
+#else
+    const F32 postScale = 1.0f - timeDelta;
+    for ( U32 n = 0; n < count; ++n )
+    {
+        buffer.mRenderTickX[n] = (timeDelta * buffer.mPreTickX[n]) + (postScale * buffer.mPostTickX[n]);
+        buffer.mRenderTickY[n] = (timeDelta * buffer.mPreTickY[n]) + (postScale * buffer.mPostTickY[n]);
+    }
+#endif
+}
+
+//------------------------------------------------------------------------------
+
+static inline void calculateOOBBScalar( ParticleSystem::ParticleBuffer& buffer, const U32 n, const F32* pPositionX, const F32* pPositionY, const Vector2* pLocalAABB )
+{
+    // Fetch the transform.
+    const F32 c = buffer.mRotationCos[n];
+    const F32 s = buffer.mRotationSin[n];
+    const F32 px = pPositionX[n];
+    const F32 py = pPositionY[n];
+
+    // Fetch the render size.
+    const F32 sizeX = buffer.mRenderSizeX[n];
+    const F32 sizeY = buffer.mRenderSizeY[n];
+
+    // Calculate the world OOBB.
+    Vector2* pRenderOOBB = buffer.mRenderOOBB + (n*4);
+    for ( U32 vertex = 0; vertex < 4; ++vertex )
+    {
+        const F32 lx = pLocalAABB[vertex].x * sizeX;
+        const F32 ly = pLocalAABB[vertex].y * sizeY;
+        pRenderOOBB[vertex].Set( (c * lx - s * ly) + px, (s * lx + c * ly) + py );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void ParticleSystem::calculateOOBB( ParticleBuffer& buffer, const U32 start, const U32 end, const F32* pPositionX, const F32* pPositionY, const Vector2* pLocalAABB )
+{
+    // Sanity!
+    AssertFatal( start <= end && end <= buffer.getCount(), "ParticleSystem::calculateOOBB() - Particle range is out of bounds." );
+
+    U32 n = start;
+
+#if defined(TORQUE_PARTICLE_SSE) || defined(TORQUE_PARTICLE_NEON)
+    // Calculate up to a SIMD boundary.
+    for ( ; n < end && (n & 3) != 0; ++n )
+        calculateOOBBScalar( buffer, n, pPositionX, pPositionY, pLocalAABB );
+
+    for ( ; n + 4 <= end; n += 4 )
+    {
+        // Fetch the output OOBB.
+        F32* pRenderOOBB = (F32*)(buffer.mRenderOOBB + (n*4));
+
+#if defined(TORQUE_PARTICLE_SSE)
+        const __m128 c = _mm_load_ps( buffer.mRotationCos+n );
+        const __m128 s = _mm_load_ps( buffer.mRotationSin+n );
+        const __m128 px = _mm_load_ps( pPositionX+n );
+        const __m128 py = _mm_load_ps( pPositionY+n );
+        const __m128 sizeX = _mm_load_ps( buffer.mRenderSizeX+n );
+        const __m128 sizeY = _mm_load_ps( buffer.mRenderSizeY+n );
+
+        for ( U32 vertex = 0; vertex < 4; ++vertex )
+        {
+            const __m128 lx = _mm_mul_ps( _mm_set1_ps( pLocalAABB[vertex].x ), sizeX );
+            const __m128 ly = _mm_mul_ps( _mm_set1_ps( pLocalAABB[vertex].y ), sizeY );
+            const __m128 x = _mm_add_ps( _mm_sub_ps( _mm_mul_ps( c, lx ), _mm_mul_ps( s, ly ) ), px );
+            const __m128 y = _mm_add_ps( _mm_add_ps( _mm_mul_ps( s, lx ), _mm_mul_ps( c, ly ) ), py );
+
+            // Interleave into vertices.
+            const __m128 lower = _mm_unpacklo_ps( x, y );
+            const __m128 upper = _mm_unpackhi_ps( x, y );
+            _mm_storel_pi( (__m64*)(pRenderOOBB + vertex*2), lower );
+            _mm_storeh_pi( (__m64*)(pRenderOOBB + 8 + vertex*2), lower );
+            _mm_storel_pi( (__m64*)(pRenderOOBB + 16 + vertex*2), upper );
+            _mm_storeh_pi( (__m64*)(pRenderOOBB + 24 + vertex*2), upper );
+        }
+#else
+        const float32x4_t c = vld1q_f32( buffer.mRotationCos+n );
+        const float32x4_t s = vld1q_f32( buffer.mRotationSin+n );
+        const float32x4_t px = vld1q_f32( pPositionX+n );
+        const float32x4_t py = vld1q_f32( pPositionY+n );
+        const float32x4_t sizeX = vld1q_f32( buffer.mRenderSizeX+n );
+        const float32x4_t sizeY = vld1q_f32( buffer.mRenderSizeY+n );
+
+        for ( U32 vertex = 0; vertex < 4; ++vertex )
+        {
+            const float32x4_t lx = vmulq_n_f32( sizeX, pLocalAABB[vertex].x );
+            const float32x4_t ly = vmulq_n_f32( sizeY, pLocalAABB[vertex].y );
+            const float32x4_t x = vaddq_f32( vmlsq_f32( vmulq_f32( c, lx ), s, ly ), px );
+            const float32x4_t y = vaddq_f32( vmlaq_f32( vmulq_f32( s, lx ), c, ly ), py );
+
+            // Interleave into vertices.
+            const float32x4x2_t interleaved = vzipq_f32( x, y );
+            vst1_f32( pRenderOOBB + vertex*2, vget_low_f32( interleaved.val[0] ) );
+            vst1_f32( pRenderOOBB + 8 + vertex*2, vget_high_f32( interleaved.val[0] ) );
+            vst1_f32( pRenderOOBB + 16 + vertex*2, vget_low_f32( interleaved.val[1] ) );
+            vst1_f32( pRenderOOBB + 24 + vertex*2, vget_high_f32( interleaved.val[1] ) );
+        }
+#endif
+    }
+#endif
+
+    // Calculate the remainder.
+    for ( ; n < end; ++n )
+        calculateOOBBScalar( buffer, n, pPositionX, pPositionY, pLocalAABB );
+}
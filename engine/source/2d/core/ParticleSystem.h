@@ -29,32 +29,26 @@
 
 //-----------------------------------------------------------------------------
 
+#if defined(__SSE__) || defined(_M_IX86) || defined(_M_AMD64) || defined(_M_X64)
+#define TORQUE_PARTICLE_SSE
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define TORQUE_PARTICLE_NEON
+#endif
+
+//-----------------------------------------------------------------------------
+
 class ParticleSystem
 {
 public:
     /// Particle node.
-    struct ParticleNode : public IFactoryObjectReset
+    /// NOTE:-  This only holds the "cold" per-particle state.  The state touched every tick lives in the owning "ParticleBuffer".
+    struct ParticleNode
     {
-        /// Particle Node Linkages.
-        ParticleNode*           mPreviousNode;
-        ParticleNode*           mNextNode;
-
-        /// Suppress Movement.
-        bool                    mSuppressMovement;
-
         /// Particle Components.
-        F32                     mParticleLifetime;
-        F32                     mParticleAge;
-        Vector2                 mPosition;
-        Vector2                 mVelocity;
         F32                     mOrientationAngle;
-        Vector2                 mRenderOOBB[4];
-        b2Transform             mTransform;
         ImageFrameProviderCore  mFrameProvider;
 
         /// Render Properties.
-        Vector2                 mRenderSize;
-        F32                     mRenderSpeed;
         F32                     mRenderSpin;
         F32                     mRenderFixedForce;
         F32                     mRenderRandomMotion;
@@ -65,25 +59,82 @@ public:
         F32                     mSpin;
         F32                     mFixedForce;
         F32                     mRandomMotion;
-        ColorF                  mColor;    
-
-        /// Interpolated Tick Position.
-        Vector2                 mPreTickPosition;
-        Vector2                 mPostTickPosition;
-        Vector2                 mRenderTickPosition;
 
         ParticleNode() { constructInPlace<ImageFrameProviderCore>(&mFrameProvider); resetState(); }
 
-        virtual void resetState( void )
+        inline void resetState( void )
         {
             mFrameProvider.resetState();
         }
     };
 
+    /// Particle buffer.
+    /// Packed structure-of-arrays storage for the particles of a single emitter.
+    /// Particles are stored oldest first and every array is padded to a multiple of four
+    /// so the integration kernels can always process whole SIMD lanes.
+    class ParticleBuffer
+    {
+    public:
+        /// Kinematics.
+        F32*            mPositionX;
+        F32*            mPositionY;
+        F32*            mVelocityX;
+        F32*            mVelocityY;
+        F32*            mRenderSpeed;
+
+        /// Lifetime.
+        F32*            mAge;
+        F32*            mLifetime;
+
+        /// Orientation.
+        F32*            mRotationCos;
+        F32*            mRotationSin;
+
+        /// Render size.
+        F32*            mRenderSizeX;
+        F32*            mRenderSizeY;
+
+        /// Interpolated Tick Position.
+        F32*            mPreTickX;
+        F32*            mPreTickY;
+        F32*            mPostTickX;
+        F32*            mPostTickY;
+        F32*            mRenderTickX;
+        F32*            mRenderTickY;
+
+        /// Render OOBB (four vertices per particle).
+        Vector2*        mRenderOOBB;
+
+        /// Render color.
+        ColorF*         mColor;
+
+        /// Cold particle state.
+        ParticleNode**  mNodes;
+
+    private:
+        U32             mCount;
+        U32             mCapacity;
+        void*           mpBlock;
+
+        void reserve( const U32 capacity );
+
+    public:
+        ParticleBuffer();
+        ~ParticleBuffer();
+
+        inline U32 getCount( void ) const { return mCount; }
+        inline U32 getCapacity( void ) const { return mCapacity; }
+
+        U32 append( ParticleNode* pParticleNode );
+        void move( const U32 fromIndex, const U32 toIndex );
+        inline void setCount( const U32 count ) { AssertFatal( count <= mCount, "ParticleBuffer::setCount() - Cannot grow the buffer." ); mCount = count; }
+        inline void clear( void ) { mCount = 0; }
+    };
+
 private:
     const U32               mParticlePoolBlockSize;
     Vector<ParticleNode*>   mParticlePool;
-    ParticleNode*           mpFreeParticleNodes;
+    Vector<ParticleNode*>   mFreeParticleNodes;
     U32                     mActiveParticleCount;
 
 public:
@@ -99,6 +150,12 @@ public:
 
     inline U32 getActiveParticleCount( void ) const { return mActiveParticleCount; };
     inline U32 getAllocatedParticleCount( void ) const { return (U32)mParticlePool.size() * mParticlePoolBlockSize; }
+
+    /// Integration kernels.
+    static void integrateAge( ParticleBuffer& buffer, const F32 elapsedTime );
+    static void integrateMotion( ParticleBuffer& buffer, const U32 start, const U32 end, const F32 elapsedTime, const bool applyVelocity );
+    static void interpolateTick( ParticleBuffer& buffer, const F32 timeDelta );
+    static void calculateOOBB( ParticleBuffer& buffer, const U32 start, const U32 end, const F32* pPositionX, const F32* pPositionY, const Vector2* pLocalAABB );
 };
 
 #endif // _PARTICLE_SYSTEM_H_
@@ -73,6 +73,42 @@ void SpriteBase::integrateObject( const F32 totalTime, const F32 elapsedTime, De
 
 //------------------------------------------------------------------------------
 
+void SpriteBase::saveIntegrationState( Vector<U8>& state ) const
+{
+    // Call Parent.
+    Parent::saveIntegrationState( state );
+
+    // Animation.
+    saveIntegrationValue( state, mLastFrameIndex );
+    saveIntegrationValue( state, mCurrentFrameIndex );
+    saveIntegrationValue( state, mCurrentTime );
+    saveIntegrationValue( state, mCurrentModTime );
+    saveIntegrationValue( state, mTotalIntegrationTime );
+    saveIntegrationValue( state, mFrameIntegrationTime );
+    saveIntegrationValue( state, mAnimationFinished );
+}
+
+//------------------------------------------------------------------------------
+
+const U8* SpriteBase::restoreIntegrationState( const U8* pState )
+{
+    // Call Parent.
+    pState = Parent::restoreIntegrationState( pState );
+
+    // Animation.
+    pState = restoreIntegrationValue( pState, mLastFrameIndex );
+    pState = restoreIntegrationValue( pState, mCurrentFrameIndex );
+    pState = restoreIntegrationValue( pState, mCurrentTime );
+    pState = restoreIntegrationValue( pState, mCurrentModTime );
+    pState = restoreIntegrationValue( pState, mTotalIntegrationTime );
+    pState = restoreIntegrationValue( pState, mFrameIntegrationTime );
+    pState = restoreIntegrationValue( pState, mAnimationFinished );
+
+    return pState;
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBase::validRender( void ) const
 {
     return ImageFrameProvider::validRender();
@@ -100,5 +136,5 @@ void SpriteBase::copyTo(SimObject* object)
 void SpriteBase::onAnimationEnd( void )
 {
     // Do script callback.
-    Con::executef( this, 1, "onAnimationEnd" );
+    performCallback( "onAnimationEnd" );
 }
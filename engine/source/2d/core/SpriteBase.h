@@ -56,6 +56,9 @@ public:
 protected:
     virtual void onAnimationEnd( void );
 
+    virtual void saveIntegrationState( Vector<U8>& state ) const;
+    virtual const U8* restoreIntegrationState( const U8* pState );
+
 protected:
     static bool setImage(void* obj, const char* data)                           { DYNAMIC_VOID_CAST_TO(SpriteBase, ImageFrameProvider, obj)->setImage(data); return false; };
     static const char* getImage(void* obj, const char* data)                    { return DYNAMIC_VOID_CAST_TO(SpriteBase, ImageFrameProvider, obj)->getImage(); }
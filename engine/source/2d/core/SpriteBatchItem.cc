@@ -239,6 +239,8 @@ void SpriteBatchItem::setExplicitVertices( const Vector2* explicitVertices )
     mExplicitVerts[1] = explicitVertices[1];
     mExplicitVerts[2] = explicitVertices[2];
     mExplicitVerts[3] = explicitVertices[3];
+
+    mLocalTransformDirty = true;
 }
 
 //------------------------------------------------------------------------------
@@ -962,26 +962,17 @@ void SceneWindow::sendWindowInputEvent( StringTableEntry name, const GuiEvent& e
     }
 
 
-    // Argument Buffers.
-    char argBuffer[3][64];
-
-     // Format Event-Modifier Buffer.
-    dSprintf(argBuffer[0], 64, "%d", event.eventID);
-
-    // Format Mouse-Position Buffer.
-    dSprintf(argBuffer[1], 64, "%g %g", worldMousePoint.x, worldMousePoint.y);
-
-    // Format Mouse-Click Count Buffer.
-    dSprintf(argBuffer[2], 64, "%d", event.mouseClickCount);
+    // Arguments are the event-modifier, mouse-position and mouse-click count.
+    Con::TypedArg args[3] = { (S32)event.eventID, Con::TypedArg( worldMousePoint.x, worldMousePoint.y ), (S32)event.mouseClickCount };
 
     // Call Scripts.
-    Con::executef(this, 4, name, argBuffer[0], argBuffer[1], argBuffer[2]);
+    Con::executeTyped( this, name, 3, args );
 
     // Iterate listeners.
     for( SimSet::iterator listenerItr = mInputListeners.begin(); listenerItr != mInputListeners.end(); ++listenerItr )
     {
         // Call scripts on listener.
-        Con::executef( *listenerItr, 4, name, argBuffer[0], argBuffer[1], argBuffer[2] );
+        Con::executeTyped( *listenerItr, name, 3, args );
     }
 }
 
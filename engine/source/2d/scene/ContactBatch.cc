@@ -0,0 +1,66 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _CONTACT_BATCH_H_
+#include "2d/scene/ContactBatch.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+// Script bindings.
+#include "ContactBatch_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+IMPLEMENT_CONOBJECT(ContactBatch);
+
+//-----------------------------------------------------------------------------
+
+ContactBatch::ContactBatch()
+{
+    VECTOR_SET_ASSOCIATION( mContacts );
+}
+
+//-----------------------------------------------------------------------------
+
+S32 ContactBatch::findObjectContact( const SceneObject* pSceneObject, const S32 startIndex ) const
+{
+    // Finish if no object.
+    if ( pSceneObject == NULL )
+        return -1;
+
+    const SimObjectId sceneObjectId = pSceneObject->getId();
+    const S32 contactCount = mContacts.size();
+
+    for ( S32 index = getMax( startIndex, 0 ); index < contactCount; ++index )
+    {
+        const Contact& contact = mContacts[index];
+
+        if (    ( contact.mSceneObjectIdA == sceneObjectId && contact.mCollideA ) ||
+                ( contact.mSceneObjectIdB == sceneObjectId && contact.mCollideB ) )
+            return index;
+    }
+
+    return -1;
+}
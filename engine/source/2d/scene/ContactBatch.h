@@ -0,0 +1,91 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _CONTACT_BATCH_H_
+#define _CONTACT_BATCH_H_
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class SceneObject;
+
+//-----------------------------------------------------------------------------
+
+/// The contacts a scene gathered in a single tick when batching its contact callbacks.
+///
+/// The contacts are packed natively and are read by script using the accessor methods
+/// so a single callback can handle any number of contacts. The contents are only valid
+/// until the scene gathers the contacts for its next tick.
+class ContactBatch : public SimObject
+{
+    typedef SimObject Parent;
+
+public:
+    struct Contact
+    {
+        SimObjectId     mSceneObjectIdA;
+        SimObjectId     mSceneObjectIdB;
+        S32             mShapeIndexA;
+        S32             mShapeIndexB;
+        U32             mPointCount;
+        b2Vec2          mNormal;
+        b2Vec2          mPoints[b2_maxManifoldPoints];
+        F32             mNormalImpulses[b2_maxManifoldPoints];
+        F32             mTangentImpulses[b2_maxManifoldPoints];
+
+        /// Whether each object is allowed to collide with the other by its collision group and layer masks.
+        bool            mCollideA;
+        bool            mCollideB;
+    };
+
+    typedef Vector<Contact> typeContactVector;
+
+public:
+    ContactBatch();
+    virtual ~ContactBatch() {}
+
+    inline void             clear( void )                               { mContacts.clear(); }
+    inline void             addContact( const Contact& contact )        { mContacts.push_back( contact ); }
+
+    inline U32              getContactCount( void ) const               { return mContacts.size(); }
+    inline const Contact&   getContact( const U32 index ) const         { return mContacts[index]; }
+    inline bool             isValidContact( const S32 index ) const     { return index >= 0 && index < mContacts.size(); }
+
+    /// Finds the next contact from the start index that the scene object is allowed to collide in.
+    /// @return The contact index or -1 if there are no more.
+    S32                     findObjectContact( const SceneObject* pSceneObject, const S32 startIndex = 0 ) const;
+
+    /// Declare Console Object.
+    DECLARE_CONOBJECT( ContactBatch );
+
+private:
+    typeContactVector       mContacts;
+};
+
+#endif // _CONTACT_BATCH_H_
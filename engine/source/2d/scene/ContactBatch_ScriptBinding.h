@@ -0,0 +1,235 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleMethodGroupBeginWithDocs(ContactBatch, SimObject)
+
+/*! Gets the number of contacts in the batch.
+    @return The number of contacts in the batch.
+*/
+ConsoleMethodWithDocs(ContactBatch, getContactCount, ConsoleInt, 2, 2, ())
+{
+    return object->getContactCount();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the first scene object in a contact.
+    @param contactIndex The contact index.
+    @return The first scene object in the contact or nothing if the index is invalid.
+*/
+ConsoleMethodWithDocs(ContactBatch, getSceneObjectA, ConsoleInt, 3, 3, (contactIndex))
+{
+    const S32 contactIndex = dAtoi(argv[2]);
+
+    if ( !object->isValidContact( contactIndex ) )
+    {
+        Con::warnf( "ContactBatch::getSceneObjectA() - Invalid contact index '%d'.", contactIndex );
+        return 0;
+    }
+
+    return object->getContact( contactIndex ).mSceneObjectIdA;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the second scene object in a contact.
+    @param contactIndex The contact index.
+    @return The second scene object in the contact or nothing if the index is invalid.
+*/
+ConsoleMethodWithDocs(ContactBatch, getSceneObjectB, ConsoleInt, 3, 3, (contactIndex))
+{
+    const S32 contactIndex = dAtoi(argv[2]);
+
+    if ( !object->isValidContact( contactIndex ) )
+    {
+        Con::warnf( "ContactBatch::getSceneObjectB() - Invalid contact index '%d'.", contactIndex );
+        return 0;
+    }
+
+    return object->getContact( contactIndex ).mSceneObjectIdB;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the collision shape index of the first scene object in a contact.
+    @param contactIndex The contact index.
+    @return The collision shape index or -1 if the index is invalid.
+*/
+ConsoleMethodWithDocs(ContactBatch, getShapeIndexA, ConsoleInt, 3, 3, (contactIndex))
+{
+    const S32 contactIndex = dAtoi(argv[2]);
+
+    if ( !object->isValidContact( contactIndex ) )
+    {
+        Con::warnf( "ContactBatch::getShapeIndexA() - Invalid contact index '%d'.", contactIndex );
+        return -1;
+    }
+
+    return object->getContact( contactIndex ).mShapeIndexA;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the collision shape index of the second scene object in a contact.
+    @param contactIndex The contact index.
+    @return The collision shape index or -1 if the index is invalid.
+*/
+ConsoleMethodWithDocs(ContactBatch, getShapeIndexB, ConsoleInt, 3, 3, (contactIndex))
+{
+    const S32 contactIndex = dAtoi(argv[2]);
+
+    if ( !object->isValidContact( contactIndex ) )
+    {
+        Con::warnf( "ContactBatch::getShapeIndexB() - Invalid contact index '%d'.", contactIndex );
+        return -1;
+    }
+
+    return object->getContact( contactIndex ).mShapeIndexB;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of contact points in a contact.
+    Contacts that have ended have no contact points.
+    @param contactIndex The contact index.
+    @return The number of contact points (0 to 2).
+*/
+ConsoleMethodWithDocs(ContactBatch, getPointCount, ConsoleInt, 3, 3, (contactIndex))
+{
+    const S32 contactIndex = dAtoi(argv[2]);
+
+    if ( !object->isValidContact( contactIndex ) )
+    {
+        Con::warnf( "ContactBatch::getPointCount() - Invalid contact index '%d'.", contactIndex );
+        return 0;
+    }
+
+    return object->getContact( contactIndex ).mPointCount;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the world normal of a contact.
+    @param contactIndex The contact index.
+    @return The world normal of the contact.
+*/
+ConsoleMethodWithDocs(ContactBatch, getNormal, ConsoleString, 3, 3, (contactIndex))
+{
+    const S32 contactIndex = dAtoi(argv[2]);
+
+    if ( !object->isValidContact( contactIndex ) )
+    {
+        Con::warnf( "ContactBatch::getNormal() - Invalid contact index '%d'.", contactIndex );
+        return Vector2::getZero().scriptThis();
+    }
+
+    return Vector2( object->getContact( contactIndex ).mNormal ).scriptThis();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets a world contact point of a contact.
+    @param contactIndex The contact index.
+    @param pointIndex The contact point index.
+    @return The world contact point.
+*/
+ConsoleMethodWithDocs(ContactBatch, getPoint, ConsoleString, 4, 4, (contactIndex, pointIndex))
+{
+    const S32 contactIndex = dAtoi(argv[2]);
+    const S32 pointIndex = dAtoi(argv[3]);
+
+    if ( !object->isValidContact( contactIndex ) || pointIndex < 0 || pointIndex >= (S32)object->getContact( contactIndex ).mPointCount )
+    {
+        Con::warnf( "ContactBatch::getPoint() - Invalid contact index '%d' or point index '%d'.", contactIndex, pointIndex );
+        return Vector2::getZero().scriptThis();
+    }
+
+    return Vector2( object->getContact( contactIndex ).mPoints[pointIndex] ).scriptThis();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the normal impulse at a contact point of a contact.
+    @param contactIndex The contact index.
+    @param pointIndex The contact point index.
+    @return The normal impulse at the contact point.
+*/
+ConsoleMethodWithDocs(ContactBatch, getNormalImpulse, ConsoleFloat, 4, 4, (contactIndex, pointIndex))
+{
+    const S32 contactIndex = dAtoi(argv[2]);
+    const S32 pointIndex = dAtoi(argv[3]);
+
+    if ( !object->isValidContact( contactIndex ) || pointIndex < 0 || pointIndex >= (S32)object->getContact( contactIndex ).mPointCount )
+    {
+        Con::warnf( "ContactBatch::getNormalImpulse() - Invalid contact index '%d' or point index '%d'.", contactIndex, pointIndex );
+        return 0.0f;
+    }
+
+    return object->getContact( contactIndex ).mNormalImpulses[pointIndex];
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the tangent impulse at a contact point of a contact.
+    @param contactIndex The contact index.
+    @param pointIndex The contact point index.
+    @return The tangent impulse at the contact point.
+*/
+ConsoleMethodWithDocs(ContactBatch, getTangentImpulse, ConsoleFloat, 4, 4, (contactIndex, pointIndex))
+{
+    const S32 contactIndex = dAtoi(argv[2]);
+    const S32 pointIndex = dAtoi(argv[3]);
+
+    if ( !object->isValidContact( contactIndex ) || pointIndex < 0 || pointIndex >= (S32)object->getContact( contactIndex ).mPointCount )
+    {
+        Con::warnf( "ContactBatch::getTangentImpulse() - Invalid contact index '%d' or point index '%d'.", contactIndex, pointIndex );
+        return 0.0f;
+    }
+
+    return object->getContact( contactIndex ).mTangentImpulses[pointIndex];
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Finds the next contact that a scene object is allowed to collide in by its collision group and layer masks.
+    This filters the batch for an object without script iterating all the contacts, for example:
+    @code
+    for ( %index = %contacts.findObjectContact( %object ); %index != -1; %index = %contacts.findObjectContact( %object, %index + 1 ) ) { ... }
+    @endcode
+    @param sceneObject The scene object to find contacts for.
+    @param startIndex The contact index to start searching from (optional, defaults to zero).
+    @return The contact index or -1 if there are no more contacts.
+*/
+ConsoleMethodWithDocs(ContactBatch, findObjectContact, ConsoleInt, 3, 4, (sceneObject, [startIndex]))
+{
+    SceneObject* pSceneObject = Sim::findObject<SceneObject>( argv[2] );
+
+    if ( pSceneObject == NULL )
+    {
+        Con::warnf( "ContactBatch::findObjectContact() - Could not find scene object '%s'.", argv[2] );
+        return -1;
+    }
+
+    return object->findObjectContact( pSceneObject, argc > 3 ? dAtoi(argv[3]) : 0 );
+}
+
+ConsoleMethodGroupEndWithDocs(ContactBatch)
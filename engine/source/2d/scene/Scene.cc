@@ -56,12 +56,23 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+#ifndef _CRC_H_
+#include "algorithm/crc.h"
+#endif
+
 // Script bindings.
 #include "Scene_ScriptBinding.h"
 
 // Debug Profiling.
 #include "debug/profiler.h"
 
+// Frame telemetry.
+#include "debug/telemetry.h"
+
 //------------------------------------------------------------------------------
 
 SimObjectPtr<Scene> Scene::LoadingScene = NULL;
@@ -74,6 +85,19 @@ static ContactFilter mContactFilter;
 static U32 sSceneCount = 0;
 static U32 sSceneMasterIndex = 0;
 
+// Frame telemetry, the world counts are from the last scene ticked and the render counts are totals.
+static TelemetryCounter sTelemetryBodyCount( "bodyCount", TelemetryCounter::Gauge );
+static TelemetryCounter sTelemetryContactCount( "contactCount", TelemetryCounter::Gauge );
+static TelemetryCounter sTelemetryObjectsCount( "objectsCount", TelemetryCounter::Gauge );
+static TelemetryCounter sTelemetryParticlesUsed( "particlesUsed", TelemetryCounter::Gauge );
+static TelemetryCounter sTelemetryWorldStep( "worldStep", TelemetryCounter::Gauge );
+static TelemetryCounter sTelemetryRenderRequests( "renderRequests" );
+static TelemetryCounter sTelemetryBatchTriangles( "batchTriangles" );
+static TelemetryCounter sTelemetryBatchDrawCalls( "batchDrawCalls" );
+static TelemetryCounter sTelemetryBatchFlushes( "batchFlushes" );
+static TelemetryCounter sTelemetryBatchTextureChangeFlushes( "batchTextureChangeFlushes" );
+static TelemetryCounter sTelemetryBatchBufferFullFlushes( "batchBufferFullFlushes" );
+
 // Joint custom node names.
 static StringTableEntry jointCustomNodeName               = StringTable->insert( "Joints" );
 static StringTableEntry jointCollideConnectedName         = StringTable->insert( "CollideConnected" );
@@ -153,6 +177,13 @@ Scene::Scene() :
     mVelocityIterations(8),
     mPositionIterations(3),
 
+    /// Parallel integration.
+    mParallelIntegration(false),
+    mParallelIntegrationActive(false),
+    mIntegrationChecksumEnabled(false),
+    mIntegrationChecksum(0),
+    mIntegrationMismatchCount(0),
+
     /// Joint access.
     mJointMasterId(1),
 
@@ -164,6 +195,9 @@ Scene::Scene() :
     mDebugMask(0X00000000),
     mpDebugSceneObject(NULL),
 
+    /// Layer sorting.
+    mIncrementalLayerSorting(false),
+
     /// Window rendering.
     mpCurrentRenderWindow(NULL),
     
@@ -171,10 +205,14 @@ Scene::Scene() :
     mIsEditorScene(0),
     mUpdateCallback(false),
     mRenderCallback(false),
-    mSceneIndex(0)
+    mSceneIndex(0),
+
+    /// Batched contact callbacks.
+    mBatchContactCallbacks(false)
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mSceneObjects );
+    VECTOR_SET_ASSOCIATION( mParallelTickedSceneObjects );
     VECTOR_SET_ASSOCIATION( mDeleteRequests );
     VECTOR_SET_ASSOCIATION( mDeleteRequestsTemp );
     VECTOR_SET_ASSOCIATION( mEndContacts );
@@ -204,6 +242,12 @@ Scene::~Scene()
     if ( mControllers.notNull() )
         mControllers->deleteObject();
 
+    // Delete the contact batches.
+    if ( mBeginContactBatch.notNull() )
+        mBeginContactBatch->deleteObject();
+    if ( mEndContactBatch.notNull() )
+        mEndContactBatch->deleteObject();
+
     // Decrease scene count.
     --sSceneCount;
 }
@@ -320,6 +364,13 @@ void Scene::initPersistFields()
     // Callbacks.
     addField("UpdateCallback", TypeBool, Offset(mUpdateCallback, Scene), &writeUpdateCallback, "");
     addField("RenderCallback", TypeBool, Offset(mRenderCallback, Scene), &writeRenderCallback, "");
+    addField("BatchContactCallbacks", TypeBool, Offset(mBatchContactCallbacks, Scene), &writeBatchContactCallbacks, "Whether the contacts of each tick are passed to a single scene callback as a ContactBatch or not.");
+
+    // Parallel integration.
+    addField("ParallelIntegration", TypeBool, Offset(mParallelIntegration, Scene), &writeParallelIntegration, "Whether parallel-safe scene objects are integrated across the worker thread pool or not.");
+
+    // Layer sorting.
+    addField("IncrementalLayerSorting", TypeBool, Offset(mIncrementalLayerSorting, Scene), &writeIncrementalLayerSorting, "Whether layers are sorted starting from their order in the previous frame or not.");
 }
 
 //-----------------------------------------------------------------------------
@@ -446,6 +497,87 @@ void Scene::forwardContacts( void )
 
 //-----------------------------------------------------------------------------
 
+/// The miscellaneous information passed to collision callbacks.  It is only formatted
+/// if a callback takes it and then only once for all the callbacks of a contact.
+struct ContactCallbackInfo
+{
+    ContactCallbackInfo( const TickContact& tickContact, const S32 shapeIndexA, const S32 shapeIndexB, const U32 pointCount ) :
+        mTickContact( tickContact ),
+        mShapeIndexA( shapeIndexA ),
+        mShapeIndexB( shapeIndexB ),
+        mPointCount( pointCount ),
+        mFormatted( false )
+    {
+    }
+
+    const char* getString( void )
+    {
+        // Finish if already formatted.
+        if ( mFormatted )
+            return mBuffer;
+
+        mFormatted = true;
+
+        // Fetch normal and contact points.
+        const b2Vec2& normal = mTickContact.mWorldManifold.normal;
+        const b2Vec2& point1 = mTickContact.mWorldManifold.points[0];
+        const b2Vec2& point2 = mTickContact.mWorldManifold.points[1];
+
+        // Fetch collision impulse information
+        const F32 normalImpulse1 = mTickContact.mNormalImpulses[0];
+        const F32 normalImpulse2 = mTickContact.mNormalImpulses[1];
+        const F32 tangentImpulse1 = mTickContact.mTangentImpulses[0];
+        const F32 tangentImpulse2 = mTickContact.mTangentImpulses[1];
+
+        // Format miscellaneous information.
+        if ( mPointCount == 2 )
+        {
+            dSprintf(mBuffer, sizeof(mBuffer),
+                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+                mShapeIndexA, mShapeIndexB,
+                normal.x, normal.y,
+                point1.x, point1.y,
+                normalImpulse1,
+                tangentImpulse1,
+                point2.x, point2.y,
+                normalImpulse2,
+                tangentImpulse2 );
+        }
+        else if ( mPointCount == 1 )
+        {
+            dSprintf(mBuffer, sizeof(mBuffer),
+                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+                mShapeIndexA, mShapeIndexB,
+                normal.x, normal.y,
+                point1.x, point1.y,
+                normalImpulse1,
+                tangentImpulse1 );
+        }
+        else
+        {
+            dSprintf(mBuffer, sizeof(mBuffer),
+                "%d %d",
+                mShapeIndexA, mShapeIndexB );
+        }
+
+        return mBuffer;
+    }
+
+    static const char* format( const void* pData, char* pBuffer, const U32 bufferSize )
+    {
+        return ((ContactCallbackInfo*)pData)->getString();
+    }
+
+    const TickContact&  mTickContact;
+    const S32           mShapeIndexA;
+    const S32           mShapeIndexB;
+    const U32           mPointCount;
+    char                mBuffer[128];
+    bool                mFormatted;
+};
+
+//-----------------------------------------------------------------------------
+
 void Scene::dispatchBeginContactCallbacks( void )
 {
     // Debug Profiling.
@@ -461,6 +593,19 @@ void Scene::dispatchBeginContactCallbacks( void )
     if ( contactCount == 0 )
         return;
 
+    // Are we batching contact callbacks?
+    if ( mBatchContactCallbacks )
+    {
+        // Yes, so batch all contacts.
+        ContactBatch* pContactBatch = resetContactBatch( mBeginContactBatch );
+        for ( typeContactHash::iterator contactItr = mBeginContacts.begin(); contactItr != mBeginContacts.end(); ++contactItr )
+            batchContact( pContactBatch, contactItr->value );
+
+        // Perform a single callback for the batch.
+        dispatchContactBatch( pContactBatch, "onSceneCollision" );
+        return;
+    }
+
     // Iterate all contacts.
     for ( typeContactHash::iterator contactItr = mBeginContacts.begin(); contactItr != mBeginContacts.end(); ++contactItr )
     {
@@ -479,11 +624,7 @@ void Scene::dispatchBeginContactCallbacks( void )
         if ( !pSceneObjectA->getCollisionCallback() && !pSceneObjectB->getCollisionCallback() )
             continue;
 
-        // Fetch normal and contact points.
-        const U32& pointCount = tickContact.mPointCount;
-        const b2Vec2& normal = tickContact.mWorldManifold.normal;
-        const b2Vec2& point1 = tickContact.mWorldManifold.points[0];
-        const b2Vec2& point2 = tickContact.mWorldManifold.points[1];
+        // Fetch shape index.
         const S32 shapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
         const S32 shapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
 
@@ -491,64 +632,26 @@ void Scene::dispatchBeginContactCallbacks( void )
         AssertFatal( shapeIndexA >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
         AssertFatal( shapeIndexB >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
 
-        // Fetch collision impulse information
-        const F32 normalImpulse1 = tickContact.mNormalImpulses[0];
-        const F32 normalImpulse2 = tickContact.mNormalImpulses[1];
-        const F32 tangentImpulse1 = tickContact.mTangentImpulses[0];
-        const F32 tangentImpulse2 = tickContact.mTangentImpulses[1];
-
-        // Format objects.
-        char sceneObjectABuffer[16];
-        char sceneObjectBBuffer[16];
-        dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", pSceneObjectA->getId() );
-        dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", pSceneObjectB->getId() );
+        // Fetch objects.
+        const char* sceneObjectABuffer = pSceneObjectA->getIdString();
+        const char* sceneObjectBBuffer = pSceneObjectB->getIdString();
 
-        // Format miscellaneous information.
-        char miscInfoBuffer[128];
-        if ( pointCount == 2 )
-        {
-            dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
-                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-                shapeIndexA, shapeIndexB,
-                normal.x, normal.y,
-                point1.x, point1.y,
-                normalImpulse1,
-                tangentImpulse1,
-                point2.x, point2.y,
-                normalImpulse2,
-                tangentImpulse2 );
-        }
-        else if ( pointCount == 1 )
-        {
-            dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
-                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-                shapeIndexA, shapeIndexB,
-                normal.x, normal.y,
-                point1.x, point1.y,
-                normalImpulse1,
-                tangentImpulse1 );
-        }
-        else
-        {
-            dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
-                "%d %d",
-                shapeIndexA, shapeIndexB );
-        }
+        // Miscellaneous information.
+        ContactCallbackInfo miscInfo( tickContact, shapeIndexA, shapeIndexB, tickContact.mPointCount );
+        const Con::TypedArg miscInfoArg( &ContactCallbackInfo::format, &miscInfo );
 
         // Does the scene handle the collision callback?
         Namespace* pNamespace = getNamespace();
         if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneCollision" ) ) != NULL )
         {
             // Yes, so perform script callback on the Scene.
-            Con::executef( this, 4, "onSceneCollision",
-                sceneObjectABuffer,
-                sceneObjectBBuffer,
-                miscInfoBuffer );
+            Con::TypedArg args[3] = { pSceneObjectA, pSceneObjectB, miscInfoArg };
+            Con::executeTyped( this, "onSceneCollision", 3, args );
         }
         else
         {
             // No, so call it on its behaviors.
-            const char* args[5] = { "onSceneCollision", "", sceneObjectABuffer, sceneObjectBBuffer, miscInfoBuffer };
+            const char* args[5] = { "onSceneCollision", "", sceneObjectABuffer, sceneObjectBBuffer, miscInfo.getString() };
             callOnBehaviors( 5, args );
         }
 
@@ -560,14 +663,13 @@ void Scene::dispatchBeginContactCallbacks( void )
             if ( pSceneObjectA->isMethod("onCollision") )            
             {
                 // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectA, 3, "onCollision",
-                    sceneObjectBBuffer,
-                    miscInfoBuffer );
+                Con::TypedArg args[2] = { pSceneObjectB, miscInfoArg };
+                Con::executeTyped( pSceneObjectA, "onCollision", 2, args );
             }
             else
             {
                 // No, so call it on its behaviors.
-                const char* args[4] = { "onCollision", "", sceneObjectBBuffer, miscInfoBuffer };
+                const char* args[4] = { "onCollision", "", sceneObjectBBuffer, miscInfo.getString() };
                 pSceneObjectA->callOnBehaviors( 4, args );
             }
         }
@@ -580,14 +682,13 @@ void Scene::dispatchBeginContactCallbacks( void )
             if ( pSceneObjectB->isMethod("onCollision") )            
             {
                 // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectB, 3, "onCollision",
-                    sceneObjectABuffer,
-                    miscInfoBuffer );
+                Con::TypedArg args[2] = { pSceneObjectA, miscInfoArg };
+                Con::executeTyped( pSceneObjectB, "onCollision", 2, args );
             }
             else
             {
                 // No, so call it on its behaviors.
-                const char* args[4] = { "onCollision", "", sceneObjectABuffer, miscInfoBuffer };
+                const char* args[4] = { "onCollision", "", sceneObjectABuffer, miscInfo.getString() };
                 pSceneObjectB->callOnBehaviors( 4, args );
             }
         }
@@ -611,6 +712,19 @@ void Scene::dispatchEndContactCallbacks( void )
     if ( contactCount == 0 )
         return;
 
+    // Are we batching contact callbacks?
+    if ( mBatchContactCallbacks )
+    {
+        // Yes, so batch all contacts.
+        ContactBatch* pContactBatch = resetContactBatch( mEndContactBatch );
+        for ( typeContactVector::iterator contactItr = mEndContacts.begin(); contactItr != mEndContacts.end(); ++contactItr )
+            batchContact( pContactBatch, *contactItr );
+
+        // Perform a single callback for the batch.
+        dispatchContactBatch( pContactBatch, "onSceneEndCollision" );
+        return;
+    }
+
     // Iterate all contacts.
     for ( typeContactVector::iterator contactItr = mEndContacts.begin(); contactItr != mEndContacts.end(); ++contactItr )
     {
@@ -637,30 +751,26 @@ void Scene::dispatchEndContactCallbacks( void )
         AssertFatal( shapeIndexA >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
         AssertFatal( shapeIndexB >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
 
-        // Format objects.
-        char sceneObjectABuffer[16];
-        char sceneObjectBBuffer[16];
-        dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", pSceneObjectA->getId() );
-        dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", pSceneObjectB->getId() );
+        // Fetch objects.
+        const char* sceneObjectABuffer = pSceneObjectA->getIdString();
+        const char* sceneObjectBBuffer = pSceneObjectB->getIdString();
 
-        // Format miscellaneous information.
-        char miscInfoBuffer[32];
-        dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer), "%d %d", shapeIndexA, shapeIndexB );
+        // Miscellaneous information.
+        ContactCallbackInfo miscInfo( tickContact, shapeIndexA, shapeIndexB, 0 );
+        const Con::TypedArg miscInfoArg( &ContactCallbackInfo::format, &miscInfo );
 
         // Does the scene handle the collision callback?
         Namespace* pNamespace = getNamespace();
         if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneEndCollision" ) ) != NULL )
         {
             // Yes, so does the scene handle the collision callback?
-            Con::executef( this, 4, "onSceneEndCollision",
-                sceneObjectABuffer,
-                sceneObjectBBuffer,
-                miscInfoBuffer );
+            Con::TypedArg args[3] = { pSceneObjectA, pSceneObjectB, miscInfoArg };
+            Con::executeTyped( this, "onSceneEndCollision", 3, args );
         }
         else
         {
             // No, so call it on its behaviors.
-            const char* args[5] = { "onSceneEndCollision", "", sceneObjectABuffer, sceneObjectBBuffer, miscInfoBuffer };
+            const char* args[5] = { "onSceneEndCollision", "", sceneObjectABuffer, sceneObjectBBuffer, miscInfo.getString() };
             callOnBehaviors( 5, args );
         }
 
@@ -672,14 +782,13 @@ void Scene::dispatchEndContactCallbacks( void )
             if ( pSceneObjectA->isMethod("onEndCollision") )            
             {
                 // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectA, 3, "onEndCollision",
-                    sceneObjectBBuffer,
-                    miscInfoBuffer );
+                Con::TypedArg args[2] = { pSceneObjectB, miscInfoArg };
+                Con::executeTyped( pSceneObjectA, "onEndCollision", 2, args );
             }
             else
             {
                 // No, so call it on its behaviors.
-                const char* args[4] = { "onEndCollision", "", sceneObjectBBuffer, miscInfoBuffer };
+                const char* args[4] = { "onEndCollision", "", sceneObjectBBuffer, miscInfo.getString() };
                 pSceneObjectA->callOnBehaviors( 4, args );
             }
         }
@@ -692,14 +801,13 @@ void Scene::dispatchEndContactCallbacks( void )
             if ( pSceneObjectB->isMethod("onEndCollision") )            
             {
                 // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectB, 3, "onEndCollision",
-                    sceneObjectABuffer,
-                    miscInfoBuffer );
+                Con::TypedArg args[2] = { pSceneObjectA, miscInfoArg };
+                Con::executeTyped( pSceneObjectB, "onEndCollision", 2, args );
             }
             else
             {
                 // No, so call it on its behaviors.
-                const char* args[4] = { "onEndCollision", "", sceneObjectABuffer, miscInfoBuffer };
+                const char* args[4] = { "onEndCollision", "", sceneObjectABuffer, miscInfo.getString() };
                 pSceneObjectB->callOnBehaviors( 4, args );
             }
         }
@@ -708,6 +816,92 @@ void Scene::dispatchEndContactCallbacks( void )
 
 //-----------------------------------------------------------------------------
 
+void Scene::batchContact( ContactBatch* pContactBatch, const TickContact& tickContact )
+{
+    // Fetch scene objects.
+    SceneObject* pSceneObjectA = tickContact.mpSceneObjectA;
+    SceneObject* pSceneObjectB = tickContact.mpSceneObjectB;
+
+    // Skip if either object is being deleted.
+    if ( pSceneObjectA->isBeingDeleted() || pSceneObjectB->isBeingDeleted() )
+        return;
+
+    // Skip if both objects don't have collision callback active.
+    if ( !pSceneObjectA->getCollisionCallback() && !pSceneObjectB->getCollisionCallback() )
+        return;
+
+    ContactBatch::Contact contact;
+    contact.mSceneObjectIdA = pSceneObjectA->getId();
+    contact.mSceneObjectIdB = pSceneObjectB->getId();
+    contact.mShapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
+    contact.mShapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
+
+    // Sanity!
+    AssertFatal( contact.mShapeIndexA >= 0, "Scene::batchContact() - Cannot find shape index reported on physics proxy of a fixture." );
+    AssertFatal( contact.mShapeIndexB >= 0, "Scene::batchContact() - Cannot find shape index reported on physics proxy of a fixture." );
+
+    // Copy normal, contact points and impulses.
+    contact.mPointCount = tickContact.mPointCount;
+    contact.mNormal = contact.mPointCount > 0 ? tickContact.mWorldManifold.normal : b2Vec2_zero;
+    for ( U32 n = 0; n < b2_maxManifoldPoints; ++n )
+    {
+        const bool validPoint = n < contact.mPointCount;
+        contact.mPoints[n] = validPoint ? tickContact.mWorldManifold.points[n] : b2Vec2_zero;
+        contact.mNormalImpulses[n] = validPoint ? tickContact.mNormalImpulses[n] : 0.0f;
+        contact.mTangentImpulses[n] = validPoint ? tickContact.mTangentImpulses[n] : 0.0f;
+    }
+
+    // Filter whether each object is allowed to collide with the other.
+    contact.mCollideA = (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
+                        (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0;
+    contact.mCollideB = (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
+                        (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0;
+
+    pContactBatch->addContact( contact );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::dispatchContactBatch( ContactBatch* pContactBatch, const char* pCallbackName )
+{
+    // Finish if no contacts were batched.
+    if ( pContactBatch->getContactCount() == 0 )
+        return;
+
+    // Does the scene handle the collision callback?
+    Namespace* pNamespace = getNamespace();
+    if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( pCallbackName ) ) != NULL )
+    {
+        // Yes, so perform script callback on the Scene.
+        Con::TypedArg arg( pContactBatch );
+        Con::executeTyped( this, pCallbackName, 1, &arg );
+    }
+    else
+    {
+        // No, so call it on its behaviors.
+        const char* args[3] = { pCallbackName, "", pContactBatch->getIdString() };
+        callOnBehaviors( 3, args );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+ContactBatch* Scene::resetContactBatch( SimObjectPtr<ContactBatch>& contactBatch )
+{
+    // Create the contact batch if needed.
+    if ( contactBatch.isNull() )
+    {
+        contactBatch = new ContactBatch();
+        contactBatch->registerObject();
+    }
+
+    contactBatch->clear();
+
+    return contactBatch;
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::processTick( void )
 {
     // Debug Profiling.
@@ -735,6 +929,13 @@ void Scene::processTick( void )
     mDebugStats.particlesUsed = ParticleSystem::Instance->getActiveParticleCount();
     mDebugStats.particlesFree = mDebugStats.particlesAlloc - mDebugStats.particlesUsed;
 
+    // Update frame telemetry.
+    sTelemetryBodyCount.set( (F32)mDebugStats.bodyCount );
+    sTelemetryContactCount.set( (F32)mDebugStats.contactCount );
+    sTelemetryObjectsCount.set( (F32)mDebugStats.objectsCount );
+    sTelemetryParticlesUsed.set( (F32)mDebugStats.particlesUsed );
+    sTelemetryWorldStep.set( mDebugStats.worldProfile.step );
+
     // Finish if scene is paused.
     if ( !getScenePause() )
     {
@@ -790,20 +991,29 @@ void Scene::processTick( void )
         // Fetch ticked scene object count.
         const S32 tickedSceneObjectCount = mTickedSceneObjects.size();
 
-        // ****************************************************
-        // Pre-integrate objects.
-        // ****************************************************
+        // Fetch whether we're integrating in parallel this tick.
+        const bool parallelIntegration = mParallelIntegration;
 
-        // Iterate ticked scene objects.
-        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
+        // Are we integrating in parallel?
+        if ( parallelIntegration )
         {
-            // Debug Profiling.
-            PROFILE_SCOPE(Scene_PreIntegrate);
+            // Yes, so gather the ticked scene objects that can be integrated on worker threads.
+            mParallelTickedSceneObjects.clear();
+            for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
+            {
+                SceneObject* pSceneObject = mTickedSceneObjects[i];
 
-            // Pre-integrate.
-            mTickedSceneObjects[i]->preIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
+                if ( pSceneObject->getParallelIntegrationSafe() )
+                    mParallelTickedSceneObjects.push_back( pSceneObject );
+            }
         }
 
+        // ****************************************************
+        // Pre-integrate objects.
+        // ****************************************************
+
+        integrateSceneObjects( INTEGRATION_STAGE_PRE, parallelIntegration, pDebugStats );
+
         // ****************************************************
         // Integrate controllers.
         // ****************************************************
@@ -859,29 +1069,17 @@ void Scene::processTick( void )
         // Integrate objects.
         // ****************************************************
 
-        // Iterate ticked scene objects.
-        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
-        {
-            // Debug Profiling.
-            PROFILE_SCOPE(Scene_IntegrateObject);
-
-            // Integrate.
-            mTickedSceneObjects[i]->integrateObject( mSceneTime, Tickable::smTickSec, pDebugStats );
-        }
+        integrateSceneObjects( INTEGRATION_STAGE_INTEGRATE, parallelIntegration, pDebugStats );
 
         // ****************************************************
         // Post-Integrate Stage.
         // ****************************************************
 
-        // Iterate ticked scene objects.
-        for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
-        {
-            // Debug Profiling.
-            PROFILE_SCOPE(Scene_PostIntegrate);
+        integrateSceneObjects( INTEGRATION_STAGE_POST, parallelIntegration, pDebugStats );
 
-            // Post-integrate.
-            mTickedSceneObjects[i]->postIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
-        }
+        // Update the integration checksum if enabled.
+        if ( mIntegrationChecksumEnabled )
+            updateIntegrationChecksum();
 
         // Scene update callback.
         if( mUpdateCallback )
@@ -902,6 +1100,7 @@ void Scene::processTick( void )
 
         // Clear ticked scene objects.
         mTickedSceneObjects.clear();
+        mParallelTickedSceneObjects.clear();
     }
 
     // Update debug stat ranges.
@@ -910,6 +1109,225 @@ void Scene::processTick( void )
 
 //-----------------------------------------------------------------------------
 
+struct SceneIntegrationJob
+{
+    SceneObject**   mpSceneObjects;
+    U32             mStage;
+    F32             mSceneTime;
+    DebugStats*     mpDebugStats;
+};
+
+//-----------------------------------------------------------------------------
+
+void Scene::integrateSceneObjectRange( void* pContext, const U32 start, const U32 end )
+{
+    // Fetch job.
+    const SceneIntegrationJob* pJob = static_cast<const SceneIntegrationJob*>( pContext );
+
+    // Iterate the scene object range.
+    for ( U32 i = start; i < end; ++i )
+    {
+        SceneObject* pSceneObject = pJob->mpSceneObjects[i];
+
+        switch( pJob->mStage )
+        {
+            case INTEGRATION_STAGE_PRE:
+                pSceneObject->preIntegrate( pJob->mSceneTime, Tickable::smTickSec, pJob->mpDebugStats );
+                break;
+
+            case INTEGRATION_STAGE_INTEGRATE:
+                pSceneObject->integrateObject( pJob->mSceneTime, Tickable::smTickSec, pJob->mpDebugStats );
+                break;
+
+            case INTEGRATION_STAGE_POST:
+                pSceneObject->postIntegrate( pJob->mSceneTime, Tickable::smTickSec, pJob->mpDebugStats );
+                break;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::integrateSceneObjects( const IntegrationStage stage, const bool parallel, DebugStats* pDebugStats )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_IntegrateSceneObjects);
+
+    // Configure the integration job.
+    SceneIntegrationJob job;
+    job.mStage = stage;
+    job.mSceneTime = mSceneTime;
+    job.mpDebugStats = pDebugStats;
+
+    // Are we integrating in parallel?
+    if ( !parallel )
+    {
+        // No, so integrate all the ticked scene objects in order.
+        job.mpSceneObjects = mTickedSceneObjects.address();
+        integrateSceneObjectRange( &job, 0, mTickedSceneObjects.size() );
+        return;
+    }
+
+    // Yes, so integrate the parallel-safe scene objects across the thread pool.
+    // Any work that cannot be done off the main thread is deferred by the objects until the drain below.
+    if ( mParallelTickedSceneObjects.size() > 0 )
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_IntegrateParallel);
+
+        job.mpSceneObjects = mParallelTickedSceneObjects.address();
+
+        // Are we checking determinism?
+        if ( mIntegrationChecksumEnabled )
+        {
+            // Yes, so integrate serially as well and compare.
+            checkParallelIntegration( job );
+        }
+        else
+        {
+            // No, so just integrate in parallel.
+            mParallelIntegrationActive = true;
+            ThreadPool::getGlobalThreadPool()->parallelFor( mParallelTickedSceneObjects.size(), 64, &integrateSceneObjectRange, &job );
+            mParallelIntegrationActive = false;
+        }
+    }
+
+    // Integrate the remaining scene objects on the main thread and drain the deferred work, both in ticked order.
+    // NOTE: This keeps the order of the callbacks the same as serial integration however the parallel-safe objects
+    // have all been integrated for this stage before any callback in the stage is performed so a callback that
+    // changes another parallel-safe object only affects it in the next stage.
+    {
+        // Debug Profiling.
+        PROFILE_SCOPE(Scene_IntegrateSerial);
+
+        job.mpSceneObjects = mTickedSceneObjects.address();
+        const U32 tickedSceneObjectCount = mTickedSceneObjects.size();
+        for ( U32 i = 0; i < tickedSceneObjectCount; ++i )
+        {
+            SceneObject* pSceneObject = mTickedSceneObjects[i];
+
+            if ( pSceneObject->getParallelIntegrationSafe() )
+                pSceneObject->processDeferredIntegration();
+            else
+                integrateSceneObjectRange( &job, i, i+1 );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::checkParallelIntegration( SceneIntegrationJob& job )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_CheckParallelIntegration);
+
+    // Fetch the parallel-safe scene object count.
+    const U32 objectCount = mParallelTickedSceneObjects.size();
+
+    // Save the state before the stage.
+    Vector<U8> initialState;
+    Vector<U32> initialOffsets;
+    saveIntegrationStates( initialState, initialOffsets );
+
+    // Integrate serially on the main thread.
+    // The objects still defer as they would on the worker threads so only the scheduling differs.
+    mParallelIntegrationActive = true;
+    integrateSceneObjectRange( &job, 0, objectCount );
+
+    // Save the serial results.
+    Vector<U8> serialState;
+    Vector<U32> serialOffsets;
+    saveIntegrationStates( serialState, serialOffsets );
+
+    // Restore the state before the stage.
+    for ( U32 i = 0; i < objectCount; ++i )
+    {
+        mParallelTickedSceneObjects[i]->restoreIntegrationState( initialState.address() + initialOffsets[i] );
+    }
+
+    // Integrate in parallel.
+    ThreadPool::getGlobalThreadPool()->parallelFor( objectCount, 64, &integrateSceneObjectRange, &job );
+    mParallelIntegrationActive = false;
+
+    // Save the parallel results.
+    Vector<U8> parallelState;
+    Vector<U32> parallelOffsets;
+    saveIntegrationStates( parallelState, parallelOffsets );
+
+    // Compare the results for each object.
+    for ( U32 i = 0; i < objectCount; ++i )
+    {
+        const U32 serialSize = serialOffsets[i+1] - serialOffsets[i];
+        const U32 parallelSize = parallelOffsets[i+1] - parallelOffsets[i];
+
+        // Skip if the results match.
+        if ( serialSize == parallelSize && dMemcmp( serialState.address() + serialOffsets[i], parallelState.address() + parallelOffsets[i], serialSize ) == 0 )
+            continue;
+
+        // Warn on the first mismatch only.
+        if ( mIntegrationMismatchCount++ == 0 )
+        {
+            SceneObject* pSceneObject = mParallelTickedSceneObjects[i];
+            Con::warnf( "Scene::checkParallelIntegration() - Parallel integration of object Id %d (%s) does not match serial integration at scene time %g.",
+                pSceneObject->getId(), pSceneObject->getClassName(), mSceneTime );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::saveIntegrationStates( Vector<U8>& state, Vector<U32>& offsets ) const
+{
+    // Save the state of each parallel-safe scene object noting where each one starts.
+    // The final offset is the end of the state.
+    const U32 objectCount = mParallelTickedSceneObjects.size();
+    offsets.setSize( objectCount + 1 );
+    for ( U32 i = 0; i < objectCount; ++i )
+    {
+        offsets[i] = state.size();
+        mParallelTickedSceneObjects[i]->saveIntegrationState( state );
+    }
+    offsets[objectCount] = state.size();
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::updateIntegrationChecksum( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Scene_UpdateIntegrationChecksum);
+
+    // Accumulate the integration state of the ticked objects into the checksum.
+    // The checksum depends only upon the results so identical scenes ticked serially
+    // and in parallel must produce the same value.
+    U32 checksum = mIntegrationChecksum;
+    for ( S32 i = 0; i < mTickedSceneObjects.size(); ++i )
+    {
+        SceneObject* pSceneObject = mTickedSceneObjects[i];
+
+        // Skip if being deleted.
+        if ( pSceneObject->isBeingDeleted() )
+            continue;
+
+        const b2Vec2 position = pSceneObject->getPosition();
+        const F32 angle = pSceneObject->getAngle();
+        const b2AABB aabb = pSceneObject->getAABB();
+        const F32 lifetime = pSceneObject->getLifetime();
+        const SimObjectId objectId = pSceneObject->getId();
+
+        checksum = calculateCRC( &objectId, sizeof(objectId), checksum );
+        checksum = calculateCRC( &position, sizeof(position), checksum );
+        checksum = calculateCRC( &angle, sizeof(angle), checksum );
+        checksum = calculateCRC( &aabb, sizeof(aabb), checksum );
+        checksum = calculateCRC( &lifetime, sizeof(lifetime), checksum );
+        checksum = calculateCRC( pSceneObject->mRenderOOBB, sizeof(pSceneObject->mRenderOOBB), checksum );
+    }
+
+    mIntegrationChecksum = checksum;
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::interpolateTick( F32 timeDelta )
 {
     // Finish if scene is paused.
@@ -1089,8 +1507,8 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
                     // Set render queue mode.
                     pSceneRenderQueue->setSortMode( mode );
 
-                    // Sort the render requests.
-                    pSceneRenderQueue->sort();
+                    // Sort the render requests, reusing the previous order if incremental.
+                    pSceneRenderQueue->sort( mIncrementalLayerSorting ? &mLayerSortHistories[layer] : NULL );
                 }
 
                 // Iterate render requests.
@@ -1260,6 +1678,14 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     // Update debug stat ranges.
     mDebugStats.updateRanges();
 
+    // Update frame telemetry.
+    sTelemetryRenderRequests.add( (F32)pDebugStats->renderRequests );
+    sTelemetryBatchTriangles.add( (F32)pDebugStats->batchTrianglesSubmitted );
+    sTelemetryBatchDrawCalls.add( (F32)(pDebugStats->batchDrawCallsStrict + pDebugStats->batchDrawCallsSorted) );
+    sTelemetryBatchFlushes.add( (F32)pDebugStats->batchFlushes );
+    sTelemetryBatchTextureChangeFlushes.add( (F32)pDebugStats->batchTextureChangeFlush );
+    sTelemetryBatchBufferFullFlushes.add( (F32)pDebugStats->batchBufferFullFlush );
+
     // Are we using the render callback?
     if( mRenderCallback )
     {
@@ -1335,6 +1761,9 @@ void Scene::addToScene( SceneObject* pSceneObject )
     // Add scene object.
     mSceneObjects.push_back( pSceneObject );
 
+    // Add to the scene layer.
+    addToSceneLayer( pSceneObject );
+
     // Register with the scene.
     pSceneObject->OnRegisterScene( this );
 
@@ -1393,6 +1822,9 @@ void Scene::removeFromScene( SceneObject* pSceneObject )
         }
     }
 
+    // Remove from the scene layer.
+    removeFromSceneLayer( pSceneObject );
+
     // Perform callback.
     Con::executef( pSceneObject, 2, "onRemoveFromScene", getIdString() );
 }
@@ -1425,31 +1857,93 @@ U32 Scene::getSceneObjects( typeSceneObjectVector& objects ) const
 
 U32 Scene::getSceneObjects( typeSceneObjectVector& objects, const U32 sceneLayer ) const
 {
-    // No objects if scene is empty!
-    if ( getSceneObjectCount() == 0 )
+    // No objects if invalid layer.
+    if ( sceneLayer >= MAX_LAYERS_SUPPORTED )
         return 0;
 
-    // Reset object count.
-    U32 count = 0;
+    // Fetch layer objects.
+    typeSceneObjectVectorConstRef layerObjects = mSceneLayerObjects[sceneLayer];
 
-    // Iterate scene objects.
-    for( S32 n = 0; n < mSceneObjects.size(); ++n )
-    {
-        // Fetch scene object.
-        SceneObject* pSceneObject = mSceneObjects[n];
+    // No objects if layer is empty!
+    if ( layerObjects.size() == 0 )
+        return 0;
 
-        // Skip if not the correct layer.
-        if ( pSceneObject->getSceneLayer() != sceneLayer )
-            continue;
+    // Merge with objects.
+    objects.merge( layerObjects );
 
-        // Add to objects.
-        objects.push_back( pSceneObject );
+    return (U32)layerObjects.size();
+}
+
+//-----------------------------------------------------------------------------
 
-        // Increase count.
-        count++;
+S32 Scene::findSceneLayerInsertIndex( typeSceneObjectVectorConstRef layerObjects, SceneObject* pSceneObject )
+{
+    // Binary search for the first object that is not behind the object.
+    S32 low = 0;
+    S32 high = layerObjects.size();
+    while ( low < high )
+    {
+        const S32 mid = (low + high) >> 1;
+
+        if ( SceneObject::sceneObjectLayerDepthSort( &layerObjects[mid], &pSceneObject ) < 0 )
+            low = mid + 1;
+        else
+            high = mid;
     }
 
-    return count;
+    return low;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 Scene::findSceneLayerIndex( SceneObject* pSceneObject ) const
+{
+    // Sanity!
+    AssertFatal( pSceneObject != NULL, "Scene::findSceneLayerIndex() - Invalid scene object." );
+
+    // Fetch layer objects.
+    typeSceneObjectVectorConstRef layerObjects = mSceneLayerObjects[pSceneObject->getSceneLayer()];
+
+    // Find the object.
+    const S32 index = findSceneLayerInsertIndex( layerObjects, pSceneObject );
+
+    // Finish if the object isn't in the layer.
+    if ( index == layerObjects.size() || layerObjects[index] != pSceneObject )
+        return -1;
+
+    return index;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::addToSceneLayer( SceneObject* pSceneObject )
+{
+    // Fetch layer objects.
+    typeSceneObjectVector& layerObjects = mSceneLayerObjects[pSceneObject->getSceneLayer()];
+
+    // Insert the object in depth order.
+    const S32 index = findSceneLayerInsertIndex( layerObjects, pSceneObject );
+
+    // Sanity!
+    AssertFatal( index == layerObjects.size() || layerObjects[index] != pSceneObject, "Scene::addToSceneLayer() - Object is already in the layer." );
+
+    layerObjects.insert( index );
+    layerObjects[index] = pSceneObject;
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::removeFromSceneLayer( SceneObject* pSceneObject )
+{
+    // Find the object.
+    const S32 index = findSceneLayerIndex( pSceneObject );
+
+    // Sanity!
+    AssertFatal( index != -1, "Scene::removeFromSceneLayer() - Object is not in the layer." );
+
+    // Remove the object.
+    if ( index != -1 )
+        mSceneLayerObjects[pSceneObject->getSceneLayer()].erase( index );
 }
 
 //-----------------------------------------------------------------------------
@@ -3573,6 +4067,22 @@ void Scene::setLayerSortMode( const U32 layer, const SceneRenderQueue::RenderSor
 
 //-----------------------------------------------------------------------------
 
+void Scene::setIncrementalLayerSorting( const bool enabled )
+{
+    // Set incremental layer sorting.
+    mIncrementalLayerSorting = enabled;
+
+    // Finish if enabled.
+    if ( enabled )
+        return;
+
+    // Discard the layer sort histories.
+    for ( U32 layer = 0; layer < MAX_LAYERS_SUPPORTED; ++layer )
+        mLayerSortHistories[layer].clear();
+}
+
+//-----------------------------------------------------------------------------
+
 SceneRenderQueue::RenderSort Scene::getLayerSortMode( const U32 layer )
 {
     // Is the layer valid?
@@ -47,6 +47,10 @@
 #include "2d/scene/WorldQuery.h"
 #endif
 
+#ifndef _CONTACT_BATCH_H_
+#include "2d/scene/ContactBatch.h"
+#endif
+
 #ifndef _DEBUG_DRAW_H_
 #include "2d/scene/DebugDraw.h"
 #endif
@@ -83,6 +87,7 @@ extern EnumTable jointTypeTable;
 
 class SceneObject;
 class SceneWindow;
+struct SceneIntegrationJob;
 
 ///-----------------------------------------------------------------------------
 
@@ -223,6 +228,17 @@ private:
     typeSceneObjectVector       mSceneObjects;
     typeSceneObjectVector       mTickedSceneObjects;
 
+    /// Scene layer occupancy, each sorted back to front by layer depth.
+    typeSceneObjectVector       mSceneLayerObjects[MAX_LAYERS_SUPPORTED];
+
+    /// Parallel integration.
+    bool                        mParallelIntegration;
+    bool                        mParallelIntegrationActive;
+    bool                        mIntegrationChecksumEnabled;
+    U32                         mIntegrationChecksum;
+    U32                         mIntegrationMismatchCount;
+    typeSceneObjectVector       mParallelTickedSceneObjects;
+
     /// Joint access.
     typeJointHash               mJoints;
     typeReverseJointHash        mReverseJoints;
@@ -245,6 +261,8 @@ private:
 
     /// Layer sorting and draw order.
     SceneRenderQueue::RenderSort mLayerSortModes[MAX_LAYERS_SUPPORTED];
+    bool                        mIncrementalLayerSorting;
+    SceneRenderQueue::SortHistory mLayerSortHistories[MAX_LAYERS_SUPPORTED];
 
     /// Batch rendering.
     BatchRender                 mBatchRenderer;
@@ -267,11 +285,37 @@ private:
     typeContactVector           mEndContacts;
     U32                         mSceneIndex;
 
+    /// Batched contact callbacks.
+    bool                        mBatchContactCallbacks;
+    SimObjectPtr<ContactBatch>  mBeginContactBatch;
+    SimObjectPtr<ContactBatch>  mEndContactBatch;
+
 private:   
+    /// Integration stages.
+    enum IntegrationStage
+    {
+        INTEGRATION_STAGE_PRE,
+        INTEGRATION_STAGE_INTEGRATE,
+        INTEGRATION_STAGE_POST,
+    };
+
+    /// Integration.
+    void                        integrateSceneObjects( const IntegrationStage stage, const bool parallel, DebugStats* pDebugStats );
+    static void                 integrateSceneObjectRange( void* pContext, const U32 start, const U32 end );
+    void                        checkParallelIntegration( SceneIntegrationJob& job );
+    void                        saveIntegrationStates( Vector<U8>& state, Vector<U32>& offsets ) const;
+    void                        updateIntegrationChecksum( void );
+
+    /// Scene layer occupancy.
+    static S32                  findSceneLayerInsertIndex( typeSceneObjectVectorConstRef layerObjects, SceneObject* pSceneObject );
+
     /// Contacts.
     void                        forwardContacts( void );
     void                        dispatchBeginContactCallbacks( void );
     void                        dispatchEndContactCallbacks( void );
+    void                        batchContact( ContactBatch* pContactBatch, const TickContact& tickContact );
+    void                        dispatchContactBatch( ContactBatch* pContactBatch, const char* pCallbackName );
+    static ContactBatch*        resetContactBatch( SimObjectPtr<ContactBatch>& contactBatch );
 
     /// Joint definition.
     struct CommonJointDefinition
@@ -318,12 +362,27 @@ public:
     virtual void            EndContact( b2Contact* pContact );
     const typeContactHash&  getBeginContacts( void ) const              { return mBeginContacts; }
     const typeContactVector& getEndContacts( void ) const               { return mEndContacts; }
+    inline void             setBatchContactCallbacks( const bool enabled ) { mBatchContactCallbacks = enabled; }
+    inline bool             getBatchContactCallbacks( void ) const      { return mBatchContactCallbacks; }
 
     /// Integration.
     virtual void            processTick();
     virtual void            interpolateTick( F32 delta );
     virtual void            advanceTime( F32 timeDelta ) {};
 
+    /// Parallel integration.
+    inline void             setParallelIntegration( const bool enabled ) { mParallelIntegration = enabled; }
+    inline bool             getParallelIntegration( void ) const        { return mParallelIntegration; }
+    inline bool             getParallelIntegrationActive( void ) const  { return mParallelIntegrationActive; }
+    inline void             setIntegrationChecksumEnabled( const bool enabled ) { mIntegrationChecksumEnabled = enabled; mIntegrationChecksum = 0; mIntegrationMismatchCount = 0; }
+    inline bool             getIntegrationChecksumEnabled( void ) const { return mIntegrationChecksumEnabled; }
+    inline U32              getIntegrationChecksum( void ) const        { return mIntegrationChecksum; }
+    inline U32              getIntegrationMismatchCount( void ) const   { return mIntegrationMismatchCount; }
+
+    /// Layer sorting.
+    void                    setIncrementalLayerSorting( const bool enabled );
+    inline bool             getIncrementalLayerSorting( void ) const    { return mIncrementalLayerSorting; }
+
     /// Render output.
     void                    sceneRender( const SceneRenderState* pSceneRenderState );
 
@@ -351,6 +410,12 @@ public:
     U32                     getSceneObjects( typeSceneObjectVector& objects ) const;
     U32                     getSceneObjects( typeSceneObjectVector& objects, const U32 sceneLayer ) const;
 
+    /// Scene layer occupancy.
+    inline typeSceneObjectVectorConstRef getSceneLayerObjects( const U32 sceneLayer ) const { return mSceneLayerObjects[sceneLayer]; }
+    S32                     findSceneLayerIndex( SceneObject* pSceneObject ) const;
+    void                    addToSceneLayer( SceneObject* pSceneObject );
+    void                    removeFromSceneLayer( SceneObject* pSceneObject );
+
     void                    mergeScene( const Scene* pScene );
 
     inline SimSet*			getControllers( void )						{ return mControllers; }
@@ -656,6 +721,8 @@ public:
     /// Miscellaneous.
     inline void             setBatchingEnabled( const bool enabled )    { mBatchRenderer.setBatchEnabled( enabled ); }
     inline bool             getBatchingEnabled( void ) const            { return mBatchRenderer.getBatchEnabled(); }
+    inline void             setBatchNullRender( const bool nullRender ) { mBatchRenderer.setNullRender( nullRender ); }
+    inline bool             getBatchNullRender( void ) const            { return mBatchRenderer.getNullRender(); }
     inline bool             getIsEditorScene( void ) const              { return ((mIsEditorScene > 0) ? true : false); }
     inline void             setIsEditorScene( bool status )             { mIsEditorScene += (status ? 1 : -1); }
     static U32              getGlobalSceneCount( void );
@@ -722,6 +789,13 @@ protected:
     // Callbacks.
     static bool writeUpdateCallback( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getUpdateCallback(); }
     static bool writeRenderCallback( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getRenderCallback(); }
+    static bool writeBatchContactCallbacks( void* obj, StringTableEntry pFieldName ) { return static_cast<Scene*>(obj)->getBatchContactCallbacks(); }
+
+    // Parallel integration.
+    static bool writeParallelIntegration( void* obj, StringTableEntry pFieldName )  { return static_cast<Scene*>(obj)->getParallelIntegration(); }
+
+    // Layer sorting.
+    static bool writeIncrementalLayerSorting( void* obj, StringTableEntry pFieldName ) { return static_cast<Scene*>(obj)->getIncrementalLayerSorting(); }
 
 public:
     static SimObjectPtr<Scene> LoadingScene;
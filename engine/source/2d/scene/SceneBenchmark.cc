@@ -0,0 +1,836 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_BENCHMARK_H_
+#include "2d/scene/SceneBenchmark.h"
+#endif
+
+#ifndef _SCENE_RENDER_STATE_H_
+#include "2d/scene/SceneRenderState.h"
+#endif
+
+#ifndef _SPRITE_H_
+#include "2d/sceneobject/Sprite.h"
+#endif
+
+#ifndef _COMPOSITE_SPRITE_H_
+#include "2d/sceneobject/CompositeSprite.h"
+#endif
+
+#ifndef _PARTICLE_PLAYER_H_
+#include "2d/sceneobject/ParticlePlayer.h"
+#endif
+
+#ifndef _MODULE_MANAGER_H
+#include "module/moduleManager.h"
+#endif
+
+#ifndef _ASSET_MANAGER_H_
+#include "assets/assetManager.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _FRAMEALLOCATOR_H_
+#include "memory/frameAllocator.h"
+#endif
+
+#ifndef _TICKABLE_H_
+#include "platform/Tickable.h"
+#endif
+
+#ifndef _PROFILER_H_
+#include "debug/profiler.h"
+#endif
+
+/// RapidJson.
+#include "rapidjson/document.h"
+#include "rapidjson/prettywriter.h"
+
+// Script bindings.
+#include "SceneBenchmark_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+// Engine library initialization (see "game/defaultGame.cc").
+extern bool initializeLibraries();
+extern void shutdownLibraries();
+
+//-----------------------------------------------------------------------------
+
+static U32 readConfigurationUnsigned( const rapidjson::Value& configuration, const char* pName, const U32 defaultValue )
+{
+    // Use the default if the member is not present.
+    if ( !configuration.HasMember( pName ) )
+        return defaultValue;
+
+    // Fetch member.
+    const rapidjson::Value& member = configuration[pName];
+
+    // Is the member a number?
+    if ( !member.IsNumber() )
+    {
+        // No, so warn.
+        Con::warnf( "SceneBenchmark - Configuration member '%s' should be a number.", pName );
+        return defaultValue;
+    }
+
+    const F64 value = member.GetDouble();
+    return value > 0.0 ? (U32)value : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+static bool readConfigurationBool( const rapidjson::Value& configuration, const char* pName, const bool defaultValue )
+{
+    // Use the default if the member is not present.
+    if ( !configuration.HasMember( pName ) )
+        return defaultValue;
+
+    // Fetch member.
+    const rapidjson::Value& member = configuration[pName];
+
+    // Is the member a boolean?
+    if ( !member.IsBool() )
+    {
+        // No, so warn.
+        Con::warnf( "SceneBenchmark - Configuration member '%s' should be a boolean.", pName );
+        return defaultValue;
+    }
+
+    return member.GetBool();
+}
+
+//-----------------------------------------------------------------------------
+
+static StringTableEntry readConfigurationString( const rapidjson::Value& configuration, const char* pName, StringTableEntry defaultValue )
+{
+    // Use the default if the member is not present.
+    if ( !configuration.HasMember( pName ) )
+        return defaultValue;
+
+    // Fetch member.
+    const rapidjson::Value& member = configuration[pName];
+
+    // Is the member a string?
+    if ( !member.IsString() )
+    {
+        // No, so warn.
+        Con::warnf( "SceneBenchmark - Configuration member '%s' should be a string.", pName );
+        return defaultValue;
+    }
+
+    return StringTable->insert( member.GetString() );
+}
+
+//-----------------------------------------------------------------------------
+
+static bool readConfigurationNumbers( const rapidjson::Value& configuration, const char* pName, F32* pValues, const U32 valueCount )
+{
+    // Finish if the member is not present.
+    if ( !configuration.HasMember( pName ) )
+        return false;
+
+    // Fetch member.
+    const rapidjson::Value& member = configuration[pName];
+
+    // Is the member an array of the expected size?
+    if ( !member.IsArray() || member.Size() != valueCount )
+    {
+        // No, so warn.
+        Con::warnf( "SceneBenchmark - Configuration member '%s' should be an array of %d numbers.", pName, valueCount );
+        return false;
+    }
+
+    // Check the elements are numbers.
+    for ( U32 index = 0; index < valueCount; ++index )
+    {
+        if ( !member[(rapidjson::SizeType)index].IsNumber() )
+        {
+            // Warn.
+            Con::warnf( "SceneBenchmark - Configuration member '%s' should be an array of %d numbers.", pName, valueCount );
+            return false;
+        }
+    }
+
+    // Fetch the elements.
+    for ( U32 index = 0; index < valueCount; ++index )
+        pValues[index] = (F32)member[(rapidjson::SizeType)index].GetDouble();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+#ifdef TORQUE_ENABLE_PROFILER
+
+struct MarkerSample
+{
+    ProfilerRootData*   mpRoot;
+    F64                 mTotalTime;
+    F64                 mSubTime;
+    U32                 mInvokeCount;
+};
+
+//-----------------------------------------------------------------------------
+
+static void sampleMarkers( Vector<MarkerSample>& samples )
+{
+    samples.clear();
+
+    // Sample all the profiler markers.
+    for( ProfilerRootData* pRoot = ProfilerRootData::sRootList; pRoot != NULL; pRoot = pRoot->mNextRoot )
+    {
+        MarkerSample sample;
+        sample.mpRoot = pRoot;
+        sample.mTotalTime = pRoot->mTotalTime;
+        sample.mSubTime = pRoot->mSubTime;
+        sample.mInvokeCount = pRoot->mTotalInvokeCount;
+        samples.push_back( sample );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static const MarkerSample* findMarkerSample( const Vector<MarkerSample>& samples, const ProfilerRootData* pRoot )
+{
+    for( Vector<MarkerSample>::const_iterator sampleItr = samples.begin(); sampleItr != samples.end(); ++sampleItr )
+    {
+        if ( sampleItr->mpRoot == pRoot )
+            return sampleItr;
+    }
+
+    return NULL;
+}
+
+#endif // TORQUE_ENABLE_PROFILER
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK markerResultTotalTimeSort( const void* a, const void* b )
+{
+    // Fetch marker results.
+    const SceneBenchmark::MarkerResult* pMarkerA = (const SceneBenchmark::MarkerResult*)a;
+    const SceneBenchmark::MarkerResult* pMarkerB = (const SceneBenchmark::MarkerResult*)b;
+
+    // Sort by descending total time.
+    if ( pMarkerA->mTotalTime > pMarkerB->mTotalTime )
+        return -1;
+
+    if ( pMarkerA->mTotalTime < pMarkerB->mTotalTime )
+        return 1;
+
+    return dStrcmp( pMarkerA->mName, pMarkerB->mName );
+}
+
+//-----------------------------------------------------------------------------
+
+SceneBenchmark::Configuration::Configuration() :
+    mName( StringTable->insert("SceneBenchmark") ),
+    mSeed( 1 ),
+    mWarmupFrames( 60 ),
+    mFrames( 600 ),
+    mArea( -50.0f, -37.5f, 100.0f, 75.0f ),
+    mGravity( 0.0f, -9.8f ),
+    mParallelIntegration( false ),
+    mBatching( true ),
+    mModulePath( StringTable->EmptyString ),
+    mImageAssetId( StringTable->EmptyString ),
+    mParticleAssetId( StringTable->EmptyString ),
+    mSprites( 1000 ),
+    mComposites( 0 ),
+    mCompositeSprites( 100 ),
+    mParticlePlayers( 0 ),
+    mBodies( 0 ),
+    mJoints( 0 )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+SceneBenchmark::SceneBenchmark() :
+    mpScene( NULL ),
+    mElapsedTime( 0.0 ),
+    mObjectCount( 0 ),
+    mRenderRequests( 0 ),
+    mBatchDrawCalls( 0 ),
+    mBatchTriangles( 0 ),
+    mContactCount( 0 ),
+    mParticleCount( 0 )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+SceneBenchmark::~SceneBenchmark()
+{
+    // Destroy any scene.
+    destroyScene();
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneBenchmark::loadConfiguration( const char* pConfigurationFile )
+{
+    // Sanity!
+    AssertFatal( pConfigurationFile != NULL, "SceneBenchmark::loadConfiguration() - Cannot load a NULL configuration file." );
+
+    // Expand the configuration file path.
+    char filePathBuffer[1024];
+    Con::expandPath( filePathBuffer, sizeof(filePathBuffer), pConfigurationFile );
+
+    // Open the configuration file.
+    FileStream stream;
+    if ( !stream.open( filePathBuffer, FileStream::Read ) )
+    {
+        // Warn.
+        Con::warnf( "SceneBenchmark::loadConfiguration() - Could not open configuration file '%s'.", filePathBuffer );
+        return false;
+    }
+
+    // Read the configuration file.
+    const U32 streamSize = stream.getStreamSize();
+    FrameTemp<char> jsonText( streamSize + 1 );
+    if ( !stream.read( streamSize, jsonText ) )
+    {
+        // Warn.
+        Con::warnf( "SceneBenchmark::loadConfiguration() - Could not read configuration file '%s'.", filePathBuffer );
+        return false;
+    }
+    ((char*)jsonText)[streamSize] = 0;
+    stream.close();
+
+    // Parse the configuration.
+    rapidjson::Document document;
+    document.Parse<0>( jsonText );
+
+    // Check the document is valid.
+    if ( document.HasParseError() || !document.IsObject() )
+    {
+        // Warn.
+        Con::warnf( "SceneBenchmark::loadConfiguration() - Configuration file '%s' is not a valid JSON object.", filePathBuffer );
+        return false;
+    }
+
+    Configuration configuration;
+
+    // Run.
+    configuration.mName = readConfigurationString( document, "name", configuration.mName );
+    configuration.mSeed = (S32)readConfigurationUnsigned( document, "seed", configuration.mSeed );
+    configuration.mWarmupFrames = readConfigurationUnsigned( document, "warmupFrames", configuration.mWarmupFrames );
+    configuration.mFrames = getMax( readConfigurationUnsigned( document, "frames", configuration.mFrames ), (U32)1 );
+
+    // Scene.
+    F32 values[4];
+    if ( readConfigurationNumbers( document, "area", values, 4 ) )
+        configuration.mArea = RectF( values[0], values[1], values[2], values[3] );
+    if ( readConfigurationNumbers( document, "gravity", values, 2 ) )
+        configuration.mGravity.Set( values[0], values[1] );
+    configuration.mParallelIntegration = readConfigurationBool( document, "parallelIntegration", configuration.mParallelIntegration );
+    configuration.mBatching = readConfigurationBool( document, "batching", configuration.mBatching );
+
+    // Modules and assets.
+    configuration.mModulePath = readConfigurationString( document, "modulePath", configuration.mModulePath );
+    if ( document.HasMember( "modules" ) )
+    {
+        // Fetch modules.
+        const rapidjson::Value& modules = document["modules"];
+        if ( modules.IsArray() )
+        {
+            for ( rapidjson::SizeType index = 0; index < modules.Size(); ++index )
+            {
+                if ( modules[index].IsString() )
+                    configuration.mModules.push_back( StringTable->insert( modules[index].GetString() ) );
+            }
+        }
+        else
+        {
+            // Warn.
+            Con::warnf( "SceneBenchmark::loadConfiguration() - Configuration member 'modules' should be an array of module Ids." );
+        }
+    }
+    configuration.mImageAssetId = readConfigurationString( document, "image", configuration.mImageAssetId );
+    configuration.mParticleAssetId = readConfigurationString( document, "particle", configuration.mParticleAssetId );
+
+    // Population.
+    configuration.mSprites = readConfigurationUnsigned( document, "sprites", configuration.mSprites );
+    configuration.mComposites = readConfigurationUnsigned( document, "composites", configuration.mComposites );
+    configuration.mCompositeSprites = readConfigurationUnsigned( document, "compositeSprites", configuration.mCompositeSprites );
+    configuration.mParticlePlayers = readConfigurationUnsigned( document, "particlePlayers", configuration.mParticlePlayers );
+    configuration.mBodies = readConfigurationUnsigned( document, "bodies", configuration.mBodies );
+    configuration.mJoints = readConfigurationUnsigned( document, "joints", configuration.mJoints );
+
+    mConfiguration = configuration;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneBenchmark::run( void )
+{
+    // Reset the results.
+    mElapsedTime = 0.0;
+    mMarkerResults.clear();
+
+    // Create the scene.
+    if ( !createScene() )
+        return false;
+
+    // Populate the scene.
+    mRandom.setSeed( mConfiguration.mSeed );
+    populateScene();
+
+    Con::printf( "SceneBenchmark - Running '%s' with %d objects for %d frames.", mConfiguration.mName, mpScene->getSceneObjectCount(), mConfiguration.mFrames );
+
+    // Run the warm-up frames.
+    for ( U32 frame = 0; frame < mConfiguration.mWarmupFrames; ++frame )
+        processFrame();
+
+#ifdef TORQUE_ENABLE_PROFILER
+    // Sample the profiler markers before the timed frames.
+    Vector<MarkerSample> startSamples;
+    sampleMarkers( startSamples );
+#endif
+
+    // Run the timed frames.
+    const U32 startTime = Platform::getRealMilliseconds();
+    for ( U32 frame = 0; frame < mConfiguration.mFrames; ++frame )
+        processFrame();
+    mElapsedTime = (F64)(Platform::getRealMilliseconds() - startTime);
+
+    // Fetch the stats for the last frame.
+    const DebugStats& debugStats = mpScene->getDebugStats();
+    mObjectCount = mpScene->getSceneObjectCount();
+    mRenderRequests = debugStats.renderRequests;
+    mBatchDrawCalls = debugStats.batchDrawCallsStrict + debugStats.batchDrawCallsSorted;
+    mBatchTriangles = debugStats.batchTrianglesSubmitted;
+    mContactCount = debugStats.contactCount;
+    mParticleCount = debugStats.particlesUsed;
+
+#ifdef TORQUE_ENABLE_PROFILER
+    // Sample the profiler markers after the timed frames.
+    Vector<MarkerSample> endSamples;
+    sampleMarkers( endSamples );
+
+    // Find the frame marker.
+    // NOTE: The profiler measures in platform timer units so the frame marker is used to convert them to milliseconds.
+    F64 frameTime = 0.0;
+    for( Vector<MarkerSample>::iterator sampleItr = endSamples.begin(); sampleItr != endSamples.end(); ++sampleItr )
+    {
+        if ( dStrcmp( sampleItr->mpRoot->mName, "SceneBenchmark_Frame" ) != 0 )
+            continue;
+
+        const MarkerSample* pStartSample = findMarkerSample( startSamples, sampleItr->mpRoot );
+        frameTime = sampleItr->mTotalTime - (pStartSample != NULL ? pStartSample->mTotalTime : 0.0);
+        break;
+    }
+
+    // Calculate the marker results if the profiler was active.
+    if ( frameTime > 0.0 )
+    {
+        const F64 timeScale = mElapsedTime / frameTime;
+
+        for( Vector<MarkerSample>::iterator sampleItr = endSamples.begin(); sampleItr != endSamples.end(); ++sampleItr )
+        {
+            // Fetch the start sample.
+            const MarkerSample* pStartSample = findMarkerSample( startSamples, sampleItr->mpRoot );
+
+            // Calculate the marker activity during the timed frames.
+            MarkerResult markerResult;
+            markerResult.mName = StringTable->insert( sampleItr->mpRoot->mName );
+            markerResult.mInvokeCount = sampleItr->mInvokeCount - (pStartSample != NULL ? pStartSample->mInvokeCount : 0);
+            const F64 totalTime = sampleItr->mTotalTime - (pStartSample != NULL ? pStartSample->mTotalTime : 0.0);
+            const F64 subTime = sampleItr->mSubTime - (pStartSample != NULL ? pStartSample->mSubTime : 0.0);
+            markerResult.mTotalTime = totalTime * timeScale;
+            markerResult.mSelfTime = (totalTime - subTime) * timeScale;
+
+            // Skip markers that were not used.
+            if ( markerResult.mInvokeCount == 0 )
+                continue;
+
+            mMarkerResults.push_back( markerResult );
+        }
+
+        // Sort the marker results.
+        dQsort( mMarkerResults.address(), mMarkerResults.size(), sizeof(MarkerResult), markerResultTotalTimeSort );
+    }
+    else
+    {
+        // Warn.
+        Con::warnf( "SceneBenchmark::run() - The profiler was not active so no marker timings were recorded." );
+    }
+#endif
+
+    Con::printf( "SceneBenchmark - Finished '%s' in %.0fms (%.3fms per frame).", mConfiguration.mName, mElapsedTime, mElapsedTime / mConfiguration.mFrames );
+
+    // Destroy the scene.
+    destroyScene();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneBenchmark::writeResults( const char* pResultsFile ) const
+{
+    // Sanity!
+    AssertFatal( pResultsFile != NULL, "SceneBenchmark::writeResults() - Cannot write to a NULL results file." );
+
+    // Expand the results file path.
+    char filePathBuffer[1024];
+    Con::expandPath( filePathBuffer, sizeof(filePathBuffer), pResultsFile );
+
+    // Open the results file.
+    FileStream stream;
+    if ( !stream.open( filePathBuffer, FileStream::Write ) )
+    {
+        // Warn.
+        Con::warnf( "SceneBenchmark::writeResults() - Could not open results file '%s'.", filePathBuffer );
+        return false;
+    }
+
+    const F64 frameCount = (F64)mConfiguration.mFrames;
+
+    rapidjson::PrettyWriter<FileStream> writer( stream );
+    writer.StartObject();
+
+    // Run.
+    writer.String( "name" );
+    writer.String( mConfiguration.mName );
+    writer.String( "frames" );
+    writer.Uint( mConfiguration.mFrames );
+    writer.String( "tickSeconds" );
+    writer.Double( Tickable::smTickSec );
+    writer.String( "elapsedMs" );
+    writer.Double( mElapsedTime );
+    writer.String( "frameMs" );
+    writer.Double( mElapsedTime / frameCount );
+
+    // Last frame stats.
+    writer.String( "stats" );
+    writer.StartObject();
+    writer.String( "objects" );
+    writer.Uint( mObjectCount );
+    writer.String( "renderRequests" );
+    writer.Uint( mRenderRequests );
+    writer.String( "batchDrawCalls" );
+    writer.Uint( mBatchDrawCalls );
+    writer.String( "batchTriangles" );
+    writer.Uint( mBatchTriangles );
+    writer.String( "contacts" );
+    writer.Uint( mContactCount );
+    writer.String( "particles" );
+    writer.Uint( mParticleCount );
+    writer.EndObject();
+
+    // Markers.
+    writer.String( "markers" );
+    writer.StartArray();
+    for( Vector<MarkerResult>::const_iterator markerItr = mMarkerResults.begin(); markerItr != mMarkerResults.end(); ++markerItr )
+    {
+        writer.StartObject();
+        writer.String( "name" );
+        writer.String( markerItr->mName );
+        writer.String( "totalMs" );
+        writer.Double( markerItr->mTotalTime );
+        writer.String( "selfMs" );
+        writer.Double( markerItr->mSelfTime );
+        writer.String( "frameMs" );
+        writer.Double( markerItr->mTotalTime / frameCount );
+        writer.String( "calls" );
+        writer.Uint( markerItr->mInvokeCount );
+        writer.EndObject();
+    }
+    writer.EndArray();
+
+    writer.EndObject();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 SceneBenchmark::runHeadless( S32 argc, const char** argv )
+{
+    // Check the arguments.
+    if ( argc < 3 )
+    {
+        dPrintf( "Usage: %s <configuration.json> <results.json>\n", argc > 0 ? argv[0] : "Torque2DBenchmark" );
+        return 1;
+    }
+
+    // Initialize the engine libraries.
+    if ( !initializeLibraries() )
+        return 1;
+
+    // Register the module and asset databases.
+    ModuleDatabase.registerObject( "ModuleDatabase" );
+    AssetDatabase.registerObject( "AssetDatabase" );
+    ModuleDatabase.addListener( &AssetDatabase );
+
+    // Use the current directory for resources.
+    ResourceManager->setWriteablePath( Platform::getCurrentDirectory() );
+    ResourceManager->addPath( Platform::getCurrentDirectory() );
+
+#ifdef TORQUE_ENABLE_PROFILER
+    // Enable the profiler.
+    // NOTE: This takes effect after the first warm-up frame.
+    if ( gProfiler != NULL )
+        gProfiler->enable( true );
+#endif
+
+    // Run the benchmark.
+    bool success = false;
+    {
+        SceneBenchmark sceneBenchmark;
+        success = sceneBenchmark.loadConfiguration( argv[1] ) && sceneBenchmark.run() && sceneBenchmark.writeResults( argv[2] );
+    }
+
+    // Unregister the module and asset databases.
+    ModuleDatabase.unregisterObject();
+    AssetDatabase.unregisterObject();
+
+    // Shutdown the engine libraries.
+    shutdownLibraries();
+
+    return success ? 0 : 1;
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneBenchmark::createScene( void )
+{
+    // Destroy any existing scene.
+    destroyScene();
+
+    // Scan for modules.
+    if ( mConfiguration.mModulePath != StringTable->EmptyString )
+    {
+        char modulePathBuffer[1024];
+        Con::expandPath( modulePathBuffer, sizeof(modulePathBuffer), mConfiguration.mModulePath );
+        ModuleDatabase.scanModules( modulePathBuffer );
+    }
+
+    // Load the modules.
+    for( Vector<StringTableEntry>::iterator moduleItr = mConfiguration.mModules.begin(); moduleItr != mConfiguration.mModules.end(); ++moduleItr )
+    {
+        if ( !ModuleDatabase.loadModuleExplicit( *moduleItr ) )
+        {
+            // Warn.
+            Con::warnf( "SceneBenchmark::createScene() - Could not load module '%s'.", *moduleItr );
+            destroyScene();
+            return false;
+        }
+
+        mLoadedModules.push_back( *moduleItr );
+    }
+
+    // Create the scene.
+    mpScene = new Scene();
+    if ( !mpScene->registerObject() )
+    {
+        // Warn.
+        Con::warnf( "SceneBenchmark::createScene() - Could not register the scene." );
+        delete mpScene;
+        mpScene = NULL;
+        destroyScene();
+        return false;
+    }
+
+    // Configure the scene.
+    mpScene->setGravity( mConfiguration.mGravity );
+    mpScene->setParallelIntegration( mConfiguration.mParallelIntegration );
+    mpScene->setBatchingEnabled( mConfiguration.mBatching );
+
+    // Render to the null sink.
+    mpScene->setBatchNullRender( true );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneBenchmark::destroyScene( void )
+{
+    // Delete the scene.
+    if ( mpScene != NULL )
+    {
+        mpScene->deleteObject();
+        mpScene = NULL;
+    }
+
+    mBodies.clear();
+
+    // Unload the modules.
+    for( Vector<StringTableEntry>::iterator moduleItr = mLoadedModules.begin(); moduleItr != mLoadedModules.end(); ++moduleItr )
+        ModuleDatabase.unloadModuleExplicit( *moduleItr );
+
+    mLoadedModules.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneBenchmark::populateScene( void )
+{
+    // Sanity!
+    AssertFatal( mpScene != NULL, "SceneBenchmark::populateScene() - No scene available." );
+
+    const bool useImage = mConfiguration.mImageAssetId != StringTable->EmptyString;
+
+    // Sprites.
+    for ( U32 index = 0; index < mConfiguration.mSprites; ++index )
+    {
+        Sprite* pSprite = static_cast<Sprite*>( mpScene->create( "Sprite" ) );
+        pSprite->setPosition( getRandomPosition() );
+        pSprite->setSize( Vector2( mRandom.randRangeF( 1.0f, 3.0f ), mRandom.randRangeF( 1.0f, 3.0f ) ) );
+        pSprite->setSceneLayer( mRandom.randI() % MAX_LAYERS_SUPPORTED );
+        pSprite->setCollisionSuppress( true );
+        pSprite->setGravityScale( 0.0f );
+        pSprite->setLinearVelocity( Vector2( mRandom.randRangeF( -2.0f, 2.0f ), mRandom.randRangeF( -2.0f, 2.0f ) ) );
+        pSprite->setAngularVelocity( mRandom.randRangeF( -1.0f, 1.0f ) );
+        if ( useImage )
+            pSprite->ImageFrameProvider::setImage( mConfiguration.mImageAssetId, (U32)0 );
+    }
+
+    // Composite sprites.
+    const U32 compositeStride = (U32)mCeil( mSqrt( (F32)mConfiguration.mCompositeSprites ) );
+    for ( U32 index = 0; index < mConfiguration.mComposites; ++index )
+    {
+        CompositeSprite* pCompositeSprite = static_cast<CompositeSprite*>( mpScene->create( "CompositeSprite" ) );
+        pCompositeSprite->setPosition( getRandomPosition() );
+        pCompositeSprite->setSceneLayer( mRandom.randI() % MAX_LAYERS_SUPPORTED );
+        pCompositeSprite->setCollisionSuppress( true );
+        pCompositeSprite->setGravityScale( 0.0f );
+        pCompositeSprite->setAngularVelocity( mRandom.randRangeF( -1.0f, 1.0f ) );
+        pCompositeSprite->setBatchLayout( CompositeSprite::RECTILINEAR_LAYOUT );
+        pCompositeSprite->setDefaultSpriteStride( Vector2::getOne() );
+        pCompositeSprite->setDefaultSpriteSize( Vector2::getOne() );
+
+        for ( U32 spriteIndex = 0; spriteIndex < mConfiguration.mCompositeSprites; ++spriteIndex )
+        {
+            pCompositeSprite->addSprite( SpriteBatchItem::LogicalPosition( avar( "%d %d", spriteIndex % compositeStride, spriteIndex / compositeStride ) ) );
+            if ( useImage )
+                pCompositeSprite->setSpriteImage( mConfiguration.mImageAssetId, (U32)0 );
+        }
+    }
+
+    // Particle players.
+    if ( mConfiguration.mParticlePlayers > 0 && mConfiguration.mParticleAssetId == StringTable->EmptyString )
+    {
+        // Warn.
+        Con::warnf( "SceneBenchmark::populateScene() - Particle players were requested without a particle asset so none were created." );
+    }
+    else
+    {
+        for ( U32 index = 0; index < mConfiguration.mParticlePlayers; ++index )
+        {
+            ParticlePlayer* pParticlePlayer = static_cast<ParticlePlayer*>( mpScene->create( "ParticlePlayer" ) );
+            pParticlePlayer->setPosition( getRandomPosition() );
+            pParticlePlayer->setBodyType( b2_staticBody );
+            pParticlePlayer->setParticle( mConfiguration.mParticleAssetId );
+            pParticlePlayer->play( true );
+        }
+    }
+
+    // Physics bodies.
+    if ( mConfiguration.mBodies > 0 )
+    {
+        // Create a static container around the area.
+        const RectF& area = mConfiguration.mArea;
+        const b2Vec2 lowerLeft( area.point.x, area.point.y );
+        const b2Vec2 lowerRight( area.point.x + area.extent.x, area.point.y );
+        const b2Vec2 upperRight( area.point.x + area.extent.x, area.point.y + area.extent.y );
+        const b2Vec2 upperLeft( area.point.x, area.point.y + area.extent.y );
+        SceneObject* pContainer = mpScene->create( "SceneObject" );
+        pContainer->setBodyType( b2_staticBody );
+        pContainer->createEdgeCollisionShape( lowerLeft, lowerRight );
+        pContainer->createEdgeCollisionShape( lowerRight, upperRight );
+        pContainer->createEdgeCollisionShape( upperRight, upperLeft );
+        pContainer->createEdgeCollisionShape( upperLeft, lowerLeft );
+
+        for ( U32 index = 0; index < mConfiguration.mBodies; ++index )
+        {
+            const F32 bodySize = mRandom.randRangeF( 0.5f, 2.0f );
+
+            Sprite* pBody = static_cast<Sprite*>( mpScene->create( "Sprite" ) );
+            pBody->setPosition( getRandomPosition() );
+            pBody->setSize( Vector2( bodySize, bodySize ) );
+            pBody->setSceneLayer( mRandom.randI() % MAX_LAYERS_SUPPORTED );
+
+            // Alternate the collision shapes.
+            if ( (index & 1) == 0 )
+                pBody->createCircleCollisionShape( bodySize * 0.5f );
+            else
+                pBody->createPolygonBoxCollisionShape( bodySize, bodySize );
+
+            if ( useImage )
+                pBody->ImageFrameProvider::setImage( mConfiguration.mImageAssetId, (U32)0 );
+
+            mBodies.push_back( pBody );
+        }
+
+        // Join consecutive bodies.
+        const U32 jointCount = getMin( mConfiguration.mJoints, (U32)mBodies.size() - 1 );
+        for ( U32 index = 0; index < jointCount; ++index )
+            mpScene->createDistanceJoint( mBodies[index], mBodies[index+1] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneBenchmark::processFrame( void )
+{
+    // Debug Profiling.
+    PROFILE_START(SceneBenchmark_Frame);
+
+    // Tick the scene.
+    PROFILE_START(SceneBenchmark_Tick);
+    mpScene->processTick();
+    PROFILE_END();  // SceneBenchmark_Tick
+
+    // Render the scene area.
+    PROFILE_START(SceneBenchmark_Render);
+    SceneRenderState sceneRenderState(
+        mConfiguration.mArea,
+        mConfiguration.mArea.centre(),
+        0.0f,
+        MASK_ALL,
+        MASK_ALL,
+        Vector2::getOne(),
+        &mpScene->getDebugStats(),
+        NULL );
+    mpScene->sceneRender( &sceneRenderState );
+    PROFILE_END();  // SceneBenchmark_Render
+
+    PROFILE_END();  // SceneBenchmark_Frame
+}
+
+//-----------------------------------------------------------------------------
+
+Vector2 SceneBenchmark::getRandomPosition( void )
+{
+    const RectF& area = mConfiguration.mArea;
+    return Vector2( mRandom.randRangeF( area.point.x, area.point.x + area.extent.x ), mRandom.randRangeF( area.point.y, area.point.y + area.extent.y ) );
+}
@@ -0,0 +1,145 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_BENCHMARK_H_
+#define _SCENE_BENCHMARK_H_
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _MRANDOM_H_
+#include "math/mRandom.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class SceneObject;
+
+//-----------------------------------------------------------------------------
+
+/// Populates a scene from a JSON configuration then runs fixed-step ticks and
+/// renders of it, reporting the time spent in each profiler marker as JSON.
+///
+/// The configuration is an object with the following (optional) members:
+/// @code
+/// {
+///     "name": "mixed",                    // Name reported in the results.
+///     "seed": 1,                          // Seed for object placement.
+///     "warmupFrames": 60,                 // Frames run before timing starts.
+///     "frames": 600,                      // Frames timed.
+///     "area": [-50, -37.5, 100, 75],      // World area (x, y, width, height) populated and rendered.
+///     "gravity": [0, -9.8],               // Scene gravity.
+///     "parallelIntegration": false,       // Scene parallel integration.
+///     "batching": true,                   // Scene render batching.
+///     "modulePath": "modules",            // Path to scan for modules.
+///     "modules": [ "ToyAssets" ],         // Modules to load.
+///     "image": "ToyAssets:Blocks",        // Image asset used by sprites.
+///     "particle": "ToyAssets:bonfire",    // Particle asset used by particle players.
+///     "sprites": 5000,                    // Moving sprites without collision shapes.
+///     "composites": 10,                   // Composite sprites.
+///     "compositeSprites": 100,            // Sprites in each composite sprite.
+///     "particlePlayers": 10,              // Particle players.
+///     "bodies": 500,                      // Physics bodies falling within the area.
+///     "joints": 250                       // Distance joints between consecutive bodies.
+/// }
+/// @endcode
+class SceneBenchmark
+{
+public:
+    struct Configuration
+    {
+        Configuration();
+
+        StringTableEntry    mName;
+        S32                 mSeed;
+        U32                 mWarmupFrames;
+        U32                 mFrames;
+        RectF               mArea;
+        Vector2             mGravity;
+        bool                mParallelIntegration;
+        bool                mBatching;
+        StringTableEntry    mModulePath;
+        Vector<StringTableEntry> mModules;
+        StringTableEntry    mImageAssetId;
+        StringTableEntry    mParticleAssetId;
+        U32                 mSprites;
+        U32                 mComposites;
+        U32                 mCompositeSprites;
+        U32                 mParticlePlayers;
+        U32                 mBodies;
+        U32                 mJoints;
+    };
+
+    struct MarkerResult
+    {
+        StringTableEntry    mName;
+        F64                 mTotalTime;
+        F64                 mSelfTime;
+        U32                 mInvokeCount;
+    };
+
+public:
+    SceneBenchmark();
+    virtual ~SceneBenchmark();
+
+    /// Configuration.
+    bool loadConfiguration( const char* pConfigurationFile );
+    inline const Configuration& getConfiguration( void ) const { return mConfiguration; }
+
+    /// Run the benchmark.
+    bool run( void );
+
+    /// Results.
+    bool writeResults( const char* pResultsFile ) const;
+    inline F64 getElapsedTime( void ) const { return mElapsedTime; }
+    inline const Vector<MarkerResult>& getMarkerResults( void ) const { return mMarkerResults; }
+
+    /// Runs a benchmark without a window or OpenGL, returning the process exit code.
+    static S32 runHeadless( S32 argc, const char** argv );
+
+private:
+    bool createScene( void );
+    void destroyScene( void );
+    void populateScene( void );
+    void processFrame( void );
+
+    Vector2 getRandomPosition( void );
+
+private:
+    Configuration           mConfiguration;
+    RandomLCG               mRandom;
+    Scene*                  mpScene;
+    Vector<SceneObject*>    mBodies;
+    Vector<StringTableEntry> mLoadedModules;
+
+    F64                     mElapsedTime;
+    U32                     mObjectCount;
+    U32                     mRenderRequests;
+    U32                     mBatchDrawCalls;
+    U32                     mBatchTriangles;
+    U32                     mContactCount;
+    U32                     mParticleCount;
+    Vector<MarkerResult>    mMarkerResults;
+};
+
+#endif // _SCENE_BENCHMARK_H_
@@ -0,0 +1,46 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin( SceneBenchmark, "Scene benchmark functionality.");
+
+/*! Runs a deterministic scene benchmark rendering into a null batch renderer.
+    @param configurationFile The JSON file describing the scene population and the number of frames to run.
+    @param resultsFile The JSON file to write the frame timings and profiler marker timings to.
+    @return Whether the benchmark was run and the results written or not.
+*/
+ConsoleFunctionWithDocs( runSceneBenchmark, ConsoleBool, 3, 3, (configurationFile, resultsFile))
+{
+    SceneBenchmark sceneBenchmark;
+
+    // Load the configuration.
+    if ( !sceneBenchmark.loadConfiguration( argv[1] ) )
+        return false;
+
+    // Run the benchmark.
+    if ( !sceneBenchmark.run() )
+        return false;
+
+    // Write the results.
+    return sceneBenchmark.writeResults( argv[2] );
+}
+
+ConsoleFunctionGroupEnd( SceneBenchmark );
@@ -81,168 +81,472 @@ const char* SceneRenderQueue::getRenderSortDescription( const RenderSort& sortMo
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredNewFrontSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+// Requests below this count are insertion sorted.
+#define SCENE_RENDER_QUEUE_INSERTION_SORT_LIMIT     32
+
+// The number of moves per request an incremental sort may make before falling back to a full sort.
+#define SCENE_RENDER_QUEUE_INCREMENTAL_MOVE_LIMIT   4
+
+//-----------------------------------------------------------------------------
 
-    // Use serial Id,
-    return pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+static inline U32 getSerialIdSortKey( const S32 serialId )
+{
+    // Flip the sign so signed Ids sort correctly as unsigned.
+    return (U32)serialId ^ 0x80000000;
 }
-    
+
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredOldFrontSort(const void* a, const void* b)
+static inline U32 getFloatSortKey( const F32 value )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Zero sorts as positive zero.
+    if ( value == 0.0f )
+        return 0x80000000;
+
+    // Flip all the bits of negative values and the sign of positive values so the float sorts correctly as unsigned.
+    union { F32 f; U32 u; } bits;
+    bits.f = value;
+    return (bits.u & 0x80000000) ? ~bits.u : (bits.u | 0x80000000);
+}
 
-    // Use reverse serial Id,
-    return pSceneRenderRequestB->mSerialId - pSceneRenderRequestA->mSerialId;
+//-----------------------------------------------------------------------------
+
+static inline bool isSortItemBefore( const SceneRenderQueue::SortItem& itemA, const SceneRenderQueue::SortItem& itemB )
+{
+    // Use the submission order if the keys are identical.
+    return itemA.mKey < itemB.mKey || ( itemA.mKey == itemB.mKey && itemA.mIndex < itemB.mIndex );
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredDepthSort(const void* a, const void* b)
+void SceneRenderQueue::sort( SortHistory* pSortHistory )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Sort layer appropriately.
+    switch( mSortMode )
+    {
+        case RENDER_SORT_NEWEST:
+        case RENDER_SORT_OLDEST:
+        case RENDER_SORT_XAXIS:
+        case RENDER_SORT_YAXIS:
+        case RENDER_SORT_ZAXIS:
+        case RENDER_SORT_INVERSE_XAXIS:
+        case RENDER_SORT_INVERSE_YAXIS:
+        case RENDER_SORT_INVERSE_ZAXIS:
+            break;
+
+        case RENDER_SORT_BATCH:
+            {
+                // Batching means we don't need strict order.
+                mStrictOrderMode = false;
+                break;
+            }
+
+        case RENDER_SORT_GROUP:
+            {
+                // Debug Profiling.
+                PROFILE_SCOPE(SceneRenderQueue_SortGroup);
+
+                // Render groups are addresses so aren't sorted by key.
+                dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layerGroupOrderSort );
+                return;
+            }
+
+        default:
+            return;
+    };
+
+    // Finish if nothing to sort.
+    if ( mRenderRequests.size() < 2 )
+        return;
+
+    // Generate the sort keys.
+    generateSortKeys();
+
+    // Sort incrementally if we have a history.
+    if ( pSortHistory == NULL || !incrementalSort( pSortHistory ) )
+    {
+        // Use an insertion sort for a small number of requests otherwise a radix sort.
+        if ( mSortItems.size() < SCENE_RENDER_QUEUE_INSERTION_SORT_LIMIT )
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(SceneRenderQueue_SortInsertion);
+
+            insertionSort( U32_MAX );
+        }
+        else
+        {
+            radixSort();
+        }
+    }
 
-    // Fetch depths.
-    const F32 depthA = pSceneRenderRequestA->mDepth;
-    const F32 depthB = pSceneRenderRequestB->mDepth;
+    // Reorder the requests.
+    applySort();
 
-    return depthA < depthB ? 1 : depthA > depthB ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+    // Update the history.
+    if ( pSortHistory != NULL )
+        pSortHistory->update( mSortItems );
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredInverseDepthSort(const void* a, const void* b)
+void SceneRenderQueue::generateSortKeys( void )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_GenerateSortKeys);
 
-    // Fetch depths.
-    const F32 depthA = pSceneRenderRequestA->mDepth;
-    const F32 depthB = pSceneRenderRequestB->mDepth;
+    const U32 requestCount = (U32)mRenderRequests.size();
+    mSortItems.setSize( requestCount );
 
-    return depthA < depthB ? -1 : depthA > depthB ? 1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+    for ( U32 index = 0; index < requestCount; ++index )
+    {
+        // Fetch scene render request.
+        SceneRenderRequest* pSceneRenderRequest = mRenderRequests[index];
+
+        // Ties are sorted by serial Id.
+        U32 primaryKey = 0;
+        U32 secondaryKey = getSerialIdSortKey( pSceneRenderRequest->mSerialId );
+
+        switch( mSortMode )
+        {
+            case RENDER_SORT_OLDEST:
+                // Use reverse serial Id.
+                secondaryKey = ~secondaryKey;
+                break;
+
+            case RENDER_SORT_BATCH:
+                // Render isolated requests first.
+                primaryKey = pSceneRenderRequest->mpSceneRenderObject->getBatchIsolated() ? 0 : 1;
+                break;
+
+            case RENDER_SORT_XAXIS:
+                // We sort lower x values before higher values.
+                primaryKey = getFloatSortKey( pSceneRenderRequest->mWorldPosition.x + pSceneRenderRequest->mSortPoint.x );
+                break;
+
+            case RENDER_SORT_YAXIS:
+                // We sort lower y values before higher values.
+                primaryKey = getFloatSortKey( pSceneRenderRequest->mWorldPosition.y + pSceneRenderRequest->mSortPoint.y );
+                break;
+
+            case RENDER_SORT_ZAXIS:
+                // We sort higher depths before lower depths.
+                primaryKey = ~getFloatSortKey( pSceneRenderRequest->mDepth );
+                break;
+
+            case RENDER_SORT_INVERSE_XAXIS:
+                // We sort higher x values before lower values.
+                primaryKey = ~getFloatSortKey( pSceneRenderRequest->mWorldPosition.x + pSceneRenderRequest->mSortPoint.x );
+                break;
+
+            case RENDER_SORT_INVERSE_YAXIS:
+                // We sort higher y values before lower values.
+                primaryKey = ~getFloatSortKey( pSceneRenderRequest->mWorldPosition.y + pSceneRenderRequest->mSortPoint.y );
+                break;
+
+            case RENDER_SORT_INVERSE_ZAXIS:
+                // We sort lower depths before higher depths.
+                primaryKey = getFloatSortKey( pSceneRenderRequest->mDepth );
+                break;
+
+            default:
+                break;
+        }
+
+        SortItem& item = mSortItems[index];
+        item.mKey = ((U64)primaryKey << 32) | (U64)secondaryKey;
+        item.mpRenderRequest = pSceneRenderRequest;
+        item.mIndex = index;
+        item.mRank = 0;
+    }
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layerBatchOrderSort(const void* a, const void* b)
+void SceneRenderQueue::radixSort( void )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    // Fetch scene render objects.
-    SceneRenderObject* pSceneRenderObjectA = pSceneRenderRequestA->mpSceneRenderObject;
-    SceneRenderObject* pSceneRenderObjectB = pSceneRenderRequestB->mpSceneRenderObject;
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_SortRadix);
 
-    // Fetch batch render isolation.
-    const bool renderIsolatedA = pSceneRenderObjectA->getBatchIsolated();
-    const bool renderIsolatedB = pSceneRenderObjectB->getBatchIsolated();
+    const U32 itemCount = (U32)mSortItems.size();
 
-    // A not render isolated?
-    if ( !renderIsolatedA )
+    // Count every key byte in a single pass.
+    U32 byteCounts[8][256];
+    dMemset( byteCounts, 0, sizeof(byteCounts) );
+    for ( U32 index = 0; index < itemCount; ++index )
     {
-        // Use the serial Id if neither are render isolated.
-        if ( !renderIsolatedB )
-            return pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+        const U64 key = mSortItems[index].mKey;
+        for ( U32 byteIndex = 0; byteIndex < 8; ++byteIndex )
+            byteCounts[byteIndex][(key >> (byteIndex * 8)) & 0xFF]++;
+    }
+
+    mSortItemsTemp.setSize( itemCount );
+    SortItem* pSource = mSortItems.address();
+    SortItem* pDestination = mSortItemsTemp.address();
 
-        // A not render isolated but B is.
-        return 1;
+    // Sort on each key byte, least significant first.  Each pass is stable so ties keep their submission order.
+    for ( U32 byteIndex = 0; byteIndex < 8; ++byteIndex )
+    {
+        U32* pCounts = byteCounts[byteIndex];
+        const U32 shift = byteIndex * 8;
+
+        // Skip the byte if it's the same for every key.
+        if ( pCounts[(pSource[0].mKey >> shift) & 0xFF] == itemCount )
+            continue;
+
+        // Convert the counts to offsets.
+        U32 offset = 0;
+        for ( U32 byteValue = 0; byteValue < 256; ++byteValue )
+        {
+            const U32 count = pCounts[byteValue];
+            pCounts[byteValue] = offset;
+            offset += count;
+        }
+
+        // Scatter the items.
+        for ( U32 index = 0; index < itemCount; ++index )
+        {
+            const SortItem& item = pSource[index];
+            pDestination[pCounts[(item.mKey >> shift) & 0xFF]++] = item;
+        }
+
+        // Swap buffers.
+        SortItem* pSorted = pDestination;
+        pDestination = pSource;
+        pSource = pSorted;
     }
 
-    // B not render isolated?
-    if ( !renderIsolatedB )
+    // Make sure the sorted items are in the sort items.
+    if ( pSource != mSortItems.address() )
+        dMemcpy( mSortItems.address(), pSource, itemCount * sizeof(SortItem) );
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneRenderQueue::insertionSort( const U32 maxMoves )
+{
+    SortItem* pItems = mSortItems.address();
+    const U32 itemCount = (U32)mSortItems.size();
+    U32 moves = 0;
+
+    for ( U32 index = 1; index < itemCount; ++index )
     {
-        // A is render isolated.
-        return -1;
+        // Fetch the item.
+        const SortItem item = pItems[index];
+
+        // Move earlier items up until we find the item's place.
+        U32 insertIndex = index;
+        while ( insertIndex > 0 && isSortItemBefore( item, pItems[insertIndex-1] ) )
+        {
+            pItems[insertIndex] = pItems[insertIndex-1];
+            insertIndex--;
+        }
+
+        pItems[insertIndex] = item;
+
+        // Finish if we've moved too many items.
+        moves += index - insertIndex;
+        if ( moves > maxMoves )
+            return false;
     }
 
-    // A and B are render isolated so use serial Id,
-    return pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+    return true;
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layerGroupOrderSort(const void* a, const void* b)
+bool SceneRenderQueue::incrementalSort( SortHistory* pSortHistory )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_SortIncremental);
 
-    // Fetch the groups.
-    StringTableEntry renderGroupA = pSceneRenderRequestA->mRenderGroup;
-    StringTableEntry renderGroupB = pSceneRenderRequestB->mRenderGroup;
+    // Fetch previous rank count.
+    const U32 rankCount = pSortHistory->getRankCount();
 
-    // Sort by render group (address, arbitrary but static) and use age if render groups are identical.
-    return renderGroupA == renderGroupB ? pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId : renderGroupA < renderGroupB ? -1 : 1;
+    // Finish if there's no previous order.
+    if ( rankCount == 0 )
+        return false;
+
+    const U32 itemCount = (U32)mSortItems.size();
+
+    // Fetch the previous rank of each request.  New requests go after all the others.
+    mRankCounts.setSize( rankCount + 1 );
+    dMemset( mRankCounts.address(), 0, mRankCounts.size() * sizeof(U32) );
+    for ( U32 index = 0; index < itemCount; ++index )
+    {
+        SortItem& item = mSortItems[index];
+        const U32 rank = pSortHistory->findRank( index, item.mpRenderRequest->mSerialId );
+        item.mRank = rank < rankCount ? rank : rankCount;
+        mRankCounts[item.mRank]++;
+    }
+
+    // Convert the counts to offsets.
+    U32 offset = 0;
+    for ( U32 rank = 0; rank <= rankCount; ++rank )
+    {
+        const U32 count = mRankCounts[rank];
+        mRankCounts[rank] = offset;
+        offset += count;
+    }
+
+    // Place the items in their previous order.
+    mSortItemsTemp.setSize( itemCount );
+    for ( U32 index = 0; index < itemCount; ++index )
+    {
+        const SortItem& item = mSortItems[index];
+        mSortItemsTemp[mRankCounts[item.mRank]++] = item;
+    }
+    dMemcpy( mSortItems.address(), mSortItemsTemp.address(), itemCount * sizeof(SortItem) );
+
+    // Fix-up the order.
+    if ( insertionSort( itemCount * SCENE_RENDER_QUEUE_INCREMENTAL_MOVE_LIMIT ) )
+        return true;
+
+    // The order has changed too much so restore the submission order for a full sort.
+    generateSortKeys();
+
+    return false;
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredXSortPointSort(const void* a, const void* b)
+void SceneRenderQueue::applySort( void )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Reorder the requests.
+    const U32 itemCount = (U32)mSortItems.size();
+    for ( U32 index = 0; index < itemCount; ++index )
+    {
+        mRenderRequests[index] = mSortItems[index].mpRenderRequest;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 SceneRenderQueue::SortHistory::findRank( const U32 index, const S32 serialId )
+{
+    // Use the rank of the request submitted at the same index if it's the same serial Id.  This is the common case when the submission order is stable.
+    if ( index < (U32)mSubmittedSlots.size() && mSubmittedSlots[index].mSerialId == serialId )
+        return mSubmittedSlots[index].mRank;
+
+    // Build the serial Id lookup if needed.
+    if ( !mSerialLookupValid )
+        buildSerialLookup();
 
-    const F32 x1 = pSceneRenderRequestA->mWorldPosition.x + pSceneRenderRequestA->mSortPoint.x;
-    const F32 x2 = pSceneRenderRequestB->mWorldPosition.x + pSceneRenderRequestB->mSortPoint.x;
+    // Finish if no history.
+    if ( mSerialSlots.size() == 0 )
+        return U32_MAX;
 
-    // We sort lower x values before higher values.
-    return x1 < x2 ? -1 : x1 > x2 ? 1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+    const U32 mask = (U32)mSerialSlots.size() - 1;
+
+    // Find the serial Id.
+    for ( U32 slotIndex = hashSerialId( serialId ) & mask; ; slotIndex = (slotIndex + 1) & mask )
+    {
+        const Slot& slot = mSerialSlots[slotIndex];
+
+        // Finish if the slot is empty.
+        if ( slot.mRank == U32_MAX )
+            return U32_MAX;
+
+        if ( slot.mSerialId == serialId )
+            return slot.mRank;
+    }
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredYSortPointSort(const void* a, const void* b)
+void SceneRenderQueue::SortHistory::update( const typeSortItemVector& sortItems )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_UpdateSortHistory);
 
-    const F32 y1 = pSceneRenderRequestA->mWorldPosition.y + pSceneRenderRequestA->mSortPoint.y;
-    const F32 y2 = pSceneRenderRequestB->mWorldPosition.y + pSceneRenderRequestB->mSortPoint.y;
+    const U32 requestCount = (U32)sortItems.size();
 
-    // We sort lower y values before higher values.
-    return y1 < y2 ? -1 : y1 > y2 ? 1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+    // Record the rank of each submitted request.
+    mSubmittedSlots.setSize( requestCount );
+    for ( U32 rank = 0; rank < requestCount; ++rank )
+    {
+        const SortItem& item = sortItems[rank];
+        Slot& slot = mSubmittedSlots[item.mIndex];
+        slot.mSerialId = item.mpRenderRequest->mSerialId;
+        slot.mRank = rank;
+    }
+
+    mRankCount = requestCount;
+
+    // The serial Id lookup is built when it's first needed.
+    mSerialLookupValid = false;
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredInverseXSortPointSort(const void* a, const void* b)
+void SceneRenderQueue::SortHistory::buildSerialLookup( void )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_BuildSortHistoryLookup);
+
+    const U32 requestCount = (U32)mSubmittedSlots.size();
+
+    // Size the slots so they're no more than half full.
+    U32 slotCount = 16;
+    while ( slotCount < requestCount * 2 )
+        slotCount <<= 1;
+
+    // Clear the slots.
+    mSerialSlots.setSize( slotCount );
+    for ( U32 slotIndex = 0; slotIndex < slotCount; ++slotIndex )
+        mSerialSlots[slotIndex].mRank = U32_MAX;
+
+    const U32 mask = slotCount - 1;
 
-    const F32 x1 = pSceneRenderRequestA->mWorldPosition.x + pSceneRenderRequestA->mSortPoint.x;
-    const F32 x2 = pSceneRenderRequestB->mWorldPosition.x + pSceneRenderRequestB->mSortPoint.x;
+    // Record the first rank of each serial Id.
+    for ( U32 index = 0; index < requestCount; ++index )
+    {
+        const Slot& submittedSlot = mSubmittedSlots[index];
+
+        for ( U32 slotIndex = hashSerialId( submittedSlot.mSerialId ) & mask; ; slotIndex = (slotIndex + 1) & mask )
+        {
+            Slot& slot = mSerialSlots[slotIndex];
+
+            // Use the slot if it's empty.
+            if ( slot.mRank == U32_MAX )
+            {
+                slot = submittedSlot;
+                break;
+            }
+
+            // Keep the earliest rank if the serial Id is already recorded.
+            if ( slot.mSerialId == submittedSlot.mSerialId )
+            {
+                slot.mRank = getMin( slot.mRank, submittedSlot.mRank );
+                break;
+            }
+        }
+    }
 
-    // We sort higher x values before lower values.
-    return x1 < x2 ? 1 : x1 > x2 ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+    mSerialLookupValid = true;
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredInverseYSortPointSort(const void* a, const void* b)
+void SceneRenderQueue::SortHistory::clear( void )
+{
+    mSubmittedSlots.clear();
+    mSerialSlots.clear();
+    mRankCount = 0;
+    mSerialLookupValid = false;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 QSORT_CALLBACK SceneRenderQueue::layerGroupOrderSort(const void* a, const void* b)
 {
     // Fetch scene render requests.
     SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
     SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
 
-    const F32 y1 = pSceneRenderRequestA->mWorldPosition.y + pSceneRenderRequestA->mSortPoint.y;
-    const F32 y2 = pSceneRenderRequestB->mWorldPosition.y + pSceneRenderRequestB->mSortPoint.y;
+    // Fetch the groups.
+    StringTableEntry renderGroupA = pSceneRenderRequestA->mRenderGroup;
+    StringTableEntry renderGroupB = pSceneRenderRequestB->mRenderGroup;
 
-    // We sort higher y values before lower values.
-    return y1 < y2 ? 1 : y1 > y2 ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+    // Sort by render group (address, arbitrary but static) and use age if render groups are identical.
+    return renderGroupA == renderGroupB ? pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId : renderGroupA < renderGroupB ? -1 : 1;
 }
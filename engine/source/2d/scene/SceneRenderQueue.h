@@ -55,22 +55,60 @@ public:
         RENDER_SORT_INVERSE_ZAXIS,
     };
 
+    /// Render request sort item.
+    struct SortItem
+    {
+        U64                 mKey;
+        SceneRenderRequest* mpRenderRequest;
+        U32                 mIndex;
+        U32                 mRank;
+    };
+    typedef Vector<SortItem> typeSortItemVector;
+
+    /// The order of a previous sort used to sort incrementally.
+    class SortHistory
+    {
+    public:
+        SortHistory() : mRankCount(0), mSerialLookupValid(false) {}
+
+        inline U32 getRankCount( void ) const { return mRankCount; }
+        U32 findRank( const U32 index, const S32 serialId );
+        void update( const typeSortItemVector& sortItems );
+        void clear( void );
+
+    private:
+        struct Slot
+        {
+            S32 mSerialId;
+            U32 mRank;
+        };
+
+        inline static U32 hashSerialId( const S32 serialId ) { const U32 hash = (U32)serialId * 0x9E3779B1; return hash ^ (hash >> 16); }
+        void buildSerialLookup( void );
+
+        Vector<Slot>    mSubmittedSlots;
+        Vector<Slot>    mSerialSlots;
+        U32             mRankCount;
+        bool            mSerialLookupValid;
+    };
+
 private: 
     typeRenderRequestVector mRenderRequests;
     RenderSort              mSortMode;
     bool                    mStrictOrderMode;
 
+    typeSortItemVector      mSortItems;
+    typeSortItemVector      mSortItemsTemp;
+    Vector<U32>             mRankCounts;
+
 private:
-    static S32 QSORT_CALLBACK layeredNewFrontSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredOldFrontSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredDepthSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredInverseDepthSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layerBatchOrderSort(const void* a, const void* b);
     static S32 QSORT_CALLBACK layerGroupOrderSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredXSortPointSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredYSortPointSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredInverseXSortPointSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredInverseYSortPointSort(const void* a, const void* b);
+
+    void generateSortKeys( void );
+    void radixSort( void );
+    bool insertionSort( const U32 maxMoves );
+    bool incrementalSort( SortHistory* pSortHistory );
+    void applySort( void );
 
 public:
     SceneRenderQueue()
@@ -123,113 +161,8 @@ public:
     inline void setStrictOrderMode( const bool strictOrderMode ) { mStrictOrderMode = strictOrderMode; }
     inline bool getStrictOrderMode( void ) const { return mStrictOrderMode; }
 
-    void sort( void )
-    {
-        // Sort layer appropriately.
-        switch( mSortMode )
-        {
-            case RENDER_SORT_NEWEST:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortNewest);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredNewFrontSort );
-                    return;
-                }
-
-            case RENDER_SORT_OLDEST:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortOldest);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredOldFrontSort );
-                    return;
-                }
-
-            case RENDER_SORT_BATCH:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortBatch);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layerBatchOrderSort );
-
-                    // Batching means we don't need strict order.
-                    mStrictOrderMode = false;
-                    return;
-                }
-
-            case RENDER_SORT_GROUP:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortGroup);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layerGroupOrderSort );
-                    return;
-                }
-
-            case RENDER_SORT_XAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortXAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredXSortPointSort);
-                    return;
-                }
-
-            case RENDER_SORT_YAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortYAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredYSortPointSort );
-                    return;
-                }
-
-            case RENDER_SORT_ZAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortZAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredDepthSort );
-                    return;
-                }
-
-            case RENDER_SORT_INVERSE_XAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseXAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseXSortPointSort );
-                    return;
-                }
-
-            case RENDER_SORT_INVERSE_YAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseYAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseYSortPointSort );
-                    return;
-                }
-
-            case RENDER_SORT_INVERSE_ZAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseZAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseDepthSort );
-                    return;
-                }
-
-            case RENDER_SORT_OFF:
-                {
-                    return;
-                }
-
-            default:
-                break;
-        };
-    }
+    /// Sorts the render requests.  Providing a sort history reuses the order of the previous sort where possible.
+    void sort( SortHistory* pSortHistory = NULL );
 
     static RenderSort getRenderSortEnum(const char* label);
     static const char* getRenderSortDescription( const RenderSort& sortMode );
@@ -3568,6 +3568,115 @@ ConsoleMethodWithDocs(Scene, getBatchingEnabled, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether parallel integration is enabled or not.
+    When enabled, scene objects that are parallel-safe (such as sprites) have their integration stages split across the worker thread pool.
+    Script callbacks raised by those objects are deferred and performed on the main thread, in ticked order, after each integration stage.
+    The worker count is controlled by "$pref::ThreadPool::workerCount".
+    @param enabled Whether parallel integration is enabled or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setParallelIntegration, ConsoleVoid, 3, 3, ( bool enabled ))
+{
+    object->setParallelIntegration( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether contact callbacks are batched or not.
+    When enabled, the contacts that begin and end each tick are gathered into a ContactBatch and the scene receives a single
+    "onSceneCollision(%contacts)" and "onSceneEndCollision(%contacts)" callback per tick instead of one per contact.
+    Scene objects do not receive "onCollision" or "onEndCollision" callbacks; use the batch "findObjectContact" method to find their contacts.
+    The batch is only valid until the contacts of the next tick are gathered.
+    @param enabled Whether contact callbacks are batched or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setBatchContactCallbacks, ConsoleVoid, 3, 3, ( bool enabled ))
+{
+    object->setBatchContactCallbacks( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether contact callbacks are batched or not.
+    @return Whether contact callbacks are batched or not.
+*/
+ConsoleMethodWithDocs(Scene, getBatchContactCallbacks, ConsoleBool, 2, 2, ())
+{
+    return object->getBatchContactCallbacks();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether parallel integration is enabled or not.
+    @return Whether parallel integration is enabled or not.
+*/
+ConsoleMethodWithDocs(Scene, getParallelIntegration, ConsoleBool, 2, 2, ())
+{
+    return object->getParallelIntegration();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether the integration checksum is calculated or not.
+    This is a determinism check for parallel integration: the checksum accumulates the integration results of every ticked object
+    so running identical scenes for the same number of ticks serially and in parallel must produce the same checksum.
+    While enabled with parallel integration, each stage also integrates the parallel-safe objects serially, restores them then integrates them in parallel
+    and compares the results per object, warning on the first object that does not match (see "getIntegrationMismatchCount()").
+    Enabling or disabling resets the checksum and the mismatch count.
+    @param enabled Whether the integration checksum is calculated or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setIntegrationChecksumEnabled, ConsoleVoid, 3, 3, ( bool enabled ))
+{
+    object->setIntegrationChecksumEnabled( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the integration checksum accumulated since it was enabled.
+    @return The integration checksum.
+*/
+ConsoleMethodWithDocs(Scene, getIntegrationChecksum, ConsoleInt, 2, 2, ())
+{
+    return (S32)object->getIntegrationChecksum();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets how many times a parallel-safe object integrated in parallel did not match integrating it serially since the integration checksum was enabled.
+    @return The integration mismatch count.
+*/
+ConsoleMethodWithDocs(Scene, getIntegrationMismatchCount, ConsoleInt, 2, 2, ())
+{
+    return (S32)object->getIntegrationMismatchCount();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets whether layers are sorted incrementally or not.
+    When enabled, each layer starts sorting from its order in the previous frame and only fixes up the requests that have moved.
+    This is faster when the order changes little between frames and falls back to a full sort when it changes a lot.
+    The resulting order is identical either way.
+    @param enabled Whether layers are sorted incrementally or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setIncrementalLayerSorting, ConsoleVoid, 3, 3, ( bool enabled ))
+{
+    object->setIncrementalLayerSorting( dAtob(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether layers are sorted incrementally or not.
+    @return Whether layers are sorted incrementally or not.
+*/
+ConsoleMethodWithDocs(Scene, getIncrementalLayerSorting, ConsoleBool, 2, 2, ())
+{
+    return object->getIncrementalLayerSorting();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether this is an editor scene.
     @return No return value.
 */
@@ -28,7 +28,7 @@
 
 //------------------------------------------------------------------------------
 
-ParticleSystem::ParticleNode* ParticlePlayer::EmitterNode::createParticle( void )
+U32 ParticlePlayer::EmitterNode::createParticle( void )
 {
     // Sanity!
     AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::createParticle() - Cannot create a particle with a NULL owner." );
@@ -36,34 +36,62 @@ ParticleSystem::ParticleNode* ParticlePlayer::EmitterNode::createParticle( void
     // Fetch a free node,
     ParticleSystem::ParticleNode* pFreeParticleNode = ParticleSystem::Instance->createParticle();
 
-    // Insert node into emitter chain.
-    pFreeParticleNode->mNextNode        = mParticleNodeHead.mNextNode;
-    pFreeParticleNode->mPreviousNode    = &mParticleNodeHead;
-    mParticleNodeHead.mNextNode         = pFreeParticleNode;
-    pFreeParticleNode->mNextNode->mPreviousNode = pFreeParticleNode;
+    // Append the node to the emitter particles.
+    const U32 particleIndex = mParticles.append( pFreeParticleNode );
 
-    // Configure the node.
-    mOwner->configureParticle( this, pFreeParticleNode );
+    // Configure the particle.
+    mOwner->configureParticle( this, particleIndex );
 
-    return pFreeParticleNode;
+    return particleIndex;
 }
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::EmitterNode::freeParticle( ParticleSystem::ParticleNode* pParticleNode )
+U32 ParticlePlayer::EmitterNode::freeExpiredParticles( const bool singleParticle )
 {
     // Sanity!
-    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeParticle() - Cannot free a particle with a NULL owner." );
+    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeExpiredParticles() - Cannot free particles with a NULL owner." );
 
-    // Deallocate the assets.
-    pParticleNode->mFrameProvider.deallocateAssets();
+    // Fetch the particle count.
+    const U32 particleCount = mParticles.getCount();
 
-    // Remove the node from the emitter chain.
-    pParticleNode->mPreviousNode->mNextNode = pParticleNode->mNextNode;
-    pParticleNode->mNextNode->mPreviousNode = pParticleNode->mPreviousNode;
-   
-    // Free the node.
-    ParticleSystem::Instance->freeParticle( pParticleNode );
+    // Reset the active particle count.
+    U32 activeParticleCount = 0;
+
+    // Process all particles.
+    // NOTE:-   We compact the remaining particles in-place so that their order (oldest first) is preserved.
+    for ( U32 particleIndex = 0; particleIndex < particleCount; ++particleIndex )
+    {
+        // Fetch the particle lifetime.
+        const F32 particleLifetime = mParticles.mLifetime[particleIndex];
+
+        // Has the particle expired?
+        // NOTE:-   If we're in single-particle mode then the particle lives as long as the particle player does.
+        if (    ( !singleParticle && mParticles.mAge[particleIndex] > particleLifetime ) ||
+                ( mIsZero(particleLifetime) ) )
+        {
+            // Yes, so fetch the particle node.
+            ParticleSystem::ParticleNode* pParticleNode = mParticles.mNodes[particleIndex];
+
+            // Deallocate the assets.
+            pParticleNode->mFrameProvider.deallocateAssets();
+
+            // Free the node.
+            ParticleSystem::Instance->freeParticle( pParticleNode );
+            continue;
+        }
+
+        // Move the particle if required.
+        if ( activeParticleCount != particleIndex )
+            mParticles.move( particleIndex, activeParticleCount );
+
+        activeParticleCount++;
+    }
+
+    // Set the active particle count.
+    mParticles.setCount( activeParticleCount );
+
+    return activeParticleCount;
 }
 
 //------------------------------------------------------------------------------
@@ -73,11 +101,24 @@ void ParticlePlayer::EmitterNode::freeAllParticles( void )
     // Sanity!
     AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeAllParticles() - Cannot free all particles with a NULL owner." );
 
+    // Fetch the particle count.
+    const U32 particleCount = mParticles.getCount();
+
     // Free all the nodes,
-    while( mParticleNodeHead.mNextNode != &mParticleNodeHead )
+    for ( U32 particleIndex = 0; particleIndex < particleCount; ++particleIndex )
     {
-        freeParticle( mParticleNodeHead.mNextNode );
+        // Fetch the particle node.
+        ParticleSystem::ParticleNode* pParticleNode = mParticles.mNodes[particleIndex];
+
+        // Deallocate the assets.
+        pParticleNode->mFrameProvider.deallocateAssets();
+
+        // Free the node.
+        ParticleSystem::Instance->freeParticle( pParticleNode );
     }
+
+    // Clear the particles.
+    mParticles.clear();
 }
 
 //------------------------------------------------------------------------------
@@ -299,42 +340,17 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
             // Fetch the asset emitter.
             ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
-            // Fetch the first particle node.
-            ParticleSystem::ParticleNode* pParticleNode = pEmitterNode->getFirstParticle();
+            // Update the particle ages.
+            ParticleSystem::integrateAge( pEmitterNode->getParticles(), scaledTime );
 
-            // Fetch the particle node head.
-            ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+            // Free any expired particles.
+            const U32 particleCount = pEmitterNode->freeExpiredParticles( pParticleAssetEmitter->getSingleParticle() );
 
-            // Process All particle nodes.
-            while ( pParticleNode != pParticleNodeHead )
-            {
-                // Update the particle age.
-                pParticleNode->mParticleAge += scaledTime;
+            // Integrate the remaining particles.
+            integrateParticles( pEmitterNode, 0, particleCount, scaledTime );
 
-                // Has the particle expired?
-                // NOTE:-   If we're in single-particle mode then the particle lives as long as the particle player does.
-                if (    ( !pParticleAssetEmitter->getSingleParticle() && pParticleNode->mParticleAge > pParticleNode->mParticleLifetime ) ||
-                        ( mIsZero(pParticleNode->mParticleLifetime) ) )
-                {
-                    // Yes, so fetch next particle before we kill it.
-                    pParticleNode = pParticleNode->mNextNode;
-
-                    // Kill the particle.
-                    // NOTE:-   Because we move to the next particle the particle to kill is now the previous!
-                    pEmitterNode->freeParticle( pParticleNode->mPreviousNode );
-                }
-                else
-                {
-                    // No, so integrate the particle.
-                    integrateParticle( pEmitterNode, pParticleNode, pParticleNode->mParticleAge / pParticleNode->mParticleLifetime, scaledTime );
-
-                    // Move to the next particle node.
-                    pParticleNode = pParticleNode->mNextNode;
-
-                    // Only count particles when not in single-particle mode.
-                    activeParticleCount++;
-                }
-            };
+            // Count the active particles.
+            activeParticleCount += particleCount;
 
             // Skip generating new particles if the emitter is paused.
             if ( pEmitterNode->getPaused() )
@@ -344,7 +360,7 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
             if ( pParticleAssetEmitter->getSingleParticle() )
             {
                 // Yes, so do we have a single particle yet?
-                if ( pParticleNodeHead->mNextNode == pParticleNodeHead )
+                if ( !pEmitterNode->getActiveParticles() )
                 {
                     // No, so generate a single particle.
                     pEmitterNode->createParticle();
@@ -475,46 +491,14 @@ void ParticlePlayer::interpolateObject( const F32 timeDelta )
         // Fetch the emitter node.
         EmitterNode* pEmitterNode = *emitterItr;
 
-        // Fetch First Particle Node.
-        ParticleSystem::ParticleNode* pParticleNode = pEmitterNode->getFirstParticle();
-
-        // Fetch the particle node head.
-        ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+        // Fetch the particles.
+        ParticleSystem::ParticleBuffer& particles = pEmitterNode->getParticles();
 
-        // Fetch the asset emitter.
-        ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
+        // Interpolate the positions.
+        ParticleSystem::interpolateTick( particles, timeDelta );
 
-        // Fetch the local AABB..
-        const Vector2& localAABB0 = pParticleAssetEmitter->getLocalPivotAABB0();
-        const Vector2& localAABB1 = pParticleAssetEmitter->getLocalPivotAABB1();
-        const Vector2& localAABB2 = pParticleAssetEmitter->getLocalPivotAABB2();
-        const Vector2& localAABB3 = pParticleAssetEmitter->getLocalPivotAABB3();
-
-        // Process All particle nodes.
-        while ( pParticleNode != pParticleNodeHead )
-        {
-            // Interpolate the position.
-            pParticleNode->mRenderTickPosition = (timeDelta * pParticleNode->mPreTickPosition) + ((1.0f-timeDelta) * pParticleNode->mPostTickPosition);
-
-            // Set the transform.
-            pParticleNode->mTransform.p = pParticleNode->mRenderTickPosition;
-
-            // Fetch the render size.
-            const Vector2& renderSize = pParticleNode->mRenderSize;
-
-            // Calculate the scaled AABB.
-            Vector2 scaledAABB[4];
-            scaledAABB[0] = localAABB0 * renderSize;
-            scaledAABB[1] = localAABB1 * renderSize;
-            scaledAABB[2] = localAABB2 * renderSize;
-            scaledAABB[3] = localAABB3 * renderSize;
-
-            // Calculate the world OOBB..
-            CoreMath::mCalculateOOBB( scaledAABB, pParticleNode->mTransform, pParticleNode->mRenderOOBB );
-
-            // Move to the next particle.
-            pParticleNode = pParticleNode->mNextNode;
-        }
+        // Calculate the world OOBB.
+        ParticleSystem::calculateOOBB( particles, 0, particles.getCount(), particles.mRenderTickX, particles.mRenderTickY, pEmitterNode->getAssetEmitter()->getLocalPivotAABB() );
     }
 }
 
@@ -619,17 +603,21 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
         // Fetch the oldest-in-front flag.
         const bool oldestInFront = pParticleAssetEmitter->getOldestInFront();
 
-        // Fetch the starting particle (using appropriate particle order).
-        ParticleSystem::ParticleNode* pParticleNode = oldestInFront ? pEmitterNode->getFirstParticle() : pEmitterNode->getLastParticle();
+        // Fetch the particles.
+        const ParticleSystem::ParticleBuffer& particles = pEmitterNode->getParticles();
 
-        // Fetch the particle node head.
-        ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+        // Fetch the particle count.
+        const U32 particleCount = particles.getCount();
 
-        // Process all particle nodes.
-        while ( pParticleNode != pParticleNodeHead )
+        // Process all particles.
+        // NOTE:-   Particles are stored oldest first so we render in reverse to have the oldest in front.
+        for ( U32 n = 0; n < particleCount; ++n )
         {
+            // Fetch the particle index (using appropriate particle order).
+            const U32 particleIndex = oldestInFront ? particleCount-1-n : n;
+
             // Fetch the frame provider.
-            const ImageFrameProviderCore& frameProvider = pParticleNode->mFrameProvider;
+            const ImageFrameProviderCore& frameProvider = particles.mNodes[particleIndex]->mFrameProvider;
 
             // Fetch the frame area.
             const ImageAsset::FrameArea::TexelArea& texelFrameArea = frameProvider.getProviderImageFrameArea().mTexelArea;
@@ -638,7 +626,7 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
             TextureHandle& frameTexture = frameProvider.getProviderTexture();
 
             // Fetch the particle render OOBB.
-            Vector2* renderOOBB = pParticleNode->mRenderOOBB;
+            const Vector2* renderOOBB = particles.mRenderOOBB + (particleIndex*4);
 
             // Fetch lower/upper texture coordinates.
             const Vector2& texLower = texelFrameArea.mTexelLower;
@@ -655,11 +643,8 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
                 Vector2( texUpper.x, texLower.y ),
                 Vector2( texLower.x, texLower.y ),
                 frameTexture,
-                pParticleNode->mColor );
-
-            // Move to next Particle ( using appropriate sort-order ).
-            pParticleNode = oldestInFront ? pParticleNode->mNextNode : pParticleNode->mPreviousNode;
-        };
+                particles.mColor[particleIndex] );
+        }
 
         // Flush.
         pBatchRenderer->flush( getScene()->getDebugStats().batchIsolatedFlush );
@@ -877,17 +862,20 @@ void ParticlePlayer::stop( const bool waitForParticles, const bool killEffect )
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode )
+void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, const U32 particleIndex )
 {
+    // Fetch the particles.
+    ParticleSystem::ParticleBuffer& particles = pEmitterNode->getParticles();
+
+    // Fetch the particle node.
+    ParticleSystem::ParticleNode* pParticleNode = particles.mNodes[particleIndex];
+
     // Fetch the particle player age.
     const F32 particlePlayerAge = mAge;
 
     // Fetch the particle player position.
     const Vector2& particlePlayerPosition = getPosition();
 
-    // Default to not suppressing movement.
-    pParticleNode->mSuppressMovement = false;
-
     // Fetch particle asset.
     ParticleAsset* pParticleAsset = mParticleAsset;
 
@@ -907,17 +895,20 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     const Vector2& emitterSize = pParticleAssetEmitter->getEmitterSize() * getSizeScale();
     const F32 emitterAngle = mDegToRad(pParticleAssetEmitter->getEmitterAngle());
 
+    // Reset the particle position.
+    Vector2 particlePosition( 0.0f, 0.0f );
+
     // Are we using Single Particle?
     if ( pParticleAssetEmitter->getSingleParticle() )
     {
         // Determine whether to use world-space or emitter-space.
         if ( attachPositionToEmitter )
         {
-            pParticleNode->mPosition = emitterOffset;
+            particlePosition = emitterOffset;
         }
         else
         {
-            pParticleNode->mPosition = particlePlayerPosition + emitterOffset;
+            particlePosition = particlePlayerPosition + emitterOffset;
         }
     }
     else
@@ -932,12 +923,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 if ( attachPositionToEmitter )
                 {
                     // Yes, so transform the particle into emitter-space only.
-                    pParticleNode->mPosition = emitterOffset;
+                    particlePosition = emitterOffset;
                 }
                 else
                 {
                     // No, so transform the particle into world-space here.
-                    pParticleNode->mPosition = emitterOffset + particlePlayerPosition;
+                    particlePosition = emitterOffset + particlePlayerPosition;
                 }
 
             } break;
@@ -952,14 +943,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( CoreMath::mGetRandomF( -halfWidth, halfWidth ), 0.0f );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particlePosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particlePosition = b2Mul( xform, particlePosition );
                 }
 
             } break;
@@ -975,14 +966,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( CoreMath::mGetRandomF( -halfWidth, halfWidth ), CoreMath::mGetRandomF( -halfHeight, halfHeight ) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particlePosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particlePosition = b2Mul( xform, particlePosition );
                 }
 
             } break;
@@ -1008,14 +999,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( radiusX * mCos(angle), radiusY * mSin(angle) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particlePosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particlePosition = b2Mul( xform, particlePosition );
                 }
 
             } break;
@@ -1030,14 +1021,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( emitterSize.x * 0.5f * mCos(angle), emitterSize.y * 0.5f * mSin(angle) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particlePosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particlePosition = b2Mul( xform, particlePosition );
                 }
 
             } break;
@@ -1065,12 +1056,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 if ( attachPositionToEmitter )
                 {
                     // Yes, so transform the particle into emitter-space only.
-                    pParticleNode->mPosition = emissionPosition + emitterOffset;
+                    particlePosition = emissionPosition + emitterOffset;
                 }
                 else
                 {
                     // No, so transform the particle into world-space here.
-                    pParticleNode->mPosition = emissionPosition + emitterOffset + particlePlayerPosition;
+                    particlePosition = emissionPosition + emitterOffset + particlePlayerPosition;
                 }
 
             } break;
@@ -1080,12 +1071,17 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         }
     }
 
+    // Set the particle position.
+    particles.mPositionX[particleIndex] = particlePosition.x;
+    particles.mPositionY[particleIndex] = particlePosition.y;
+
+
     // **********************************************************************************************************************
     // Calculate Particle Lifetime.
     // **********************************************************************************************************************
 
-    pParticleNode->mParticleAge = 0.0f;
-    pParticleNode->mParticleLifetime = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getParticleLifeBaseField(),
+    particles.mAge[particleIndex] = 0.0f;
+    particles.mLifetime[particleIndex] = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getParticleLifeBaseField(),
                                                                                 pParticleAssetEmitter->getParticleLifeVariationField(),
                                                                                 pParticleAsset->getParticleLifeScaleField(),
                                                                                 particlePlayerAge );
@@ -1116,7 +1112,8 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     }
 
     // Reset the render size.
-    pParticleNode->mRenderSize.Set(-1.0f, -1.0f);
+    particles.mRenderSizeX[particleIndex] = -1.0f;
+    particles.mRenderSizeY[particleIndex] = -1.0f;
 
 
     // **********************************************************************************************************************
@@ -1170,7 +1167,8 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
 
         // Calculate the particle velocity.
         const F32 emissionAngleRadians = mDegToRad( emissionAngle );
-        pParticleNode->mVelocity.Set( emissionForce * mCos( emissionAngleRadians ), emissionForce * mSin( emissionAngleRadians ) );
+        particles.mVelocityX[particleIndex] = emissionForce * mCos( emissionAngleRadians );
+        particles.mVelocityY[particleIndex] = emissionForce * mSin( emissionAngleRadians );
     }
 
 
@@ -1242,10 +1240,10 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     const ParticleAssetField& alphaChannelScale = pParticleAsset->getAlphaChannelScaleField();
 
     // Calculate the color.
-    pParticleNode->mColor.set(  mClampF( redChannel.getFieldValue( 0.0f ), redChannel.getMinValue(), redChannel.getMaxValue() ),
-                                mClampF( greenChannel.getFieldValue( 0.0f ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
-                                mClampF( blueChannel.getFieldValue( 0.0f ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
-                                mClampF( alphaChannel.getFieldValue( 0.0f ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
+    particles.mColor[particleIndex].set(    mClampF( redChannel.getFieldValue( 0.0f ), redChannel.getMinValue(), redChannel.getMaxValue() ),
+                                            mClampF( greenChannel.getFieldValue( 0.0f ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
+                                            mClampF( blueChannel.getFieldValue( 0.0f ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
+                                            mClampF( alphaChannel.getFieldValue( 0.0f ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
 
 
     // **********************************************************************************************************************
@@ -1292,30 +1290,59 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
     // Reset Tick Position.
     // **********************************************************************************************************************
-    pParticleNode->mPreTickPosition = pParticleNode->mPostTickPosition = pParticleNode->mRenderTickPosition = pParticleNode->mPosition;
+    particles.mPreTickX[particleIndex] = particles.mPostTickX[particleIndex] = particles.mRenderTickX[particleIndex] = particlePosition.x;
+    particles.mPreTickY[particleIndex] = particles.mPostTickY[particleIndex] = particles.mRenderTickY[particleIndex] = particlePosition.y;
 
 
     // **********************************************************************************************************************
     // Do a Single Particle Integration to get things going.
     // **********************************************************************************************************************
-    integrateParticle( pEmitterNode, pParticleNode, 0.0f, 0.0f );
+    integrateParticles( pEmitterNode, particleIndex, particleIndex+1, 0.0f );
 }
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode, F32 particleAge, F32 elapsedTime )
+void ParticlePlayer::integrateParticles( EmitterNode* pEmitterNode, const U32 start, const U32 end, const F32 elapsedTime )
 {
-    // Fetch particle asset.
-    ParticleAsset* pParticleAsset = mParticleAsset;
+    // Fetch the particles.
+    ParticleSystem::ParticleBuffer& particles = pEmitterNode->getParticles();
 
     // Fetch the asset emitter.
     ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
+    // Integrate the particle properties.
+    for ( U32 particleIndex = start; particleIndex < end; ++particleIndex )
+    {
+        // Fetch the particle lifetime.
+        const F32 particleLifetime = particles.mLifetime[particleIndex];
 
-    // **********************************************************************************************************************
-    // Copy Old Tick Position.
-    // **********************************************************************************************************************
-    pParticleNode->mRenderTickPosition = pParticleNode->mPreTickPosition = pParticleNode->mPostTickPosition;
+        // Integrate the particle.
+        integrateParticle( pEmitterNode, particleIndex, mIsZero(particleLifetime) ? 0.0f : particles.mAge[particleIndex] / particleLifetime, elapsedTime );
+    }
+
+    // Integrate the particle motion.
+    // NOTE:-   Single particles do not move.
+    ParticleSystem::integrateMotion( particles, start, end, elapsedTime, !pParticleAssetEmitter->getSingleParticle() );
+
+    // Calculate the world OOBB.
+    ParticleSystem::calculateOOBB( particles, start, end, particles.mPositionX, particles.mPositionY, pParticleAssetEmitter->getLocalPivotAABB() );
+}
+
+//------------------------------------------------------------------------------
+
+void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, const U32 particleIndex, const F32 particleAge, const F32 elapsedTime )
+{
+    // Fetch the particles.
+    ParticleSystem::ParticleBuffer& particles = pEmitterNode->getParticles();
+
+    // Fetch the particle node.
+    ParticleSystem::ParticleNode* pParticleNode = particles.mNodes[particleIndex];
+
+    // Fetch particle asset.
+    ParticleAsset* pParticleAsset = mParticleAsset;
+
+    // Fetch the asset emitter.
+    ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
 
     // **********************************************************************************************************************
@@ -1323,31 +1350,31 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
 
     // Scale Size-X.
-    pParticleNode->mRenderSize.x = mClampF( pParticleNode->mSize.x * pParticleAssetEmitter->getSizeXLifeField().getFieldValue( particleAge ),
-                                            pParticleAssetEmitter->getSizeXBaseField().getMinValue(),
-                                            pParticleAssetEmitter->getSizeXBaseField().getMaxValue());
+    particles.mRenderSizeX[particleIndex] = mClampF(    pParticleNode->mSize.x * pParticleAssetEmitter->getSizeXLifeField().getFieldValue( particleAge ),
+                                                        pParticleAssetEmitter->getSizeXBaseField().getMinValue(),
+                                                        pParticleAssetEmitter->getSizeXBaseField().getMaxValue());
 
     // Is the particle using a fixed aspect?
     if ( pParticleAssetEmitter->getFixedAspect() )
     {
         // Yes, so simply copy Size-X.
-        pParticleNode->mRenderSize.y = pParticleNode->mRenderSize.x;
+        particles.mRenderSizeY[particleIndex] = particles.mRenderSizeX[particleIndex];
     }
     else
     {
         // No, so Scale Size-Y.
-        pParticleNode->mRenderSize.y = mClampF( pParticleNode->mSize.y * pParticleAssetEmitter->getSizeYLifeField().getFieldValue( particleAge ),
-                                                pParticleAssetEmitter->getSizeYBaseField().getMinValue(),
-                                                pParticleAssetEmitter->getSizeYBaseField().getMaxValue() );
+        particles.mRenderSizeY[particleIndex] = mClampF(    pParticleNode->mSize.y * pParticleAssetEmitter->getSizeYLifeField().getFieldValue( particleAge ),
+                                                            pParticleAssetEmitter->getSizeYBaseField().getMinValue(),
+                                                            pParticleAssetEmitter->getSizeYBaseField().getMaxValue() );
     }
 
 
     // **********************************************************************************************************************
     // Scale Speed.
     // **********************************************************************************************************************
-    pParticleNode->mRenderSpeed = mClampF(  pParticleNode->mSpeed * pParticleAssetEmitter->getSpeedLifeField().getFieldValue( particleAge ),
-                                            pParticleAssetEmitter->getSpeedBaseField().getMinValue(),
-                                            pParticleAssetEmitter->getSpeedBaseField().getMaxValue() );
+    particles.mRenderSpeed[particleIndex] = mClampF(    pParticleNode->mSpeed * pParticleAssetEmitter->getSpeedLifeField().getFieldValue( particleAge ),
+                                                        pParticleAssetEmitter->getSpeedBaseField().getMinValue(),
+                                                        pParticleAssetEmitter->getSpeedBaseField().getMaxValue() );
 
 
     // **********************************************************************************************************************
@@ -1378,10 +1405,10 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     const ParticleAssetField& alphaChannelScale = pParticleAsset->getAlphaChannelScaleField();
 
     // Calculate the color.
-    pParticleNode->mColor.set(  mClampF( redChannel.getFieldValue( particleAge ), redChannel.getMinValue(), redChannel.getMaxValue() ),
-                                mClampF( greenChannel.getFieldValue( particleAge ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
-                                mClampF( blueChannel.getFieldValue( particleAge ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
-                                mClampF( alphaChannel.getFieldValue( particleAge ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
+    particles.mColor[particleIndex].set(    mClampF( redChannel.getFieldValue( particleAge ), redChannel.getMinValue(), redChannel.getMaxValue() ),
+                                            mClampF( greenChannel.getFieldValue( particleAge ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
+                                            mClampF( blueChannel.getFieldValue( particleAge ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
+                                            mClampF( alphaChannel.getFieldValue( particleAge ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
 
 
     // **********************************************************************************************************************
@@ -1411,22 +1438,20 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
             const F32 randomMotion = pParticleNode->mRenderRandomMotion * 0.5f;
 
             // Add time-integrated random motion into velocity.
-            pParticleNode->mVelocity += Vector2( CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime, CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime );
+            particles.mVelocityX[particleIndex] += CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime;
+            particles.mVelocityY[particleIndex] += CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime;
         }
 
         // Do we have any fixed force?
         if ( mNotZero( pParticleNode->mRenderFixedForce ) )
         {
             // Yes, so time-integrate a fixed force to the velocity.
-            pParticleNode->mVelocity += (pParticleAssetEmitter->getFixedForceDirection() * (pParticleNode->mRenderFixedForce * getForceScale()) * elapsedTime);
+            const Vector2 fixedForce = pParticleAssetEmitter->getFixedForceDirection() * (pParticleNode->mRenderFixedForce * getForceScale()) * elapsedTime;
+            particles.mVelocityX[particleIndex] += fixedForce.x;
+            particles.mVelocityY[particleIndex] += fixedForce.y;
         }
 
-        // Are we suppressing movement?
-        if ( !pParticleNode->mSuppressMovement )
-        {
-            // No, so adjust particle position.
-            pParticleNode->mPosition += (pParticleNode->mVelocity * pParticleNode->mRenderSpeed * elapsedTime);
-        }
+        // NOTE:-   The particle position is integrated in bulk by the particle system.
     }
 
 
@@ -1436,7 +1461,7 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     if ( pParticleAssetEmitter->getKeepAligned() && pParticleAssetEmitter->getOrientationType() == ParticleAssetEmitter::ALIGNED_ORIENTATION )
     {
         // Yes, so calculate last movement direction.
-        F32 movementAngle = mRadToDeg( mAtan( pParticleNode->mVelocity.x, pParticleNode->mVelocity.y ) );
+        F32 movementAngle = mRadToDeg( mAtan( particles.mVelocityX[particleIndex], particles.mVelocityY[particleIndex] ) );
 
         // Adjust for negative ArcTan quadrants.
         if ( movementAngle < 0.0f )
@@ -1462,33 +1487,10 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
         }
     }
 
-    // Calculate the transform.
-    pParticleNode->mTransform.Set( pParticleNode->mPosition, mDegToRad(pParticleNode->mOrientationAngle) );
-
-    // Fetch the local AABB..
-    const Vector2& localAABB0 = pParticleAssetEmitter->getLocalPivotAABB0();
-    const Vector2& localAABB1 = pParticleAssetEmitter->getLocalPivotAABB1();
-    const Vector2& localAABB2 = pParticleAssetEmitter->getLocalPivotAABB2();
-    const Vector2& localAABB3 = pParticleAssetEmitter->getLocalPivotAABB3();
-
-    // Fetch the render size.
-    const Vector2& renderSize = pParticleNode->mRenderSize;
-
-    // Calculate the scaled AABB.
-    Vector2 scaledAABB[4];
-    scaledAABB[0] = localAABB0 * renderSize;
-    scaledAABB[1] = localAABB1 * renderSize;
-    scaledAABB[2] = localAABB2 * renderSize;
-    scaledAABB[3] = localAABB3 * renderSize;
-
-    // Calculate the world OOBB..
-    CoreMath::mCalculateOOBB( scaledAABB, pParticleNode->mTransform, pParticleNode->mRenderOOBB );
-
-
-    // **********************************************************************************************************************
-    // Set Post Tick Position.
-    // **********************************************************************************************************************
-    pParticleNode->mPostTickPosition = pParticleNode->mPosition;
+    // Calculate the rotation.
+    const F32 orientationAngle = mDegToRad(pParticleNode->mOrientationAngle);
+    particles.mRotationCos[particleIndex] = mCos( orientationAngle );
+    particles.mRotationSin[particleIndex] = mSin( orientationAngle );
 }
 
 //-----------------------------------------------------------------------------
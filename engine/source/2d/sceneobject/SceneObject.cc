@@ -176,6 +176,10 @@ SceneObject::SceneObject() :
     mBeingSafeDeleted(false),
     mSafeDeleteReady(true),
 
+    /// Deferred integration.
+    mDeferredIntegration(0),
+    mDeferredTickDisplacement(0.0f, 0.0f),
+
     /// Miscellaneous.
     mBatchIsolated(false),
     mSerialiseKey(0),
@@ -191,6 +195,7 @@ SceneObject::SceneObject() :
     VECTOR_SET_ASSOCIATION( mDestroyNotifyList );
     VECTOR_SET_ASSOCIATION( mCollisionFixtureDefs );
     VECTOR_SET_ASSOCIATION( mCollisionFixtures );
+    VECTOR_SET_ASSOCIATION( mDeferredCallbacks );
 
     // Assign scene-object index.
     mSerialId = ++sSceneObjectMasterSerialId;
@@ -587,9 +592,20 @@ void SceneObject::integrateObject( const F32 totalTime, const F32 elapsedTime, D
 
         // Calculate tick displacement.
         b2Vec2 tickDisplacement = position - mPreTickPosition;
-            
-        // Update world proxy.
-        mpScene->getWorldQuery()->update( this, tickAABB, tickDisplacement );
+
+        // Are we integrating in parallel?
+        if ( getIntegratingInParallel() )
+        {
+            // Yes, so defer the world proxy update as the world query is not thread-safe.
+            mDeferredTickAABB = tickAABB;
+            mDeferredTickDisplacement = tickDisplacement;
+            mDeferredIntegration |= DEFERRED_WORLD_QUERY_UPDATE;
+        }
+        else
+        {
+            // No, so update world proxy.
+            mpScene->getWorldQuery()->update( this, tickAABB, tickDisplacement );
+        }
     }
 
     // Update Lifetime.
@@ -601,14 +617,20 @@ void SceneObject::integrateObject( const F32 totalTime, const F32 elapsedTime, D
     // Update Any Attached GUI.
     if ( mpAttachedGui && mpAttachedGuiSceneWindow )
     {
-        updateAttachedGui();
+        if ( getIntegratingInParallel() )
+            mDeferredIntegration |= DEFERRED_ATTACHED_GUI;
+        else
+            updateAttachedGui();
     }
 
     // Are we attached to a camera?
     if ( mpAttachedCamera )
     {
         // Yes, so calculate camera mount.
-        mpAttachedCamera->calculateCameraMount( elapsedTime );
+        if ( getIntegratingInParallel() )
+            mDeferredIntegration |= DEFERRED_CAMERA_MOUNT;
+        else
+            mpAttachedCamera->calculateCameraMount( elapsedTime );
     }
 }
 
@@ -624,13 +646,16 @@ void SceneObject::postIntegrate(const F32 totalTime, const F32 elapsedTime, Debu
         return;
 
     // Notify components.
-    notifyComponentsUpdate();
+    if ( getIntegratingInParallel() )
+        mDeferredIntegration |= DEFERRED_COMPONENTS_UPDATE;
+    else
+        notifyComponentsUpdate();
 
     // Script "onUpdate".
     if ( mUpdateCallback )
     {
         PROFILE_SCOPE(SceneObject_onUpdateCallback);
-        Con::executef(this, 1, "onUpdate");
+        performCallback( "onUpdate" );
     }
 
     // Are we using the sleeping callback?
@@ -649,15 +674,156 @@ void SceneObject::postIntegrate(const F32 totalTime, const F32 elapsedTime, Debu
 
             // Perform the appropriate callback.
             if ( currentAwakeState )
-                Con::executef(this, 1, "onWake");
+                performCallback( "onWake" );
             else
-                Con::executef(this, 1, "onSleep");
+                performCallback( "onSleep" );
         }
     }
 }
 
 //-----------------------------------------------------------------------------
 
+void SceneObject::performCallback( const char* pCallbackName )
+{
+    // Are we integrating in parallel?
+    if ( getIntegratingInParallel() )
+    {
+        // Yes, so defer the callback until the scene drains deferred integration.
+        mDeferredCallbacks.push_back( pCallbackName );
+        return;
+    }
+
+    // No, so perform the callback now.
+    Con::executef( this, 1, pCallbackName );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::processDeferredIntegration( void )
+{
+    // Finish if nothing was deferred.
+    if ( mDeferredIntegration == 0 && mDeferredCallbacks.size() == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneObject_ProcessDeferredIntegration);
+
+    // Fetch and reset the deferred work.
+    const U32 deferredIntegration = mDeferredIntegration;
+    mDeferredIntegration = 0;
+
+    // Update world proxy.
+    if ( (deferredIntegration & DEFERRED_WORLD_QUERY_UPDATE) && getScene() )
+        mpScene->getWorldQuery()->update( this, mDeferredTickAABB, mDeferredTickDisplacement );
+
+    // Initiate death.
+    if ( deferredIntegration & DEFERRED_SAFE_DELETE )
+        safeDelete();
+
+    // Update any attached GUI.
+    if ( (deferredIntegration & DEFERRED_ATTACHED_GUI) && mpAttachedGui && mpAttachedGuiSceneWindow )
+        updateAttachedGui();
+
+    // Calculate camera mount.
+    if ( (deferredIntegration & DEFERRED_CAMERA_MOUNT) && mpAttachedCamera )
+        mpAttachedCamera->calculateCameraMount( Tickable::smTickSec );
+
+    // Notify components.
+    if ( deferredIntegration & DEFERRED_COMPONENTS_UPDATE )
+        notifyComponentsUpdate();
+
+    // Finish if no callbacks.
+    if ( mDeferredCallbacks.size() == 0 )
+        return;
+
+    // Perform the callbacks in the order they were raised.
+    // NOTE: Nothing is deferred outside of parallel integration so the callbacks cannot add to the list
+    // but one may delete this object so stop as soon as that happens.
+    SimObjectPtr<SceneObject> safeThis( this );
+    for ( S32 n = 0; n < mDeferredCallbacks.size(); ++n )
+    {
+        Con::executef( this, 1, mDeferredCallbacks[n] );
+
+        // Finish if we were deleted.
+        if ( safeThis.isNull() )
+            return;
+    }
+
+    // Reset the callbacks.
+    mDeferredCallbacks.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::saveIntegrationState( Vector<U8>& state ) const
+{
+    // Spatials.
+    saveIntegrationValue( state, mSpatialDirty );
+    saveIntegrationValue( state, mPreTickPosition );
+    saveIntegrationValue( state, mPreTickAngle );
+    saveIntegrationValue( state, mPreTickAABB );
+    saveIntegrationValue( state, mCurrentAABB );
+    saveIntegrationValue( state, mRenderPosition );
+    saveIntegrationValue( state, mRenderAngle );
+    saveIntegrationValue( state, mRenderOOBB );
+
+    // Lifetime.
+    saveIntegrationValue( state, mLifetime );
+    saveIntegrationValue( state, mLifetimeActive );
+
+    // Sleeping.
+    saveIntegrationValue( state, mLastAwakeState );
+
+    // Deferred integration.
+    saveIntegrationValue( state, mDeferredIntegration );
+    saveIntegrationValue( state, mDeferredTickAABB );
+    saveIntegrationValue( state, mDeferredTickDisplacement );
+    const U32 deferredCallbackCount = mDeferredCallbacks.size();
+    saveIntegrationValue( state, deferredCallbackCount );
+    for ( U32 n = 0; n < deferredCallbackCount; ++n )
+    {
+        saveIntegrationValue( state, mDeferredCallbacks[n] );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+const U8* SceneObject::restoreIntegrationState( const U8* pState )
+{
+    // Spatials.
+    pState = restoreIntegrationValue( pState, mSpatialDirty );
+    pState = restoreIntegrationValue( pState, mPreTickPosition );
+    pState = restoreIntegrationValue( pState, mPreTickAngle );
+    pState = restoreIntegrationValue( pState, mPreTickAABB );
+    pState = restoreIntegrationValue( pState, mCurrentAABB );
+    pState = restoreIntegrationValue( pState, mRenderPosition );
+    pState = restoreIntegrationValue( pState, mRenderAngle );
+    pState = restoreIntegrationValue( pState, mRenderOOBB );
+
+    // Lifetime.
+    pState = restoreIntegrationValue( pState, mLifetime );
+    pState = restoreIntegrationValue( pState, mLifetimeActive );
+
+    // Sleeping.
+    pState = restoreIntegrationValue( pState, mLastAwakeState );
+
+    // Deferred integration.
+    pState = restoreIntegrationValue( pState, mDeferredIntegration );
+    pState = restoreIntegrationValue( pState, mDeferredTickAABB );
+    pState = restoreIntegrationValue( pState, mDeferredTickDisplacement );
+    U32 deferredCallbackCount;
+    pState = restoreIntegrationValue( pState, deferredCallbackCount );
+    mDeferredCallbacks.setSize( deferredCallbackCount );
+    for ( U32 n = 0; n < deferredCallbackCount; ++n )
+    {
+        pState = restoreIntegrationValue( pState, mDeferredCallbacks[n] );
+    }
+
+    return pState;
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::interpolateObject( const F32 timeDelta )
 {
     // Debug Profiling.
@@ -873,7 +1039,10 @@ void SceneObject::updateLifetime( const F32 elapsedTime )
             setLifetime( 0.0f );
 
             // Initiate Death!
-            safeDelete();
+            if ( getIntegratingInParallel() )
+                mDeferredIntegration |= DEFERRED_SAFE_DELETE;
+            else
+                safeDelete();
         }
     }
 }
@@ -889,47 +1058,67 @@ void SceneObject::setSceneLayer( const U32 sceneLayer )
         return;
     }
 
+    // Finish if the layer is unchanged.
+    if ( sceneLayer == mSceneLayer )
+        return;
+
+    // Fetch the scene.
+    Scene* pScene = getScene();
+
+    // Remove from the current scene layer.
+    if ( pScene != NULL )
+        pScene->removeFromSceneLayer( this );
+
     // Set Layer.
     mSceneLayer = sceneLayer;
 
     // Set Layer Mask.
     mSceneLayerMask = BIT( mSceneLayer );
+
+    // Add to the new scene layer.
+    if ( pScene != NULL )
+        pScene->addToSceneLayer( this );
 }
 
 //-----------------------------------------------------------------------------
 
-bool SceneObject::setSceneLayerDepthFront( void )
+void SceneObject::setSceneLayerDepth( const F32 order )
 {
+    // Finish if the depth is unchanged.
+    if ( order == mSceneLayerDepth )
+        return;
+
     // Fetch the scene.
     Scene* pScene = getScene();
 
-    // Finish if no scene or only a single object.
-    if ( pScene == NULL || pScene->getSceneObjectCount() == 1 )
-        return false;
+    // Remove from the scene layer as its position depends on the depth.
+    if ( pScene != NULL )
+        pScene->removeFromSceneLayer( this );
 
-    // Fetch scene objects.
-    typeSceneObjectVector layerList;
-    pScene->getSceneObjects( layerList, getSceneLayer() );
+    // Set Layer Depth.
+    mSceneLayerDepth = order;
 
-    // Fetch layer object count.
-    const U32 layerObjectCount = (U32)layerList.size();
+    // Add back to the scene layer.
+    if ( pScene != NULL )
+        pScene->addToSceneLayer( this );
+}
+
+//-----------------------------------------------------------------------------
 
-    // Sort the layer.
-    dQsort(layerList.address(), layerObjectCount, sizeof(SceneObject*), sceneObjectLayerDepthSort);
+bool SceneObject::setSceneLayerDepthFront( void )
+{
+    // Fetch the scene.
+    Scene* pScene = getScene();
 
-    // Reset object index.
-    U32 objectIndex = 0;
+    // Finish if no scene.
+    if ( pScene == NULL )
+        return false;
 
-    // Find object index.
-    for ( ; objectIndex < layerObjectCount; ++objectIndex )
-    {
-        // Stop if this is the current object index.
-        if ( layerList[objectIndex] == this )
-            break;
-    }
+    // Fetch layer objects.  These are sorted back to front.
+    typeSceneObjectVectorConstRef layerList = pScene->getSceneLayerObjects( getSceneLayer() );
 
     // Finish if already at front of layer.
-    if ( objectIndex == layerObjectCount-1 )
+    if ( layerList.size() == 0 || layerList.last() == this )
         return false;
 
     // Fetch furthest front depth.
@@ -948,33 +1137,15 @@ bool SceneObject::setSceneLayerDepthBack( void )
     // Fetch the scene.
     Scene* pScene = getScene();
 
-    // Finish if no scene or only a single object.
-    if ( pScene == NULL || pScene->getSceneObjectCount() == 1 )
+    // Finish if no scene.
+    if ( pScene == NULL )
         return false;
 
-    // Fetch scene objects.
-    typeSceneObjectVector layerList;
-    pScene->getSceneObjects( layerList, getSceneLayer() );
-
-    // Fetch layer object count.
-    const U32 layerObjectCount = (U32)layerList.size();
-
-    // Sort the layer.
-    dQsort(layerList.address(), layerObjectCount, sizeof(SceneObject*), sceneObjectLayerDepthSort);
-
-    // Reset object index.
-    U32 objectIndex = 0;
-
-    // Find object index.
-    for ( ; objectIndex < layerObjectCount; ++objectIndex )
-    {
-        // Stop if this is the current object index.
-        if ( layerList[objectIndex] == this )
-            break;
-    }
+    // Fetch layer objects.  These are sorted back to front.
+    typeSceneObjectVectorConstRef layerList = pScene->getSceneLayerObjects( getSceneLayer() );
 
     // Finish if already at back of layer.
-    if ( objectIndex == 0 )
+    if ( layerList.size() == 0 || layerList.first() == this )
         return false;
 
     // Fetch furthest back depth.
@@ -993,55 +1164,54 @@ bool SceneObject::setSceneLayerDepthForward( void )
     // Fetch the scene.
     Scene* pScene = getScene();
 
-    // Finish if no scene or only a single object.
-    if ( pScene == NULL || pScene->getSceneObjectCount() == 1 )
+    // Finish if no scene.
+    if ( pScene == NULL )
         return false;
 
-    // Fetch scene objects.
-    typeSceneObjectVector layerList;
-    pScene->getSceneObjects( layerList, getSceneLayer() );
+    // Fetch layer objects.  These are sorted back to front.
+    typeSceneObjectVectorConstRef layerList = pScene->getSceneLayerObjects( getSceneLayer() );
 
     // Fetch layer object count.
-    const U32 layerObjectCount = (U32)layerList.size();
-
-    // Sort the layer.
-    dQsort(layerList.address(), layerObjectCount, sizeof(SceneObject*), sceneObjectLayerDepthSort);
-
-    // Reset object index.
-    U32 objectIndex = 0;
+    const S32 layerObjectCount = layerList.size();
 
     // Find object index.
-    for ( ; objectIndex < layerObjectCount; ++objectIndex )
-    {
-        // Stop if this is the current object index.
-        if ( layerList[objectIndex] == this )
-            break;
-    }
+    const S32 objectIndex = pScene->findSceneLayerIndex( this );
 
     // Finish if already at the front of the layer.
-    if ( objectIndex == layerObjectCount-1 )
+    if ( objectIndex == -1 || objectIndex == layerObjectCount-1 )
         return false;
 
-    // Fetch forwards depth.
-    const F32 forwardDepth = layerList[objectIndex+1]->getSceneLayerDepth();
+    // Fetch forwards object.
+    SceneObject* pForwardSceneObject = layerList[objectIndex+1];
 
-    // Adjust depth to be forward.
-    setSceneLayerDepth( forwardDepth - 0.5f );
+    // Fetch depths.
+    const F32 currentDepth = getSceneLayerDepth();
+    const F32 forwardDepth = pForwardSceneObject->getSceneLayerDepth();
 
-    // Finish if we were almost at the front anyway.
-    if ( objectIndex == layerObjectCount-2 )
+    // Can we simply swap depths with the forwards object?
+    if ( currentDepth > forwardDepth &&
+        ( objectIndex == 0 || layerList[objectIndex-1]->getSceneLayerDepth() > currentDepth ) &&
+        ( objectIndex == layerObjectCount-2 || layerList[objectIndex+2]->getSceneLayerDepth() < forwardDepth ) )
+    {
+        // Yes, so swap depths.
+        setSceneLayerDepth( forwardDepth );
+        pForwardSceneObject->setSceneLayerDepth( currentDepth );
         return true;
+    }
 
-    // Adjust next objects forwards.
-    for( U32 forwardIndex = objectIndex+2; forwardIndex < layerObjectCount; ++forwardIndex )
+    // Adjust next objects forwards.  This doesn't change their order so they can be adjusted in place.
+    for( S32 forwardIndex = objectIndex+2; forwardIndex < layerObjectCount; ++forwardIndex )
     {
         // Fetch scene object.
         SceneObject* forwardSceneObject = layerList[forwardIndex];
 
         // Adjust depth to be forwards.
-        forwardSceneObject->setSceneLayerDepth( forwardSceneObject->getSceneLayerDepth() - 1.0f );
+        forwardSceneObject->mSceneLayerDepth -= 1.0f;
     }
 
+    // Adjust depth to be forward.
+    setSceneLayerDepth( forwardDepth - 0.5f );
+
     return true;
 }
 
@@ -1052,55 +1222,51 @@ bool SceneObject::setSceneLayerDepthBackward( void )
     // Fetch the scene.
     Scene* pScene = getScene();
 
-    // Finish if no scene or only a single object.
-    if ( pScene == NULL || pScene->getSceneObjectCount() == 1 )
+    // Finish if no scene.
+    if ( pScene == NULL )
         return false;
 
-    // Fetch scene objects.
-    typeSceneObjectVector layerList;
-    pScene->getSceneObjects( layerList, getSceneLayer() );
-
-    // Fetch layer object count.
-    const U32 layerObjectCount = (U32)layerList.size();
-
-    // Sort the layer.
-    dQsort(layerList.address(), layerObjectCount, sizeof(SceneObject*), sceneObjectLayerDepthSort);
-
-    // Reset object index.
-    U32 objectIndex = 0;
+    // Fetch layer objects.  These are sorted back to front.
+    typeSceneObjectVectorConstRef layerList = pScene->getSceneLayerObjects( getSceneLayer() );
 
     // Find object index.
-    for ( ; objectIndex < layerObjectCount; ++objectIndex )
-    {
-        // Stop if this is the current object index.
-        if ( layerList[objectIndex] == this )
-            break;
-    }
+    const S32 objectIndex = pScene->findSceneLayerIndex( this );
 
     // Finish if already at the back of the layer.
-    if ( objectIndex == 0 )
+    if ( objectIndex <= 0 )
         return false;
 
-    // Fetch backwards depth.
-    const F32 backDepth = layerList[objectIndex-1]->getSceneLayerDepth();
+    // Fetch backwards object.
+    SceneObject* pBackSceneObject = layerList[objectIndex-1];
 
-    // Adjust depth to be backwards.
-    setSceneLayerDepth( backDepth + 0.5f );
+    // Fetch depths.
+    const F32 currentDepth = getSceneLayerDepth();
+    const F32 backDepth = pBackSceneObject->getSceneLayerDepth();
 
-    // Finish if we were almost at the back anyway.
-    if ( objectIndex == 1 )
+    // Can we simply swap depths with the backwards object?
+    if ( currentDepth < backDepth &&
+        ( objectIndex == layerList.size()-1 || layerList[objectIndex+1]->getSceneLayerDepth() < currentDepth ) &&
+        ( objectIndex == 1 || layerList[objectIndex-2]->getSceneLayerDepth() > backDepth ) )
+    {
+        // Yes, so swap depths.
+        setSceneLayerDepth( backDepth );
+        pBackSceneObject->setSceneLayerDepth( currentDepth );
         return true;
+    }
 
-    // Adjust previous objects backwards.
-    for( U32 backIndex = 0; backIndex < (objectIndex-1); ++backIndex )
+    // Adjust previous objects backwards.  This doesn't change their order so they can be adjusted in place.
+    for( S32 backIndex = 0; backIndex < (objectIndex-1); ++backIndex )
     {
         // Fetch scene object.
         SceneObject* backSceneObject = layerList[backIndex];
 
         // Adjust depth to be backwards.
-        backSceneObject->setSceneLayerDepth( backSceneObject->getSceneLayerDepth() + 1.0f );
+        backSceneObject->mSceneLayerDepth += 1.0f;
     }
 
+    // Adjust depth to be backwards.
+    setSceneLayerDepth( backDepth + 0.5f );
+
     return true;
 }
 
@@ -2648,20 +2814,11 @@ void SceneObject::onInputEvent( StringTableEntry name, const GuiEvent& event, co
     // Debug Profiling.
     PROFILE_SCOPE(SceneObject_OnInputEvent);
 
-    // Argument Buffers.
-    char argBuffer[3][32];
-
-    // ID
-    dSprintf(argBuffer[0], 32, "%d", event.eventID);
-    
-    // Format Mouse-Position Buffer.
-    dSprintf(argBuffer[1], 32, "%g %g", worldMousePosition.x, worldMousePosition.y);
-
-    // Optional double click
-    dSprintf(argBuffer[2], 32, "%d", event.mouseClickCount);
+    // Arguments are the event ID, mouse-position and optional double click.
+    Con::TypedArg args[3] = { (S32)event.eventID, Con::TypedArg( worldMousePosition.x, worldMousePosition.y ), (S32)event.mouseClickCount };
 
     // Call Scripts.
-    Con::executef(this, 4, name, argBuffer[0], argBuffer[1], argBuffer[2]);
+    Con::executeTyped( this, name, 3, args );
 }
 
 //-----------------------------------------------------------------------------
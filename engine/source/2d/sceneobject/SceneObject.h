@@ -206,6 +206,12 @@ protected:
     bool                    mBeingSafeDeleted;
     bool                    mSafeDeleteReady;
 
+    /// Deferred integration.
+    U32                     mDeferredIntegration;
+    b2AABB                  mDeferredTickAABB;
+    b2Vec2                  mDeferredTickDisplacement;
+    Vector<const char*>     mDeferredCallbacks;
+
     /// Destroy notifications.
     typeDestroyNotificationVector mDestroyNotifyList;
 
@@ -232,6 +238,31 @@ protected:
     void                    resetTickSpatials( const bool resize = false );
     inline bool             getSpatialDirty( void ) const { return mSpatialDirty; }
 
+    /// Deferred integration.
+    enum DeferredIntegration
+    {
+        DEFERRED_WORLD_QUERY_UPDATE = BIT(0),
+        DEFERRED_SAFE_DELETE        = BIT(1),
+        DEFERRED_ATTACHED_GUI       = BIT(2),
+        DEFERRED_CAMERA_MOUNT       = BIT(3),
+        DEFERRED_COMPONENTS_UPDATE  = BIT(4),
+    };
+    inline bool             getIntegratingInParallel( void ) const { return mpScene.notNull() && mpScene->getParallelIntegrationActive(); }
+    void                    performCallback( const char* pCallbackName );
+
+    /// Integration state.
+    /// Parallel-safe objects save and restore everything their integration stages change so that the
+    /// scene's determinism check can integrate them serially and then in parallel from the same state.
+    virtual void            saveIntegrationState( Vector<U8>& state ) const;
+    virtual const U8*       restoreIntegrationState( const U8* pState );
+    template<typename T> static inline void saveIntegrationValue( Vector<U8>& state, const T& value )
+    {
+        const U32 offset = state.size();
+        state.increment( sizeof(T) );
+        dMemcpy( state.address() + offset, &value, sizeof(T) );
+    }
+    template<typename T> static inline const U8* restoreIntegrationValue( const U8* pState, T& value ) { dMemcpy( &value, pState, sizeof(T) ); return pState + sizeof(T); }
+
     /// Contact processing.
     void                    initializeContactGathering( void );
 
@@ -256,6 +287,13 @@ public:
     virtual void            interpolateObject( const F32 timeDelta );
     inline bool             getIsEditorTickAllowed( void ) const { return mEditorTickAllowed; }
 
+    /// Parallel integration.
+    /// Objects that return true here have their integration stages called from worker threads
+    /// when the scene has parallel integration enabled.  Anything that is not thread-safe such
+    /// as script callbacks or world-query updates must be deferred until processDeferredIntegration().
+    virtual bool            getParallelIntegrationSafe( void ) const { return false; }
+    virtual void            processDeferredIntegration( void );
+
     /// Render batching.
     inline void             setBatchIsolated( const bool batchIsolated ) { mBatchIsolated = batchIsolated; }
     virtual bool            getBatchIsolated( void ) { return mBatchIsolated; }
@@ -293,7 +331,7 @@ public:
     inline U32              getSceneLayerMask( void ) const             { return mSceneLayerMask; }
 
     /// Scene Layer depth.
-    inline void             setSceneLayerDepth( const F32 order )       { mSceneLayerDepth = order; };
+    void                    setSceneLayerDepth( const F32 order );
     inline F32              getSceneLayerDepth( void ) const            { return mSceneLayerDepth; }
     bool                    setSceneLayerDepthFront( void );
     bool                    setSceneLayerDepthBack( void );
@@ -96,6 +96,9 @@ public:
     virtual bool validRender( void ) const { return (mPolygonLocalList.size() > 0 || mIsCircle); }
     virtual bool shouldRender( void ) const { return true; }
 
+    /// Parallel integration.
+    virtual bool getParallelIntegrationSafe( void ) const { return true; }
+
     /// Render batching.
     virtual bool isBatchRendered( void ) { return false; }
 
@@ -57,7 +57,9 @@ SkeletonObject::SkeletonObject() :  mPreTickTime( 0.0f ),
                                     mAnimationFinished(true),
                                     mAnimationDuration(0.0),
                                     mFlipX(false),
-                                    mFlipY(false)
+                                    mFlipY(false),
+                                    mDeferredComposition(false),
+                                    mDeferredAnimationFinished(false)
 {
     mCurrentAnimation = StringTable->insert("");
     mSkeletonScale.SetZero();
@@ -103,6 +105,27 @@ void SkeletonObject::preIntegrate( const F32 totalTime, const F32 elapsedTime, D
     mPreTickTime = mPostTickTime;
     mPostTickTime = totalTime;
     
+    // Are we integrating in parallel?
+    if ( getIntegratingInParallel() )
+    {
+        // Yes, so only update the skeleton here as the sprites and callbacks must be updated on the main thread.
+        if ( updateSkeleton( mPreTickTime ) )
+            mDeferredAnimationFinished = true;
+
+        mDeferredComposition = true;
+
+        // Are the spatials dirty?
+        if ( getSpatialDirty() )
+        {
+            // Yes, so update the world transform.
+            setBatchTransform( getRenderTransform() );
+        }
+
+        // Call parent.
+        Parent::preIntegrate( totalTime, elapsedTime, pDebugStats );
+        return;
+    }
+
     // Update composition at pre-tick time.
     updateComposition( mPreTickTime );
     
@@ -113,12 +136,8 @@ void SkeletonObject::preIntegrate( const F32 totalTime, const F32 elapsedTime, D
         setBatchTransform( getRenderTransform() );
     }
     
-    // Are the render extents dirty?
-    if ( getLocalExtentsDirty() )
-    {
-        // Yes, so set size as local extents.
-        setSize( getLocalExtents() );
-    }
+    // Update the size from the local extents.
+    updateBatchExtents();
     
     // Call parent.
     Parent::preIntegrate( totalTime, elapsedTime, pDebugStats );
@@ -126,6 +145,36 @@ void SkeletonObject::preIntegrate( const F32 totalTime, const F32 elapsedTime, D
 
 //-----------------------------------------------------------------------------
 
+void SkeletonObject::processDeferredIntegration( void )
+{
+    // Is the composition deferred?
+    if ( mDeferredComposition )
+    {
+        mDeferredComposition = false;
+
+        // Yes, so update the sprites from the skeleton updated by the worker.
+        updateSprites();
+        updateBatchExtents();
+    }
+
+    // Keep a reference as the callbacks may delete the object.
+    SimObjectPtr<SkeletonObject> pSkeletonObject( this );
+
+    // Call parent.
+    Parent::processDeferredIntegration();
+
+    // Finish if the object was deleted or the animation did not finish.
+    if ( pSkeletonObject.isNull() || !mDeferredAnimationFinished )
+        return;
+
+    mDeferredAnimationFinished = false;
+
+    // Do the animation callback.
+    onAnimationFinished();
+}
+
+//-----------------------------------------------------------------------------
+
 void SkeletonObject::integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
 {
     // Call Parent.
@@ -337,6 +386,7 @@ void SkeletonObject::generateComposition( void )
     // Clear existing visualization
     clearSprites();
     mSkeletonSprites.clear();
+    mSkeletonAttachments.clear();
     
     // Finish if skeleton asset isn't available.
     if ( mSkeletonAsset.isNull() )
@@ -382,10 +432,34 @@ void SkeletonObject::generateComposition( void )
 
 void SkeletonObject::updateComposition( const F32 time )
 {
+    // Update the skeleton then the sprites.
+    const bool animationFinished = updateSkeleton( time );
+    updateSprites();
+    
+    if ( animationFinished )
+        onAnimationFinished();
+}
+
+//-----------------------------------------------------------------------------
+
+bool SkeletonObject::updateSkeleton( const F32 time )
+{
+    // Finish if there is no skeleton.
+    if ( mSkeleton == NULL )
+        return false;
+    
     // Update position/orientation/state of visualization
     float delta = (time - mLastFrameTime) * mTimeScale;
     mLastFrameTime = time;
     
+    mSkeleton->r = mBlendColor.red;
+    mSkeleton->g = mBlendColor.green;
+    mSkeleton->b = mBlendColor.blue;
+    mSkeleton->a = mBlendColor.alpha;
+    
+    mSkeleton->flipX = getFlipX();
+    mSkeleton->flipY = getFlipY();
+    
     spSkeleton_update(mSkeleton, delta);
     
     if (!mAnimationFinished)
@@ -396,11 +470,38 @@ void SkeletonObject::updateComposition( const F32 time )
     
     spSkeleton_updateWorldTransform(mSkeleton);
     
+    if (mLastFrameTime >= mTotalAnimationTime)
+        mAnimationFinished = true;
+    
+    if (mAnimationFinished && !mAnimationCycle)
+        return true;
+    
+    mAnimationFinished = false;
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonObject::updateSprites( void )
+{
+    // Finish if there is no skeleton.
+    if ( mSkeleton == NULL )
+        return;
+    
+    // Has the slot count changed?
+    if ( mSkeletonSprites.size() != (U32)mSkeleton->slotCount )
+    {
+        // Yes, so start a new set of sprites.
+        clearSprites();
+        mSkeletonSprites.setSize( mSkeleton->slotCount );
+        mSkeletonAttachments.setSize( mSkeleton->slotCount );
+        dMemset( mSkeletonSprites.address(), 0, mSkeletonSprites.memSize() );
+        dMemset( mSkeletonAttachments.address(), 0, mSkeletonAttachments.memSize() );
+    }
+    
     // Get the ImageAsset used by the sprites
     StringTableEntry assetId = (*mSkeletonAsset).mImageAsset.getAssetId();
     
-    clearSprites();
-    
     Vector2 vertices[4];
     
     F32 vertexPositions[8];
@@ -408,25 +509,41 @@ void SkeletonObject::updateComposition( const F32 time )
     {
         spSlot* slot = mSkeleton->slots[i];
         spAttachment* attachment = slot->attachment;
+        SpriteBatchItem* pSprite = mSkeletonSprites[i];
         
         if (!attachment || attachment->type != ATTACHMENT_REGION)
+        {
+            // Hide any sprite the slot had.
+            if ( pSprite != NULL )
+                pSprite->setVisible( false );
+            
             continue;
+        }
+        
+        // Create the slot sprite if it doesn't exist.
+        if ( pSprite == NULL )
+        {
+            pSprite = SpriteBatch::createSprite();
+            pSprite->setImage(assetId);
+            mSkeletonSprites[i] = pSprite;
+        }
+        
+        // Update the frame only if the attachment changed.
+        if ( mSkeletonAttachments[i] != attachment )
+        {
+            pSprite->setNamedImageFrame(attachment->name);
+            mSkeletonAttachments[i] = attachment;
+        }
         
         spRegionAttachment* regionAttachment = (spRegionAttachment*)attachment;
         spRegionAttachment_computeWorldVertices(regionAttachment, slot->skeleton->x, slot->skeleton->y, slot->bone, vertexPositions);
         
-        SpriteBatchItem* pSprite = SpriteBatch::createSprite();
-
+        pSprite->setVisible(true);
         pSprite->setDepth(mSceneLayerDepth);
         
         pSprite->setSrcBlendFactor(mSrcBlendFactor);
         pSprite->setDstBlendFactor(mDstBlendFactor);
         
-        mSkeleton->r = mBlendColor.red;
-        mSkeleton->g = mBlendColor.green;
-        mSkeleton->b = mBlendColor.blue;
-        mSkeleton->a = mBlendColor.alpha;
-        
         F32 alpha = mSkeleton->a * slot->a;
         pSprite->setBlendColor(ColorF(
             mSkeleton->r * slot->r * alpha,
@@ -435,9 +552,6 @@ void SkeletonObject::updateComposition( const F32 time )
             alpha
         ));
         
-        mSkeleton->flipX = getFlipX();
-        mSkeleton->flipY = getFlipY();
-        
         vertices[0].x = vertexPositions[VERTEX_X1];
         vertices[0].y = vertexPositions[VERTEX_Y1];
         vertices[1].x = vertexPositions[VERTEX_X4];
@@ -447,21 +561,21 @@ void SkeletonObject::updateComposition( const F32 time )
         vertices[3].x = vertexPositions[VERTEX_X2];
         vertices[3].y = vertexPositions[VERTEX_Y2];
         pSprite->setExplicitVertices(vertices);
-        
-        pSprite->setImage(assetId);
-        pSprite->setNamedImageFrame(attachment->name);
     }
     
-    if (mLastFrameTime >= mTotalAnimationTime)
-        mAnimationFinished = true;
-    
-    if (mAnimationFinished && !mAnimationCycle)
-    {
-        onAnimationFinished();
-    }
-    else
+    // The sprites have moved so the extents need recalculating.
+    setLocalExtentsDirty();
+}
+
+//-----------------------------------------------------------------------------
+
+void SkeletonObject::updateBatchExtents( void )
+{
+    // Are the render extents dirty?
+    if ( getLocalExtentsDirty() )
     {
-        mAnimationFinished = false;
+        // Yes, so set size as local extents.
+        setSize( getLocalExtents() );
     }
 }
 
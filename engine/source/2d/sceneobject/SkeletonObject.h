@@ -44,7 +44,11 @@ protected:
     
 private:
     typedef Vector<SpriteBatchItem*> typeSkeletonSpritesVector;
-    typeSkeletonSpritesVector   mSkeletonSprites;
+    typedef Vector<spAttachment*> typeSkeletonAttachmentsVector;
+
+    /// Sprites and the attachments they show, indexed by slot.
+    typeSkeletonSpritesVector       mSkeletonSprites;
+    typeSkeletonAttachmentsVector   mSkeletonAttachments;
     
     AssetPtr<SkeletonAsset>     mSkeletonAsset;
     spSkeleton*                 mSkeleton;
@@ -68,7 +72,8 @@ private:
     bool                        mFlipX;
     bool                        mFlipY;
     
-    
+    bool                        mDeferredComposition;
+    bool                        mDeferredAnimationFinished;
     
 public:
     SkeletonObject();
@@ -80,6 +85,10 @@ public:
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
     virtual void interpolateObject( const F32 timeDelta );
     
+    /// Parallel integration.
+    virtual bool getParallelIntegrationSafe( void ) const { return true; }
+    virtual void processDeferredIntegration( void );
+    
     virtual void copyTo( SimObject* object );
     
     virtual bool canPrepareRender( void ) const { return true; }
@@ -129,6 +138,9 @@ public:
 protected:
     void generateComposition( void );
     void updateComposition( const F32 time );
+    bool updateSkeleton( const F32 time );
+    void updateSprites( void );
+    void updateBatchExtents( void );
     
 protected:
     static bool setSkeletonAsset( void* obj, const char* data )                  { static_cast<SkeletonObject*>(obj)->setSkeletonAsset(data); return false; }
@@ -32,6 +32,10 @@
 #include "string/stringBuffer.h"
 #endif
 
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
 // Script bindings.
 #include "Sprite_ScriptBinding.h"
 
@@ -54,6 +54,9 @@ public:
 
     virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer );
 
+    /// Parallel integration.
+    virtual bool getParallelIntegrationSafe( void ) const { return true; }
+
     /// Declare Console Object.
     DECLARE_CONOBJECT( Sprite );
 
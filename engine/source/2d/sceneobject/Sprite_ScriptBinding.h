@@ -95,3 +95,130 @@ ConsoleMethodWithDocs(Sprite, getFlipY, ConsoleBool, 2, 2, ())
 }
 
 ConsoleMethodGroupEndWithDocs(Sprite)
+
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin( SpriteBenchmark, "Sprite benchmark functionality.");
+
+/*! Times finding a sprite's fields, setting and getting sprite fields by name as script does and reading a sprite with TAML.
+    Field finding is timed against a linear scan of the field list as well as the class field index.
+    The TAML file is written with all defaults to a temporary file that is removed afterwards.
+    @param passes The number of field finding and field access passes, defaults to 2000.
+    @param reads The number of TAML reads, defaults to 200.
+    @return The times taken in milliseconds formatted as "linearFindTime indexedFindTime accessTime tamlReadTime" or nothing if the benchmark could not run.
+*/
+ConsoleFunctionWithDocs( runSpriteFieldBenchmark, ConsoleString, 1, 3, ([passes], [reads]))
+{
+   // Fetch the configuration.
+   const U32 passes = argc < 2 ? 2000 : getMax( dAtoi(argv[1]), 1 );
+   const U32 reads = argc < 3 ? 200 : getMax( dAtoi(argv[2]), 1 );
+
+   // Fetch the sprite fields.
+   AbstractClassRep* pClassRep = AbstractClassRep::findClassRep( "Sprite" );
+   const AbstractClassRep::FieldList& fields = pClassRep->mFieldList;
+   const U32 fieldCount = fields.size();
+
+   // Time finding the fields with a linear scan.
+   U32 linearFound = 0;
+   const U32 linearStartTime = Platform::getRealMilliseconds();
+   for ( U32 pass = 0; pass < passes; ++pass )
+   {
+      for ( U32 index = 0; index < fieldCount; ++index )
+      {
+         StringTableEntry fieldName = fields[index].pFieldname;
+         for ( U32 scanIndex = 0; scanIndex < fieldCount; ++scanIndex )
+         {
+            if ( fields[scanIndex].pFieldname == fieldName )
+            {
+               linearFound++;
+               break;
+            }
+         }
+      }
+   }
+   const U32 linearTime = Platform::getRealMilliseconds() - linearStartTime;
+
+   // Time finding the fields with the field index.
+   U32 indexedFound = 0;
+   const U32 indexedStartTime = Platform::getRealMilliseconds();
+   for ( U32 pass = 0; pass < passes; ++pass )
+   {
+      for ( U32 index = 0; index < fieldCount; ++index )
+      {
+         if ( pClassRep->findField( fields[index].pFieldname ) != NULL )
+            indexedFound++;
+      }
+   }
+   const U32 indexedTime = Platform::getRealMilliseconds() - indexedStartTime;
+
+   if ( linearFound != indexedFound )
+      Con::warnf( "runSpriteFieldBenchmark() - The field index found %d fields but a linear scan found %d.", indexedFound, linearFound );
+
+   // Create a sprite.
+   Sprite* pSprite = new Sprite();
+   if ( !pSprite->registerObject() )
+   {
+      Con::warnf( "runSpriteFieldBenchmark() - Could not register a sprite." );
+      delete pSprite;
+      return StringTable->EmptyString;
+   }
+
+   // Time setting and getting fields by name.
+   StringTableEntry angleField = StringTable->insert( "Angle" );
+   StringTableEntry sizeField = StringTable->insert( "Size" );
+   StringTableEntry flipXField = StringTable->insert( "FlipX" );
+   const U32 accessStartTime = Platform::getRealMilliseconds();
+   for ( U32 pass = 0; pass < passes; ++pass )
+   {
+      pSprite->setDataField( angleField, NULL, "45" );
+      pSprite->setDataField( sizeField, NULL, "2 3" );
+      pSprite->setDataField( flipXField, NULL, "1" );
+      pSprite->getDataField( angleField, NULL );
+      pSprite->getDataField( sizeField, NULL );
+      pSprite->getDataField( flipXField, NULL );
+   }
+   const U32 accessTime = Platform::getRealMilliseconds() - accessStartTime;
+
+   // Write the sprite with all its fields.
+   StringTableEntry tamlFile = Platform::getTemporaryFileName();
+   Taml taml;
+   taml.setAutoFormat( false );
+   taml.setWriteDefaults( true );
+   const bool written = taml.write( pSprite, tamlFile );
+   pSprite->deleteObject();
+   if ( !written )
+   {
+      Con::warnf( "runSpriteFieldBenchmark() - Could not write a sprite to '%s'.", tamlFile );
+      return StringTable->EmptyString;
+   }
+
+   // Time reading the sprite.
+   U32 readFailures = 0;
+   const U32 tamlStartTime = Platform::getRealMilliseconds();
+   for ( U32 index = 0; index < reads; ++index )
+   {
+      Sprite* pReadSprite = taml.read<Sprite>( tamlFile );
+      if ( pReadSprite == NULL )
+      {
+         readFailures++;
+         continue;
+      }
+      pReadSprite->deleteObject();
+   }
+   const U32 tamlTime = Platform::getRealMilliseconds() - tamlStartTime;
+
+   Platform::fileDelete( tamlFile );
+
+   if ( readFailures > 0 )
+      Con::warnf( "runSpriteFieldBenchmark() - %d TAML reads failed.", readFailures );
+
+   // Report.
+   Con::printf( "Sprite field benchmark: %d fields, %d passes, find linear %dms, find indexed %dms, access %dms, %d TAML reads %dms.",
+      fieldCount, passes, linearTime, indexedTime, accessTime, reads, tamlTime );
+
+   char* pBuffer = Con::getReturnBuffer( 64 );
+   dSprintf( pBuffer, 64, "%d %d %d %d", linearTime, indexedTime, accessTime, tamlTime );
+   return pBuffer;
+}
+
+ConsoleFunctionGroupEnd( SpriteBenchmark );
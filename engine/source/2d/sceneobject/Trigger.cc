@@ -110,7 +110,8 @@ void Trigger::integrateObject( const F32 totalTime, const F32 elapsedTime, Debug
 
         for ( collideCallbackType::iterator contactItr = mEnterColliders.begin(); contactItr != mEnterColliders.end(); ++contactItr )
         {
-            Con::executef(this, 2, "onEnter", (*contactItr)->getIdString());
+            Con::TypedArg arg( *contactItr );
+            Con::executeTyped( this, "onEnter", 1, &arg );
         }
     }
 
@@ -131,7 +132,8 @@ void Trigger::integrateObject( const F32 totalTime, const F32 elapsedTime, Debug
             // Fetch colliding object.
             SceneObject* pCollideWidth = contactItr->getCollideWith( this );
 
-            Con::executef(this, 2, "onStay", pCollideWidth->getIdString());
+            Con::TypedArg arg( pCollideWidth );
+            Con::executeTyped( this, "onStay", 1, &arg );
         }
     }
 
@@ -143,7 +145,8 @@ void Trigger::integrateObject( const F32 totalTime, const F32 elapsedTime, Debug
 
         for ( collideCallbackType::iterator contactItr = mLeaveColliders.begin(); contactItr != mLeaveColliders.end(); ++contactItr )
         {
-            Con::executef(this, 2, "onLeave", (*contactItr)->getIdString());
+            Con::TypedArg arg( *contactItr );
+            Con::executeTyped( this, "onLeave", 1, &arg );
         }
     }
 }
@@ -0,0 +1,262 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "assets/assetLoader.h"
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _GBITMAP_H_
+#include "graphics/gBitmap.h"
+#endif
+
+#ifndef _BITMAP_DECODER_H_
+#include "graphics/bitmapDecoder.h"
+#endif
+
+#ifndef TINYXML_INCLUDED
+#include "persistence/tinyXML/tinyxml.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+AssetLoader::LoadRequest::LoadRequest() :
+    mAssetId( StringTable->EmptyString ),
+    mAssetFilePath( StringTable->EmptyString ),
+    mParseXml( false ),
+    mGroupId( 0 ),
+    mpDocument( NULL ),
+    mLoadedSemaphore( 0 ),
+    mLoaded( false )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+AssetLoader::LoadRequest::~LoadRequest()
+{
+    // Delete the document.
+    delete mpDocument;
+
+    // Delete any bitmaps that were not handed over.
+    for ( S32 index = 0; index < mBitmaps.size(); ++index )
+        delete mBitmaps[index].mpBitmap;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetLoader::WorkerThread::run( void* arg )
+{
+    while( true )
+    {
+        // Wait for work.
+        mpAssetLoader->mWorkSemaphore.acquire();
+
+        // Finish if the loader is shutting down.
+        if ( checkForStop() || mpAssetLoader->mShutdown )
+            return;
+
+        // Fetch the next request.
+        LoadRequest* pRequest = mpAssetLoader->popRequest();
+
+        // Load it if it wasn't taken by a waiting thread.
+        if ( pRequest != NULL )
+            loadRequest( pRequest );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+AssetLoader::AssetLoader( const U32 workerCount ) :
+    mPendingIndex( 0 ),
+    mWorkSemaphore( 0 ),
+    mShutdown( false )
+{
+    VECTOR_SET_ASSOCIATION( mWorkers );
+    VECTOR_SET_ASSOCIATION( mPendingRequests );
+
+    // Start the workers.
+    for ( U32 n = 0; n < workerCount; ++n )
+    {
+        WorkerThread* pWorker = new WorkerThread( this );
+        mWorkers.push_back( pWorker );
+        pWorker->start();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+AssetLoader::~AssetLoader()
+{
+    // Flag shutdown and wake all the workers.
+    mShutdown = true;
+    for ( S32 n = 0; n < mWorkers.size(); ++n )
+    {
+        mWorkers[n]->stop();
+        mWorkSemaphore.release();
+    }
+
+    // Wait for the workers to finish.
+    for ( S32 n = 0; n < mWorkers.size(); ++n )
+    {
+        mWorkers[n]->join();
+        delete mWorkers[n];
+    }
+
+    mWorkers.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetLoader::queueRequest( LoadRequest* pRequest )
+{
+    // Sanity!
+    AssertFatal( pRequest != NULL, "AssetLoader::queueRequest() - Invalid request." );
+    AssertFatal( !pRequest->mLoaded, "AssetLoader::queueRequest() - Request is already loaded." );
+
+    // Load it now if there are no workers.
+    if ( mWorkers.size() == 0 )
+    {
+        loadRequest( pRequest );
+        return;
+    }
+
+    // Queue the request.
+    mPendingMutex.lock();
+    mPendingRequests.push_back( pRequest );
+    mPendingMutex.unlock();
+
+    // Wake a worker.
+    mWorkSemaphore.release();
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetLoader::waitForRequest( LoadRequest* pRequest )
+{
+    // Finish if already loaded.
+    if ( isRequestLoaded( pRequest ) )
+        return;
+
+    // Load it here if no worker has started it.
+    if ( removeRequest( pRequest ) )
+        loadRequest( pRequest );
+
+    // Wait for the request to be released.
+    pRequest->mLoadedSemaphore.acquire();
+    pRequest->mLoaded = true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetLoader::isRequestLoaded( LoadRequest* pRequest )
+{
+    // Finish if already acquired.
+    if ( pRequest->mLoaded )
+        return true;
+
+    // Acquire the request if it has been released.
+    if ( !pRequest->mLoadedSemaphore.acquire( false ) )
+        return false;
+
+    pRequest->mLoaded = true;
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+AssetLoader::LoadRequest* AssetLoader::popRequest( void )
+{
+    MutexHandle mutex;
+    mutex.lock( &mPendingMutex, true );
+
+    // Finish if there are no pending requests.
+    if ( mPendingIndex == (U32)mPendingRequests.size() )
+        return NULL;
+
+    // Fetch the oldest request.
+    LoadRequest* pRequest = mPendingRequests[mPendingIndex++];
+
+    // Reset the queue once it's drained.
+    if ( mPendingIndex == (U32)mPendingRequests.size() )
+    {
+        mPendingRequests.clear();
+        mPendingIndex = 0;
+    }
+
+    return pRequest;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetLoader::removeRequest( LoadRequest* pRequest )
+{
+    MutexHandle mutex;
+    mutex.lock( &mPendingMutex, true );
+
+    for ( U32 index = mPendingIndex; index < (U32)mPendingRequests.size(); ++index )
+    {
+        if ( mPendingRequests[index] == pRequest )
+        {
+            // Leave a hole so the order is preserved; the workers skip it.
+            mPendingRequests[index] = NULL;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetLoader::loadRequest( LoadRequest* pRequest )
+{
+    // Is the asset file XML?
+    if ( pRequest->mParseXml )
+    {
+        // Yes, so parse it.
+        FileStream stream;
+        if ( stream.open( pRequest->mAssetFilePath, FileStream::Read ) )
+        {
+            TiXmlDocument* pDocument = new TiXmlDocument();
+
+            // Keep the document if it parsed, otherwise the asset manager will report the failure when it reads the file itself.
+            if ( pDocument->LoadFile( stream ) )
+                pRequest->mpDocument = pDocument;
+            else
+                delete pDocument;
+
+            stream.close();
+        }
+    }
+
+    // Decode the bitmaps in the layout their textures are uploaded in.
+    for ( S32 index = 0; index < pRequest->mBitmaps.size(); ++index )
+    {
+        LoadBitmap& bitmap = pRequest->mBitmaps[index];
+        bitmap.mpBitmap = BitmapDecoder::decode( bitmap.mBitmapFile, BitmapDecoder::PowerOfTwo );
+    }
+
+    // Release the request to the thread waiting for it.  This must be the last time the request is touched.
+    pRequest->mLoadedSemaphore.release();
+}
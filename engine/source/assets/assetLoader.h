@@ -0,0 +1,136 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ASSET_LOADER_H_
+#define _ASSET_LOADER_H_
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class GBitmap;
+class TiXmlDocument;
+
+//-----------------------------------------------------------------------------
+
+/// Notifications for asynchronous asset loads.  These are always called on the main thread.
+class AssetLoadCallback
+{
+public:
+    virtual ~AssetLoadCallback() {}
+
+    /// Called when an asynchronously loaded asset has finished loading or failed to load.
+    virtual void onAssetLoaded( StringTableEntry assetId, const bool success ) {}
+
+    /// Called when all the assets in an asynchronous load group have finished.
+    virtual void onAssetLoadGroupComplete( const U32 groupId ) {}
+};
+
+//-----------------------------------------------------------------------------
+
+/// The background stage of asynchronous asset loading.
+///
+/// Worker threads read and parse the asset file (XML only) and decode any PNG/JPEG
+/// loose files of each request.  Nothing here touches the console or the simulation;
+/// the asset manager finalizes each request on the main thread once it is loaded.
+class AssetLoader
+{
+public:
+    struct LoadBitmap
+    {
+        StringTableEntry    mBitmapFile;
+        GBitmap*            mpBitmap;
+    };
+
+    struct LoadRequest
+    {
+        LoadRequest();
+        ~LoadRequest();
+
+        /// Request state, set on the main thread before the request is queued.
+        StringTableEntry    mAssetId;
+        StringTableEntry    mAssetFilePath;
+        bool                mParseXml;
+        U32                 mGroupId;
+        Vector<LoadBitmap>  mBitmaps;
+
+        /// Load state, set on a worker thread.
+        TiXmlDocument*      mpDocument;
+
+        /// Released by the thread that loaded the request, and acquired once by the thread waiting for it.
+        Semaphore           mLoadedSemaphore;
+        bool                mLoaded;
+    };
+
+private:
+    class WorkerThread : public Thread
+    {
+    public:
+        WorkerThread( AssetLoader* pAssetLoader ) : Thread( 0, 0, false ), mpAssetLoader( pAssetLoader ) {}
+        virtual void run( void* arg = 0 );
+
+    private:
+        AssetLoader* mpAssetLoader;
+    };
+
+    Vector<WorkerThread*>   mWorkers;
+    Vector<LoadRequest*>    mPendingRequests;
+    U32                     mPendingIndex;
+    Mutex                   mPendingMutex;
+    Semaphore               mWorkSemaphore;
+    bool                    mShutdown;
+
+    LoadRequest*            popRequest( void );
+    bool                    removeRequest( LoadRequest* pRequest );
+    static void             loadRequest( LoadRequest* pRequest );
+
+public:
+    AssetLoader( const U32 workerCount );
+    ~AssetLoader();
+
+    /// Queue a request for the workers.  The loader does not take ownership of the request
+    /// but it must not be deleted until it is loaded or the loader is destroyed.
+    void                    queueRequest( LoadRequest* pRequest );
+
+    /// Wait for a request to be loaded, loading it on the calling thread if no worker has started it.
+    void                    waitForRequest( LoadRequest* pRequest );
+
+    /// Check if a request is loaded without waiting.  Once this returns true the workers
+    /// no longer touch the request and it can be deleted.
+    static bool             isRequestLoaded( LoadRequest* pRequest );
+};
+
+#endif // _ASSET_LOADER_H_
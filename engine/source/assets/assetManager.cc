@@ -54,6 +54,22 @@
 #include "console/consoleTypes.h"
 #endif
 
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
+#ifndef _BITMAP_DECODER_H_
+#include "graphics/bitmapDecoder.h"
+#endif
+
+#ifndef _STRINGUNIT_H_
+#include "string/stringUnit.h"
+#endif
+
+#ifndef _SAFE_DELETE_H_
+#include "memory/safeDelete.h"
+#endif
+
 // Script bindings.
 #include "assetManager_ScriptBinding.h"
 
@@ -68,15 +84,17 @@ AssetManager AssetDatabase;
 //-----------------------------------------------------------------------------
 
 AssetManager::AssetManager() :
+    mpAssetLoader( NULL ),
+    mAsyncLoadGroupMasterId( 0 ),
+    mEchoInfo( false ),
+    mIgnoreAutoUnload( false ),
     mLoadedInternalAssetsCount( 0 ),
     mLoadedExternalAssetsCount( 0 ),
     mLoadedPrivateAssetsCount( 0 ),
+    mAcquiredReferenceCount( 0 ),
     mMaxLoadedInternalAssetsCount( 0 ),
     mMaxLoadedExternalAssetsCount( 0 ),
-    mMaxLoadedPrivateAssetsCount( 0 ),
-    mAcquiredReferenceCount( 0 ),
-    mEchoInfo( false ),
-    mIgnoreAutoUnload( false )
+    mMaxLoadedPrivateAssetsCount( 0 )
 {
 }
 
@@ -95,6 +113,9 @@ bool AssetManager::onAdd()
 
 void AssetManager::onRemove()
 {
+    // Cancel any asynchronous loads.
+    cancelAsyncLoads();
+
     // Do we have an asset tags manifest?
     if ( !mAssetTagsManifest.isNull() )
     {
@@ -1003,6 +1024,191 @@ void AssetManager::purgeAssets( void )
 
 //-----------------------------------------------------------------------------
 
+U32 AssetManager::loadAssetAsync( const char* pAssetId, AssetLoadCallback* pCallback, SimObject* pCallbackObject )
+{
+    // Sanity!
+    AssertFatal( pAssetId != NULL, "Cannot load NULL asset Id." );
+
+    // Load as a group of one.
+    Vector<StringTableEntry> assetIds;
+    assetIds.push_back( StringTable->insert( pAssetId ) );
+    return loadAssetGroupAsync( assetIds, pCallback, pCallbackObject );
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AssetManager::loadAssetGroupAsync( const Vector<StringTableEntry>& assetIds, AssetLoadCallback* pCallback, SimObject* pCallbackObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_LoadAssetGroupAsync);
+
+    // Create the load group.
+    AsyncLoadGroup* pAsyncLoadGroup = new AsyncLoadGroup();
+    pAsyncLoadGroup->mGroupId = ++mAsyncLoadGroupMasterId;
+    pAsyncLoadGroup->mAssetCount = 0;
+    pAsyncLoadGroup->mFinishedCount = 0;
+    pAsyncLoadGroup->mpCallback = pCallback;
+    pAsyncLoadGroup->mCallbackObject = pCallbackObject;
+    mAsyncLoadGroups.insert( pAsyncLoadGroup->mGroupId, pAsyncLoadGroup );
+
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printf( "Asset Manager: Started asynchronous load group '%d'...", pAsyncLoadGroup->mGroupId );
+    }
+
+    // Queue the assets.
+    typeAsyncLoadQueuedHash queuedAssets;
+    for ( S32 index = 0; index < assetIds.size(); ++index )
+    {
+        // Skip empty asset Ids.
+        if ( assetIds[index] == NULL || *assetIds[index] == 0 )
+            continue;
+
+        queueAsyncLoad( pAsyncLoadGroup, StringTable->insert( assetIds[index] ), queuedAssets );
+    }
+
+    // Are there any assets to load?
+    if ( pAsyncLoadGroup->mAssetCount == 0 )
+    {
+        // No, so complete the group when the loads are next processed so the caller has the group Id before the callbacks.
+        mAsyncLoadEmptyGroups.push_back( pAsyncLoadGroup->mGroupId );
+    }
+
+    // Process the loads when time advances.
+    setProcessTicks( true );
+
+    return pAsyncLoadGroup->mGroupId;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::isAsyncLoadGroupComplete( const U32 groupId )
+{
+    // The group is removed once complete.
+    return mAsyncLoadGroups.find( groupId ) == mAsyncLoadGroups.end();
+}
+
+//-----------------------------------------------------------------------------
+
+F32 AssetManager::getAsyncLoadGroupProgress( const U32 groupId )
+{
+    // Find the load group.
+    typeAsyncLoadGroupHash::iterator groupItr = mAsyncLoadGroups.find( groupId );
+
+    // The group is removed once complete.
+    if ( groupItr == mAsyncLoadGroups.end() )
+        return 1.0f;
+
+    // Fetch load group.
+    AsyncLoadGroup* pAsyncLoadGroup = groupItr->value;
+
+    // An empty group has nothing left to load.
+    if ( pAsyncLoadGroup->mAssetCount == 0 )
+        return 1.0f;
+
+    return (F32)pAsyncLoadGroup->mFinishedCount / (F32)pAsyncLoadGroup->mAssetCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::processAsyncLoads( const U32 timeBudget )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_ProcessAsyncLoads);
+
+    const U32 startTime = Platform::getRealMilliseconds();
+
+    // Complete any groups that had nothing to load.
+    while ( mAsyncLoadEmptyGroups.size() > 0 )
+    {
+        const U32 groupId = mAsyncLoadEmptyGroups.front();
+        mAsyncLoadEmptyGroups.pop_front();
+
+        // Skip if the group is gone.
+        typeAsyncLoadGroupHash::iterator groupItr = mAsyncLoadGroups.find( groupId );
+        if ( groupItr == mAsyncLoadGroups.end() )
+            continue;
+
+        // Fetch the callbacks and remove the group.
+        AsyncLoadGroup* pAsyncLoadGroup = groupItr->value;
+        AssetLoadCallback* pCallback = pAsyncLoadGroup->mpCallback;
+        SimObject* pCallbackObject = pAsyncLoadGroup->mCallbackObject;
+        mAsyncLoadGroups.erase( groupId );
+        delete pAsyncLoadGroup;
+
+        completeAsyncLoadGroup( groupId, pCallback, pCallbackObject );
+    }
+
+    while ( mAsyncLoadRequests.size() > 0 )
+    {
+        // Fetch the oldest request.
+        AssetLoader::LoadRequest* pRequest = mAsyncLoadRequests.front();
+
+        // Finish if it's not loaded yet.  Requests are finalized in order so that dependencies are always loaded first.
+        if ( !AssetLoader::isRequestLoaded( pRequest ) )
+            break;
+
+        mAsyncLoadRequests.pop_front();
+
+        // Finalize the load.
+        const bool success = finalizeAsyncLoad( pRequest );
+        finishAsyncLoad( pRequest, success );
+        delete pRequest;
+
+        // Finish if we've used the time budget.
+        if ( Platform::getRealMilliseconds() - startTime >= timeBudget )
+            break;
+    }
+
+    // Stop processing if there's nothing left to load.
+    if ( mAsyncLoadRequests.size() == 0 && mAsyncLoadEmptyGroups.size() == 0 )
+        setProcessTicks( false );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::finishAsyncLoads( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_FinishAsyncLoads);
+
+    while ( mAsyncLoadRequests.size() > 0 || mAsyncLoadEmptyGroups.size() > 0 )
+    {
+        // Wait for the oldest request.
+        AssetLoader::LoadRequest* pRequest = mAsyncLoadRequests.size() > 0 ? mAsyncLoadRequests.front() : NULL;
+        if ( pRequest != NULL && !AssetLoader::isRequestLoaded( pRequest ) )
+            mpAssetLoader->waitForRequest( pRequest );
+
+        // Finalize everything that is loaded.
+        processAsyncLoads( U32_MAX );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::cancelAsyncLoads( void )
+{
+    // Stop the loader.  This waits for any requests the workers are loading.
+    SAFE_DELETE( mpAssetLoader );
+
+    // Delete the requests.
+    for ( S32 index = 0; index < mAsyncLoadRequests.size(); ++index )
+        delete mAsyncLoadRequests[index];
+    mAsyncLoadRequests.clear();
+
+    // Delete the groups.
+    for ( typeAsyncLoadGroupHash::iterator groupItr = mAsyncLoadGroups.begin(); groupItr != mAsyncLoadGroups.end(); ++groupItr )
+        delete groupItr->value;
+    mAsyncLoadGroups.clear();
+    mAsyncLoadEmptyGroups.clear();
+
+    // Stop processing.
+    setProcessTicks( false );
+}
+
+//-----------------------------------------------------------------------------
+
 bool AssetManager::deleteAsset( const char* pAssetId, const bool deleteLooseFiles, const bool deleteDependencies )
 {
     // Debug Profiling.
@@ -2962,6 +3168,243 @@ void AssetManager::unloadAsset( AssetDefinition* pAssetDefinition )
 
 //-----------------------------------------------------------------------------
 
+void AssetManager::addLoadedAsset( AssetDefinition* pAssetDefinition )
+{
+    // Increase loaded count.
+    pAssetDefinition->mAssetLoadedCount++;
+
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printf( "Asset Manager: > Loading asset into memory as object Id '%d' from file '%s'.",
+            pAssetDefinition->mpAssetBase->getId(), pAssetDefinition->mAssetBaseFilePath );
+    }
+
+    // Set ownership by asset manager.
+    pAssetDefinition->mpAssetBase->setOwned( this, pAssetDefinition );
+
+    // Is the asset internal?
+    if ( pAssetDefinition->mAssetInternal )
+    {
+        // Yes, so increase internal loaded asset count.
+        if ( ++mLoadedInternalAssetsCount > mMaxLoadedInternalAssetsCount )
+            mMaxLoadedInternalAssetsCount = mLoadedInternalAssetsCount;
+    }
+    else
+    {
+        // No, so increase external loaded assets count.
+        if ( ++mLoadedExternalAssetsCount > mMaxLoadedExternalAssetsCount )
+            mMaxLoadedExternalAssetsCount = mLoadedExternalAssetsCount;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::queueAsyncLoad( AsyncLoadGroup* pAsyncLoadGroup, StringTableEntry assetId, typeAsyncLoadQueuedHash& queuedAssets )
+{
+    // Finish if the asset is already queued in this group.
+    if ( queuedAssets.contains( assetId ) )
+        return;
+
+    queuedAssets.insert( assetId, true );
+
+    // Find asset.
+    AssetDefinition* pAssetDefinition = findAsset( assetId );
+
+    // Queue any dependencies first so they are finalized before the asset.
+    if ( pAssetDefinition != NULL && pAssetDefinition->mpAssetBase == NULL )
+    {
+        for( typeAssetDependsOnHash::iterator assetDependenciesItr = mAssetDependsOn.find( assetId ); assetDependenciesItr != mAssetDependsOn.end() && assetDependenciesItr->key == assetId; ++assetDependenciesItr )
+        {
+            queueAsyncLoad( pAsyncLoadGroup, assetDependenciesItr->value, queuedAssets );
+        }
+    }
+
+    // Create the request.
+    AssetLoader::LoadRequest* pRequest = new AssetLoader::LoadRequest();
+    pRequest->mAssetId = assetId;
+    pRequest->mGroupId = pAsyncLoadGroup->mGroupId;
+    pAsyncLoadGroup->mAssetCount++;
+    mAsyncLoadRequests.push_back( pRequest );
+
+    // Is there anything to load in the background?
+    if ( pAssetDefinition == NULL || pAssetDefinition->mpAssetBase != NULL )
+    {
+        // No, so it's ready to finalize.
+        pRequest->mLoaded = true;
+        return;
+    }
+
+    // Fetch the asset file.
+    pRequest->mAssetFilePath = pAssetDefinition->mAssetBaseFilePath;
+    pRequest->mParseXml = mTaml.getFileAutoFormatMode( pAssetDefinition->mAssetBaseFilePath ) == Taml::XmlFormat;
+
+    // Fetch any bitmap loose files.
+    Vector<StringTableEntry>& assetLooseFiles = pAssetDefinition->mAssetLooseFiles;
+    for ( Vector<StringTableEntry>::iterator looseFileItr = assetLooseFiles.begin(); looseFileItr != assetLooseFiles.end(); ++looseFileItr )
+    {
+        if ( !BitmapDecoder::isBitmapFile( *looseFileItr ) )
+            continue;
+
+        AssetLoader::LoadBitmap bitmap;
+        bitmap.mBitmapFile = *looseFileItr;
+        bitmap.mpBitmap = NULL;
+        pRequest->mBitmaps.push_back( bitmap );
+    }
+
+    // Create the loader if needed.
+    if ( mpAssetLoader == NULL )
+    {
+        const S32 workerCount = Con::getIntVariable( ASSET_MANAGER_ASYNC_LOAD_THREADS, 2 );
+        mpAssetLoader = new AssetLoader( (U32)getMax( workerCount, 0 ) );
+    }
+
+    // Queue the request.
+    mpAssetLoader->queueRequest( pRequest );
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::finalizeAsyncLoad( AssetLoader::LoadRequest* pRequest )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_FinalizeAsyncLoad);
+
+    // Find asset.
+    AssetDefinition* pAssetDefinition = findAsset( pRequest->mAssetId );
+
+    // Did we find the asset?
+    if ( pAssetDefinition == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "Asset Manager: Failed to load asset Id '%s' asynchronously as it does not exist.", pRequest->mAssetId );
+        return false;
+    }
+
+    // Finish if the asset was loaded whilst the request was in progress.
+    if ( pAssetDefinition->mpAssetBase != NULL )
+        return true;
+
+    // Hand any decoded bitmaps to the texture manager so initializing the asset doesn't decode them again.
+    for ( S32 index = 0; index < pRequest->mBitmaps.size(); ++index )
+    {
+        AssetLoader::LoadBitmap& bitmap = pRequest->mBitmaps[index];
+        if ( bitmap.mpBitmap == NULL )
+            continue;
+
+        TextureManager::addPreloadedBitmap( bitmap.mBitmapFile, bitmap.mpBitmap );
+        bitmap.mpBitmap = NULL;
+    }
+
+    // Flag asset as loading.
+    pAssetDefinition->mAssetLoading = true;
+
+    // Generate primary asset from the parsed document if we have one otherwise from the file.
+    if ( pRequest->mpDocument != NULL )
+        pAssetDefinition->mpAssetBase = mTaml.read<AssetBase>( *pRequest->mpDocument, pAssetDefinition->mAssetBaseFilePath );
+    else
+        pAssetDefinition->mpAssetBase = mTaml.read<AssetBase>( pAssetDefinition->mAssetBaseFilePath );
+
+    // Flag asset as finished loading.
+    pAssetDefinition->mAssetLoading = false;
+
+    // Did we generate the asset?
+    if ( pAssetDefinition->mpAssetBase == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "Asset Manager: Failed to load asset Id '%s' asynchronously as loading the asset file failed to return the asset: '%s'.",
+            pRequest->mAssetId, pAssetDefinition->mAssetBaseFilePath );
+
+        // Discard any unused bitmaps.
+        TextureManager::flushPreloadedBitmaps();
+        return false;
+    }
+
+    // Add the loaded asset.
+    addLoadedAsset( pAssetDefinition );
+
+    // Discard any bitmaps the asset didn't use.
+    TextureManager::flushPreloadedBitmaps();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::finishAsyncLoad( AssetLoader::LoadRequest* pRequest, const bool success )
+{
+    // Find the load group.
+    const U32 groupId = pRequest->mGroupId;
+    typeAsyncLoadGroupHash::iterator groupItr = mAsyncLoadGroups.find( groupId );
+
+    // Finish if the group is gone.
+    if ( groupItr == mAsyncLoadGroups.end() )
+        return;
+
+    // Fetch load group.
+    AsyncLoadGroup* pAsyncLoadGroup = groupItr->value;
+    pAsyncLoadGroup->mFinishedCount++;
+
+    // Fetch the callbacks.  Callbacks may start or cancel loads so nothing is used after them.
+    AssetLoadCallback* pCallback = pAsyncLoadGroup->mpCallback;
+    SimObject* pCallbackObject = pAsyncLoadGroup->mCallbackObject;
+    const bool groupComplete = pAsyncLoadGroup->mFinishedCount == pAsyncLoadGroup->mAssetCount;
+
+    // Remove the group if it's complete.
+    if ( groupComplete )
+    {
+        mAsyncLoadGroups.erase( groupId );
+        delete pAsyncLoadGroup;
+    }
+
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printf( "Asset Manager: Asynchronous load of asset Id '%s' %s.", pRequest->mAssetId, success ? "finished" : "failed" );
+    }
+
+    // Asset callbacks.
+    if ( pCallback != NULL )
+        pCallback->onAssetLoaded( pRequest->mAssetId, success );
+
+    if ( pCallbackObject != NULL && pCallbackObject->isMethod( "onAssetLoaded" ) )
+        Con::executef( pCallbackObject, 3, "onAssetLoaded", pRequest->mAssetId, Con::getBoolArg( success ) );
+
+    // Finish if the group isn't complete.
+    if ( !groupComplete )
+        return;
+
+    completeAsyncLoadGroup( groupId, pCallback, pCallbackObject );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::completeAsyncLoadGroup( const U32 groupId, AssetLoadCallback* pCallback, SimObject* pCallbackObject )
+{
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printf( "Asset Manager: ... Finished asynchronous load group '%d'.", groupId );
+    }
+
+    // Group callbacks.
+    if ( pCallback != NULL )
+        pCallback->onAssetLoadGroupComplete( groupId );
+
+    if ( pCallbackObject != NULL && pCallbackObject->isMethod( "onAssetLoadGroupComplete" ) )
+        Con::executef( pCallbackObject, 2, "onAssetLoadGroupComplete", Con::getIntArg( groupId ) );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::advanceTime( F32 timeDelta )
+{
+    // Finalize loaded assets within the time budget.
+    processAsyncLoads( (U32)getMax( Con::getIntVariable( ASSET_MANAGER_ASYNC_FINALIZE_BUDGET, 4 ), 1 ) );
+}
+
+//-----------------------------------------------------------------------------
+
 void AssetManager::onModulePreLoad( ModuleDefinition* pModuleDefinition )
 {
     // Debug Profiling.
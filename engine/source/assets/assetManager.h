@@ -59,17 +59,30 @@
 #include "assets/assetFieldTypes.h"
 #endif
 
+#ifndef _ASSET_LOADER_H_
+#include "assets/assetLoader.h"
+#endif
+
+#ifndef _TICKABLE_H_
+#include "platform/Tickable.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
 //-----------------------------------------------------------------------------
 
+#define ASSET_MANAGER_ASYNC_LOAD_THREADS        "$pref::AssetManager::AsyncLoadThreads"
+#define ASSET_MANAGER_ASYNC_FINALIZE_BUDGET     "$pref::AssetManager::AsyncFinalizeBudget"
+
+//-----------------------------------------------------------------------------
+
 class AssetPtrCallback;
 class AssetPtrBase;
 
 //-----------------------------------------------------------------------------
 
-class AssetManager : public SimObject, public ModuleCallbacks
+class AssetManager : public SimObject, public ModuleCallbacks, public virtual Tickable
 {
 private:
     typedef SimObject Parent;
@@ -82,6 +95,18 @@ private:
     typedef HashTable<typeAssetId, typeAssetId> typeAssetIsDependedOnHash;
     typedef HashMap<AssetPtrBase*, AssetPtrCallback*> typeAssetPtrRefreshHash;
 
+    /// Asynchronous load group.
+    struct AsyncLoadGroup
+    {
+        U32                         mGroupId;
+        U32                         mAssetCount;
+        U32                         mFinishedCount;
+        AssetLoadCallback*          mpCallback;
+        SimObjectPtr<SimObject>     mCallbackObject;
+    };
+    typedef HashMap<U32, AsyncLoadGroup*> typeAsyncLoadGroupHash;
+    typedef HashMap<typeAssetId, bool> typeAsyncLoadQueuedHash;
+
     /// Declared assets.
     typeDeclaredAssetsHash              mDeclaredAssets;
 
@@ -99,6 +124,13 @@ private:
     /// Asset pointer refresh notifications.
     typeAssetPtrRefreshHash             mAssetPtrRefreshNotifications;
 
+    /// Asynchronous loading.
+    AssetLoader*                        mpAssetLoader;
+    Vector<AssetLoader::LoadRequest*>   mAsyncLoadRequests;
+    typeAsyncLoadGroupHash              mAsyncLoadGroups;
+    Vector<U32>                         mAsyncLoadEmptyGroups;
+    U32                                 mAsyncLoadGroupMasterId;
+
     /// Miscellaneous.
     bool                                mEchoInfo;
     bool                                mIgnoreAutoUnload;
@@ -234,32 +266,8 @@ public:
                 return NULL;
             }
 
-            // Increase loaded count.
-            pAssetDefinition->mAssetLoadedCount++;
-
-            // Info.
-            if ( mEchoInfo )
-            {
-                Con::printf( "Asset Manager: > Loading asset into memory as object Id '%d' from file '%s'.",
-                    pAssetDefinition->mpAssetBase->getId(), pAssetDefinition->mAssetBaseFilePath );
-            }
-
-            // Set ownership by asset manager.
-            pAssetDefinition->mpAssetBase->setOwned( this, pAssetDefinition );
-
-            // Is the asset internal?
-            if ( pAssetDefinition->mAssetInternal )
-            {
-                // Yes, so increase internal loaded asset count.
-                if ( ++mLoadedInternalAssetsCount > mMaxLoadedInternalAssetsCount )
-                    mMaxLoadedInternalAssetsCount = mLoadedInternalAssetsCount;
-            }
-            else
-            {
-                // No, so increase external loaded assets count.
-                if ( ++mLoadedExternalAssetsCount > mMaxLoadedExternalAssetsCount )
-                    mMaxLoadedExternalAssetsCount = mLoadedExternalAssetsCount;
-            }
+            // Add the loaded asset.
+            addLoadedAsset( pAssetDefinition );
         }
         else if ( pAssetDefinition->mpAssetBase->getAcquiredReferenceCount() == 0 )
         {
@@ -322,6 +330,19 @@ public:
     bool releaseAsset( const char* pAssetId );
     void purgeAssets( void );
 
+    /// Asynchronous asset loading.
+    /// Assets are loaded into the idle state (not acquired) along with their dependencies.  Files are read, parsed
+    /// and any bitmap loose files decoded on worker threads then each asset is finalized on the main thread in the
+    /// order requested.  Callbacks must remain valid until their group completes or the loads are cancelled.
+    U32 loadAssetAsync( const char* pAssetId, AssetLoadCallback* pCallback = NULL, SimObject* pCallbackObject = NULL );
+    U32 loadAssetGroupAsync( const Vector<StringTableEntry>& assetIds, AssetLoadCallback* pCallback = NULL, SimObject* pCallbackObject = NULL );
+    bool isAsyncLoadGroupComplete( const U32 groupId );
+    F32 getAsyncLoadGroupProgress( const U32 groupId );
+    inline U32 getPendingAsyncLoadCount( void ) const { return (U32)mAsyncLoadRequests.size(); }
+    void processAsyncLoads( const U32 timeBudget );
+    void finishAsyncLoads( void );
+    void cancelAsyncLoads( void );
+
     /// Asset deletion.
     bool deleteAsset( const char* pAssetId, const bool deleteLooseFiles, const bool deleteDependencies );
 
@@ -381,6 +402,18 @@ private:
     void removeAssetDependencies( const char* pAssetId );
     void removeAssetLooseFiles( const char* pAssetId );
     void unloadAsset( AssetDefinition* pAssetDefinition );
+    void addLoadedAsset( AssetDefinition* pAssetDefinition );
+
+    /// Asynchronous loading.
+    void queueAsyncLoad( AsyncLoadGroup* pAsyncLoadGroup, StringTableEntry assetId, typeAsyncLoadQueuedHash& queuedAssets );
+    bool finalizeAsyncLoad( AssetLoader::LoadRequest* pRequest );
+    void finishAsyncLoad( AssetLoader::LoadRequest* pRequest, const bool success );
+    void completeAsyncLoadGroup( const U32 groupId, AssetLoadCallback* pCallback, SimObject* pCallbackObject );
+
+    /// Tickable.
+    virtual void interpolateTick( F32 delta ) {}
+    virtual void processTick( void ) {}
+    virtual void advanceTime( F32 timeDelta );
 
     /// Module callbacks.
     virtual void onModulePreLoad( ModuleDefinition* pModuleDefinition );
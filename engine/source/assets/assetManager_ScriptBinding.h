@@ -949,4 +949,98 @@ ConsoleMethodWithDocs( AssetManager, dumpDeclaredAssets, ConsoleVoid, 2, 2, ())
     return object->dumpDeclaredAssets();
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Loads the specified asset in the background.
+    The asset and its dependencies are loaded but not acquired.
+    @param assetId The asset Id to load.
+    @param callbackObject An optional object that receives "onAssetLoaded(assetId, success)" and "onAssetLoadGroupComplete(groupId)" callbacks.
+    @return Returns the load group Id.
+*/
+ConsoleMethodWithDocs( AssetManager, loadAssetAsync, ConsoleInt, 3, 4, (assetId, [callbackObject]))
+{
+    // Fetch the callback object.
+    SimObject* pCallbackObject = argc > 3 ? Sim::findObject( argv[3] ) : NULL;
+
+    return object->loadAssetAsync( argv[2], NULL, pCallbackObject );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Loads the specified assets in the background as a group.
+    The assets and their dependencies are loaded but not acquired.
+    @param assetIds A space-separated list of asset Ids to load.
+    @param callbackObject An optional object that receives "onAssetLoaded(assetId, success)" and "onAssetLoadGroupComplete(groupId)" callbacks.
+    A group with no asset Ids still receives "onAssetLoadGroupComplete(groupId)" when the loads are next processed.
+    @return Returns the load group Id.
+*/
+ConsoleMethodWithDocs( AssetManager, loadAssetGroupAsync, ConsoleInt, 3, 4, (assetIds, [callbackObject]))
+{
+    // Fetch the asset Ids.
+    Vector<StringTableEntry> assetIds;
+    const U32 assetIdCount = StringUnit::getUnitCount( argv[2], " \t\n" );
+    for ( U32 index = 0; index < assetIdCount; ++index )
+    {
+        assetIds.push_back( StringTable->insert( StringUnit::getUnit( argv[2], index, " \t\n" ) ) );
+    }
+
+    // Fetch the callback object.
+    SimObject* pCallbackObject = argc > 3 ? Sim::findObject( argv[3] ) : NULL;
+
+    return object->loadAssetGroupAsync( assetIds, NULL, pCallbackObject );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Checks whether the specified load group has finished loading.
+    @param groupId The load group Id.
+    @return Returns true if the load group has finished loading, false otherwise.
+*/
+ConsoleMethodWithDocs( AssetManager, isAsyncLoadGroupComplete, ConsoleBool, 3, 3, (groupId))
+{
+    return object->isAsyncLoadGroupComplete( dAtoi(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the progress of the specified load group.
+    @param groupId The load group Id.
+    @return Returns the fraction of the load group that has finished loading in the range [0-1].
+*/
+ConsoleMethodWithDocs( AssetManager, getAsyncLoadGroupProgress, ConsoleFloat, 3, 3, (groupId))
+{
+    return object->getAsyncLoadGroupProgress( dAtoi(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of assets waiting to finish loading in the background.
+    @return Returns the number of assets waiting to finish loading in the background.
+*/
+ConsoleMethodWithDocs( AssetManager, getPendingAsyncLoadCount, ConsoleInt, 2, 2, ())
+{
+    return object->getPendingAsyncLoadCount();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Waits for all background loads to finish.
+    @return No return value.
+*/
+ConsoleMethodWithDocs( AssetManager, finishAsyncLoads, ConsoleVoid, 2, 2, ())
+{
+    object->finishAsyncLoads();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Cancels all background loads.
+    No callbacks are made for cancelled loads.
+    @return No return value.
+*/
+ConsoleMethodWithDocs( AssetManager, cancelAsyncLoads, ConsoleVoid, 2, 2, ())
+{
+    object->cancelAsyncLoads();
+}
+
 ConsoleMethodGroupEndWithDocs(AssetManager)
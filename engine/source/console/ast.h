@@ -373,7 +373,11 @@ struct FuncCallExprNode : ExprNode
    enum {
       FunctionCall,
       MethodCall,
-      ParentCall
+      ParentCall,
+
+      // Set at runtime once a call site has been given an inline cache.
+      CachedMethodCall,
+      CachedParentCall
    };
 
    static FuncCallExprNode *alloc(StringTableEntry funcName, StringTableEntry nameSpace, ExprNode *args, bool dot);
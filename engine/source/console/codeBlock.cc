@@ -31,6 +31,8 @@
 #include "debug/remote/RemoteDebuggerBase.h"
 #endif
 
+#include "codeBlock_ScriptBinding.h"
+
 using namespace Compiler;
 
 bool           CodeBlock::smInFunction = false;
@@ -53,6 +55,8 @@ CodeBlock::CodeBlock()
 
    refCount = 0;
    code = NULL;
+   mCallSiteCaches = NULL;
+   VECTOR_SET_ASSOCIATION( mFunctionTiers );
    name = NULL;
    fullPath = NULL;
    modPath = NULL;
@@ -71,6 +75,8 @@ CodeBlock::~CodeBlock()
    delete[] globalFloats;
    delete[] functionFloats;
    delete[] code;
+   clearCallSiteCaches();
+   clearFunctionTiers();
    delete[] breakList;
 }
 
@@ -476,6 +482,32 @@ bool CodeBlock::read(StringTableEntry fileName, Stream &st)
 
 
 bool CodeBlock::compile(const char *codeFileName, StringTableEntry fileName, const char *script)
+{
+   if(!parseScript(fileName, script))
+      return false;
+
+   FileStream st;
+   if(!ResourceManager->openFileForWrite(st, codeFileName)) 
+      return false;
+   st.write(DSO_VERSION);
+
+   writeCompiled(st);
+   st.close();
+
+   return true;
+}
+
+bool CodeBlock::compileToStream(Stream &st, StringTableEntry fileName, const char *script)
+{
+   if(!parseScript(fileName, script))
+      return false;
+
+   writeCompiled(st);
+
+   return true;
+}
+
+bool CodeBlock::parseScript(StringTableEntry fileName, const char *script)
 {
    gSyntaxError = false;
 
@@ -500,11 +532,11 @@ bool CodeBlock::compile(const char *codeFileName, StringTableEntry fileName, con
       return false;
    }   
 
-   FileStream st;
-   if(!ResourceManager->openFileForWrite(st, codeFileName)) 
-      return false;
-   st.write(DSO_VERSION);
+   return true;
+}
 
+void CodeBlock::writeCompiled(Stream &st)
+{
    // Reset all our value tables...
    resetTables();
 
@@ -564,9 +596,6 @@ bool CodeBlock::compile(const char *codeFileName, StringTableEntry fileName, con
    getIdentTable().write(st);
 
    consoleAllocReset();
-   st.close();
-
-   return true;
 }
 
 const char *CodeBlock::compileExec(StringTableEntry fileName, const char *string, bool noCalls, int setFrame)
@@ -25,9 +25,15 @@
 
 #include "console/compiler.h"
 #include "console/consoleParser.h"
+#include "collection/vector.h"
 
 class Stream;
 
+namespace Con
+{
+   class TypedArg;
+}
+
 
 /// Core TorqueScript code management class.
 ///
@@ -37,12 +43,44 @@ class CodeBlock
 private:
    static CodeBlock* smCodeBlockList;
    static CodeBlock* smCurrentCodeBlock;
+
+   struct CallSiteCache;
+   CallSiteCache* mCallSiteCaches;
+
+   CallSiteCache* getCallSiteCache(U32 ip);
+   void clearCallSiteCaches();
+
+   struct FunctionTier;
+   Vector<FunctionTier*> mFunctionTiers;
+
+   FunctionTier* countFunctionCall(U32 functionIp);
+   FunctionTier* findFunctionTier(U32 functionIp);
+   void optimizeFunction(FunctionTier* functionTier);
+   U32 getInstruction(U32 ip);
+   void setInstruction(U32 ip, U32 instruction);
+   void clearFunctionTiers();
+
+   bool parseScript(StringTableEntry fileName, const char *script);
+   void writeCompiled(Stream &st);
    
 public:
    static U32                       smBreakLineCount;
    static bool                      smInFunction;
    static Compiler::ConsoleParser * smCurrentParser;
 
+   /// Inline call site cache counters.
+   static U32 smCallSiteNamespaceHits;
+   static U32 smCallSiteNamespaceMisses;
+   static U32 smCallSiteObjectHits;
+   static U32 smCallSiteObjectMisses;
+
+   /// Functions called this many times are rewritten to the second tier
+   /// instructions, zero disables the second tier.
+   static S32 smTierThreshold;
+
+   /// The number of functions rewritten to the second tier instructions.
+   static U32 smTierFunctionCount;
+
    static CodeBlock* getCurrentBlock()
    {
       return smCurrentCodeBlock;
@@ -107,6 +145,10 @@ public:
    bool read(StringTableEntry fileName, Stream &st);
    bool compile(const char *dsoName, StringTableEntry fileName, const char *script);
 
+   /// Compiles a script writing the code that compile() would write to a DSO,
+   /// without the version, to a stream.
+   bool compileToStream(Stream &st, StringTableEntry fileName, const char *script);
+
    void incRefCount();
    void decRefCount();
 
@@ -143,9 +185,10 @@ public:
    /// -1 a new frame is created. If the index is out of range the
    /// top stack frame is used.
    /// @param packageName The code package name or null.
+   /// @param typedArgv The function parameter list as typed arguments, used instead of argv.
    const char *exec(U32 offset, const char *fnName, Namespace *ns, U32 argc, 
       const char **argv, bool noCalls, StringTableEntry packageName, 
-      S32 setFrame = -1);
+      S32 setFrame = -1, const Con::TypedArg *typedArgv = NULL);
 };
 
 #endif
@@ -0,0 +1,197 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin(CodeBlock, "Script code execution functions.");
+
+/*! @addtogroup ConsoleOutput Console Output
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Gets the method call site cache counters.
+    Each method and parent call site caches the namespace entries and the object it last resolved.
+    @return The counters formatted as "namespaceHits namespaceMisses objectHits objectMisses".
+    @sa resetScriptCallCacheStats, dumpScriptCallCacheStats
+*/
+ConsoleFunctionWithDocs(getScriptCallCacheStats, ConsoleString, 1, 1, ())
+{
+   char* pBuffer = Con::getReturnBuffer(64);
+   dSprintf(pBuffer, 64, "%d %d %d %d",
+      CodeBlock::smCallSiteNamespaceHits, CodeBlock::smCallSiteNamespaceMisses,
+      CodeBlock::smCallSiteObjectHits, CodeBlock::smCallSiteObjectMisses);
+   return pBuffer;
+}
+
+/*! Prints the method call site cache hit rates to the console.
+    @return No return value.
+    @sa getScriptCallCacheStats, resetScriptCallCacheStats
+*/
+ConsoleFunctionWithDocs(dumpScriptCallCacheStats, ConsoleVoid, 1, 1, ())
+{
+   const U32 namespaceLookups = CodeBlock::smCallSiteNamespaceHits + CodeBlock::smCallSiteNamespaceMisses;
+   const U32 objectLookups = CodeBlock::smCallSiteObjectHits + CodeBlock::smCallSiteObjectMisses;
+
+   Con::printf("Script call site caches:");
+   Con::printf("  Namespace lookups: %d, hits: %d (%.1f%%)", namespaceLookups, CodeBlock::smCallSiteNamespaceHits,
+      namespaceLookups ? 100.0f * CodeBlock::smCallSiteNamespaceHits / namespaceLookups : 0.0f);
+   Con::printf("  Object lookups: %d, hits: %d (%.1f%%)", objectLookups, CodeBlock::smCallSiteObjectHits,
+      objectLookups ? 100.0f * CodeBlock::smCallSiteObjectHits / objectLookups : 0.0f);
+}
+
+/*! Resets the method call site cache counters.
+    @return No return value.
+    @sa getScriptCallCacheStats, dumpScriptCallCacheStats
+*/
+ConsoleFunctionWithDocs(resetScriptCallCacheStats, ConsoleVoid, 1, 1, ())
+{
+   CodeBlock::smCallSiteNamespaceHits = 0;
+   CodeBlock::smCallSiteNamespaceMisses = 0;
+   CodeBlock::smCallSiteObjectHits = 0;
+   CodeBlock::smCallSiteObjectMisses = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+// Scripts covering loops, string concatenation, method calls and field access.
+static const char* scriptTierBenchmarkFunctions =
+   "function ScriptTierBenchmarkObject::value(%this, %index) { return %index % 7; }"
+   "function scriptTierBenchmarkLoop(%count)"
+   "{"
+   "   %sum = 0;"
+   "   for (%i = 0; %i < %count; %i++)"
+   "   {"
+   "      %sum += %i * 2;"
+   "      if (%sum >= 1000000)"
+   "         %sum -= 1000000;"
+   "   }"
+   "   return %sum;"
+   "}"
+   "function scriptTierBenchmarkConcat(%count)"
+   "{"
+   "   %text = \"\";"
+   "   for (%i = 0; %i < %count; %i++)"
+   "   {"
+   "      %text = %text @ %i SPC (%i * 0.5) SPC (0 - %i);"
+   "      if (strlen(%text) > 200)"
+   "         %text = \"\";"
+   "   }"
+   "   return %text;"
+   "}"
+   "function scriptTierBenchmarkMethod(%object, %count)"
+   "{"
+   "   %sum = 0;"
+   "   for (%i = 0; %i < %count; %i++)"
+   "      %sum += %object.value(%i);"
+   "   return %sum;"
+   "}"
+   "function scriptTierBenchmarkField(%object, %count)"
+   "{"
+   "   %sum = 0;"
+   "   for (%i = 0; %i < %count; %i++)"
+   "   {"
+   "      %object.counter = %i;"
+   "      %sum += %object.counter % 3;"
+   "   }"
+   "   return %sum;"
+   "}";
+
+static const char* scriptTierBenchmarkNames[] = { "loops", "concatenation", "method calls", "field access" };
+
+static const char* scriptTierBenchmarkCalls[] =
+{
+   "scriptTierBenchmarkLoop(%d);",
+   "scriptTierBenchmarkConcat(%d);",
+   "scriptTierBenchmarkMethod($ScriptTierBenchmarkObject, %d);",
+   "scriptTierBenchmarkField($ScriptTierBenchmarkObject, %d);"
+};
+
+static const U32 scriptTierBenchmarkCount = sizeof(scriptTierBenchmarkCalls) / sizeof(scriptTierBenchmarkCalls[0]);
+
+#define SCRIPTTIER_BENCHMARK_RESULT_SIZE 256
+
+//-----------------------------------------------------------------------------
+
+static void runScriptTierBenchmarkPass(const S32 tierThreshold, const U32 iterations, char results[][SCRIPTTIER_BENCHMARK_RESULT_SIZE], U32* pTimes)
+{
+   // Define the functions again so they start in the first tier.
+   CodeBlock::smTierThreshold = tierThreshold;
+   Con::evaluate(scriptTierBenchmarkFunctions);
+
+   for (U32 index = 0; index < scriptTierBenchmarkCount; ++index)
+   {
+      const U32 startTime = Platform::getRealMilliseconds();
+      const char* pResult = Con::evaluatef(scriptTierBenchmarkCalls[index], iterations);
+      pTimes[index] = Platform::getRealMilliseconds() - startTime;
+
+      dStrncpy(results[index], pResult, SCRIPTTIER_BENCHMARK_RESULT_SIZE - 1);
+      results[index][SCRIPTTIER_BENCHMARK_RESULT_SIZE - 1] = 0;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Times script loops, string concatenation, method calls and field access in each execution tier.
+    Each script is run once in the first tier only then again with functions moved to the second tier after their first call.
+    A warning is printed if the tiers return different results.
+    @param iterations The number of loop iterations each script runs, defaults to 100000.
+    @return The times taken in milliseconds formatted as "firstLoop firstConcat firstMethod firstField secondLoop secondConcat secondMethod secondField".
+*/
+ConsoleFunctionWithDocs(runScriptTierBenchmark, ConsoleString, 1, 2, ([iterations]))
+{
+   // Fetch the iteration count.
+   const U32 iterations = argc < 2 ? 100000 : getMax(dAtoi(argv[1]), 1);
+
+   const S32 tierThreshold = CodeBlock::smTierThreshold;
+
+   Con::evaluate("$ScriptTierBenchmarkObject = new ScriptObject() { class = ScriptTierBenchmarkObject; };");
+
+   // Run the scripts in each tier.
+   char firstResults[scriptTierBenchmarkCount][SCRIPTTIER_BENCHMARK_RESULT_SIZE];
+   char secondResults[scriptTierBenchmarkCount][SCRIPTTIER_BENCHMARK_RESULT_SIZE];
+   U32 firstTimes[scriptTierBenchmarkCount];
+   U32 secondTimes[scriptTierBenchmarkCount];
+   runScriptTierBenchmarkPass(0, iterations, firstResults, firstTimes);
+   runScriptTierBenchmarkPass(1, iterations, secondResults, secondTimes);
+
+   Con::evaluate("$ScriptTierBenchmarkObject.delete();");
+   CodeBlock::smTierThreshold = tierThreshold;
+
+   // Report.
+   Con::printf("Script tier benchmark: %d iterations.", iterations);
+   for (U32 index = 0; index < scriptTierBenchmarkCount; ++index)
+   {
+      Con::printf("  %s: first tier %dms, second tier %dms.", scriptTierBenchmarkNames[index], firstTimes[index], secondTimes[index]);
+
+      if (dStrcmp(firstResults[index], secondResults[index]) != 0)
+         Con::warnf("runScriptTierBenchmark() - The tiers returned different results for %s: '%s' and '%s'.", scriptTierBenchmarkNames[index], firstResults[index], secondResults[index]);
+   }
+
+   char* pBuffer = Con::getReturnBuffer(128);
+   dSprintf(pBuffer, 128, "%d %d %d %d %d %d %d %d",
+      firstTimes[0], firstTimes[1], firstTimes[2], firstTimes[3],
+      secondTimes[0], secondTimes[1], secondTimes[2], secondTimes[3]);
+   return pBuffer;
+}
+
+/*! @} */ // group ConsoleOutput
+
+ConsoleFunctionGroupEnd(CodeBlock);
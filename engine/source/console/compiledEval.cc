@@ -39,6 +39,7 @@
 #include "string/stringStack.h"
 #include "messaging/message.h"
 #include "memory/frameAllocator.h"
+#include "sim/simObjectPtr.h"
 
 #include "debug/telnetDebugger.h"
 
@@ -447,7 +448,519 @@ static void setFieldComponent( SimObject* object, StringTableEntry field, const
     }
 }
 
-const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNamespace, U32 argc, const char **argv, bool noCalls, StringTableEntry packageName, S32 setFrame)
+//------------------------------------------------------------
+
+U32 CodeBlock::smCallSiteNamespaceHits = 0;
+U32 CodeBlock::smCallSiteNamespaceMisses = 0;
+U32 CodeBlock::smCallSiteObjectHits = 0;
+U32 CodeBlock::smCallSiteObjectMisses = 0;
+
+/// Inline cache for a method or parent call site.
+///
+/// The first time a call site runs it is rewritten to point at its cache.
+/// Namespace entries are cached for the last few namespaces called through the
+/// site and are all discarded when Namespace::mCacheSequence changes. The target
+/// object is cached only when it was referenced by its numeric Id as names can
+/// be reassigned to other objects.
+struct CodeBlock::CallSiteCache
+{
+   enum
+   {
+      NamespaceCount = 4,
+      ObjectTextSize = 16
+   };
+
+   U32                     mSequence;
+   U32                     mNamespaceCount;
+   U32                     mNextNamespace;
+   Namespace*              mNamespaces[NamespaceCount];
+   Namespace::Entry*       mEntries[NamespaceCount];
+
+   SimObjectPtr<SimObject> mObject;
+   SimObjectId             mObjectId;
+   char                    mObjectText[ObjectTextSize];
+
+   CallSiteCache*          mNext;
+
+   CallSiteCache()
+   {
+      mSequence = Namespace::mCacheSequence;
+      mNamespaceCount = 0;
+      mNextNamespace = 0;
+      mObjectId = 0;
+      mObjectText[0] = 0;
+      mNext = NULL;
+   }
+
+   Namespace::Entry* lookup(Namespace* ns, StringTableEntry fnName)
+   {
+      // Discard everything if any namespace has changed.
+      if(mSequence != Namespace::mCacheSequence)
+      {
+         mSequence = Namespace::mCacheSequence;
+         mNamespaceCount = 0;
+         mNextNamespace = 0;
+      }
+
+      for(U32 i = 0; i < mNamespaceCount; i++)
+      {
+         if(mNamespaces[i] == ns)
+         {
+            CodeBlock::smCallSiteNamespaceHits++;
+            return mEntries[i];
+         }
+      }
+
+      CodeBlock::smCallSiteNamespaceMisses++;
+
+      Namespace::Entry* entry = ns->lookup(fnName);
+
+      // Replace the oldest namespace once the cache is full.
+      U32 slot = mNamespaceCount;
+      if(slot < NamespaceCount)
+         mNamespaceCount++;
+      else
+      {
+         slot = mNextNamespace;
+         mNextNamespace = (mNextNamespace + 1) % NamespaceCount;
+      }
+      mNamespaces[slot] = ns;
+      mEntries[slot] = entry;
+      return entry;
+   }
+
+   SimObject* findObject(const char* objectText)
+   {
+      if(!mObject.isNull() && !mObject->isRemoved() && mObject->getId() == mObjectId && dStrcmp(objectText, mObjectText) == 0)
+      {
+         CodeBlock::smCallSiteObjectHits++;
+         return mObject;
+      }
+
+      CodeBlock::smCallSiteObjectMisses++;
+
+      SimObject* object = Sim::findObject(objectText);
+      if(object && isDigitsOnly(objectText) && dStrlen(objectText) < ObjectTextSize)
+      {
+         mObject = object;
+         mObjectId = object->getId();
+         dStrcpy(mObjectText, objectText);
+      }
+      else
+      {
+         mObject = NULL;
+      }
+
+      return object;
+   }
+};
+
+CodeBlock::CallSiteCache* CodeBlock::getCallSiteCache(U32 ip)
+{
+   // The call site holds the namespace identifier until it is first run.
+   U32 callType = code[ip+4];
+   if(callType == FuncCallExprNode::CachedMethodCall || callType == FuncCallExprNode::CachedParentCall)
+   {
+#ifdef TORQUE_64
+      return (CallSiteCache *) *((U64*)(code+ip+2));
+#else
+      return (CallSiteCache *) *(code+ip+2);
+#endif
+   }
+
+   // Create the cache and rewrite the call site to use it.
+   CallSiteCache* cache = new CallSiteCache;
+   cache->mNext = mCallSiteCaches;
+   mCallSiteCaches = cache;
+
+#ifdef TORQUE_64
+   *((U64*)(code+ip+2)) = ((U64)cache);
+#else
+   code[ip+2] = ((U32)cache);
+#endif
+   code[ip+4] = callType == FuncCallExprNode::MethodCall ? FuncCallExprNode::CachedMethodCall : FuncCallExprNode::CachedParentCall;
+
+   return cache;
+}
+
+void CodeBlock::clearCallSiteCaches()
+{
+   while(mCallSiteCaches)
+   {
+      CallSiteCache* next = mCallSiteCaches->mNext;
+      delete mCallSiteCaches;
+      mCallSiteCaches = next;
+   }
+}
+
+//------------------------------------------------------------
+
+S32 CodeBlock::smTierThreshold = 0;
+U32 CodeBlock::smTierFunctionCount = 0;
+
+/// Call counter and local variable slots for a function.
+///
+/// Once a function has been called CodeBlock::smTierThreshold times its bytecode
+/// is rewritten in place to the second tier instructions. Local variables are
+/// then addressed by slot rather than by name, each call caching the frame
+/// dictionary entry of a slot the first time it is used, so the locals are still
+/// visible to eval(), the debugger and tracing. Loads and saves of locals are
+/// fused with the variable selection and numeric locals loaded as strings are
+/// formatted without dSprintf where possible. Comparisons followed by a
+/// conditional jump are fused too.
+///
+/// Every rewritten instruction keeps the same size and the instruction boundaries
+/// of the original code so jump targets are unchanged and the .dso format is
+/// unaffected.
+struct CodeBlock::FunctionTier
+{
+   FunctionTier(U32 functionIp) :
+      mFunctionIp(functionIp),
+      mCallCount(0),
+      mOptimized(false)
+   {
+      VECTOR_SET_ASSOCIATION( mLocalNames );
+   }
+
+   U32 getLocalSlot(StringTableEntry name)
+   {
+      for(U32 i = 0; i < (U32)mLocalNames.size(); i++)
+      {
+         if(mLocalNames[i] == name)
+            return i;
+      }
+
+      mLocalNames.push_back(name);
+      return mLocalNames.size() - 1;
+   }
+
+   Dictionary::Entry* getLocalVariable(Dictionary::Entry** slots, U32 slot, bool create) const
+   {
+      // Use the entry cached by this call.
+      if(slots && slots[slot])
+         return slots[slot];
+
+      StringTableEntry name = mLocalNames[slot];
+      Dictionary::Entry* variable = create ? gEvalState.stack.last()->add(name) : gEvalState.stack.last()->lookup(name);
+      if(!variable && gWarnUndefinedScriptVariables)
+         Con::warnf(ConsoleLogEntry::Script, "Variable referenced before assignment: %s", name);
+
+      // Entries are never removed from a frame so they can be cached for the rest of the call.
+      if(slots)
+         slots[slot] = variable;
+
+      return variable;
+   }
+
+   U32                        mFunctionIp;
+   U32                        mCallCount;
+   bool                       mOptimized;
+   Vector<StringTableEntry>   mLocalNames;
+};
+
+/// Gets the number of code words following an instruction or -1 if it can't be optimized.
+static S32 getInstructionOperandCount(U32 instruction)
+{
+   switch(instruction)
+   {
+      case OP_CREATE_OBJECT:
+         return 6;
+
+      case OP_CALLFUNC_RESOLVE:
+      case OP_CALLFUNC:
+         return 5;
+
+      case OP_SETCURVAR:
+      case OP_SETCURVAR_CREATE:
+      case OP_SETCURFIELD:
+      case OP_LOADIMMED_IDENT:
+         return 2;
+
+      case OP_ADD_OBJECT:
+      case OP_END_OBJECT:
+      case OP_JMPIFFNOT:
+      case OP_JMPIFNOT:
+      case OP_JMPIFF:
+      case OP_JMPIF:
+      case OP_JMPIFNOT_NP:
+      case OP_JMPIF_NP:
+      case OP_JMP:
+      case OP_SETCUROBJECT_INTERNAL:
+      case OP_LOADIMMED_UINT:
+      case OP_LOADIMMED_FLT:
+      case OP_TAG_TO_STR:
+      case OP_LOADIMMED_STR:
+      case OP_DOCBLOCK_STR:
+      case OP_ADVANCE_STR_APPENDCHAR:
+         return 1;
+
+      case OP_RETURN:
+      case OP_CMPEQ:
+      case OP_CMPGR:
+      case OP_CMPGE:
+      case OP_CMPLT:
+      case OP_CMPLE:
+      case OP_CMPNE:
+      case OP_XOR:
+      case OP_MOD:
+      case OP_BITAND:
+      case OP_BITOR:
+      case OP_NOT:
+      case OP_NOTF:
+      case OP_ONESCOMPLEMENT:
+      case OP_SHR:
+      case OP_SHL:
+      case OP_AND:
+      case OP_OR:
+      case OP_ADD:
+      case OP_SUB:
+      case OP_MUL:
+      case OP_DIV:
+      case OP_NEG:
+      case OP_SETCURVAR_ARRAY:
+      case OP_SETCURVAR_ARRAY_CREATE:
+      case OP_LOADVAR_UINT:
+      case OP_LOADVAR_FLT:
+      case OP_LOADVAR_STR:
+      case OP_SAVEVAR_UINT:
+      case OP_SAVEVAR_FLT:
+      case OP_SAVEVAR_STR:
+      case OP_SETCUROBJECT:
+      case OP_SETCUROBJECT_NEW:
+      case OP_SETCURFIELD_ARRAY:
+      case OP_LOADFIELD_UINT:
+      case OP_LOADFIELD_FLT:
+      case OP_LOADFIELD_STR:
+      case OP_SAVEFIELD_UINT:
+      case OP_SAVEFIELD_FLT:
+      case OP_SAVEFIELD_STR:
+      case OP_STR_TO_UINT:
+      case OP_STR_TO_FLT:
+      case OP_STR_TO_NONE:
+      case OP_FLT_TO_UINT:
+      case OP_FLT_TO_STR:
+      case OP_FLT_TO_NONE:
+      case OP_UINT_TO_FLT:
+      case OP_UINT_TO_STR:
+      case OP_UINT_TO_NONE:
+      case OP_ADVANCE_STR:
+      case OP_ADVANCE_STR_COMMA:
+      case OP_ADVANCE_STR_NUL:
+      case OP_REWIND_STR:
+      case OP_TERMINATE_REWIND_STR:
+      case OP_COMPARE_STR:
+      case OP_PUSH:
+      case OP_PUSH_FRAME:
+         return 0;
+
+      default:
+         return -1;
+   }
+}
+
+CodeBlock::FunctionTier* CodeBlock::findFunctionTier(U32 functionIp)
+{
+   S32 min = 0;
+   S32 max = mFunctionTiers.size() - 1;
+   while(min <= max)
+   {
+      const S32 mid = (min + max) / 2;
+      FunctionTier* functionTier = mFunctionTiers[mid];
+      if(functionTier->mFunctionIp == functionIp)
+         return functionTier;
+      else if(functionTier->mFunctionIp < functionIp)
+         min = mid + 1;
+      else
+         max = mid - 1;
+   }
+
+   return NULL;
+}
+
+CodeBlock::FunctionTier* CodeBlock::countFunctionCall(U32 functionIp)
+{
+   FunctionTier* functionTier = findFunctionTier(functionIp);
+   if(!functionTier)
+   {
+      // Keep the tiers sorted by function.
+      U32 index = 0;
+      while(index < (U32)mFunctionTiers.size() && mFunctionTiers[index]->mFunctionIp < functionIp)
+         index++;
+
+      functionTier = new FunctionTier(functionIp);
+      mFunctionTiers.insert(index);
+      mFunctionTiers[index] = functionTier;
+   }
+
+   if(!functionTier->mOptimized && ++functionTier->mCallCount >= (U32)smTierThreshold)
+      optimizeFunction(functionTier);
+
+   return functionTier->mOptimized ? functionTier : NULL;
+}
+
+U32 CodeBlock::getInstruction(U32 ip)
+{
+   // Breakpoints replace the instruction so use the one they restore.
+   if(code[ip] == OP_BREAK)
+   {
+      U32 line, instruction;
+      findBreakLine(ip, line, instruction);
+      return instruction;
+   }
+
+   return code[ip];
+}
+
+void CodeBlock::setInstruction(U32 ip, U32 instruction)
+{
+   // Update the instruction restored when a breakpoint on it is cleared.
+   // The line break pairs are sorted by ip.
+   S32 min = 0;
+   S32 max = lineBreakPairs ? lineBreakPairCount - 1 : -1;
+   while(min <= max)
+   {
+      const S32 mid = (min + max) / 2;
+      U32 *p = lineBreakPairs + mid * 2;
+      if(p[1] == ip)
+      {
+         p[0] = (p[0] & ~0xFF) | instruction;
+         break;
+      }
+      else if(p[1] < ip)
+         min = mid + 1;
+      else
+         max = mid - 1;
+   }
+
+   if(code[ip] != OP_BREAK)
+      code[ip] = instruction;
+}
+
+void CodeBlock::optimizeFunction(FunctionTier* functionTier)
+{
+   functionTier->mOptimized = true;
+
+   const U32 functionIp = functionTier->mFunctionIp;
+   const U32 startIp = functionIp + (code[functionIp + 8] * 2) + 9;
+   const U32 endIp = code[functionIp + 7];
+   if(endIp <= startIp || endIp > codeSize)
+      return;
+
+   // Find the jump targets and breakable lines, which nothing can be fused into,
+   // and check every instruction can be stepped over.
+   FrameTemp<bool> isTarget(endIp - startIp + 1);
+   for(U32 i = 0; i <= endIp - startIp; i++)
+      isTarget[i] = false;
+
+   for(U32 i = 0; lineBreakPairs && i < lineBreakPairCount; i++)
+   {
+      U32 *p = lineBreakPairs + i * 2;
+      if(p[1] >= startIp && p[1] <= endIp)
+         isTarget[p[1] - startIp] = true;
+   }
+
+   U32 ip;
+   for(ip = startIp; ip < endIp; )
+   {
+      const U32 instruction = getInstruction(ip);
+      const S32 operandCount = getInstructionOperandCount(instruction);
+      if(operandCount < 0)
+         return;
+
+      U32 target = endIp + 1;
+      switch(instruction)
+      {
+         case OP_JMPIFFNOT:
+         case OP_JMPIFNOT:
+         case OP_JMPIFF:
+         case OP_JMPIF:
+         case OP_JMPIFNOT_NP:
+         case OP_JMPIF_NP:
+         case OP_JMP:
+            target = code[ip + 1];
+            break;
+
+         case OP_CREATE_OBJECT:
+            target = code[ip + 6];
+            break;
+      }
+
+      if(target != endIp + 1)
+      {
+         if(target < startIp || target > endIp)
+            return;
+         isTarget[target - startIp] = true;
+      }
+
+      ip += operandCount + 1;
+   }
+
+   if(ip != endIp)
+      return;
+
+   // Rewrite the local variable and comparison instructions.
+   for(ip = startIp; ip < endIp; )
+   {
+      const U32 instruction = getInstruction(ip);
+      const U32 nextIp = ip + getInstructionOperandCount(instruction) + 1;
+      const U32 nextInstruction = nextIp < endIp && !isTarget[nextIp - startIp] ? getInstruction(nextIp) : OP_INVALID;
+
+      switch(instruction)
+      {
+         case OP_SETCURVAR:
+         case OP_SETCURVAR_CREATE:
+         {
+            StringTableEntry name = CodeToSTE(code, ip + 1);
+            if(name[0] != '%')
+               break;
+
+            // Fuse the following load or save.
+            U32 localInstruction;
+            switch(nextInstruction)
+            {
+               case OP_LOADVAR_UINT: localInstruction = OP_LOADLOCAL_UINT; break;
+               case OP_LOADVAR_FLT:  localInstruction = OP_LOADLOCAL_FLT; break;
+               case OP_LOADVAR_STR:  localInstruction = OP_LOADLOCAL_STR; break;
+               case OP_SAVEVAR_UINT: localInstruction = OP_SAVELOCAL_UINT; break;
+               case OP_SAVEVAR_FLT:  localInstruction = OP_SAVELOCAL_FLT; break;
+               case OP_SAVEVAR_STR:  localInstruction = OP_SAVELOCAL_STR; break;
+               default:              localInstruction = OP_SETCURVAR_LOCAL; break;
+            }
+
+            // The name is replaced by the slot and whether to create the variable.
+            code[ip + 1] = functionTier->getLocalSlot(name);
+            code[ip + 2] = instruction == OP_SETCURVAR_CREATE;
+            setInstruction(ip, localInstruction);
+            break;
+         }
+
+         case OP_CMPEQ:
+         case OP_CMPGR:
+         case OP_CMPGE:
+         case OP_CMPLT:
+         case OP_CMPLE:
+         case OP_CMPNE:
+            if(nextInstruction == OP_JMPIFNOT)
+               setInstruction(ip, OP_CMPEQ_JMPIFNOT + (instruction - OP_CMPEQ));
+            break;
+      }
+
+      ip = nextIp;
+   }
+
+   smTierFunctionCount++;
+}
+
+void CodeBlock::clearFunctionTiers()
+{
+   for(U32 i = 0; i < (U32)mFunctionTiers.size(); i++)
+      delete mFunctionTiers[i];
+   mFunctionTiers.clear();
+}
+
+//------------------------------------------------------------
+
+const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNamespace, U32 argc, const char **argv, bool noCalls, StringTableEntry packageName, S32 setFrame, const Con::TypedArg *typedArgv)
 {
 #ifdef TORQUE_DEBUG
    U32 stackStart = STR.mStartStackSize;
@@ -462,7 +975,14 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
    STR.clearFunctionOffset();
    StringTableEntry thisFunctionName = NULL;
    bool popFrame = false;
-   if(argv)
+   const bool isFunctionCall = argv != NULL || typedArgv != NULL;
+   char typedArgBuffer[Con::TypedArg::FormatBufferSize];
+
+   // Count the call for the second tier.
+   const U32 functionIp = ip;
+   FunctionTier* functionTier = isFunctionCall && smTierThreshold > 0 ? countFunctionCall(functionIp) : NULL;
+
+   if(isFunctionCall)
    {
       // assume this points into a function decl:
       U32 fnArgc = code[ip + 2 + 6];
@@ -490,7 +1010,7 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
          }
          for(i = 0; i < argc; i++)
          {
-            dStrcat(traceBuffer, argv[i+1]);
+            dStrcat(traceBuffer, typedArgv ? typedArgv[i+1].getString(typedArgBuffer, sizeof(typedArgBuffer)) : argv[i+1]);
             if(i != argc - 1)
                dStrcat(traceBuffer, ", ");
          }
@@ -503,7 +1023,22 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
       {
          StringTableEntry var = CodeToSTE(code, ip + (2 + 6 + 1) + (i * 2));
          gEvalState.setCurVarNameCreate(var);
-         gEvalState.setStringVariable(argv[i+1]);
+
+         if(!typedArgv)
+         {
+            gEvalState.setStringVariable(argv[i+1]);
+            continue;
+         }
+
+         // Store typed arguments without formatting them.
+         // Negative ints are stored as strings as int variables are unsigned.
+         const Con::TypedArg& typedArg = typedArgv[i+1];
+         if(typedArg.getType() == Con::TypedArg::IntType && typedArg.getIntValue() >= 0)
+            gEvalState.setIntVariable(typedArg.getIntValue());
+         else if(typedArg.getType() == Con::TypedArg::FloatType)
+            gEvalState.setFloatVariable(typedArg.getFloatValue());
+         else
+            gEvalState.setStringVariable(typedArg.getString(typedArgBuffer, sizeof(typedArgBuffer)));
       }
       ip = ip + (fnArgc * 2) + (2 + 6 + 1);
       curFloatTable = functionFloats;
@@ -532,6 +1067,13 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
       }
    }
 
+   // The second tier caches the frame entries of local variables for this call.
+   const U32 localSlotCount = functionTier ? functionTier->mLocalNames.size() : 0;
+   FrameTemp<Dictionary::Entry*> localSlotBuffer( getMax( localSlotCount, (U32)1 ) );
+   Dictionary::Entry** localSlots = localSlotCount ? (Dictionary::Entry**)localSlotBuffer : NULL;
+   for(U32 slot = 0; slot < localSlotCount; slot++)
+      localSlots[slot] = NULL;
+
    // Grab the state of the telenet debugger here once
    // so that the push and pop frames are always balanced.
    const bool telDebuggerOn = TelDebugger && TelDebugger->isConnected();
@@ -1460,6 +2002,14 @@ breakContinue:
 
             U32 callType = code[ip+4];
 
+            // Method and parent calls are resolved through the call site cache.
+            CallSiteCache* callSiteCache = NULL;
+            if(callType != FuncCallExprNode::FunctionCall)
+            {
+               callSiteCache = getCallSiteCache(ip);
+               callType = callType == FuncCallExprNode::MethodCall || callType == FuncCallExprNode::CachedMethodCall ? FuncCallExprNode::MethodCall : FuncCallExprNode::ParentCall;
+            }
+
             ip += 5;
             STR.getArgcArgv(fnName, &callArgc, &callArgv);
 
@@ -1475,7 +2025,7 @@ breakContinue:
             else if(callType == FuncCallExprNode::MethodCall)
             {
                saveObject = gEvalState.thisObject;
-               gEvalState.thisObject = Sim::findObject(callArgv[1]);
+               gEvalState.thisObject = callSiteCache->findObject(callArgv[1]);
                if(!gEvalState.thisObject)
                {
                   gEvalState.thisObject = 0;
@@ -1496,7 +2046,7 @@ breakContinue:
                
                ns = gEvalState.thisObject->getNamespace();
                if(ns)
-                  nsEntry = ns->lookup(fnName);
+                  nsEntry = callSiteCache->lookup(ns, fnName);
                else
                   nsEntry = NULL;
             }
@@ -1506,7 +2056,7 @@ breakContinue:
                {
                   ns = thisNamespace->mParent;
                   if(ns)
-                     nsEntry = ns->lookup(fnName);
+                     nsEntry = callSiteCache->lookup(ns, fnName);
                   else
                      nsEntry = NULL;
                }
@@ -1695,6 +2245,110 @@ breakContinue:
          case OP_PUSH_FRAME:
             STR.pushFrame();
             break;
+
+         case OP_SETCURVAR_LOCAL:
+         case OP_LOADLOCAL_UINT:
+         case OP_LOADLOCAL_FLT:
+         case OP_LOADLOCAL_STR:
+         case OP_SAVELOCAL_UINT:
+         case OP_SAVELOCAL_FLT:
+         case OP_SAVELOCAL_STR:
+         {
+            // See OP_SETCURVAR
+            prevField = NULL;
+            prevObject = NULL;
+            curObject = NULL;
+            curFNDocBlock = NULL;
+            curNSDocBlock = NULL;
+
+            // The function may have been optimized after this call started.
+            if(!functionTier)
+               functionTier = findFunctionTier(functionIp);
+            AssertFatal(functionTier != NULL, "CodeBlock::exec - Second tier instruction in a function without a tier.");
+
+            Dictionary::Entry *localVariable = functionTier->getLocalVariable(localSlots, code[ip], code[ip+1] != 0);
+            gEvalState.currentVariable = localVariable;
+
+            // Fused loads and saves skip the instruction they replaced.
+            switch(instruction)
+            {
+               case OP_SETCURVAR_LOCAL:
+                  ip += 2;
+                  break;
+
+               case OP_LOADLOCAL_UINT:
+                  intStack[++UINT] = localVariable ? (S32)localVariable->getIntValue() : 0;
+                  ip += 3;
+                  break;
+
+               case OP_LOADLOCAL_FLT:
+                  floatStack[++FLT] = localVariable ? localVariable->getFloatValue() : 0;
+                  ip += 3;
+                  break;
+
+               case OP_LOADLOCAL_STR:
+                  // Format whole numbers without dSprintf. Floats are formatted
+                  // with "%.9g" which prints these digits exactly, except for -0.
+                  if(localVariable && localVariable->type == Dictionary::Entry::TypeInternalInt)
+                     STR.setIntegralValue((S32)localVariable->ival);
+                  else if(localVariable && localVariable->type == Dictionary::Entry::TypeInternalFloat &&
+                          mFabs(localVariable->fval) < 1e9f && localVariable->fval == (F32)(S32)localVariable->fval &&
+                          (localVariable->fval != 0.0f || !(1.0f / localVariable->fval < 0.0f)))
+                     STR.setIntegralValue((S32)localVariable->fval);
+                  else
+                     STR.setStringValue(localVariable ? localVariable->getStringValue() : "");
+                  ip += 3;
+                  break;
+
+               case OP_SAVELOCAL_UINT:
+                  gEvalState.setIntVariable((S32)intStack[UINT]);
+                  ip += 3;
+                  break;
+
+               case OP_SAVELOCAL_FLT:
+                  gEvalState.setFloatVariable(floatStack[FLT]);
+                  ip += 3;
+                  break;
+
+               case OP_SAVELOCAL_STR:
+                  gEvalState.setStringVariable(STR.getStringValue());
+                  ip += 3;
+                  break;
+            }
+            break;
+         }
+
+         // Fused comparisons skip the OP_JMPIFNOT they replaced.
+         case OP_CMPEQ_JMPIFNOT:
+            FLT -= 2;
+            ip = floatStack[FLT+2] == floatStack[FLT+1] ? ip + 2 : code[ip+1];
+            break;
+
+         case OP_CMPGR_JMPIFNOT:
+            FLT -= 2;
+            ip = floatStack[FLT+2] > floatStack[FLT+1] ? ip + 2 : code[ip+1];
+            break;
+
+         case OP_CMPGE_JMPIFNOT:
+            FLT -= 2;
+            ip = floatStack[FLT+2] >= floatStack[FLT+1] ? ip + 2 : code[ip+1];
+            break;
+
+         case OP_CMPLT_JMPIFNOT:
+            FLT -= 2;
+            ip = floatStack[FLT+2] < floatStack[FLT+1] ? ip + 2 : code[ip+1];
+            break;
+
+         case OP_CMPLE_JMPIFNOT:
+            FLT -= 2;
+            ip = floatStack[FLT+2] <= floatStack[FLT+1] ? ip + 2 : code[ip+1];
+            break;
+
+         case OP_CMPNE_JMPIFNOT:
+            FLT -= 2;
+            ip = floatStack[FLT+2] != floatStack[FLT+1] ? ip + 2 : code[ip+1];
+            break;
+
          case OP_BREAK:
          {
             //append the ip and codeptr before managing the breakpoint!
@@ -1733,7 +2387,7 @@ execFinished:
    if ( popFrame )
       gEvalState.popFrame();
 
-   if(argv)
+   if(isFunctionCall)
    {
       if(gEvalState.traceOn)
       {
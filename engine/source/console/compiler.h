@@ -141,6 +141,23 @@ namespace Compiler
 
       OP_BREAK,
 
+      // Second tier instructions. These are never compiled or written to a .dso,
+      // hot functions are rewritten to use them when they are run (see CodeBlock::optimizeFunction).
+      OP_SETCURVAR_LOCAL,
+      OP_LOADLOCAL_UINT,
+      OP_LOADLOCAL_FLT,
+      OP_LOADLOCAL_STR,
+      OP_SAVELOCAL_UINT,
+      OP_SAVELOCAL_FLT,
+      OP_SAVELOCAL_STR,
+
+      OP_CMPEQ_JMPIFNOT,
+      OP_CMPGR_JMPIFNOT,
+      OP_CMPGE_JMPIFNOT,
+      OP_CMPLT_JMPIFNOT,
+      OP_CMPLE_JMPIFNOT,
+      OP_CMPNE_JMPIFNOT,
+
       OP_INVALID
    };
 
@@ -253,6 +253,7 @@ void init()
    addVariable("Con::logBufferEnabled", TypeBool, &logBufferEnabled);
    addVariable("Con::printLevel", TypeS32, &printLevel);
    addVariable("Con::warnUndefinedVariables", TypeBool, &gWarnUndefinedScriptVariables);
+   addVariable("Con::scriptTierThreshold", TypeS32, &CodeBlock::smTierThreshold);
 
    // Current script file name and root
    Con::addVariable( "Con::File", TypeString, &gCurrentFile );
@@ -1093,6 +1094,126 @@ const char *executef(S32 argc, ...)
    return execute(argc, argv);
 }
 
+//------------------------------------------------------------------------------
+TypedArg::TypedArg(const SimObject* pObject) : mType(StringType)
+{
+   mString = pObject != NULL ? pObject->getIdString() : "0";
+}
+
+const char* TypedArg::getString(char* pBuffer, const U32 bufferSize) const
+{
+   switch(mType)
+   {
+      case IntType:
+         dSprintf(pBuffer, bufferSize, "%d", mInt);
+         return pBuffer;
+
+      case FloatType:
+         dSprintf(pBuffer, bufferSize, "%g", mFloat);
+         return pBuffer;
+
+      case Vector2Type:
+         dSprintf(pBuffer, bufferSize, "%g %g", mVector[0], mVector[1]);
+         return pBuffer;
+
+      case FormattedType:
+         return mFormat.mpCallback(mFormat.mpData, pBuffer, bufferSize);
+
+      default:
+         return mString;
+   }
+}
+
+/// The most typed arguments that can be passed to a callback.
+static const S32 MaxTypedArgs = 32;
+
+static const char *executeTypedAsStrings(SimObject *object, const char* pName, S32 argc, const TypedArg* argv)
+{
+   char buffers[MaxTypedArgs][TypedArg::FormatBufferSize];
+   const char *stringArgv[MaxTypedArgs + 2];
+
+   // Format the arguments after the name and, for methods, the object.
+   S32 stringArgc = 0;
+   stringArgv[stringArgc++] = pName;
+   if(object)
+      stringArgv[stringArgc++] = "";
+   for(S32 i = 0; i < argc; i++)
+      stringArgv[stringArgc++] = argv[i].getString(buffers[i], TypedArg::FormatBufferSize);
+
+   return object ? execute(object, stringArgc, stringArgv) : execute(stringArgc, stringArgv);
+}
+
+const char *executeTyped(const char* pFunctionName, S32 argc, const TypedArg* argv)
+{
+   AssertFatal(argc <= MaxTypedArgs, "Con::executeTyped() - Too many arguments.");
+
+#ifdef TORQUE_MULTITHREAD
+   // Calls from other threads are posted to the main thread as strings.
+   if(!isMainThread())
+      return executeTypedAsStrings(NULL, pFunctionName, argc, argv);
+#endif
+
+   StringTableEntry funcName = StringTable->insert(pFunctionName);
+   Namespace::Entry *ent = Namespace::global()->lookup(funcName);
+
+   // Only script functions can take typed arguments.
+   if(ent == NULL || ent->mType != Namespace::Entry::ScriptFunctionType)
+      return executeTypedAsStrings(NULL, pFunctionName, argc, argv);
+
+   if(!ent->mFunctionOffset)
+      return "";
+
+   TypedArg typedArgv[MaxTypedArgs + 1];
+   typedArgv[0] = funcName;
+   for(S32 i = 0; i < argc; i++)
+      typedArgv[i+1] = argv[i];
+
+   const char *ret = ent->mCode->exec(ent->mFunctionOffset, funcName, ent->mNamespace, argc + 1, NULL, false, ent->mPackage, -1, typedArgv);
+
+   // Reset the function offset so the stack
+   // doesn't continue to grow unnecessarily
+   STR.clearFunctionOffset();
+
+   return ret;
+}
+
+const char *executeTyped(SimObject *object, const char* pMethodName, S32 argc, const TypedArg* argv)
+{
+   AssertFatal(argc <= MaxTypedArgs, "Con::executeTyped() - Too many arguments.");
+
+   StringTableEntry methodName = StringTable->insert(pMethodName);
+   Namespace::Entry *ent = object->getNamespace() ? object->getNamespace()->lookup(methodName) : NULL;
+
+   // Only script methods can take typed arguments.
+   // Objects with component methods are called as strings so their components are called too.
+   if(ent == NULL || ent->mType != Namespace::Entry::ScriptFunctionType || dynamic_cast<DynamicConsoleMethodComponent *>(object) != NULL)
+      return executeTypedAsStrings(object, pMethodName, argc, argv);
+
+   if(!ent->mFunctionOffset)
+      return "";
+
+   TypedArg typedArgv[MaxTypedArgs + 2];
+   typedArgv[0] = methodName;
+   typedArgv[1] = object;
+   for(S32 i = 0; i < argc; i++)
+      typedArgv[i+2] = argv[i];
+
+   object->pushScriptCallbackGuard();
+
+   SimObject *save = gEvalState.thisObject;
+   gEvalState.thisObject = object;
+   const char *ret = ent->mCode->exec(ent->mFunctionOffset, methodName, ent->mNamespace, argc + 2, NULL, false, ent->mPackage, -1, typedArgv);
+   gEvalState.thisObject = save;
+
+   object->popScriptCallbackGuard();
+
+   // Reset the function offset so the stack
+   // doesn't continue to grow unnecessarily
+   STR.clearFunctionOffset();
+
+   return ret;
+}
+
 //------------------------------------------------------------------------------
 bool isFunction(const char *fn)
 {
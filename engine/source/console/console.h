@@ -569,6 +569,89 @@ namespace Con
    /// @see execute(SimObject *, S32 argc, const char *argv[])
    const char *executef(SimObject *, S32 argc, ...);
 
+   /// A typed argument for a script callback.
+   ///
+   /// When the callback is a script function, typed arguments are stored directly
+   /// in its parameters, so ints and floats are not formatted into strings and then
+   /// parsed back. They are only formatted when the callback is an engine function.
+   /// Formatted arguments are only formatted if the callback takes the parameter.
+   class TypedArg
+   {
+   public:
+      enum Type
+      {
+         StringType,
+         IntType,
+         FloatType,
+         Vector2Type,
+         FormattedType
+      };
+
+      /// Formats an argument when it is needed.  The string may be returned in the buffer
+      /// or in storage owned by the data but must stay valid for the callback.
+      typedef const char* (*FormatCallback)(const void* pData, char* pBuffer, const U32 bufferSize);
+
+      /// The buffer size needed to format any typed argument.
+      enum { FormatBufferSize = 64 };
+
+      TypedArg() : mType(StringType) { mString = ""; }
+      TypedArg(const char* pString) : mType(StringType) { mString = pString != NULL ? pString : ""; }
+      TypedArg(const S32 value) : mType(IntType) { mInt = value; }
+      TypedArg(const U32 value) : mType(IntType) { mInt = (S32)value; }
+      TypedArg(const F32 value) : mType(FloatType) { mFloat = value; }
+      TypedArg(const F32 x, const F32 y) : mType(Vector2Type) { mVector[0] = x; mVector[1] = y; }
+      TypedArg(FormatCallback pFormat, const void* pData) : mType(FormattedType) { mFormat.mpCallback = pFormat; mFormat.mpData = pData; }
+
+      /// Objects are passed by their Id string, which needs no formatting.
+      TypedArg(const SimObject* pObject);
+
+      inline Type getType() const { return mType; }
+      inline const char* getStringValue() const { return mString; }
+      inline S32 getIntValue() const { return mInt; }
+      inline F32 getFloatValue() const { return mFloat; }
+
+      /// Gets the argument as a string.
+      /// Strings are returned directly, anything else is formatted into the buffer.
+      const char* getString(char* pBuffer, const U32 bufferSize) const;
+
+   private:
+      Type mType;
+      union
+      {
+         const char* mString;
+         S32 mInt;
+         F32 mFloat;
+         F32 mVector[2];
+         struct
+         {
+            FormatCallback mpCallback;
+            const void* mpData;
+         } mFormat;
+      };
+   };
+
+   /// Call a script function from C/C++ code with typed arguments.
+   ///
+   /// @param pFunctionName   The name of the function to call.
+   /// @param argc            Number of elements in the argv parameter.
+   /// @param argv            The arguments to the function.
+   /// @see execute(S32 argc, const char* argv[])
+   const char *executeTyped(const char* pFunctionName, S32 argc = 0, const TypedArg* argv = NULL);
+
+   /// Call a Torque Script member function of a SimObject from C/C++ code with typed arguments.
+   ///
+   /// @param object          Object on which to execute the method call.
+   /// @param pMethodName     The name of the member function to call.
+   /// @param argc            Number of elements in the argv parameter.
+   /// @param argv            The arguments to the function, not including the object.
+   /// @code
+   /// // Call the method onHit() on an object, passing an object and a position.
+   /// Con::TypedArg args[] = { pOther, Con::TypedArg( position.x, position.y ) };
+   /// Con::executeTyped( mysimobject, "onHit", 2, args );
+   /// @endcode
+   /// @see execute(SimObject *, S32 argc, const char *argv[])
+   const char *executeTyped(SimObject *object, const char* pMethodName, S32 argc = 0, const TypedArg* argv = NULL);
+
    /// Evaluate an arbitrary chunk of code.
    ///
    /// @param  string   Buffer containing code to execute.
@@ -39,14 +39,79 @@ AbstractClassRep **                AbstractClassRep::classTable[NetClassGroupsCo
 U32                                AbstractClassRep::classCRC[NetClassGroupsCount] = {INITIAL_CRC_VALUE, };
 bool                               AbstractClassRep::initialized = false;
 
+//--------------------------------------
+static inline U32 hashFieldName(StringTableEntry name)
+{
+   // Field names are string table entries so the pointer identifies the name.
+   U32 hash = (U32)(dsize_t)name;
+   hash ^= hash >> 16;
+   hash *= 0x85ebca6b;
+   hash ^= hash >> 13;
+   return hash;
+}
+
 //--------------------------------------
 const AbstractClassRep::Field *AbstractClassRep::findField(StringTableEntry name) const
 {
-   for(U32 i = 0; i < (U32)mFieldList.size(); i++)
-      if(mFieldList[i].pFieldname == name)
-         return &mFieldList[i];
+   // Scan the field list if the index has not been built yet.
+   if(mFieldHashTable == NULL)
+   {
+      for(U32 i = 0; i < (U32)mFieldList.size(); i++)
+         if(mFieldList[i].pFieldname == name)
+            return &mFieldList[i];
 
-   return NULL;
+      return NULL;
+   }
+
+   // Probe the index until the field or an empty slot is found.
+   for(U32 slot = hashFieldName(name) & mFieldHashMask;; slot = (slot + 1) & mFieldHashMask)
+   {
+      const S32 index = mFieldHashTable[slot];
+      if(index < 0)
+         return NULL;
+
+      if(mFieldList[index].pFieldname == name)
+         return &mFieldList[index];
+   }
+}
+
+//--------------------------------------
+void AbstractClassRep::buildFieldHashTable()
+{
+   delete [] mFieldHashTable;
+   mFieldHashTable = NULL;
+   mFieldHashMask = 0;
+
+   const U32 fieldCount = mFieldList.size();
+   if(fieldCount == 0)
+      return;
+
+   // Keep the table at most half full so probe sequences stay short.
+   const U32 tableSize = getNextPow2(getMax(fieldCount * 2, (U32)8));
+   mFieldHashTable = new S32[tableSize];
+   mFieldHashMask = tableSize - 1;
+   for(U32 slot = 0; slot < tableSize; slot++)
+      mFieldHashTable[slot] = -1;
+
+   for(U32 i = 0; i < fieldCount; i++)
+   {
+      StringTableEntry name = mFieldList[i].pFieldname;
+
+      for(U32 slot = hashFieldName(name) & mFieldHashMask;; slot = (slot + 1) & mFieldHashMask)
+      {
+         const S32 index = mFieldHashTable[slot];
+
+         // The first field with a name wins, as it did with a linear scan.
+         if(index >= 0 && mFieldList[index].pFieldname == name)
+            break;
+
+         if(index < 0)
+         {
+            mFieldHashTable[slot] = (S32)i;
+            break;
+         }
+      }
+   }
 }
 
 //-----------------------------------------------------------------------------
@@ -202,6 +267,9 @@ void AbstractClassRep::initialize()
 
       // And of course delete it every round.
       sg_tempFieldList.clear();
+
+      // Index the final field list for lookups.
+      walk->buildFieldHashTable();
    }
 
    // Calculate counts and bit sizes for the various NetClasses.
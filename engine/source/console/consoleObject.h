@@ -176,6 +176,7 @@ class ConsoleTypeValidator;
 ///         - Links namespaces between parent and child classes, using Con::classLinkNamespaces.
 ///         - Calls initPersistFields() and consoleInit().
 ///      - As a result of calling initPersistFields, the field list for the class is populated.
+///      - Builds a hashed index of the field list so findField() does not scan it.
 ///      - Assigns network IDs for classes based on their NetGroup membership. Determines
 ///        bit allocations for network ID fields.
 ///
@@ -243,6 +244,16 @@ public:
 
     bool mDynamicGroupExpand;
 
+protected:
+    /// Open-addressed index of field list positions keyed by field name.
+    /// Built once the field list is final so that field lookups are O(1).
+    S32*    mFieldHashTable;
+    U32     mFieldHashMask;
+
+    void buildFieldHashTable();
+
+public:
+
     static U32  NetClassCount [NetClassGroupsCount][NetClassTypesCount];
     static U32  NetClassBitSize[NetClassGroupsCount][NetClassTypesCount];
 
@@ -256,8 +267,10 @@ public:
     {
         VECTOR_SET_ASSOCIATION(mFieldList);
         parentClass  = NULL;
+        mFieldHashTable = NULL;
+        mFieldHashMask = 0;
     }
-    virtual ~AbstractClassRep() { }
+    virtual ~AbstractClassRep() { delete [] mFieldHashTable; }
 
     S32 mClassGroupMask;                ///< Mask indicating in which NetGroups this object belongs.
     S32 mClassType;                     ///< Stores the NetClass of this class.
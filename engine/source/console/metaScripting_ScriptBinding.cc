@@ -27,6 +27,8 @@
 #include "io/resource/resourceManager.h"
 #include "io/fileStream.h"
 #include "console/compiler.h"
+#include "console/scriptCache.h"
+#include "io/memstream.h"
 
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_OSX)
 #include <ifaddrs.h>
@@ -199,6 +201,7 @@ ConsoleFunctionWithDocs(setScriptExecEcho, ConsoleVoid, 2, 2, (echo?))
 
 /*! Use the exec function to compile and execute a normal script, or a special journal script.
     If $Pref::ignoreDSOs is set to true, the system will use .cs before a .dso file if both are found.
+    Scripts held in a module script cache archive, see $Scripts::cacheArchives, are read from the archive instead of a .dso file.
     @param fileName A string containing a path to the script to be compiled and executed.
     @param nocalls A boolean value. If this value is set to true, then all function calls encountered while executing the script file will be skipped and not called. This allows us to re-define function definitions found in a script file, without re-executing other worker scripts in the same file.
     @param journalScript A boolean value. If this value is set tot true, and if a journal is being played, the engine will attempt to read this script from the journal stream. If no journal is playing, this field is ignored.
@@ -384,6 +387,38 @@ ConsoleFunctionWithDocs(exec, ConsoleBool, 2, 4, ( fileName, [nocalls]?, [journa
    }
 #endif //TORQUE_ALLOW_JOURNALING
 
+   // Is the script held in a loaded script cache archive?
+   if(compiled)
+   {
+      MemStream *cachedStream = ScriptCache::openScript(scriptFileName);
+      if(cachedStream)
+      {
+         F32 st1 = (F32)Platform::getRealMilliseconds();
+
+         // A short read means the archive entry is damaged.
+         CodeBlock *code = new CodeBlock;
+         const bool cachedRead = code->read(scriptFileName, *cachedStream) && cachedStream->getStatus() == Stream::Ok;
+         delete cachedStream;
+
+         if(cachedRead)
+         {
+            code->exec(0, scriptFileName, NULL, 0, NULL, noCalls, NULL, 0);
+
+            F32 etf = (F32)Platform::getRealMilliseconds() - st1;
+
+            if ( scriptExecutionEcho )
+               Con::printf("Loaded cached script %s. Took %.0f ms", scriptFileName, etf);
+
+            execDepth--;
+            return true;
+         }
+
+         // Fall back to the DSO or the script source.
+         Con::warnf("exec: Could not read cached script %s, loading it without the cache.", scriptFileName);
+         delete code;
+      }
+   }
+
    // Ok, we let's try to load and compile the script.
    ResourceObject *rScr = ResourceManager->find(scriptFileName);
    ResourceObject *rCom = NULL;
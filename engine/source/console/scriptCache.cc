@@ -0,0 +1,462 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "console/scriptCache.h"
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _COMPILER_H_
+#include "console/compiler.h"
+#endif
+
+#ifndef _MEMSTREAM_H_
+#include "io/memstream.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _BITSTREAM_H_
+#include "io/bitStream.h"
+#endif
+
+#ifndef _RESMANAGER_H_
+#include "io/resource/resourceManager.h"
+#endif
+
+#ifndef _CRC_H_
+#include "algorithm/crc.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCRIPTCACHE_SIGNATURE       (U32('T') | (U32('D') << 8) | (U32('S') << 16) | (U32('A') << 24))
+#define SCRIPTCACHE_EXTENSION       "dsa"
+#define SCRIPTCACHE_MAX_PATH        1024
+
+//-----------------------------------------------------------------------------
+
+Vector<ScriptCache*> ScriptCache::smCaches;
+
+//-----------------------------------------------------------------------------
+
+namespace
+{
+   /// A script found while updating an archive.
+   struct SourceFile
+   {
+      StringTableEntry  mScriptFile;
+      char*             mpSource;
+      U32               mSourceSize;
+      U32               mSourceHash;
+   };
+
+   /// Read and hash a range of scripts.  This runs on the thread pool so it
+   /// only uses the platform file and the CRC functions.
+   void readSourceRange( void* pContext, const U32 start, const U32 end )
+   {
+      SourceFile* pSources = static_cast<SourceFile*>( pContext );
+
+      for ( U32 index = start; index < end; ++index )
+      {
+         SourceFile& source = pSources[index];
+
+         File file;
+         if ( file.open( source.mScriptFile, File::Read ) != File::Ok )
+            continue;
+
+         const U32 size = file.getSize();
+         char* pSource = new char[size + 1];
+         U32 bytesRead = 0;
+         file.read( size, pSource, &bytesRead );
+         file.close();
+
+         if ( bytesRead != size )
+         {
+            delete [] pSource;
+            continue;
+         }
+
+         pSource[size] = 0;
+         source.mpSource = pSource;
+         source.mSourceSize = size;
+         source.mSourceHash = calculateCRC( pSource, size );
+      }
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+ScriptCache::ScriptCache( StringTableEntry moduleId, StringTableEntry scriptPath ) :
+   mModuleId( moduleId ),
+   mScriptPath( scriptPath ),
+   mpArchiveBuffer( NULL ),
+   mDirty( false )
+{
+   char archiveFile[SCRIPTCACHE_MAX_PATH];
+   dSprintf( archiveFile, sizeof(archiveFile), "%s/%s.%s", scriptPath, moduleId, SCRIPTCACHE_EXTENSION );
+   mArchiveFile = StringTable->insert( archiveFile );
+}
+
+//-----------------------------------------------------------------------------
+
+ScriptCache::~ScriptCache()
+{
+   clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptCache::clear( void )
+{
+   for ( typeEntryHash::iterator entryItr = mEntries.begin(); entryItr != mEntries.end(); ++entryItr )
+   {
+      delete [] entryItr->value->mpOwnedData;
+      delete entryItr->value;
+   }
+
+   mEntries.clear();
+
+   delete [] mpArchiveBuffer;
+   mpArchiveBuffer = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+ScriptCache::Entry* ScriptCache::findEntry( StringTableEntry scriptFile )
+{
+   typeEntryHash::iterator entryItr = mEntries.find( scriptFile );
+
+   return entryItr == mEntries.end() ? NULL : entryItr->value;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptCache::removeEntry( Entry* pEntry )
+{
+   mEntries.erase( pEntry->mScriptFile );
+
+   delete [] pEntry->mpOwnedData;
+   delete pEntry;
+
+   mDirty = true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScriptCache::read( void )
+{
+   // Read the whole archive in one go.
+   File file;
+   if ( file.open( mArchiveFile, File::Read ) != File::Ok )
+      return false;
+
+   const U32 archiveSize = file.getSize();
+   if ( archiveSize == 0 )
+   {
+      file.close();
+      return false;
+   }
+
+   mpArchiveBuffer = new U8[archiveSize];
+   U32 bytesRead = 0;
+   file.read( archiveSize, (char*)mpArchiveBuffer, &bytesRead );
+   file.close();
+
+   MemStream stream( archiveSize, mpArchiveBuffer, true, false );
+
+   // Check the versions.
+   U32 signature = 0;
+   U32 archiveVersion = 0;
+   U32 dsoVersion = 0;
+   U32 entryCount = 0;
+   if ( bytesRead != archiveSize ||
+      !stream.read( &signature ) || signature != SCRIPTCACHE_SIGNATURE ||
+      !stream.read( &archiveVersion ) || archiveVersion != ArchiveVersion ||
+      !stream.read( &dsoVersion ) || dsoVersion != DSO_VERSION ||
+      !stream.read( &entryCount ) )
+   {
+      Con::warnf( "ScriptCache: Found an old or invalid archive '%s', ignoring.", mArchiveFile );
+      delete [] mpArchiveBuffer;
+      mpArchiveBuffer = NULL;
+      return false;
+   }
+
+   // Read the entry table, the data offsets are relative to the end of the table.
+   Vector<Entry*> entries;
+   Vector<U32> offsets;
+   for ( U32 index = 0; index < entryCount; ++index )
+   {
+      char fileName[SCRIPTCACHE_MAX_PATH];
+      stream.readLongString( sizeof(fileName) - 1, fileName );
+
+      char scriptFile[SCRIPTCACHE_MAX_PATH];
+      dSprintf( scriptFile, sizeof(scriptFile), "%s/%s", mScriptPath, fileName );
+
+      Entry* pEntry = new Entry;
+      pEntry->mScriptFile = StringTable->insert( scriptFile );
+      pEntry->mpData = NULL;
+      pEntry->mpOwnedData = NULL;
+      pEntry->mValid = false;
+
+      U32 offset = 0;
+      stream.read( &pEntry->mSourceHash );
+      stream.read( &pEntry->mSourceSize );
+      stream.read( &offset );
+      stream.read( &pEntry->mDataSize );
+
+      entries.push_back( pEntry );
+      offsets.push_back( offset );
+      mEntries.insert( pEntry->mScriptFile, pEntry );
+   }
+
+   // Point the entries into the archive buffer.
+   const U32 dataStart = stream.getPosition();
+   for ( U32 index = 0; index < (U32)entries.size(); ++index )
+   {
+      Entry* pEntry = entries[index];
+      const U32 offset = offsets[index];
+
+      if ( stream.getStatus() == Stream::IOError || dataStart + offset + pEntry->mDataSize > archiveSize )
+      {
+         Con::warnf( "ScriptCache: Found a truncated archive '%s', ignoring.", mArchiveFile );
+         clear();
+         return false;
+      }
+
+      pEntry->mpData = mpArchiveBuffer + dataStart + offset;
+   }
+
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScriptCache::write( void )
+{
+   FileStream stream;
+   if ( !ResourceManager->openFileForWrite( stream, mArchiveFile ) )
+   {
+      Con::warnf( "ScriptCache: Could not write the archive '%s'.", mArchiveFile );
+      return false;
+   }
+
+   stream.write( U32(SCRIPTCACHE_SIGNATURE) );
+   stream.write( U32(ArchiveVersion) );
+   stream.write( DSO_VERSION );
+   stream.write( U32(mEntries.size()) );
+
+   // Write the entry table with the scripts relative to the script path.
+   const U32 scriptPathLength = dStrlen( mScriptPath ) + 1;
+   U32 offset = 0;
+   for ( typeEntryHash::iterator entryItr = mEntries.begin(); entryItr != mEntries.end(); ++entryItr )
+   {
+      Entry* pEntry = entryItr->value;
+
+      stream.writeLongString( SCRIPTCACHE_MAX_PATH - 1, pEntry->mScriptFile + scriptPathLength );
+      stream.write( pEntry->mSourceHash );
+      stream.write( pEntry->mSourceSize );
+      stream.write( offset );
+      stream.write( pEntry->mDataSize );
+
+      offset += pEntry->mDataSize;
+   }
+
+   // Write the compiled code.
+   for ( typeEntryHash::iterator entryItr = mEntries.begin(); entryItr != mEntries.end(); ++entryItr )
+   {
+      stream.write( entryItr->value->mDataSize, entryItr->value->mpData );
+   }
+
+   stream.close();
+
+   mDirty = false;
+
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptCache::update( void )
+{
+   // Find the scripts.
+   Vector<Platform::FileInfo> files;
+   Platform::dumpPath( mScriptPath, files );
+
+   Vector<SourceFile> sources;
+   for ( Vector<Platform::FileInfo>::iterator fileItr = files.begin(); fileItr != files.end(); ++fileItr )
+   {
+      const char* pExtension = dStrrchr( fileItr->pFileName, '.' );
+      if ( pExtension == NULL || ( dStricmp( pExtension, ".cs" ) != 0 && dStricmp( pExtension, ".gui" ) != 0 ) )
+         continue;
+
+      char scriptFile[SCRIPTCACHE_MAX_PATH];
+      dSprintf( scriptFile, sizeof(scriptFile), "%s/%s", fileItr->pFullPath, fileItr->pFileName );
+
+      SourceFile source;
+      source.mScriptFile = StringTable->insert( scriptFile );
+      source.mpSource = NULL;
+      source.mSourceSize = 0;
+      source.mSourceHash = 0;
+      sources.push_back( source );
+   }
+
+   // Build the CRC table before the worker threads use it.
+   calculateCRC( NULL, 0 );
+
+   // Read and hash the scripts across the thread pool.
+   if ( sources.size() > 0 )
+      ThreadPool::getGlobalThreadPool()->parallelFor( sources.size(), 4, &readSourceRange, sources.address() );
+
+   for ( typeEntryHash::iterator entryItr = mEntries.begin(); entryItr != mEntries.end(); ++entryItr )
+      entryItr->value->mValid = false;
+
+   // Compile the changed scripts.  The compiler uses global state so this is serial.
+   U32 compileCount = 0;
+   for ( Vector<SourceFile>::iterator sourceItr = sources.begin(); sourceItr != sources.end(); ++sourceItr )
+   {
+      if ( sourceItr->mpSource == NULL )
+         continue;
+
+      Entry* pEntry = findEntry( sourceItr->mScriptFile );
+
+      if ( pEntry == NULL || pEntry->mSourceHash != sourceItr->mSourceHash || pEntry->mSourceSize != sourceItr->mSourceSize )
+      {
+         InfiniteBitStream compiledStream;
+         CodeBlock* pCodeBlock = new CodeBlock();
+         const bool compiled = pCodeBlock->compileToStream( compiledStream, sourceItr->mScriptFile, sourceItr->mpSource );
+         delete pCodeBlock;
+
+         if ( compiled )
+         {
+            if ( pEntry == NULL )
+            {
+               pEntry = new Entry;
+               pEntry->mScriptFile = sourceItr->mScriptFile;
+               pEntry->mpOwnedData = NULL;
+               mEntries.insert( pEntry->mScriptFile, pEntry );
+            }
+
+            delete [] pEntry->mpOwnedData;
+            pEntry->mDataSize = compiledStream.getPosition();
+            pEntry->mpOwnedData = new U8[pEntry->mDataSize];
+            dMemcpy( pEntry->mpOwnedData, compiledStream.getBuffer(), pEntry->mDataSize );
+            pEntry->mpData = pEntry->mpOwnedData;
+            pEntry->mSourceHash = sourceItr->mSourceHash;
+            pEntry->mSourceSize = sourceItr->mSourceSize;
+
+            mDirty = true;
+            compileCount++;
+         }
+         else
+         {
+            pEntry = NULL;
+         }
+      }
+
+      // Remember the script time so exec() can tell when the script changes.
+      if ( pEntry != NULL )
+         pEntry->mValid = Platform::getFileTimes( pEntry->mScriptFile, NULL, &pEntry->mModifyTime );
+
+      delete [] sourceItr->mpSource;
+   }
+
+   // Remove the scripts that are gone or failed to compile.
+   Vector<Entry*> staleEntries;
+   for ( typeEntryHash::iterator entryItr = mEntries.begin(); entryItr != mEntries.end(); ++entryItr )
+   {
+      if ( !entryItr->value->mValid )
+         staleEntries.push_back( entryItr->value );
+   }
+
+   for ( Vector<Entry*>::iterator entryItr = staleEntries.begin(); entryItr != staleEntries.end(); ++entryItr )
+      removeEntry( *entryItr );
+
+   if ( mDirty )
+      write();
+
+   Con::printf( "ScriptCache: Module '%s' has %d script(s) cached, %d compiled.", mModuleId, mEntries.size(), compileCount );
+}
+
+//-----------------------------------------------------------------------------
+
+ScriptCache* ScriptCache::loadModule( StringTableEntry moduleId, StringTableEntry modulePath )
+{
+   // Finish if the module is already loaded.
+   for ( Vector<ScriptCache*>::iterator cacheItr = smCaches.begin(); cacheItr != smCaches.end(); ++cacheItr )
+   {
+      if ( (*cacheItr)->mModuleId == moduleId )
+         return *cacheItr;
+   }
+
+   ScriptCache* pScriptCache = new ScriptCache( moduleId, modulePath );
+   pScriptCache->read();
+   pScriptCache->update();
+
+   smCaches.push_back( pScriptCache );
+
+   return pScriptCache;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScriptCache::unloadModule( StringTableEntry moduleId )
+{
+   for ( Vector<ScriptCache*>::iterator cacheItr = smCaches.begin(); cacheItr != smCaches.end(); ++cacheItr )
+   {
+      if ( (*cacheItr)->mModuleId == moduleId )
+      {
+         delete *cacheItr;
+         smCaches.erase( cacheItr );
+         return;
+      }
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+MemStream* ScriptCache::openScript( StringTableEntry scriptFile )
+{
+   for ( Vector<ScriptCache*>::iterator cacheItr = smCaches.begin(); cacheItr != smCaches.end(); ++cacheItr )
+   {
+      Entry* pEntry = (*cacheItr)->findEntry( scriptFile );
+
+      if ( pEntry == NULL || !pEntry->mValid || pEntry->mDataSize == 0 )
+         continue;
+
+      // Ignore the entry if the script changed since the archive was updated.
+      FileTime modifyTime;
+      if ( !Platform::getFileTimes( scriptFile, NULL, &modifyTime ) || Platform::compareFileTimes( modifyTime, pEntry->mModifyTime ) != 0 )
+         return NULL;
+
+      return new MemStream( pEntry->mDataSize, (void*)pEntry->mpData, true, false );
+   }
+
+   return NULL;
+}
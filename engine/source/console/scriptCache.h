@@ -0,0 +1,110 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCRIPTCACHE_H_
+#define _SCRIPTCACHE_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+class MemStream;
+
+//-----------------------------------------------------------------------------
+
+/// A single file holding the compiled code of every script below a path.
+///
+/// Each module loaded by the module manager gets an archive named after the
+/// module Id in the module path when "$Scripts::cacheArchives" is set.  The
+/// archive is read into memory with a single read and validated against the
+/// archive and DSO versions.  Each entry records a hash of the script source
+/// it was compiled from so only scripts that changed are recompiled.
+///
+/// exec() looks scripts up in the loaded archives before looking for a DSO
+/// and reads the code block straight out of the archive memory.
+class ScriptCache
+{
+public:
+   struct Entry
+   {
+      StringTableEntry  mScriptFile;
+      U32               mSourceHash;
+      U32               mSourceSize;
+      FileTime          mModifyTime;
+      const U8*         mpData;
+      U32               mDataSize;
+      U8*               mpOwnedData;
+      bool              mValid;
+   };
+
+   typedef HashMap<StringTableEntry, Entry*> typeEntryHash;
+
+private:
+   StringTableEntry     mModuleId;
+   StringTableEntry     mScriptPath;
+   StringTableEntry     mArchiveFile;
+   U8*                  mpArchiveBuffer;
+   typeEntryHash        mEntries;
+   bool                 mDirty;
+
+   static Vector<ScriptCache*> smCaches;
+
+   Entry*               findEntry( StringTableEntry scriptFile );
+   void                 removeEntry( Entry* pEntry );
+   void                 clear( void );
+   bool                 read( void );
+   bool                 write( void );
+   void                 update( void );
+
+public:
+   ScriptCache( StringTableEntry moduleId, StringTableEntry scriptPath );
+   ~ScriptCache();
+
+   inline U32           getEntryCount( void ) const { return (U32)mEntries.size(); }
+
+   /// Archive file format version.
+   static const U32     ArchiveVersion = 1;
+
+   /// Load and update the archive for a module.
+   static ScriptCache*  loadModule( StringTableEntry moduleId, StringTableEntry modulePath );
+
+   /// Release the archive for a module.
+   static void          unloadModule( StringTableEntry moduleId );
+
+   /// Open a stream over the compiled code of a script or NULL if no loaded
+   /// archive holds an up to date entry.  The caller deletes the stream.
+   static MemStream*    openScript( StringTableEntry scriptFile );
+};
+
+#endif // _SCRIPTCACHE_H_
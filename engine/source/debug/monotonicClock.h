@@ -0,0 +1,96 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _MONOTONIC_CLOCK_H_
+#define _MONOTONIC_CLOCK_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#if defined(TORQUE_OS_WIN32)
+#include "platformWin32/platformWin32.h"
+#elif defined(TORQUE_OS_MAC) || defined(TORQUE_OS_IOS)
+#include <mach/mach_time.h>
+#else
+#include <time.h>
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// The platform monotonic clock.
+///
+/// Unlike the profiler timers it is available in every build and its ticks are
+/// comparable between threads, so it is used for trace timestamps and frame
+/// times.
+namespace MonotonicClock
+{
+
+#if defined(TORQUE_OS_WIN32)
+
+inline U64 getTicks()
+{
+   LARGE_INTEGER ticks;
+   QueryPerformanceCounter(&ticks);
+   return ticks.QuadPart;
+}
+
+inline F64 getTicksPerSecond()
+{
+   LARGE_INTEGER frequency;
+   QueryPerformanceFrequency(&frequency);
+   return (F64)frequency.QuadPart;
+}
+
+#elif defined(TORQUE_OS_MAC) || defined(TORQUE_OS_IOS)
+
+inline U64 getTicks()
+{
+   return mach_absolute_time();
+}
+
+inline F64 getTicksPerSecond()
+{
+   mach_timebase_info_data_t timebase;
+   mach_timebase_info(&timebase);
+   return 1000000000.0 * timebase.denom / timebase.numer;
+}
+
+#else
+
+inline U64 getTicks()
+{
+   struct timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return (U64)now.tv_sec * 1000000000 + now.tv_nsec;
+}
+
+inline F64 getTicksPerSecond()
+{
+   return 1000000000.0;
+}
+
+#endif
+
+}
+
+#endif // _MONOTONIC_CLOCK_H_
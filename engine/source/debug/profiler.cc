@@ -29,6 +29,9 @@
 #include "collection/vector.h"
 #include "io/fileStream.h"
 #include "platform/threads/thread.h"
+#include "platform/threads/mutex.h"
+#include "platform/threads/atomic.h"
+#include "debug/monotonicClock.h"
 
 #include "profiler_ScriptBinding.h"
 
@@ -36,9 +39,9 @@
 ProfilerRootData *ProfilerRootData::sRootList = NULL;
 Profiler *gProfiler = NULL;
 
-#ifdef TORQUE_MULTITHREAD
+// Worker threads (such as the thread pool) may hit profiler markers so only
+// the main thread activity is recorded.
 ThreadIdent gMainThread = 0;
-#endif
 
 #if defined(TORQUE_SUPPORTS_VC_INLINE_X86_ASM)
 // platform specific get hires times...
@@ -158,6 +161,47 @@ U32 endHighResolutionTimer(U32 time[2])
 
 #endif
 
+/// Ring buffer of marker entries and exits for a single thread.  Only the
+/// owning thread writes to it, dumpTrace() reads the events published by mHead.
+struct Profiler::TraceBuffer
+{
+   enum {
+      EventCount = 65536 ///< must be a power of two.
+   };
+   enum EventType {
+      Begin,
+      End,
+      Frame
+   };
+   struct Event
+   {
+      U64 mTime;
+      ProfilerRootData *mRoot;
+      U32 mType;
+      U32 mFrame;
+   };
+
+   ThreadIdent mThreadId;
+   U32 mGeneration; ///< the trace the stack belongs to.
+   U32 mStart; ///< the first event of the current trace.
+   U32 mHead; ///< the number of events written, only the last EventCount are kept.
+   U32 mStackDepth;
+   ProfilerRootData *mStack[MaxStackDepth];
+   Event mEvents[EventCount];
+
+   void write(U32 type, ProfilerRootData *root, U32 frame)
+   {
+      Event &event = mEvents[mHead & (EventCount - 1)];
+      event.mTime = MonotonicClock::getTicks();
+      event.mRoot = root;
+      event.mType = type;
+      event.mFrame = frame;
+      dAtomicStoreRelease(&mHead, mHead + 1);
+   }
+};
+
+static Mutex gTraceMutex;
+
 Profiler::Profiler()
 {
    mMaxStackDepth = MaxStackDepth;
@@ -192,15 +236,26 @@ Profiler::Profiler()
    mDumpToFile      = false;
    mDumpFileName[0] = '\0';
 
-#ifdef TORQUE_MULTITHREAD
+   for(U32 i = 0; i < MaxTraceThreads; i++)
+      mTraceBuffers[i] = NULL;
+   mTraceBufferCount = 0;
+   mTraceGeneration = 0;
+   mTraceFrame = 0;
+   mTraceStartTime = 0;
+   mTraceEnabled = false;
+   mNextTraceEnable = false;
+   mDumpTrace = false;
+   mTraceFileName[0] = '\0';
+
    gMainThread = ThreadManager::getCurrentThreadId();
-#endif
 }
 
 Profiler::~Profiler()
 {
    reset();
    free(mRootProfilerData);
+   for(U32 i = 0; i < mTraceBufferCount; i++)
+      free(mTraceBuffers[i]);
    gProfiler = NULL;
 }
 
@@ -276,11 +331,13 @@ void Profiler::validate()
 
 void Profiler::hashPush(ProfilerRootData *root)
 {
-#ifdef TORQUE_MULTITHREAD
+   // The trace records every thread.
+   if(mTraceEnabled)
+      traceBegin(root);
+
    // Ignore non-main-thread profiler activity.
    if(! ThreadManager::isCurrentThread(gMainThread) )
       return;
-#endif
 
    mStackDepth++;
    AssertFatal(mStackDepth <= (S32)mMaxStackDepth,
@@ -372,11 +429,12 @@ void Profiler::dumpToFile(const char* fileName)
 
 void Profiler::hashPop()
 {
-#ifdef TORQUE_MULTITHREAD
+   if(mTraceEnabled)
+      traceEnd();
+
    // Ignore non-main-thread profiler activity.
    if(! ThreadManager::isCurrentThread(gMainThread) )
       return;
-#endif
 
    mStackDepth--;
    AssertFatal(mStackDepth >= 0, "Stack underflow in profiler.  You may have mismatched PROFILE_START and PROFILE_ENDs");
@@ -403,6 +461,18 @@ void Profiler::hashPop()
          dump();
          startHighResolutionTimer(mCurrentProfilerData->mStartTime);
       }
+      if(mDumpTrace)
+         dumpTrace();
+      if(!mTraceEnabled && mNextTraceEnable)
+      {
+         // Start a new trace, stacks left open by the last one are discarded.
+         for(U32 i = 0; i < mTraceBufferCount; i++)
+            mTraceBuffers[i]->mStart = mTraceBuffers[i]->mHead;
+         dAtomicStoreRelease(&mTraceGeneration, mTraceGeneration + 1);
+         mTraceFrame = 0;
+         mTraceStartTime = MonotonicClock::getTicks();
+      }
+      mTraceEnabled = mNextTraceEnable;
       if(!mEnabled && mNextEnable)
          startHighResolutionTimer(mCurrentProfilerData->mStartTime);
       mEnabled = mNextEnable;
@@ -611,4 +681,204 @@ void Profiler::enableMarker(const char *marker, bool enable)
    }
 }
 
+void Profiler::enableTrace(bool enabled)
+{
+   mNextTraceEnable = enabled;
+
+   if ( enabled )
+       Con::printf( "Profiler trace is on." );
+   else
+       Con::printf( "Profiler trace is off." );
+}
+
+void Profiler::dumpTraceToFile(const char *fileName)
+{
+   AssertFatal(dStrlen(fileName) < DumpFileNameLength, "Error, trace filename too long");
+   mDumpTrace = true;
+   dStrcpy(mTraceFileName, fileName);
+}
+
+void Profiler::markFrame()
+{
+   if(!mTraceEnabled)
+      return;
+
+   TraceBuffer *buffer = getTraceBuffer();
+   if(buffer)
+      buffer->write(TraceBuffer::Frame, NULL, mTraceFrame++);
+}
+
+Profiler::TraceBuffer *Profiler::getTraceBuffer()
+{
+   const ThreadIdent threadId = ThreadManager::getCurrentThreadId();
+   const U32 generation = dAtomicLoadAcquire(&mTraceGeneration);
+
+   // Buffers are never removed so they can be searched without locking.
+   U32 count = dAtomicLoadAcquire(&mTraceBufferCount);
+   for(U32 i = 0; i < count; i++)
+   {
+      TraceBuffer *buffer = mTraceBuffers[i];
+      if(!ThreadManager::compare(buffer->mThreadId, threadId))
+         continue;
+
+      // Scopes entered before the trace started never close in it.
+      if(buffer->mGeneration != generation)
+      {
+         buffer->mGeneration = generation;
+         buffer->mStackDepth = 0;
+      }
+      return buffer;
+   }
+
+   MutexHandle handle;
+   handle.lock(&gTraceMutex, true);
+
+   count = mTraceBufferCount;
+   if(count == MaxTraceThreads)
+      return NULL;
+
+   TraceBuffer *buffer = (TraceBuffer *) malloc(sizeof(TraceBuffer));
+   buffer->mThreadId = threadId;
+   buffer->mGeneration = generation;
+   buffer->mStart = 0;
+   buffer->mHead = 0;
+   buffer->mStackDepth = 0;
+   mTraceBuffers[count] = buffer;
+   dAtomicStoreRelease(&mTraceBufferCount, count + 1);
+   return buffer;
+}
+
+void Profiler::traceBegin(ProfilerRootData *root)
+{
+   TraceBuffer *buffer = getTraceBuffer();
+   if(!buffer)
+      return;
+
+   const U32 depth = buffer->mStackDepth++;
+   if(depth >= MaxStackDepth)
+      return;
+
+   buffer->mStack[depth] = root;
+   if(root->mEnabled)
+      buffer->write(TraceBuffer::Begin, root, 0);
+}
+
+void Profiler::traceEnd()
+{
+   TraceBuffer *buffer = getTraceBuffer();
+   if(!buffer || !buffer->mStackDepth)
+      return;
+
+   const U32 depth = --buffer->mStackDepth;
+   if(depth >= MaxStackDepth)
+      return;
+
+   ProfilerRootData *root = buffer->mStack[depth];
+   if(root->mEnabled)
+      buffer->write(TraceBuffer::End, root, 0);
+}
+
+static void writeTraceEvent(FileStream &fws, bool &firstEvent, const char *event)
+{
+   if(!firstEvent)
+      fws.write(2, ",\n");
+   fws.write(dStrlen(event), event);
+   firstEvent = false;
+}
+
+void Profiler::dumpTrace()
+{
+   mDumpTrace = false;
+
+   FileStream fws;
+   if(!fws.open(mTraceFileName, FileStream::Write))
+   {
+      Con::errorf("Profiler::dumpTrace() - Cannot write profile trace to '%s'.", mTraceFileName);
+      return;
+   }
+
+   struct OpenScope
+   {
+      ProfilerRootData *mRoot;
+      F64 mTime;
+   };
+   TraceBuffer::Event *events = (TraceBuffer::Event *) malloc(sizeof(TraceBuffer::Event) * TraceBuffer::EventCount);
+   OpenScope openScopes[MaxStackDepth];
+   const F64 ticksPerMicrosecond = MonotonicClock::getTicksPerSecond() / 1000000.0;
+   char buffer[1024];
+   bool firstEvent = true;
+
+   dStrcpy(buffer, "{\"traceEvents\":[\n");
+   fws.write(dStrlen(buffer), buffer);
+
+   const U32 bufferCount = dAtomicLoadAcquire(&mTraceBufferCount);
+   for(U32 threadIndex = 0; threadIndex < bufferCount; threadIndex++)
+   {
+      TraceBuffer *traceBuffer = mTraceBuffers[threadIndex];
+
+      if(ThreadManager::compare(traceBuffer->mThreadId, gMainThread))
+         dSprintf(buffer, sizeof(buffer), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"Main Thread\"}}", threadIndex);
+      else
+         dSprintf(buffer, sizeof(buffer), "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"Thread %d\"}}", threadIndex, threadIndex);
+      writeTraceEvent(fws, firstEvent, buffer);
+
+      // Copy the events then drop any the thread overwrote while copying.
+      const U32 head = dAtomicLoadAcquire(&traceBuffer->mHead);
+      U32 start = traceBuffer->mStart;
+      if(head - start > TraceBuffer::EventCount)
+         start = head - TraceBuffer::EventCount;
+      const U32 eventCount = head - start;
+      for(U32 i = 0; i < eventCount; i++)
+         events[i] = traceBuffer->mEvents[(start + i) & (TraceBuffer::EventCount - 1)];
+
+      const U32 copiedHead = dAtomicLoadAcquire(&traceBuffer->mHead);
+      U32 firstValid = 0;
+      if(copiedHead - start >= TraceBuffer::EventCount)
+         firstValid = copiedHead - start - TraceBuffer::EventCount + 1;
+
+      // Pair the entries and exits, exits whose entry was overwritten are skipped.
+      U32 depth = 0;
+      for(U32 i = firstValid; i < eventCount; i++)
+      {
+         const TraceBuffer::Event &event = events[i];
+         const F64 time = (S64)(event.mTime - mTraceStartTime) / ticksPerMicrosecond;
+
+         if(event.mType == TraceBuffer::Begin)
+         {
+            if(depth < MaxStackDepth)
+            {
+               openScopes[depth].mRoot = event.mRoot;
+               openScopes[depth].mTime = time;
+            }
+            depth++;
+         }
+         else if(event.mType == TraceBuffer::End)
+         {
+            if(!depth)
+               continue;
+            depth--;
+            if(depth >= MaxStackDepth || openScopes[depth].mRoot != event.mRoot)
+               continue;
+
+            dSprintf(buffer, sizeof(buffer), "{\"name\":\"%s\",\"cat\":\"profiler\",\"ph\":\"X\",\"pid\":0,\"tid\":%d,\"ts\":%.3f,\"dur\":%.3f}",
+                     event.mRoot->mName, threadIndex, openScopes[depth].mTime, time - openScopes[depth].mTime);
+            writeTraceEvent(fws, firstEvent, buffer);
+         }
+         else
+         {
+            dSprintf(buffer, sizeof(buffer), "{\"name\":\"Frame %d\",\"cat\":\"frame\",\"ph\":\"i\",\"s\":\"g\",\"pid\":0,\"tid\":%d,\"ts\":%.3f}",
+                     event.mFrame, threadIndex, time);
+            writeTraceEvent(fws, firstEvent, buffer);
+         }
+      }
+   }
+
+   dStrcpy(buffer, "\n],\"displayTimeUnit\":\"ms\"}\n");
+   fws.write(dStrlen(buffer), buffer);
+   fws.close();
+   free(events);
+
+   Con::printf("Profiler trace dumped to '%s'.", mTraceFileName);
+}
+
 #endif
@@ -41,8 +41,14 @@ struct ProfilerRootData;
 /// profilerDump();                                         //dumps all profiler data to the console
 /// profilerDumpToFile(string filename);                    //dumps all profiler data to a given file
 /// profilerMarkerEnable((string markerName, bool enable);  //enables or disables a given profile tag
+/// profilerTraceEnable(bool enable);                       //enables or disables recording a trace of every marker
+/// profilerDumpTrace(string filename);                     //dumps the recorded trace to a Chrome trace JSON file
 /// @endcode
 ///
+/// The trace keeps the most recent entries and exits of every marker on every thread, along with
+/// the frame markers from PROFILE_FRAME(), so individual frame spikes can be inspected in
+/// chrome://tracing or Perfetto rather than only the averages the dumps show.
+///
 /// The C++ code side of the profiler uses pairs of PROFILE_START() and PROFILE_END().
 ///
 /// When using these macros, make sure there is a PROFILE_END() for every PROFILE_START
@@ -69,7 +75,8 @@ class Profiler
 {
    enum {
       MaxStackDepth = 256,
-      DumpFileNameLength = 256
+      DumpFileNameLength = 256,
+      MaxTraceThreads = 32
    };
    U32 mCurrentHash;
 
@@ -84,8 +91,25 @@ class Profiler
    bool mDumpToConsole;
    bool mDumpToFile;
    char mDumpFileName[DumpFileNameLength];
+
+   struct TraceBuffer;
+   TraceBuffer *mTraceBuffers[MaxTraceThreads];
+   U32 mTraceBufferCount;
+   U32 mTraceGeneration;
+   U32 mTraceFrame;
+   U64 mTraceStartTime;
+   bool mTraceEnabled;
+   bool mNextTraceEnable;
+   bool mDumpTrace;
+   char mTraceFileName[DumpFileNameLength];
+
    void dump();
    void validate();
+
+   TraceBuffer *getTraceBuffer();
+   void traceBegin(ProfilerRootData *root);
+   void traceEnd();
+   void dumpTrace();
 public:
    Profiler();
    ~Profiler();
@@ -105,6 +129,13 @@ public:
    void hashPop();
    /// Enable a profiler marker
    void enableMarker(const char *marker, bool enabled);
+   /// Enable recording a trace of every marker on every thread
+   void enableTrace(bool enabled);
+   /// Dumps the recorded trace to a Chrome trace JSON file
+   /// @param fileName filename to dump the trace to
+   void dumpTraceToFile(const char *fileName);
+   /// Helper function for macro definition PROFILE_FRAME
+   void markFrame();
 };
 
 extern Profiler *gProfiler;
@@ -156,6 +187,9 @@ if(gProfiler) gProfiler->hashPush(& pdata##name##obj )
 #undef PROFILE_END
 #define PROFILE_END() if(gProfiler) gProfiler->hashPop()
 
+#undef PROFILE_FRAME
+#define PROFILE_FRAME() if(gProfiler) gProfiler->markFrame()
+
 class ScopedProfiler {
 public:
    ScopedProfiler(ProfilerRootData *data) {
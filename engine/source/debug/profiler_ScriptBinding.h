@@ -77,6 +77,27 @@ ConsoleFunctionWithDocs(profilerReset, ConsoleVoid, 1, 1, ())
       gProfiler->reset();
 }
 
+/*! Enables (or disables) recording a trace of every profiler marker entry and exit on every thread.
+    The most recent events of each thread are kept along with a marker for each frame.
+    @param enable Boolean value. Starts a new trace if true, stops recording if false.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(profilerTraceEnable, ConsoleVoid, 2, 2, (bool enable))
+{
+   if(gProfiler)
+      gProfiler->enableTrace(dAtob(argv[1]));
+}
+
+/*! Dump the recorded trace to a file in the Chrome trace JSON format, which can be opened with chrome://tracing or Perfetto.
+    @param filename The file to write the trace to.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(profilerDumpTrace, ConsoleVoid, 2, 2, (string filename))
+{
+   if(gProfiler)
+      gProfiler->dumpTraceToFile(argv[1]);
+}
+
 ConsoleFunctionGroupEnd( Profiler );
 
 /*! @} */ // group ProfilerFunctions
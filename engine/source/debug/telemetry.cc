@@ -0,0 +1,552 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/platform.h"
+#include "debug/telemetry.h"
+#include "debug/profiler.h"
+#include "console/console.h"
+#include "collection/vector.h"
+#include "io/fileStream.h"
+#include "io/memstream.h"
+#include "platform/event.h"
+#include "platform/platformNetwork.h"
+#include "math/mMathFn.h"
+#include "debug/monotonicClock.h"
+
+#include "telemetry_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+TelemetryCounter *TelemetryCounter::smCounters[TelemetryCounter::MaxCounters];
+U32 TelemetryCounter::smCounterCount = 0;
+TelemetryHistogram *TelemetryHistogram::smHistogramList = NULL;
+
+// The counter values of the most recent frames.
+static F32 sWindow[Telemetry::WindowFrames][TelemetryCounter::MaxCounters];
+static U32 sFrameCount = 0;
+static U64 sLastFrameTicks = 0;
+static F64 sTicksPerMillisecond = 0.0;
+
+//-----------------------------------------------------------------------------
+
+static TelemetryCounter sFrameTimeCounter( "frameTime", TelemetryCounter::Gauge );
+static TelemetryHistogram sFrameTimeHistogram( "frameTime", 0.25f );
+
+enum StreamTarget
+{
+   StreamNone,
+   StreamFile,
+   StreamUDP,
+   StreamTCP
+};
+
+static const U32 sStreamBlockHeaderSize = 4 + sizeof(U16) + sizeof(U16);
+
+static StreamTarget sStreamTarget = StreamNone;
+static FileStream *sStreamFile = NULL;
+static NetSocket sStreamSocket = InvalidSocket;
+static NetAddress sStreamAddress;
+static bool sStreamConnected = false;
+static bool sStreamSendWarned = false;
+static Vector<U8> sStreamQueue;
+static U8 sStreamBlock[Telemetry::StreamBlockSize];
+static U32 sStreamBlockSize = 0;
+static U32 sStreamedCounterCount = 0;
+static U32 sStreamNamesFrame = 0;
+static bool sStreamNamesPending = false;
+
+//-----------------------------------------------------------------------------
+
+TelemetryCounter::TelemetryCounter(const char *name, Mode mode)
+{
+   mName = name;
+   mMode = mode;
+   mValue = 0.0f;
+
+   // Counters are usually static so there's nowhere to report too many.
+   mIndex = smCounterCount < MaxCounters ? smCounterCount++ : MaxCounters;
+   if(mIndex < MaxCounters)
+      smCounters[mIndex] = this;
+}
+
+TelemetryCounter *TelemetryCounter::find(const char *name)
+{
+   for(U32 i = 0; i < smCounterCount; i++)
+   {
+      if(!dStricmp(smCounters[i]->mName, name))
+         return smCounters[i];
+   }
+   return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+TelemetryHistogram::TelemetryHistogram(const char *name, F32 minimum)
+{
+   mName = name;
+   mMinimum = minimum;
+   mNext = smHistogramList;
+   smHistogramList = this;
+   reset();
+}
+
+void TelemetryHistogram::record(F32 value)
+{
+   // Bucket zero holds values up to the minimum, after that each bucket
+   // ends a quarter of a doubling above the last.
+   U32 bucket = 0;
+   if(value > mMinimum)
+   {
+      bucket = (U32)(mLog(value / mMinimum) * (BucketsPerDoubling / 0.69314718f)) + 1;
+      if(bucket >= BucketCount)
+         bucket = BucketCount - 1;
+   }
+
+   mBuckets[bucket]++;
+   mSampleCount++;
+}
+
+void TelemetryHistogram::reset()
+{
+   mSampleCount = 0;
+   for(U32 i = 0; i < BucketCount; i++)
+      mBuckets[i] = 0;
+}
+
+F32 TelemetryHistogram::getPercentile(F32 percentile) const
+{
+   if(mSampleCount == 0)
+      return 0.0f;
+
+   U32 rank = (U32)mCeil(mClampF(percentile, 0.0f, 100.0f) * mSampleCount / 100.0f);
+   if(rank < 1)
+      rank = 1;
+
+   U32 count = 0;
+   U32 bucket = 0;
+   for(; bucket < BucketCount - 1; bucket++)
+   {
+      count += mBuckets[bucket];
+      if(count >= rank)
+         break;
+   }
+
+   return mMinimum * mPow(2.0f, (F32)bucket / BucketsPerDoubling);
+}
+
+TelemetryHistogram *TelemetryHistogram::find(const char *name)
+{
+   for(TelemetryHistogram *walk = smHistogramList; walk; walk = walk->mNext)
+   {
+      if(!dStricmp(walk->mName, name))
+         return walk;
+   }
+   return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+static void sendStreamQueue()
+{
+   // Sends can be short so whatever is not sent stays queued for the next frame.
+   U32 sentSize = 0;
+   while(sentSize < (U32)sStreamQueue.size())
+   {
+      S32 bytesSent = 0;
+      if(Net::send(sStreamSocket, sStreamQueue.address() + sentSize, sStreamQueue.size() - sentSize, &bytesSent) != Net::NoError || bytesSent <= 0)
+         break;
+      sentSize += bytesSent;
+   }
+
+   if(sentSize > 0)
+   {
+      dMemmove(sStreamQueue.address(), sStreamQueue.address() + sentSize, sStreamQueue.size() - sentSize);
+      sStreamQueue.setSize(sStreamQueue.size() - sentSize);
+   }
+}
+
+static void queueStreamBlock()
+{
+   // Whole blocks are dropped when the queue is full so the stream stays
+   // readable, the names are repeated in case the dropped block held them.
+   if(sStreamQueue.size() + sStreamBlockSize > Telemetry::StreamQueueSize)
+   {
+      if(!sStreamSendWarned)
+         Con::warnf("Telemetry - The stream is not keeping up, frames are being dropped.");
+      sStreamSendWarned = true;
+      sStreamNamesPending = true;
+      return;
+   }
+
+   const U32 queueSize = sStreamQueue.size();
+   sStreamQueue.setSize(queueSize + sStreamBlockSize);
+   dMemcpy(sStreamQueue.address() + queueSize, sStreamBlock, sStreamBlockSize);
+
+   if(sStreamConnected)
+      sendStreamQueue();
+}
+
+static void flushStreamBlock()
+{
+   if(sStreamBlockSize == 0)
+      return;
+
+   MemStream header(sStreamBlockHeaderSize, sStreamBlock, false, true);
+   header.write(4, "T2TM");
+   header.write(U16(Telemetry::StreamVersion));
+   header.write(U16(sStreamBlockSize));
+
+   // Telemetry is lossy, blocks that cannot be sent are dropped.
+   switch(sStreamTarget)
+   {
+   case StreamFile:
+      sStreamFile->write(sStreamBlockSize, sStreamBlock);
+      break;
+
+   case StreamUDP:
+      if(Net::sendto(&sStreamAddress, sStreamBlock, sStreamBlockSize) != Net::NoError && !sStreamSendWarned)
+      {
+         Con::warnf("Telemetry - Could not send to the stream address, has the port been opened with setNetPort()?");
+         sStreamSendWarned = true;
+      }
+      break;
+
+   case StreamTCP:
+      queueStreamBlock();
+      break;
+
+   default:
+      break;
+   }
+
+   sStreamBlockSize = 0;
+}
+
+static U8 *reserveStreamRecord(U32 size)
+{
+   if(sStreamBlockSize + size > Telemetry::StreamBlockSize)
+      flushStreamBlock();
+
+   if(sStreamBlockSize == 0)
+      sStreamBlockSize = sStreamBlockHeaderSize;
+
+   U8 *pRecord = sStreamBlock + sStreamBlockSize;
+   sStreamBlockSize += size;
+   return pRecord;
+}
+
+static U8 getStreamNameLength(const TelemetryCounter *counter)
+{
+   const U32 length = dStrlen(counter->getName());
+   return (U8)(length < TelemetryCounter::MaxNameLength ? length : TelemetryCounter::MaxNameLength);
+}
+
+static void writeStreamNames(U32 counterCount)
+{
+   U32 size = sizeof(U8) + sizeof(U16);
+   for(U32 i = 0; i < counterCount; i++)
+      size += sizeof(U8) + getStreamNameLength(TelemetryCounter::getCounter(i));
+
+   MemStream record(size, reserveStreamRecord(size), false, true);
+   record.write(U8('N'));
+   record.write(U16(counterCount));
+   for(U32 i = 0; i < counterCount; i++)
+   {
+      const TelemetryCounter *counter = TelemetryCounter::getCounter(i);
+      const U8 length = getStreamNameLength(counter);
+      record.write(length);
+      record.write(length, counter->getName());
+   }
+
+   sStreamedCounterCount = counterCount;
+   sStreamNamesFrame = sFrameCount;
+   sStreamNamesPending = false;
+}
+
+static void writeStreamFrame(const F32 *pValues, U32 counterCount)
+{
+   // UDP receivers may have missed the names so they are repeated.
+   if(sStreamNamesPending || counterCount != sStreamedCounterCount ||
+      (sStreamTarget == StreamUDP && sFrameCount - sStreamNamesFrame >= Telemetry::StreamNamesInterval))
+      writeStreamNames(counterCount);
+
+   const U32 size = sizeof(U8) + sizeof(U32) + sizeof(U16) + counterCount * sizeof(F32);
+   MemStream record(size, reserveStreamRecord(size), false, true);
+   record.write(U8('F'));
+   record.write(sFrameCount);
+   record.write(U16(counterCount));
+   for(U32 i = 0; i < counterCount; i++)
+      record.write(pValues[i]);
+}
+
+//-----------------------------------------------------------------------------
+
+void Telemetry::endFrame()
+{
+   // Debug Profiling.
+   PROFILE_SCOPE(Telemetry_EndFrame);
+
+   // Frame times use the monotonic clock so they stay valid in shipping builds,
+   // where the profiler and its timers are compiled out.
+   const U64 ticks = MonotonicClock::getTicks();
+   const U64 lastTicks = sLastFrameTicks;
+   sLastFrameTicks = ticks;
+
+   const U32 counterCount = TelemetryCounter::getCount();
+
+   // The first frame has no start so it isn't recorded.
+   if(lastTicks != 0)
+   {
+      if(sTicksPerMillisecond == 0.0)
+         sTicksPerMillisecond = MonotonicClock::getTicksPerSecond() / 1000.0;
+
+      const F32 frameTime = (F32)((ticks - lastTicks) / sTicksPerMillisecond);
+      sFrameTimeCounter.set(frameTime);
+      sFrameTimeHistogram.record(frameTime);
+
+      F32 *pValues = sWindow[sFrameCount & (WindowFrames - 1)];
+      for(U32 i = 0; i < counterCount; i++)
+         pValues[i] = TelemetryCounter::getCounter(i)->mValue;
+
+      if(sStreamTarget != StreamNone)
+         writeStreamFrame(pValues, counterCount);
+
+      // Retry anything a short send left behind.
+      if(sStreamConnected && sStreamQueue.size() > 0)
+         sendStreamQueue();
+
+      sFrameCount++;
+   }
+
+   for(U32 i = 0; i < counterCount; i++)
+   {
+      TelemetryCounter *counter = TelemetryCounter::getCounter(i);
+      if(counter->mMode == TelemetryCounter::Sum)
+         counter->mValue = 0.0f;
+   }
+}
+
+void Telemetry::reset()
+{
+   sFrameCount = 0;
+
+   for(TelemetryHistogram *walk = TelemetryHistogram::getFirst(); walk; walk = walk->getNext())
+      walk->reset();
+}
+
+U32 Telemetry::getFrameCount()
+{
+   return sFrameCount;
+}
+
+U32 Telemetry::getWindowFrameCount()
+{
+   return sFrameCount < WindowFrames ? sFrameCount : (U32)WindowFrames;
+}
+
+static U32 getWindowQueryFrames(const TelemetryCounter *counter, U32 frames)
+{
+   if(counter == NULL || counter->getIndex() >= TelemetryCounter::MaxCounters)
+      return 0;
+
+   const U32 windowFrames = Telemetry::getWindowFrameCount();
+   return (frames == 0 || frames > windowFrames) ? windowFrames : frames;
+}
+
+static inline F32 getWindowValue(const TelemetryCounter *counter, U32 age)
+{
+   return sWindow[(sFrameCount - 1 - age) & (Telemetry::WindowFrames - 1)][counter->getIndex()];
+}
+
+static S32 QSORT_CALLBACK compareWindowValues(const void *a, const void *b)
+{
+   const F32 valueA = *(const F32 *)a;
+   const F32 valueB = *(const F32 *)b;
+   return valueA < valueB ? -1 : (valueA > valueB ? 1 : 0);
+}
+
+F32 Telemetry::getWindowPercentile(const TelemetryCounter *counter, F32 percentile, U32 frames)
+{
+   frames = getWindowQueryFrames(counter, frames);
+   if(frames == 0)
+      return 0.0f;
+
+   Vector<F32> values;
+   values.setSize(frames);
+   for(U32 i = 0; i < frames; i++)
+      values[i] = getWindowValue(counter, i);
+   dQsort(values.address(), frames, sizeof(F32), compareWindowValues);
+
+   // Nearest rank.
+   U32 rank = (U32)mCeil(mClampF(percentile, 0.0f, 100.0f) * frames / 100.0f);
+   if(rank < 1)
+      rank = 1;
+   return values[rank - 1];
+}
+
+F32 Telemetry::getWindowAverage(const TelemetryCounter *counter, U32 frames)
+{
+   frames = getWindowQueryFrames(counter, frames);
+   if(frames == 0)
+      return 0.0f;
+
+   F64 total = 0.0;
+   for(U32 i = 0; i < frames; i++)
+      total += getWindowValue(counter, i);
+   return (F32)(total / frames);
+}
+
+F32 Telemetry::getWindowMax(const TelemetryCounter *counter, U32 frames)
+{
+   frames = getWindowQueryFrames(counter, frames);
+   if(frames == 0)
+      return 0.0f;
+
+   F32 maximum = getWindowValue(counter, 0);
+   for(U32 i = 1; i < frames; i++)
+   {
+      const F32 value = getWindowValue(counter, i);
+      if(value > maximum)
+         maximum = value;
+   }
+   return maximum;
+}
+
+//-----------------------------------------------------------------------------
+
+bool Telemetry::streamToFile(const char *fileName)
+{
+   closeStream();
+
+   char filePath[1024];
+   Con::expandPath(filePath, sizeof(filePath), fileName);
+
+   FileStream *pStream = new FileStream();
+   if(!pStream->open(filePath, FileStream::Write))
+   {
+      Con::warnf("Telemetry::streamToFile() - Could not open '%s' for writing.", filePath);
+      delete pStream;
+      return false;
+   }
+
+   sStreamFile = pStream;
+   sStreamTarget = StreamFile;
+   sStreamNamesPending = true;
+   return true;
+}
+
+bool Telemetry::streamToAddress(const char *address, bool reliable)
+{
+   closeStream();
+
+   if(reliable)
+   {
+      // The connection completes later, blocks are queued until it does.
+      sStreamSocket = Net::openConnectTo(address);
+      if(sStreamSocket == InvalidSocket)
+      {
+         Con::warnf("Telemetry::streamToAddress() - Could not connect to '%s'.", address);
+         return false;
+      }
+      sStreamConnected = false;
+      sStreamTarget = StreamTCP;
+   }
+   else
+   {
+      if(!Net::stringToAddress(address, &sStreamAddress))
+      {
+         Con::warnf("Telemetry::streamToAddress() - Invalid address '%s'.", address);
+         return false;
+      }
+      sStreamTarget = StreamUDP;
+   }
+
+   sStreamSendWarned = false;
+   sStreamNamesPending = true;
+   return true;
+}
+
+bool Telemetry::processConnectedNotifyEvent(const ConnectedNotifyEvent *event)
+{
+   if(sStreamTarget != StreamTCP || event->tag != (U32)sStreamSocket)
+      return false;
+
+   switch(event->state)
+   {
+   case ConnectedNotifyEvent::Connected:
+      // The names are written again in case the queued blocks that held
+      // them were dropped.
+      sStreamConnected = true;
+      sStreamNamesPending = true;
+      sendStreamQueue();
+      break;
+
+   case ConnectedNotifyEvent::DNSFailed:
+   case ConnectedNotifyEvent::ConnectFailed:
+      Con::warnf("Telemetry - Could not connect to the stream address.");
+      closeStream();
+      break;
+
+   case ConnectedNotifyEvent::Disconnected:
+      Con::warnf("Telemetry - The stream was disconnected.");
+      sStreamConnected = false;
+      closeStream();
+      break;
+
+   default:
+      break;
+   }
+
+   return true;
+}
+
+void Telemetry::closeStream()
+{
+   if(sStreamTarget == StreamNone)
+      return;
+
+   flushStreamBlock();
+
+   if(sStreamTarget == StreamFile)
+   {
+      sStreamFile->close();
+      delete sStreamFile;
+      sStreamFile = NULL;
+   }
+   else if(sStreamTarget == StreamTCP)
+   {
+      if(sStreamConnected)
+         sendStreamQueue();
+      sStreamQueue.clear();
+      sStreamConnected = false;
+
+      Net::closeConnectTo(sStreamSocket);
+      sStreamSocket = InvalidSocket;
+   }
+
+   sStreamTarget = StreamNone;
+}
+
+bool Telemetry::isStreaming()
+{
+   return sStreamTarget != StreamNone;
+}
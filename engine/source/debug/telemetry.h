@@ -0,0 +1,185 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _TELEMETRY_H_
+#define _TELEMETRY_H_
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+struct ConnectedNotifyEvent;
+
+/// A named value recorded by the Telemetry once every frame.
+///
+/// Counters are declared statically where their values are produced and are
+/// cheap enough to update in shipping builds:
+/// @code
+/// static TelemetryCounter sDrawCallsCounter("drawCalls");
+/// sDrawCallsCounter.add( drawCalls );
+/// @endcode
+///
+/// Counters are only expected to be updated by the main thread.  Counters
+/// declared after the first MaxCounters are ignored.
+class TelemetryCounter
+{
+public:
+   enum
+   {
+      MaxCounters = 64,
+      MaxNameLength = 60 ///< longer names are truncated in streams.
+   };
+
+   enum Mode
+   {
+      Sum,   ///< The value is reset to zero at the end of every frame.
+      Gauge  ///< The value is kept until it is next set.
+   };
+
+   TelemetryCounter(const char *name, Mode mode = Sum);
+
+   inline void add(F32 value) { mValue += value; }
+   inline void set(F32 value) { mValue = value; }
+   inline F32 getValue() const { return mValue; }
+   inline const char *getName() const { return mName; }
+   inline U32 getIndex() const { return mIndex; }
+
+   static TelemetryCounter *getCounter(U32 index) { return smCounters[index]; }
+   static U32 getCount() { return smCounterCount; }
+   static TelemetryCounter *find(const char *name);
+
+private:
+   friend class Telemetry;
+
+   const char *mName;
+   Mode mMode;
+   U32 mIndex;
+   F32 mValue;
+
+   static TelemetryCounter *smCounters[MaxCounters];
+   static U32 smCounterCount;
+};
+
+/// A named distribution of values with constant memory and record cost.
+///
+/// Values are counted in logarithmic buckets, four per doubling from the
+/// minimum, so percentiles are accurate to within 19%.
+class TelemetryHistogram
+{
+public:
+   enum
+   {
+      BucketCount = 64,
+      BucketsPerDoubling = 4
+   };
+
+   TelemetryHistogram(const char *name, F32 minimum);
+
+   void record(F32 value);
+   void reset();
+
+   /// Returns the upper bound of the bucket holding the percentile.
+   /// @param percentile The percentile, from 0 to 100.
+   F32 getPercentile(F32 percentile) const;
+   inline U32 getSampleCount() const { return mSampleCount; }
+   inline const char *getName() const { return mName; }
+   inline TelemetryHistogram *getNext() const { return mNext; }
+
+   static TelemetryHistogram *getFirst() { return smHistogramList; }
+   static TelemetryHistogram *find(const char *name);
+
+private:
+   const char *mName;
+   F32 mMinimum;
+   U32 mSampleCount;
+   U32 mBuckets[BucketCount];
+   TelemetryHistogram *mNext;
+
+   static TelemetryHistogram *smHistogramList;
+};
+
+/// Always-on frame telemetry.
+///
+/// At the end of every frame the values of all counters are stored in a
+/// rolling window that can be queried for percentiles, averages and maximums.
+/// The frame time in milliseconds is recorded by the "frameTime" counter and
+/// histogram.
+///
+/// The frames can also be streamed to a file or a socket in a compact binary
+/// format, made of blocks of at most StreamBlockSize bytes:
+/// @code
+/// block:   char[4] "T2TM", U16 version, U16 block size, records...
+/// names:   U8 'N', U16 counter count, { U8 name length, name }...
+/// frame:   U8 'F', U32 frame number, U16 counter count, F32 counter values...
+/// @endcode
+/// Values are little endian and ordered by counter index.  Names are written
+/// when the stream opens and when counters are added, and also periodically
+/// when streaming over UDP where each block is a single datagram.
+class Telemetry
+{
+public:
+   enum
+   {
+      WindowFrames = 1024, ///< must be a power of two.
+      StreamVersion = 1,
+      StreamBlockSize = 4096,
+      StreamNamesInterval = 64, ///< frames between names when streaming over UDP.
+      StreamQueueSize = 64 * StreamBlockSize ///< bytes queued while a TCP stream connects or falls behind.
+   };
+
+   /// Records the counters for the frame that just ended.
+   static void endFrame();
+
+   /// Clears the rolling window and histograms.
+   static void reset();
+
+   /// The number of frames recorded since the last reset.
+   static U32 getFrameCount();
+
+   /// The number of frames the rolling window currently holds.
+   static U32 getWindowFrameCount();
+
+   /// Rolling window queries over the most recent frames.
+   /// @param frames The number of frames to query, zero for the whole window.
+   static F32 getWindowPercentile(const TelemetryCounter *counter, F32 percentile, U32 frames = 0);
+   static F32 getWindowAverage(const TelemetryCounter *counter, U32 frames = 0);
+   static F32 getWindowMax(const TelemetryCounter *counter, U32 frames = 0);
+
+   /// Streams every frame to a file.
+   static bool streamToFile(const char *fileName);
+
+   /// Streams every frame to an address such as "IP:127.0.0.1:28000".  UDP
+   /// datagrams are sent from the port opened with setNetPort().  TCP blocks
+   /// are queued until the connection completes.
+   static bool streamToAddress(const char *address, bool reliable);
+
+   /// Handles the connection events of a TCP stream.
+   /// @return Whether the event belonged to the stream.
+   static bool processConnectedNotifyEvent(const ConnectedNotifyEvent *event);
+
+   /// Flushes and closes the stream.
+   static void closeStream();
+
+   static bool isStreaming();
+};
+
+#endif // _TELEMETRY_H_
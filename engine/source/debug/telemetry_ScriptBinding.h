@@ -0,0 +1,151 @@
+﻿//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin( Telemetry, "Frame telemetry functionality.");
+
+/*! @defgroup TelemetryFunctions Telemetry
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+static TelemetryCounter* findTelemetryCounter( const char* pName )
+{
+   TelemetryCounter* pCounter = TelemetryCounter::find( pName );
+   if ( pCounter == NULL )
+      Con::warnf( "Could not find the telemetry counter '%s'.", pName );
+   return pCounter;
+}
+
+/*! Gets a percentile of a telemetry counter over the most recent frames.
+    @param counterName The name of the counter, such as frameTime.
+    @param percentile The percentile, from 0 to 100.
+    @param frames The number of recent frames to use, all of the rolling window if zero or omitted.
+    @return The value at the percentile.
+*/
+ConsoleFunctionWithDocs( telemetryGetPercentile, ConsoleFloat, 3, 4, (string counterName, float percentile, [int frames]))
+{
+   TelemetryCounter* pCounter = findTelemetryCounter( argv[1] );
+   return Telemetry::getWindowPercentile( pCounter, dAtof(argv[2]), argc > 3 ? dAtoi(argv[3]) : 0 );
+}
+
+/*! Gets the average of a telemetry counter over the most recent frames.
+    @param counterName The name of the counter, such as frameTime.
+    @param frames The number of recent frames to use, all of the rolling window if zero or omitted.
+    @return The average value.
+*/
+ConsoleFunctionWithDocs( telemetryGetAverage, ConsoleFloat, 2, 3, (string counterName, [int frames]))
+{
+   TelemetryCounter* pCounter = findTelemetryCounter( argv[1] );
+   return Telemetry::getWindowAverage( pCounter, argc > 2 ? dAtoi(argv[2]) : 0 );
+}
+
+/*! Gets the maximum of a telemetry counter over the most recent frames.
+    @param counterName The name of the counter, such as frameTime.
+    @param frames The number of recent frames to use, all of the rolling window if zero or omitted.
+    @return The maximum value.
+*/
+ConsoleFunctionWithDocs( telemetryGetMax, ConsoleFloat, 2, 3, (string counterName, [int frames]))
+{
+   TelemetryCounter* pCounter = findTelemetryCounter( argv[1] );
+   return Telemetry::getWindowMax( pCounter, argc > 2 ? dAtoi(argv[2]) : 0 );
+}
+
+/*! Gets a percentile of a telemetry histogram since it was last reset.
+    @param histogramName The name of the histogram, such as frameTime.
+    @param percentile The percentile, from 0 to 100.
+    @return The upper bound of the histogram bucket holding the percentile.
+*/
+ConsoleFunctionWithDocs( telemetryGetHistogramPercentile, ConsoleFloat, 3, 3, (string histogramName, float percentile))
+{
+   TelemetryHistogram* pHistogram = TelemetryHistogram::find( argv[1] );
+   if ( pHistogram == NULL )
+   {
+      Con::warnf( "Could not find the telemetry histogram '%s'.", argv[1] );
+      return 0.0f;
+   }
+   return pHistogram->getPercentile( dAtof(argv[2]) );
+}
+
+/*! Gets the number of frames recorded since the telemetry was last reset.
+    @return The frame count.
+*/
+ConsoleFunctionWithDocs( telemetryGetFrameCount, ConsoleInt, 1, 1, ())
+{
+   return Telemetry::getFrameCount();
+}
+
+/*! Prints every telemetry counter with its average, 99th percentile and maximum over the rolling window.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( telemetryDump, ConsoleVoid, 1, 1, ())
+{
+   Con::printf( "Telemetry over %d frames:", Telemetry::getWindowFrameCount() );
+   Con::printf( "   Average        p99        Max  Name" );
+   for ( U32 index = 0; index < TelemetryCounter::getCount(); ++index )
+   {
+      const TelemetryCounter* pCounter = TelemetryCounter::getCounter( index );
+      Con::printf( "%10.2f %10.2f %10.2f  %s",
+         Telemetry::getWindowAverage( pCounter ),
+         Telemetry::getWindowPercentile( pCounter, 99.0f ),
+         Telemetry::getWindowMax( pCounter ),
+         pCounter->getName() );
+   }
+}
+
+/*! Clears the telemetry rolling window and histograms.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( telemetryReset, ConsoleVoid, 1, 1, ())
+{
+   Telemetry::reset();
+}
+
+/*! Streams the telemetry of every frame to a file in the compact binary telemetry format.
+    @param fileName The file to write to.
+    @return Whether the file was opened.
+*/
+ConsoleFunctionWithDocs( telemetryStreamToFile, ConsoleBool, 2, 2, (string fileName))
+{
+   return Telemetry::streamToFile( argv[1] );
+}
+
+/*! Streams the telemetry of every frame to a network address in the compact binary telemetry format.
+    @param address The address to send to, such as IP:127.0.0.1:28000.
+    @param reliable Whether to connect over TCP rather than send UDP datagrams from the port opened with setNetPort(). False if omitted.
+    @return Whether the stream was opened.
+*/
+ConsoleFunctionWithDocs( telemetryStreamToAddress, ConsoleBool, 2, 3, (string address, [bool reliable]))
+{
+   return Telemetry::streamToAddress( argv[1], argc > 2 ? dAtob(argv[2]) : false );
+}
+
+/*! Flushes and closes the telemetry stream.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( telemetryCloseStream, ConsoleVoid, 1, 1, ())
+{
+   Telemetry::closeStream();
+}
+
+ConsoleFunctionGroupEnd( Telemetry );
+
+/*! @} */ // group TelemetryFunctions
@@ -53,6 +53,7 @@
 #include "memory/frameAllocator.h"
 #include "game/version.h"
 #include "debug/profiler.h"
+#include "debug/telemetry.h"
 #include "network/serverQuery.h"
 #include "game/defaultGame.h"
 #include "platform/nativeDialogs/msgBox.h"
@@ -81,6 +82,10 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
 #ifdef TORQUE_OS_IOS
 #include "platformiOS/iOSProfiler.h"
 #endif
@@ -181,8 +186,13 @@ void shutdownLibraries()
 
     TelnetDebugger::destroy();
     TelnetConsole::destroy();
+    Telemetry::closeStream();
 
     Sim::shutdown();
+
+    // Stop any worker threads.
+    ThreadPool::shutdownGlobalThreadPool();
+
     Platform::shutdown();
 
     NetStringTable::destroy();
@@ -457,6 +467,9 @@ void DefaultGame::mainLoop( void )
 #ifdef TORQUE_OS_ANDROID_PROFILE
     AndroidProfilerStart("MAIN_LOOP");
 #endif
+         PROFILE_FRAME();
+         TextureManager::endFrame();
+         Telemetry::endFrame();
          PROFILE_START(MainLoop);
 #ifdef TORQUE_ALLOW_JOURNALING
          PROFILE_START(JournalMain);
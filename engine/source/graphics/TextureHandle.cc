@@ -130,7 +130,7 @@ const GBitmap* TextureHandle::getBitmap( void ) const
 
 U32 TextureHandle::getGLName( void ) const
 {
-    return object == NULL ? 0 : object->mGLTextureName;
+    return object == NULL ? 0 : TextureManager::useTexture( object );
 }
 
 //-----------------------------------------------------------------------------
@@ -202,7 +202,7 @@ void TextureHandle::unlock( void )
 
     if( --object->mRefCount == 0 )
     {
-        TextureManager::freeTexture(object);
+        TextureManager::releaseTexture(object);
     }
 
     object = NULL;
@@ -33,6 +33,7 @@
 #include "console/consoleTypes.h"
 #include "memory/safeDelete.h"
 #include "math/mMath.h"
+#include "debug/telemetry.h"
 
 #include "TextureManager_ScriptBinding.h"
 
@@ -49,6 +50,9 @@ S32 TextureManager::mBitmapResidentSize = 0;
 S32 TextureManager::mTextureResidentSize = 0;
 S32 TextureManager::mTextureResidentWasteSize = 0;
 S32 TextureManager::mTextureResidentCount = 0;
+S32 TextureManager::mResidentBudget = 0;
+S32 TextureManager::mEvictionIdleFrames = 30;
+U32 TextureManager::mFrameIndex = 1;
 
 //---------------------------------------------------------------------------------------------------------------------
 
@@ -88,6 +92,53 @@ static Vector<EventCallbackEntry> sgEventCallbacks(__FILE__, __LINE__);
 
 //--------------------------------------------------------------------------------------------------------------------
 
+struct PreloadedBitmapEntry
+{
+    StringTableEntry    bitmapFile;
+    GBitmap*            pBitmap;
+};
+
+static Vector<PreloadedBitmapEntry> sgPreloadedBitmaps(__FILE__, __LINE__);
+
+//---------------------------------------------------------------------------------------------------------------------
+
+struct EvictionCandidate
+{
+    TextureObject* pTextureObject;
+    U32 idleFrames;
+    bool unreferenced;
+};
+
+struct EvictionRecord
+{
+    StringTableEntry textureKey;
+    U32 frameIndex;
+    U32 idleFrames;
+    S32 residentSize;
+    bool freed;
+};
+
+#define EVICTION_RECORD_COUNT 16
+
+static EvictionRecord sgEvictionRecords[EVICTION_RECORD_COUNT];
+static U32 sgEvictionRecordCount = 0;
+static U32 sgEvictionCount = 0;
+static U32 sgFreedCount = 0;
+static U32 sgRestoreCount = 0;
+static bool sgKeepingUnreferenced = false;
+
+static S32 sgWorkingSetCount = 0;
+static S32 sgWorkingSetSize = 0;
+static S32 sgLastWorkingSetCount = 0;
+static S32 sgLastWorkingSetSize = 0;
+static S32 sgPeakWorkingSetSize = 0;
+
+static TelemetryCounter sTelemetryTextureResidentSize( "textureResidentSize", TelemetryCounter::Gauge );
+static TelemetryCounter sTelemetryTextureWorkingSetSize( "textureWorkingSetSize", TelemetryCounter::Gauge );
+static TelemetryCounter sTelemetryTextureEvictions( "textureEvictions" );
+
+//--------------------------------------------------------------------------------------------------------------------
+
 U32 TextureManager::registerEventCallback(TextureEventCallback callback, void *userData)
 {
     sgEventCallbacks.increment();
@@ -155,6 +206,8 @@ void TextureManager::create()
     Con::addVariable("$pref::OpenGL::force16BitTexture", TypeBool, &TextureManager::mForce16BitTexture);
     Con::addVariable("$pref::OpenGL::allowTextureCompression", TypeBool, &TextureManager::mAllowTextureCompression);
     Con::addVariable("$pref::OpenGL::disableTextureSubImageUpdates", TypeBool, &TextureManager::mDisableTextureSubImageUpdates);
+    Con::addVariable("$pref::TextureManager::residentBudget", TypeS32, &TextureManager::mResidentBudget);
+    Con::addVariable("$pref::TextureManager::evictionIdleFrames", TypeS32, &TextureManager::mEvictionIdleFrames);
 
     // Flag as alive.
     mManagerState = Alive;
@@ -169,12 +222,18 @@ void TextureManager::destroy()
     // Destroy the texture dictionary.
     TextureDictionary::destroy();
 
+    // Destroy any unused preloaded bitmaps.
+    flushPreloadedBitmaps();
+
     // Reset state.
     mBitmapResidentSize = 0;
     mTextureResidentSize = 0;
     mTextureResidentWasteSize = 0;
     mTextureResidentCount = 0;
     mMasterTextureKeyIndex = 0;
+    sgKeepingUnreferenced = false;
+    sgWorkingSetCount = 0;
+    sgWorkingSetSize = 0;
 
     // Flag as not initialized.
     mManagerState = NotInitialized;
@@ -202,11 +261,13 @@ void TextureManager::killManager()
         if (probe->mGLTextureName != 0)
         {
             deleteNames.push_back(probe->mGLTextureName);
+
+            // Adjust metrics.
+            mTextureResidentCount--;
         }
         probe->mGLTextureName = 0;
         
         // Adjust metrics.
-        mTextureResidentCount--;
         mTextureResidentSize -= probe->mTextureResidentSize;
         probe->mTextureResidentSize = 0;
         mTextureResidentWasteSize -= probe->mTextureResidentWasteSize;
@@ -237,6 +298,13 @@ void TextureManager::resurrectManager( void )
     TextureObject* probe = TextureDictionary::TextureObjectChain;
     while (probe) 
     {
+        // Evicted textures are restored when they are next used.
+        if ( probe->mEvicted )
+        {
+            probe = probe->next;
+            continue;
+        }
+
         switch( probe->mHandleType )
         {
             case TextureHandle::BitmapTexture:
@@ -252,7 +320,7 @@ void TextureManager::resurrectManager( void )
 
                     // Register texture.
                     TextureObject* pTextureObject;
-                    pTextureObject = registerTexture(probe->mTextureKey, pBitmap, probe->mHandleType, probe->mClamp);
+                    pTextureObject = registerTexture(probe->mTextureKey, pBitmap, probe->mHandleType, probe->mClamp, true);
 
                     // Sanity!
                     AssertFatal(pTextureObject == probe, "A new texture was returned during resurrection.");
@@ -377,6 +445,228 @@ void TextureManager::freeTexture( TextureObject* pTextureObject )
 
 //---------------------------------------------------------------------------------------------------------------------
 
+void TextureManager::releaseTexture( TextureObject* pTextureObject )
+{
+    // Keep unreferenced bitmap textures while there is a resident budget so they can be used again without
+    // loading them.  They are the first to be freed when the budget is exceeded.
+    if ( mResidentBudget > 0 && mManagerState == Alive && pTextureObject->mHandleType == TextureHandle::BitmapTexture )
+    {
+        sgKeepingUnreferenced = true;
+        return;
+    }
+
+    freeTexture( pTextureObject );
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::markTextureUsed( TextureObject* pTextureObject )
+{
+    // Restore the texture if it was evicted.
+    if ( pTextureObject->mEvicted && mDGLRender && mManagerState == Alive )
+        restoreTexture( pTextureObject );
+
+    pTextureObject->mLastUsedFrame = mFrameIndex;
+
+    // Adjust working set.
+    sgWorkingSetCount++;
+    sgWorkingSetSize += pTextureObject->mTextureResidentSize;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::evictTexture( TextureObject* pTextureObject )
+{
+    // Sanity!
+    AssertFatal( pTextureObject->mGLTextureName != 0, "TextureManager::evictTexture() - Texture is not resident." );
+
+    glDeleteTextures(1, (const GLuint*)&pTextureObject->mGLTextureName);
+    pTextureObject->mGLTextureName = 0;
+    pTextureObject->mEvicted = true;
+
+    // Adjust metrics.
+    mTextureResidentCount--;
+    mTextureResidentSize -= pTextureObject->mTextureResidentSize;
+    pTextureObject->mTextureResidentSize = 0;
+    mTextureResidentWasteSize -= pTextureObject->mTextureResidentWasteSize;
+    pTextureObject->mTextureResidentWasteSize = 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::restoreTexture( TextureObject* pTextureObject )
+{
+    // Sanity!
+    AssertFatal( pTextureObject->mEvicted, "TextureManager::restoreTexture() - Texture is not evicted." );
+
+    if ( pTextureObject->mHandleType == TextureHandle::BitmapKeepTexture )
+    {
+        // Upload the kept bitmap again.
+        createGLName( pTextureObject );
+    }
+    else
+    {
+        // Load the bitmap again.
+        GBitmap* pBitmap = loadBitmap( pTextureObject->mTextureKey );
+
+        // Stop restoring if the bitmap could not be loaded.
+        if ( pBitmap == NULL )
+        {
+            Con::warnf( "TextureManager::restoreTexture() - Could not restore evicted texture '%s'.", pTextureObject->mTextureKey );
+            pTextureObject->mEvicted = false;
+            return;
+        }
+        pBitmap->mForce16Bit = pTextureObject->mForce16Bit;
+
+        // Register texture.
+        TextureObject* pRestoredTextureObject;
+        pRestoredTextureObject = registerTexture(pTextureObject->mTextureKey, pBitmap, pTextureObject->mHandleType, pTextureObject->mClamp, true);
+
+        // Sanity!
+        AssertFatal(pRestoredTextureObject == pTextureObject, "A new texture was returned during restore.");
+    }
+
+    sgRestoreCount++;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareEvictionCandidates( const void* a, const void* b )
+{
+    const EvictionCandidate* pCandidateA = (const EvictionCandidate*)a;
+    const EvictionCandidate* pCandidateB = (const EvictionCandidate*)b;
+
+    // Unreferenced textures first.
+    if ( pCandidateA->unreferenced != pCandidateB->unreferenced )
+        return pCandidateA->unreferenced ? -1 : 1;
+
+    // Least recently used first.
+    if ( pCandidateA->idleFrames != pCandidateB->idleFrames )
+        return pCandidateA->idleFrames > pCandidateB->idleFrames ? -1 : 1;
+
+    return 0;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::enforceResidentBudget( void )
+{
+    S32 residentSize = mTextureResidentSize + mBitmapResidentSize;
+
+    // Finish if within budget or, without a budget, if no unreferenced textures were kept.
+    if ( mResidentBudget > 0 ? residentSize <= mResidentBudget : !sgKeepingUnreferenced )
+        return;
+
+    const U32 evictionIdleFrames = getMax( mEvictionIdleFrames, 1 );
+
+    // Gather the unreferenced textures and, with a budget, the idle textures that can be restored.
+    Vector<EvictionCandidate> candidates;
+    TextureObject* pProbe = TextureDictionary::TextureObjectChain;
+    while ( pProbe != NULL )
+    {
+        const U32 idleFrames = mFrameIndex - pProbe->mLastUsedFrame;
+        const bool unreferenced = pProbe->mRefCount == 0;
+        // NOTE: Bitmap textures created from a bitmap rather than a file cannot be reloaded.
+        const bool restorable = (pProbe->mHandleType == TextureHandle::BitmapTexture && pProbe->mLoadedFromFile) || pProbe->mpBitmap != NULL;
+
+        if ( unreferenced || (mResidentBudget > 0 && mDGLRender && pProbe->mGLTextureName != 0 && idleFrames >= evictionIdleFrames && restorable) )
+        {
+            candidates.increment();
+            candidates.last().pTextureObject = pProbe;
+            candidates.last().idleFrames = idleFrames;
+            candidates.last().unreferenced = unreferenced;
+        }
+
+        pProbe = pProbe->next;
+    }
+
+    dQsort( candidates.address(), candidates.size(), sizeof(EvictionCandidate), compareEvictionCandidates );
+
+    // Free and evict until within budget.
+    for ( S32 i = 0; i < candidates.size(); ++i )
+    {
+        const EvictionCandidate& candidate = candidates[i];
+
+        if ( mResidentBudget > 0 && residentSize <= mResidentBudget )
+            break;
+
+        TextureObject* pTextureObject = candidate.pTextureObject;
+        EvictionRecord& record = sgEvictionRecords[sgEvictionRecordCount++ % EVICTION_RECORD_COUNT];
+        record.textureKey = pTextureObject->mTextureKey;
+        record.frameIndex = mFrameIndex;
+        record.idleFrames = candidate.idleFrames;
+        record.freed = candidate.unreferenced;
+
+        if ( candidate.unreferenced )
+        {
+            record.residentSize = pTextureObject->mTextureResidentSize + pTextureObject->mBitmapResidentSize;
+            freeTexture( pTextureObject );
+            sgFreedCount++;
+        }
+        else
+        {
+            record.residentSize = pTextureObject->mTextureResidentSize;
+            evictTexture( pTextureObject );
+            sgEvictionCount++;
+        }
+
+        residentSize -= record.residentSize;
+        sTelemetryTextureEvictions.add( 1.0f );
+    }
+
+    // Without a budget every unreferenced texture has now been freed.
+    if ( mResidentBudget <= 0 )
+        sgKeepingUnreferenced = false;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::endFrame( void )
+{
+    // Record the working set.
+    sgLastWorkingSetCount = sgWorkingSetCount;
+    sgLastWorkingSetSize = sgWorkingSetSize;
+    sgPeakWorkingSetSize = getMax( sgPeakWorkingSetSize, sgWorkingSetSize );
+    sgWorkingSetCount = 0;
+    sgWorkingSetSize = 0;
+
+    // Enforce the resident budget.
+    if ( mManagerState == Alive )
+        enforceResidentBudget();
+
+    sTelemetryTextureResidentSize.set( (F32)(mTextureResidentSize + mBitmapResidentSize) );
+    sTelemetryTextureWorkingSetSize.set( (F32)sgLastWorkingSetSize );
+
+    mFrameIndex++;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+U32 TextureManager::getEvictionCount( void )
+{
+    return sgEvictionCount;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+U32 TextureManager::getFreedCount( void )
+{
+    return sgFreedCount;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
+StringTableEntry TextureManager::getEvictionRecordKey( const U32 index )
+{
+    // Finish if the decision is no longer recorded.
+    if ( index >= getMin( sgEvictionRecordCount, (U32)EVICTION_RECORD_COUNT ) )
+        return NULL;
+
+    return sgEvictionRecords[(sgEvictionRecordCount - 1 - index) % EVICTION_RECORD_COUNT].textureKey;
+}
+
+//---------------------------------------------------------------------------------------------------------------------
+
 void TextureManager::getSourceDestByteFormat(GBitmap *pBitmap, U32 *sourceFormat, U32 *destFormat, U32 *byteFormat, U32* texelSize )
 {
     *byteFormat = GL_UNSIGNED_BYTE;
@@ -470,6 +760,10 @@ void TextureManager::getSourceDestByteFormat(GBitmap *pBitmap, U32 *sourceFormat
         break;
 
     case GBitmap::RGB565:
+        *sourceFormat = GL_RGB;
+        *byteFormat   = GL_UNSIGNED_SHORT_5_6_5;
+        break;
+
     case GBitmap::RGB5551:
 #if defined(TORQUE_BIG_ENDIAN)
         *sourceFormat = GL_BGRA_EXT;
@@ -497,7 +791,7 @@ void TextureManager::getSourceDestByteFormat(GBitmap *pBitmap, U32 *sourceFormat
     }
     else
     {
-        *destFormat = GL_RGB5_A1;
+        *destFormat = *byteFormat == GL_UNSIGNED_SHORT_5_6_5 ? GL_RGB5 : GL_RGB5_A1;
         *texelSize = 2;
     }
 
@@ -590,6 +884,10 @@ void TextureManager::refresh( TextureObject* pTextureObject )
     if (!(mDGLRender || mManagerState == Resurrecting))
         return;
 
+    // Finish if evicted, the texture is uploaded when it is next used.
+    if ( pTextureObject->mEvicted )
+        return;
+
     // Sanity!
     AssertISV( pTextureObject->mGLTextureName != 0, "Refreshing texture but no texture created." );
     AssertISV( pTextureObject->mpBitmap != 0, "Refreshing texture but no bitmap available." );
@@ -646,8 +944,8 @@ void TextureManager::refresh( TextureObject* pTextureObject )
     // Bind texture.
     glBindTexture( GL_TEXTURE_2D, pTextureObject->mGLTextureName );
 
-    // Are we forcing to 16-bit?
-    if( pSourceBitmap->mForce16Bit )
+    // Are we forcing to 16-bit? (bitmaps decoded to 16-bit are uploaded as-is)
+    if( pSourceBitmap->mForce16Bit && pSourceBitmap->getFormat() != GBitmap::RGB565 )
     {
         // Yes, so generate a 16-bit texture.
         GLint GLformat;
@@ -732,7 +1030,7 @@ void TextureManager::refresh( const char *textureName )
 
     // Register texture.
     TextureObject* pNewTextureObject;
-    pNewTextureObject = registerTexture(pTextureObject->mTextureKey, pBitmap, pTextureObject->mHandleType, pTextureObject->mClamp);
+    pNewTextureObject = registerTexture(pTextureObject->mTextureKey, pBitmap, pTextureObject->mHandleType, pTextureObject->mClamp, true);
 
     // Sanity!
     AssertFatal(pNewTextureObject == pTextureObject, "A new texture was returned during refresh.");
@@ -753,6 +1051,7 @@ void TextureManager::createGLName( TextureObject* pTextureObject )
 
     // Generate texture name.
     glGenTextures(1, &pTextureObject->mGLTextureName);
+    pTextureObject->mEvicted = false;
 
     // Fetch source/dest formats.
     U32 sourceFormat, destFormat, byteFormat, texelSize;
@@ -771,7 +1070,7 @@ void TextureManager::createGLName( TextureObject* pTextureObject )
 
 //--------------------------------------------------------------------------------------------------------------------
 
-TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge)
+TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge, bool loadedFromFile)
 {
     // Sanity!
     AssertISV( type != TextureHandle::InvalidTexture, "Invalid texture type." );
@@ -820,6 +1119,9 @@ TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap*
         pTextureObject->mTextureKey = textureKey;
         pTextureObject->mHandleType = type;
 
+        // Count as used by the previous frame so the texture is not evicted before it is first used.
+        pTextureObject->mLastUsedFrame = mFrameIndex - 1;
+
         TextureDictionary::insert(pTextureObject);
     }
 
@@ -831,11 +1133,13 @@ TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap*
     }
 
     pTextureObject->mpBitmap           = pNewBitmap;
-    pTextureObject->mBitmapWidth       = pNewBitmap->getWidth();
-    pTextureObject->mBitmapHeight      = pNewBitmap->getHeight();
+    pTextureObject->mBitmapWidth       = pNewBitmap->getImageWidth();
+    pTextureObject->mBitmapHeight      = pNewBitmap->getImageHeight();
     pTextureObject->mTextureWidth      = getNextPow2(pNewBitmap->getWidth());
     pTextureObject->mTextureHeight     = getNextPow2(pNewBitmap->getHeight());
     pTextureObject->mClamp             = clampToEdge;
+    pTextureObject->mForce16Bit        = pNewBitmap->mForce16Bit;
+    pTextureObject->mLoadedFromFile    = loadedFromFile;
 
     // Generate a GL texture name if one is not ready.
     if( pTextureObject->mGLTextureName == 0) 
@@ -880,7 +1184,7 @@ TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandl
         if(bmp)
         {
             bmp->mForce16Bit = force16Bit;
-            return registerTexture(textureKey, bmp, type, clampToEdge);
+            return registerTexture(textureKey, bmp, type, clampToEdge, true);
         }
     }
 
@@ -902,7 +1206,7 @@ TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandl
     }
     bmp->mForce16Bit = force16Bit;
 
-    return registerTexture(textureKey, bmp, type, clampToEdge);
+    return registerTexture(textureKey, bmp, type, clampToEdge, true);
 }
 
 //--------------------------------------------------------------------------------------------------------------------
@@ -925,7 +1229,10 @@ GBitmap *TextureManager::loadBitmap( const char* pTextureKey, bool recurse, bool
 #endif
         dStrcpy(fileNameBuffer + len, extArray[i]);
 
-        bmp = (GBitmap*)ResourceManager->loadInstance(fileNameBuffer);
+        // Use a preloaded bitmap if we have one otherwise load it.
+        bmp = takePreloadedBitmap(fileNameBuffer);
+        if ( bmp == NULL )
+            bmp = (GBitmap*)ResourceManager->loadInstance(fileNameBuffer);
 
         if ( bmp != NULL && (bmp->getWidth() > MaximumProductSupportedTextureWidth || bmp->getHeight() > MaximumProductSupportedTextureHeight) )
         {
@@ -940,6 +1247,73 @@ GBitmap *TextureManager::loadBitmap( const char* pTextureKey, bool recurse, bool
 
 //--------------------------------------------------------------------------------------------------------------------
 
+void TextureManager::addPreloadedBitmap( const char* pBitmapFile, GBitmap* pBitmap )
+{
+    // Sanity!
+    AssertFatal( pBitmapFile != NULL, "TextureManager::addPreloadedBitmap() - Invalid bitmap file." );
+    AssertFatal( pBitmap != NULL, "TextureManager::addPreloadedBitmap() - Invalid bitmap." );
+
+    // Expand the bitmap file as loading a texture does so that it finds the bitmap.
+    char fileNameBuffer[512];
+    Con::expandPath( fileNameBuffer, sizeof(fileNameBuffer), pBitmapFile );
+    StringTableEntry bitmapFile = StringTable->insert( fileNameBuffer );
+
+    // Replace any existing preloaded bitmap for the file.
+    for ( S32 i = 0; i < sgPreloadedBitmaps.size(); ++i )
+    {
+        if ( sgPreloadedBitmaps[i].bitmapFile == bitmapFile )
+        {
+            delete sgPreloadedBitmaps[i].pBitmap;
+            sgPreloadedBitmaps[i].pBitmap = pBitmap;
+            return;
+        }
+    }
+
+    sgPreloadedBitmaps.increment();
+    sgPreloadedBitmaps.last().bitmapFile = bitmapFile;
+    sgPreloadedBitmaps.last().pBitmap = pBitmap;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::flushPreloadedBitmaps( void )
+{
+    for ( S32 i = 0; i < sgPreloadedBitmaps.size(); ++i )
+        delete sgPreloadedBitmaps[i].pBitmap;
+
+    sgPreloadedBitmaps.clear();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+GBitmap* TextureManager::takePreloadedBitmap( const char* pBitmapFile )
+{
+    // Finish if there are no preloaded bitmaps.
+    if ( sgPreloadedBitmaps.size() == 0 )
+        return NULL;
+
+    // Fetch bitmap file.
+    StringTableEntry bitmapFile = StringTable->lookup( pBitmapFile );
+
+    // Finish if the bitmap file was never preloaded.
+    if ( bitmapFile == NULL )
+        return NULL;
+
+    for ( S32 i = 0; i < sgPreloadedBitmaps.size(); ++i )
+    {
+        if ( sgPreloadedBitmaps[i].bitmapFile == bitmapFile )
+        {
+            GBitmap* pBitmap = sgPreloadedBitmaps[i].pBitmap;
+            sgPreloadedBitmaps.erase_fast( i );
+            return pBitmap;
+        }
+    }
+
+    return NULL;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
 void TextureManager::dumpMetrics( void )
 {
     S32 textureResidentCount = 0;
@@ -966,11 +1340,13 @@ void TextureManager::dumpMetrics( void )
         textureResidentWasteSize += pProbe->mTextureResidentWasteSize;
 
         // Info.
-        Con::printf( "BitmapArea: (%d-%d), BitmapMemory: %d, TextureArea: (%d-%d), TextureMemory: %d, TextureMemoryWaste=%d, Refs=%d, Resident=%s, Name=%s",
+        Con::printf( "BitmapArea: (%d-%d), BitmapMemory: %d, TextureArea: (%d-%d), TextureMemory: %d, TextureMemoryWaste=%d, Refs=%d, Resident=%s, Evicted=%s, IdleFrames=%d, Name=%s",
             pProbe->mBitmapWidth,pProbe->mBitmapHeight, pProbe->mBitmapResidentSize,
             pProbe->mTextureWidth, pProbe->mTextureHeight, pProbe->mTextureResidentSize, pProbe->mTextureResidentWasteSize,
             pProbe->mRefCount,
             isTextureResident == 0 ? "NO" : "YES",
+            pProbe->mEvicted ? "YES" : "NO",
+            mFrameIndex - pProbe->mLastUsedFrame,
             pProbe->mTextureKey );
 
         pProbe = pProbe->next;
@@ -996,6 +1372,39 @@ void TextureManager::dumpMetrics( void )
         mBitmapResidentSize,
         getResidentFraction() );
 
+    // Info.
+    Con::printf( "Residency:" );
+    Con::printf( "ResidentBudget: %d, ResidentSize: %d, EvictionIdleFrames: %d, Frame: %d",
+        mResidentBudget,
+        mTextureResidentSize + mBitmapResidentSize,
+        mEvictionIdleFrames,
+        mFrameIndex );
+    Con::printf( "WorkingSetCount: %d, WorkingSetSize: %d, PeakWorkingSetSize: %d",
+        sgLastWorkingSetCount,
+        sgLastWorkingSetSize,
+        sgPeakWorkingSetSize );
+    Con::printf( "Evicted: %d, Freed: %d, Restored: %d",
+        sgEvictionCount,
+        sgFreedCount,
+        sgRestoreCount );
+
+    // Info.
+    const U32 recordCount = getMin( sgEvictionRecordCount, (U32)EVICTION_RECORD_COUNT );
+    if ( recordCount > 0 )
+    {
+        Con::printf( "Recent Eviction Decisions:" );
+        for ( U32 i = sgEvictionRecordCount - recordCount; i < sgEvictionRecordCount; ++i )
+        {
+            const EvictionRecord& record = sgEvictionRecords[i % EVICTION_RECORD_COUNT];
+            Con::printf( "Frame: %d, Decision: %s, Memory: %d, IdleFrames: %d, Name=%s",
+                record.frameIndex,
+                record.freed ? "Freed unreferenced" : "Evicted idle",
+                record.residentSize,
+                record.idleFrames,
+                record.textureKey );
+        }
+    }
+
     Con::printBlankLine();
     Con::printSeparator();
     Con::printf( "All texture manager metrics are valid." );
@@ -49,6 +49,7 @@ class TextureManager
 {
    friend class TextureHandle;
    friend class TextureDictionary;
+   friend class ImageAtlas;
 
 public:
     /// Texture manager event codes.
@@ -80,6 +81,9 @@ private:
     static bool mForce16BitTexture;
     static bool mAllowTextureCompression;
     static bool mDisableTextureSubImageUpdates;
+    static S32 mResidentBudget;
+    static S32 mEvictionIdleFrames;
+    static U32 mFrameIndex;
 
 public:
     static bool mDGLRender;
@@ -99,23 +103,62 @@ public:
     static S32 getTextureResidentWasteSize( void ) { return mTextureResidentWasteSize; }
     static S32 getTextureResidentCount( void ) { return mTextureResidentCount; }
 
+    /// The resident budget, in bytes, covers both textures and kept bitmaps.  When it is exceeded at the end
+    /// of a frame, unreferenced textures and then textures idle for at least the eviction idle frames are
+    /// evicted in least recently used order.  Evicted textures are restored when they are next used.
+    /// A budget of zero disables eviction.
+    static S32 getResidentBudget( void ) { return mResidentBudget; }
+    static void setResidentBudget( const S32 budget ) { mResidentBudget = budget; }
+    static U32 getFrameIndex( void ) { return mFrameIndex; }
+    static U32 getEvictionCount( void );
+    static U32 getFreedCount( void );
+
+    /// Gets the texture key of a recent eviction decision, zero being the most recent.
+    /// @return The texture key or NULL if the decision is no longer recorded.
+    static StringTableEntry getEvictionRecordKey( const U32 index );
+
+    /// Marks the texture as used by the current frame, restoring it first if it was evicted.
+    /// @return The GL texture name to bind.
+    static inline GLuint useTexture( TextureObject* pTextureObject )
+    {
+        if ( pTextureObject->mLastUsedFrame != mFrameIndex )
+            markTextureUsed( pTextureObject );
+
+        return pTextureObject->mGLTextureName;
+    }
+
+    /// Records the working set of the frame that just ended and enforces the resident budget.
+    static void endFrame( void );
+
     static U32  registerEventCallback(TextureEventCallback, void *userData);
     static void unregisterEventCallback(const U32 callbackKey);
 
     static StringTableEntry getUniqueTextureKey( void );
 
+    /// Preloaded bitmaps are decoded ahead of time (typically on a loader thread) and
+    /// are consumed by the next texture load of the same file instead of decoding it again.
+    /// The bitmap file is expanded as texture keys are.  The texture manager takes ownership of the bitmap.
+    static void addPreloadedBitmap( const char* pBitmapFile, GBitmap* pBitmap );
+    static void flushPreloadedBitmaps( void );
+
     static void dumpMetrics( void );
 
 private:
     static void postTextureEvent(const TextureEventCode eventCode);
 
     static void createGLName( TextureObject* pTextureObject );
-    static TextureObject* registerTexture(const char *textureName, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge);
+    static TextureObject* registerTexture(const char *textureName, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge, bool loadedFromFile = false);
     static TextureObject* loadTexture(const char *textureName, TextureHandle::TextureHandleType type, bool clampToEdge, bool checkOnly = false, bool force16Bit = false );
     static void freeTexture( TextureObject* pTextureObject );
+    static void releaseTexture( TextureObject* pTextureObject );
+    static void markTextureUsed( TextureObject* pTextureObject );
+    static void evictTexture( TextureObject* pTextureObject );
+    static void restoreTexture( TextureObject* pTextureObject );
+    static void enforceResidentBudget( void );
     static void refresh(TextureObject* pTextureObject);
 
     static GBitmap* loadBitmap(const char *textureName, bool recurse = true, bool nocompression = false);
+    static GBitmap* takePreloadedBitmap( const char* pBitmapFile );
     static GBitmap* createPowerOfTwoBitmap( GBitmap* pBitmap );
     static U16* create16BitBitmap( GBitmap *pDL, U8 *in_source8, GBitmap::BitmapFormat alpha_info, GLint *GLformat, GLint *GLdata_type, U32 width, U32 height );
     static void getSourceDestByteFormat(GBitmap *pBitmap, U32 *sourceFormat, U32 *destFormat, U32 *byteFormat, U32* texelSize);
@@ -71,6 +71,10 @@ private:
     U32                 mBitmapHeight;
     GLuint              mFilter;
     bool                mClamp;
+    bool                mForce16Bit;
+    bool                mEvicted;
+    bool                mLoadedFromFile;
+    U32                 mLastUsedFrame;
 
     TextureHandle::TextureHandleType mHandleType;
 
@@ -90,6 +94,10 @@ public:
         mBitmapHeight( 0 ),
         mFilter( GL_NEAREST ),
         mClamp( false ),
+        mForce16Bit( false ),
+        mEvicted( false ),
+        mLoadedFromFile( false ),
+        mLastUsedFrame( 0 ),
         mHandleType( TextureHandle::InvalidTexture )
     {
     }
@@ -103,6 +111,8 @@ public:
     inline U32 getBitmapHeight( void ) { return mBitmapHeight; }
     inline GLuint getFilter( void ) { return mFilter; }
     inline bool getClamp( void ) { return mClamp; }
+    inline bool isEvicted( void ) const { return mEvicted; }
+    inline U32 getLastUsedFrame( void ) const { return mLastUsedFrame; }
     
     inline S32 getTextureResidentSize( void ) const { return mTextureResidentSize; }
     inline S32 getBitmapResidentSize( void ) const { return mBitmapResidentSize; }
@@ -0,0 +1,365 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "graphics/bitmapDecoder.h"
+
+#ifndef _GBITMAP_H_
+#include "graphics/gBitmap.h"
+#endif
+
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+#ifndef _PROFILER_H_
+#include "debug/profiler.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+// Script bindings.
+#include "bitmapDecoder_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+// Whether palettized PNGs are loaded as 16-bit, located in bitmapPng.cc.
+extern bool sgForcePalletedPNGsTo16Bit;
+
+// Whether the main thread is decoding requests alongside the thread pool.
+static bool sgDecodingRequests = false;
+
+//-----------------------------------------------------------------------------
+
+/// Writes decoded rows into a bitmap with its final layout.
+class LayoutRowSink : public GBitmap::RowSink
+{
+public:
+   LayoutRowSink( const U32 flags ) :
+      mFlags( flags ),
+      mpBitmap( NULL ),
+      mpConvertRow( NULL ),
+      mImageWidth( 0 ),
+      mImageHeight( 0 )
+   {
+   }
+
+   virtual ~LayoutRowSink()
+   {
+      delete [] mpConvertRow;
+      delete mpBitmap;
+   }
+
+   virtual bool beginImage( const U32 in_width, const U32 in_height, const GBitmap::BitmapFormat in_format )
+   {
+      mImageWidth = in_width;
+      mImageHeight = in_height;
+
+      // Only RGB has a 16-bit format to convert to.
+      const bool convert = (mFlags & BitmapDecoder::Force16Bit) != 0 && in_format == GBitmap::RGB;
+
+      // Allocate the final bitmap.
+      const bool powerOfTwo = (mFlags & BitmapDecoder::PowerOfTwo) != 0;
+      mpBitmap = new GBitmap( powerOfTwo ? getNextPow2( in_width ) : in_width, powerOfTwo ? getNextPow2( in_height ) : in_height,
+         false, convert ? GBitmap::RGB565 : in_format );
+      mpBitmap->imageWidth = in_width;
+      mpBitmap->imageHeight = in_height;
+
+      // Converted rows are decoded to a scratch row.
+      if ( convert )
+         mpConvertRow = new U8[in_width * 3];
+
+      return true;
+   }
+
+   virtual U8* getRow( const U32 in_row )
+   {
+      return mpConvertRow != NULL ? mpConvertRow : mpBitmap->getAddress( 0, in_row );
+   }
+
+   virtual void endRow( const U32 in_row )
+   {
+      U8* pRow = mpBitmap->getAddress( 0, in_row );
+
+      // Convert the scratch row to RGB565.
+      if ( mpConvertRow != NULL )
+      {
+         const U8* pSource = mpConvertRow;
+         U16* pDestination = (U16*)pRow;
+         for ( U32 x = 0; x < mImageWidth; ++x, pSource += 3 )
+            pDestination[x] = (U16)(((pSource[0] & 0xF8) << 8) | ((pSource[1] & 0xFC) << 3) | ((pSource[2] & 0xF8) >> 3));
+      }
+
+      // Extrude the last pixel across the padding.
+      const U32 bytesPerPixel = mpBitmap->bytesPerPixel;
+      const U8* pLastPixel = pRow + (mImageWidth - 1) * bytesPerPixel;
+      for ( U32 x = mImageWidth; x < mpBitmap->getWidth(); ++x )
+         dMemcpy( pRow + x * bytesPerPixel, pLastPixel, bytesPerPixel );
+   }
+
+   virtual void endImage( void )
+   {
+      // Extrude the last row across the padding.
+      const U32 rowBytes = mpBitmap->getWidth() * mpBitmap->bytesPerPixel;
+      const U8* pLastRow = mpBitmap->getAddress( 0, mImageHeight - 1 );
+      for ( U32 y = mImageHeight; y < mpBitmap->getHeight(); ++y )
+         dMemcpy( mpBitmap->getAddress( 0, y ), pLastRow, rowBytes );
+   }
+
+   GBitmap* takeBitmap( void )
+   {
+      GBitmap* pBitmap = mpBitmap;
+      mpBitmap = NULL;
+      return pBitmap;
+   }
+
+private:
+   U32      mFlags;
+   GBitmap* mpBitmap;
+   U8*      mpConvertRow;
+   U32      mImageWidth;
+   U32      mImageHeight;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Records the image dimensions and format then stops the decode.
+class ImageInfoRowSink : public GBitmap::RowSink
+{
+public:
+   ImageInfoRowSink() :
+      mRead( false ),
+      mWidth( 0 ),
+      mHeight( 0 ),
+      mFormat( GBitmap::RGB )
+   {
+   }
+
+   virtual bool beginImage( const U32 in_width, const U32 in_height, const GBitmap::BitmapFormat in_format )
+   {
+      mRead = true;
+      mWidth = in_width;
+      mHeight = in_height;
+      mFormat = in_format;
+
+      // Stop before any rows are decoded.
+      return false;
+   }
+
+   virtual U8* getRow( const U32 in_row )
+   {
+      return NULL;
+   }
+
+   bool                    mRead;
+   U32                     mWidth;
+   U32                     mHeight;
+   GBitmap::BitmapFormat   mFormat;
+};
+
+//-----------------------------------------------------------------------------
+
+static void decodeRequestRange( void* pContext, const U32 start, const U32 end )
+{
+   BitmapDecoder::Request* pRequests = static_cast<BitmapDecoder::Request*>( pContext );
+
+   for ( U32 index = start; index < end; ++index )
+      pRequests[index].mpBitmap = BitmapDecoder::decode( pRequests[index].mBitmapFile, pRequests[index].mFlags );
+}
+
+//-----------------------------------------------------------------------------
+
+GBitmap* BitmapDecoder::decode( const char* pBitmapFile, const U32 flags )
+{
+   // Sanity!
+   AssertFatal( pBitmapFile != NULL, "BitmapDecoder::decode() - Invalid bitmap file." );
+
+   // Finish if the format cannot be decoded.
+   if ( !isBitmapFile( pBitmapFile ) )
+      return NULL;
+
+   // Open the bitmap file.
+   FileStream stream;
+   if ( !stream.open( pBitmapFile, FileStream::Read ) )
+      return NULL;
+
+   // Decode the bitmap.
+   GBitmap* pBitmap = decode( stream, dStricmp( dStrrchr( pBitmapFile, '.' ), ".png" ) == 0, flags );
+
+   stream.close();
+
+   return pBitmap;
+}
+
+//-----------------------------------------------------------------------------
+
+GBitmap* BitmapDecoder::decode( Stream& stream, const bool png, const U32 flags )
+{
+   LayoutRowSink sink( flags );
+
+   bool palettized = false;
+   const bool decoded = png ? GBitmap::readPNGRows( stream, sink, &palettized ) : GBitmap::readJPEGRows( stream, sink );
+   if ( !decoded )
+      return NULL;
+
+   GBitmap* pBitmap = sink.takeBitmap();
+
+   // Mark palettized images as 16-bit when the preference asks for it, as GBitmap::readPNG() does.
+   // NOTE: The preference is only read on the main thread, other threads use the last value read.
+   if ( palettized )
+   {
+      if ( Con::isMainThread() && !sgDecodingRequests )
+         sgForcePalletedPNGsTo16Bit = dAtob( Con::getVariable( "$pref::iPhone::ForcePalletedPNGsTo16Bit" ) );
+
+      if ( sgForcePalletedPNGsTo16Bit )
+         pBitmap->mForce16Bit = true;
+   }
+
+   return pBitmap;
+}
+
+//-----------------------------------------------------------------------------
+
+void BitmapDecoder::decode( Request* pRequests, const U32 requestCount )
+{
+   // Debug Profiling.
+   PROFILE_SCOPE(BitmapDecoder_DecodeRequests);
+
+   // Read the palettized preference once for all the threads.
+   sgForcePalletedPNGsTo16Bit = dAtob( Con::getVariable( "$pref::iPhone::ForcePalletedPNGsTo16Bit" ) );
+
+   // Bitmaps vary a lot in size so hand them out one at a time.
+   sgDecodingRequests = true;
+   ThreadPool::getGlobalThreadPool()->parallelFor( requestCount, 1, &decodeRequestRange, pRequests );
+   sgDecodingRequests = false;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 BitmapDecoder::preload( const Vector<StringTableEntry>& bitmapFiles, const U32 flags )
+{
+   // Set up the requests.
+   Vector<Request> requests;
+   for ( S32 index = 0; index < bitmapFiles.size(); ++index )
+   {
+      Request request;
+      request.mBitmapFile = bitmapFiles[index];
+      request.mFlags = flags;
+      request.mpBitmap = NULL;
+      requests.push_back( request );
+   }
+
+   // Decode the bitmaps.
+   decode( requests.address(), requests.size() );
+
+   // Hand the decoded bitmaps to the texture manager.
+   U32 decodedCount = 0;
+   for ( S32 index = 0; index < requests.size(); ++index )
+   {
+      if ( requests[index].mpBitmap == NULL )
+         continue;
+
+      TextureManager::addPreloadedBitmap( requests[index].mBitmapFile, requests[index].mpBitmap );
+      decodedCount++;
+   }
+
+   return decodedCount;
+}
+
+//-----------------------------------------------------------------------------
+
+bool BitmapDecoder::readImageInfo( const char* pBitmapFile, U32& width, U32& height, GBitmap::BitmapFormat& format )
+{
+   // Sanity!
+   AssertFatal( pBitmapFile != NULL, "BitmapDecoder::readImageInfo() - Invalid bitmap file." );
+
+   // Finish if the format cannot be decoded.
+   if ( !isBitmapFile( pBitmapFile ) )
+      return false;
+
+   // Open the bitmap file.
+   FileStream stream;
+   if ( !stream.open( pBitmapFile, FileStream::Read ) )
+      return false;
+
+   // Read the header.
+   ImageInfoRowSink sink;
+   if ( dStricmp( dStrrchr( pBitmapFile, '.' ), ".png" ) == 0 )
+      GBitmap::readPNGRows( stream, sink );
+   else
+      GBitmap::readJPEGRows( stream, sink );
+
+   stream.close();
+
+   // Finish if the header could not be read.
+   if ( !sink.mRead )
+      return false;
+
+   width = sink.mWidth;
+   height = sink.mHeight;
+   format = sink.mFormat;
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool BitmapDecoder::isBitmapFile( const char* pFilename )
+{
+   // Fetch the extension.
+   const char* pExtension = dStrrchr( pFilename, '.' );
+
+   return pExtension != NULL &&
+      ( dStricmp( pExtension, ".png" ) == 0 || dStricmp( pExtension, ".jpg" ) == 0 || dStricmp( pExtension, ".jpeg" ) == 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+void BitmapDecoder::findBitmapFiles( const char* pPath, const bool recurse, Vector<StringTableEntry>& bitmapFiles )
+{
+   // Find the files.
+   Vector<Platform::FileInfo> files;
+   if ( !Platform::dumpPath( pPath, files, recurse ? -1 : 0 ) )
+      return;
+
+   for ( Vector<Platform::FileInfo>::iterator fileItr = files.begin(); fileItr != files.end(); ++fileItr )
+   {
+      if ( !isBitmapFile( fileItr->pFileName ) )
+         continue;
+
+      char bitmapFile[1024];
+      dSprintf( bitmapFile, sizeof(bitmapFile), "%s/%s", fileItr->pFullPath, fileItr->pFileName );
+      bitmapFiles.push_back( StringTable->insert( bitmapFile ) );
+   }
+}
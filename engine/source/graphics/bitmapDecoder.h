@@ -0,0 +1,104 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _BITMAP_DECODER_H_
+#define _BITMAP_DECODER_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _GBITMAP_H_
+#include "graphics/gBitmap.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class Stream;
+
+//-----------------------------------------------------------------------------
+
+/// Decodes PNG and JPEG images straight into the layout the texture manager uploads.
+///
+/// Rows are streamed from the decoder into the final bitmap which is padded to
+/// power-of-two dimensions, extruding the edge pixels as the texture manager does,
+/// and optionally converted to 16-bit.  A texture created from the bitmap needs no
+/// further copies and large images need no intermediate bitmap.  Padded bitmaps
+/// report the size of the image with GBitmap::getImageWidth() and getImageHeight().
+///
+/// Decoding a single bitmap only touches its file so it can be done on any thread.
+/// Batches of bitmaps are decoded across the global thread pool.
+class BitmapDecoder
+{
+public:
+   enum DecodeFlags
+   {
+      /// Pad to power-of-two dimensions.
+      PowerOfTwo  = BIT(0),
+
+      /// Convert RGB images to RGB565.  Other formats are converted as they are uploaded.
+      Force16Bit  = BIT(1)
+   };
+
+   struct Request
+   {
+      StringTableEntry  mBitmapFile;
+      U32               mFlags;
+
+      /// The decoded bitmap, owned by the caller, or NULL if the file could not be decoded.
+      GBitmap*          mpBitmap;
+   };
+
+   /// Decode a bitmap file on the calling thread.
+   static GBitmap*   decode( const char* pBitmapFile, const U32 flags = PowerOfTwo );
+
+   /// Decode a PNG or JPEG stream on the calling thread.
+   static GBitmap*   decode( Stream& stream, const bool png, const U32 flags = PowerOfTwo );
+
+   /// Decode the requests across the global thread pool, returning once all of them have been decoded.
+   /// This must be called from the main thread.
+   static void       decode( Request* pRequests, const U32 requestCount );
+
+   /// Decode bitmap files across the global thread pool and hand them to the texture manager
+   /// so that loading their textures does not decode them again.  Returns the number decoded.
+   static U32        preload( const Vector<StringTableEntry>& bitmapFiles, const U32 flags = PowerOfTwo );
+
+   /// Read the dimensions and decoded format of a bitmap file without decoding its rows.
+   /// Returns false if the file could not be read.
+   static bool       readImageInfo( const char* pBitmapFile, U32& width, U32& height, GBitmap::BitmapFormat& format );
+
+   /// Whether the file is a PNG or JPEG which are the formats that can be decoded.
+   static bool       isBitmapFile( const char* pFilename );
+
+   /// Find the bitmap files that can be decoded in a path.
+   static void       findBitmapFiles( const char* pPath, const bool recurse, Vector<StringTableEntry>& bitmapFiles );
+};
+
+#endif // _BITMAP_DECODER_H_
@@ -0,0 +1,127 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+/*! @defgroup BitmapDecoderFunctions Bitmap Decoder
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Decodes the PNG and JPEG files in a path across the thread pool so that loading their textures does not decode them again.
+    @param path The path to search.
+    @param recurse Whether to search sub-directories or not, defaults to true.
+    @return The number of bitmaps decoded.
+*/
+ConsoleFunctionWithDocs( preloadBitmaps, ConsoleInt, 2, 3, (path, [recurse]))
+{
+    // Expand the path.
+    char pathBuffer[1024];
+    Con::expandPath( pathBuffer, sizeof(pathBuffer), argv[1] );
+
+    // Find the bitmap files.
+    Vector<StringTableEntry> bitmapFiles;
+    BitmapDecoder::findBitmapFiles( pathBuffer, argc < 3 ? true : dAtob(argv[2]), bitmapFiles );
+
+    return BitmapDecoder::preload( bitmapFiles );
+}
+
+/*! Times decoding the PNG and JPEG files in a path three ways: reading each bitmap and padding it as the texture manager used to,
+    decoding each bitmap straight into its texture layout on the calling thread and decoding them all across the thread pool.
+    @param path The path to search, defaults to the ToyAssets module folder.
+    @return The times taken in milliseconds formatted as "readPadTime decodeTime threadPoolTime" or an empty string if no images were found.
+*/
+ConsoleFunctionWithDocs( runBitmapDecodeBenchmark, ConsoleString, 1, 2, ([path]))
+{
+    // Find the bitmap files.
+    char pathBuffer[1024];
+    if ( argc < 2 )
+        Platform::makeFullPathName( "modules/ToyAssets", pathBuffer, sizeof(pathBuffer) );
+    else
+        Con::expandPath( pathBuffer, sizeof(pathBuffer), argv[1] );
+    Vector<StringTableEntry> bitmapFiles;
+    BitmapDecoder::findBitmapFiles( pathBuffer, true, bitmapFiles );
+
+    if ( bitmapFiles.size() == 0 )
+    {
+        Con::warnf( "runBitmapDecodeBenchmark() - No images were found in '%s'.", pathBuffer );
+        return "";
+    }
+
+    // Time reading each bitmap and padding it as the texture manager used to.
+    const U32 readStartTime = Platform::getRealMilliseconds();
+    for ( S32 index = 0; index < bitmapFiles.size(); ++index )
+    {
+        FileStream stream;
+        if ( !stream.open( bitmapFiles[index], FileStream::Read ) )
+            continue;
+
+        GBitmap* pBitmap = new GBitmap();
+        const bool png = dStricmp( dStrrchr( bitmapFiles[index], '.' ), ".png" ) == 0;
+        if ( png ? pBitmap->readPNG( stream ) : pBitmap->readJPEG( stream ) )
+            delete pBitmap->createPowerOfTwoBitmap();
+        delete pBitmap;
+
+        stream.close();
+    }
+    const U32 readTime = Platform::getRealMilliseconds() - readStartTime;
+
+    // Time decoding each bitmap on this thread.
+    const U32 decodeStartTime = Platform::getRealMilliseconds();
+    for ( S32 index = 0; index < bitmapFiles.size(); ++index )
+    {
+        delete BitmapDecoder::decode( bitmapFiles[index] );
+    }
+    const U32 decodeTime = Platform::getRealMilliseconds() - decodeStartTime;
+
+    // Time decoding the bitmaps across the thread pool.
+    Vector<BitmapDecoder::Request> requests;
+    for ( S32 index = 0; index < bitmapFiles.size(); ++index )
+    {
+        BitmapDecoder::Request request;
+        request.mBitmapFile = bitmapFiles[index];
+        request.mFlags = BitmapDecoder::PowerOfTwo;
+        request.mpBitmap = NULL;
+        requests.push_back( request );
+    }
+    const U32 threadPoolStartTime = Platform::getRealMilliseconds();
+    BitmapDecoder::decode( requests.address(), requests.size() );
+    const U32 threadPoolTime = Platform::getRealMilliseconds() - threadPoolStartTime;
+
+    U32 decodedBytes = 0;
+    for ( S32 index = 0; index < requests.size(); ++index )
+    {
+        if ( requests[index].mpBitmap == NULL )
+            continue;
+
+        decodedBytes += requests[index].mpBitmap->byteSize;
+        delete requests[index].mpBitmap;
+    }
+
+    // Report.
+    Con::printf( "Bitmap decode benchmark: %d images (%d KB), read and pad %dms, decode %dms, decode on the thread pool %dms.",
+        bitmapFiles.size(), decodedBytes / 1024, readTime, decodeTime, threadPoolTime );
+
+    char* pBuffer = Con::getReturnBuffer( 64 );
+    dSprintf( pBuffer, 64, "%d %d %d", readTime, decodeTime, threadPoolTime );
+    return pBuffer;
+}
+
+/*! @} */ // group BitmapDecoderFunctions
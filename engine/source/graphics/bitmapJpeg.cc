@@ -80,6 +80,15 @@ static int jpegErrorFn(void *client_data)
 
 //--------------------------------------
 bool GBitmap::readJPEG(Stream &stream)
+{
+   // Decode straight into the bitmap.
+   BitmapRowSink sink(this);
+   return readJPEGRows(stream, sink);
+}
+
+
+//--------------------------------------
+bool GBitmap::readJPEGRows(Stream &stream, RowSink &sink)
 {
    JFREAD  = jpegReadDataFn;
    JFERROR = jpegErrorFn;
@@ -124,17 +133,20 @@ bool GBitmap::readJPEG(Stream &stream)
    // Start decompressor
    jpeg_start_decompress(&cinfo);
 
-   // allocate the bitmap space and init internal variables...
-   allocateBitmap(cinfo.output_width, cinfo.output_height, false, format);
-
-   // Set up the row pointers...
-   U32 rowBytes = cinfo.output_width * cinfo.output_components;
+   // Let the sink set up the destination...
+   if (!sink.beginImage(cinfo.output_width, cinfo.output_height, format))
+   {
+      jpeg_abort_decompress(&cinfo);
+      jpeg_destroy_decompress(&cinfo);
+      return false;
+   }
 
-   U8* pBase = (U8*)getBits();
-   for (U32 i = 0; i < height; i++)
+   // Read each scanline straight into the sink.
+   for (U32 i = 0; i < cinfo.output_height; i++)
    {
-      JSAMPROW rowPointer = pBase + (i * rowBytes);
+      JSAMPROW rowPointer = sink.getRow(i);
       jpeg_read_scanlines(&cinfo, &rowPointer, 1);
+      sink.endRow(i);
    }
 
    // Finish decompression
@@ -144,6 +156,8 @@ bool GBitmap::readJPEG(Stream &stream)
    // This is an important step since it will release a good deal of memory.
    jpeg_destroy_decompress(&cinfo);
 
+   sink.endImage();
+
    return true;
 }
 
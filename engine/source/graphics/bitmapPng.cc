@@ -45,41 +45,35 @@ bool sgForcePalletedPNGsTo16Bit= false;
 
 // Our chunk signatures...
 
-static const U32 csgMaxRowPointers = (1 << GBitmap::c_maxMipLevels) - 1; ///< 2^11 = 2048, 12 mip levels (see c_maxMipLievels)
-static png_bytep sRowPointers[csgMaxRowPointers];
-
-//-------------------------------------- Instead of using the user_ptr,
-//                                        we use a global pointer, we
-//                                        need to ensure that only one thread
-//                                        at once may be using the variable.
-//                                       NOTE: Removed mutex for g_varAccess.
-//                                        may have to re-thread safe this.
-static Stream* sg_pStream = NULL;
-
 //-------------------------------------- Replacement I/O for standard LIBPng
 //                                        functions.  we don't wanna use
 //                                        FILE*'s...
-static void pngReadDataFn(png_structp  /*png_ptr*/,
+//                                        The stream is passed through the
+//                                        io_ptr so that PNGs can be read on
+//                                        more than one thread at once.
+static void pngReadDataFn(png_structp  png_ptr,
                           png_bytep   data,
                           png_size_t  length)
 {
-   AssertFatal(sg_pStream != NULL, "No stream?");
+   Stream* pStream = (Stream*)png_get_io_ptr(png_ptr);
+   AssertFatal(pStream != NULL, "No stream?");
 
    bool success;
-   success = sg_pStream->read((U32)length, data);
+   success = pStream->read((U32)length, data);
     
    AssertFatal(success, "PNG read catastrophic error!");
 }
 
 
 //--------------------------------------
-static void pngWriteDataFn(png_structp /*png_ptr*/,
+static void pngWriteDataFn(png_structp png_ptr,
                            png_bytep   data,
                            png_size_t  length)
 {
-   AssertFatal(sg_pStream != NULL, "No stream?");
+   Stream* pStream = (Stream*)png_get_io_ptr(png_ptr);
+   AssertFatal(pStream != NULL, "No stream?");
 
-   sg_pStream->write((U32)length, data);
+   pStream->write((U32)length, data);
 }
 
 
@@ -89,20 +83,25 @@ static void pngFlushDataFn(png_structp /*png_ptr*/)
    //
 }
 
-static png_voidp pngMallocFn(png_structp /*png_ptr*/, png_size_t size)
+//-------------------------------------- The frame allocator can only be used
+//                                        from the main thread so any other
+//                                        thread flags the heap via mem_ptr.
+static png_voidp pngMallocFn(png_structp png_ptr, png_size_t size)
 {
 #ifndef _WIN64
-   return FrameAllocator::alloc((U32)size);
-#else
-   return (png_voidp)dMalloc(size);
+   if (png_get_mem_ptr(png_ptr) == NULL)
+      return FrameAllocator::alloc((U32)size);
 #endif
+   return (png_voidp)dMalloc(size);
 }
 
-static void pngFreeFn(png_structp /*png_ptr*/, png_voidp mem)
+static void pngFreeFn(png_structp png_ptr, png_voidp mem)
 {
-#ifdef _WIN64
-   dFree(mem);
+#ifndef _WIN64
+   if (png_get_mem_ptr(png_ptr) == NULL)
+      return;
 #endif
+   dFree(mem);
 }
 
 
@@ -123,6 +122,29 @@ static void pngWarningFn(png_structp, png_const_charp pMessage)
 
 //--------------------------------------
 bool GBitmap::readPNG(Stream& io_rStream)
+{
+   // Decode straight into the bitmap.
+   BitmapRowSink sink(this);
+   bool palettized;
+   if (readPNGRows(io_rStream, sink, &palettized) == false)
+      return false;
+
+    //
+   //-Mat if all palleted images are to be converted, set mForce16bit
+   //     (the console is only read from the main thread)
+   if( palettized ) {
+       if( Con::isMainThread() )
+           sgForcePalletedPNGsTo16Bit = dAtob( Con::getVariable("$pref::iPhone::ForcePalletedPNGsTo16Bit") );
+       if( sgForcePalletedPNGsTo16Bit ) {
+           mForce16Bit = true;
+       }
+   }
+   return true;
+}
+
+
+//--------------------------------------
+bool GBitmap::readPNGRows(Stream& io_rStream, RowSink& io_rSink, bool* out_pPalettized)
 {
    static const U32 cs_headerBytesChecked = 8;
 
@@ -136,14 +158,16 @@ bool GBitmap::readPNG(Stream& io_rStream)
       return false;
    }
 
-   U32 prevWaterMark = FrameAllocator::getWaterMark();
+   // Only the main thread may use the frame allocator.
+   const bool mainThread = Con::isMainThread();
+   U32 prevWaterMark = mainThread ? FrameAllocator::getWaterMark() : 0;
 
 #if defined(PNG_USER_MEM_SUPPORTED)
    png_structp png_ptr = png_create_read_struct_2(PNG_LIBPNG_VER_STRING,
                                                 NULL,
                                                 pngFatalErrorFn,
                                                 pngWarningFn,
-                                                NULL,
+                                                mainThread ? NULL : (png_voidp)&io_rStream,
                                                 pngMallocFn,
                                                 pngFreeFn);
 #else
@@ -155,7 +179,8 @@ bool GBitmap::readPNG(Stream& io_rStream)
 
    if (png_ptr == NULL) 
    {
-      FrameAllocator::setWaterMark(prevWaterMark);
+      if (mainThread)
+         FrameAllocator::setWaterMark(prevWaterMark);
       return false;
    }
 
@@ -164,7 +189,8 @@ bool GBitmap::readPNG(Stream& io_rStream)
       png_destroy_read_struct(&png_ptr,
                               (png_infopp)NULL,
                               (png_infopp)NULL);
-      FrameAllocator::setWaterMark(prevWaterMark);
+      if (mainThread)
+         FrameAllocator::setWaterMark(prevWaterMark);
       return false;
    }
 
@@ -173,22 +199,17 @@ bool GBitmap::readPNG(Stream& io_rStream)
       png_destroy_read_struct(&png_ptr,
                               &info_ptr,
                               (png_infopp)NULL);
-      FrameAllocator::setWaterMark(prevWaterMark);
+      if (mainThread)
+         FrameAllocator::setWaterMark(prevWaterMark);
       return false;
    }
 
-   sg_pStream = &io_rStream;
-   png_set_read_fn(png_ptr, NULL, pngReadDataFn);
+   png_set_read_fn(png_ptr, &io_rStream, pngReadDataFn);
 
    // Read off the info on the image.
    png_set_sig_bytes(png_ptr, cs_headerBytesChecked);
    png_read_info(png_ptr, info_ptr);
 
-   // OK, at this point, if we have reached it ok, then we can reset the
-   //  image to accept the new data...
-   //
-   deleteImage();
-
    png_uint_32 width;
    png_uint_32 height;
    S32 bit_depth;
@@ -250,7 +271,7 @@ bool GBitmap::readPNG(Stream& io_rStream)
 
    // Update the info pointer with the result of the transformations
    //  above...
-   png_set_interlace_handling(png_ptr);
+   const S32 passCount = png_set_interlace_handling(png_ptr);
    png_read_update_info(png_ptr, info_ptr);
 
    png_uint_32 rowBytes = (png_uint_32)png_get_rowbytes(png_ptr, info_ptr);
@@ -264,20 +285,44 @@ bool GBitmap::readPNG(Stream& io_rStream)
                   "Error, our rowbytes are incorrect for this transform... (4)");
    }
 
-   // actually allocate the bitmap space...
-   allocateBitmap(width, height,
-                  false,            // don't extrude miplevels...
-                  format);          // use determined format...
+   // Let the sink set up the destination...
+   if (io_rSink.beginImage(width, height, format) == false)
+   {
+      png_destroy_read_struct(&png_ptr, &info_ptr, &end_info);
+      if (mainThread)
+         FrameAllocator::setWaterMark(prevWaterMark);
+      return false;
+   }
 
-   // Set up the row pointers...
-   AssertISV(height <= csgMaxRowPointers, "Error, cannot load pngs taller than 2048 pixels!");
-   png_bytep* rowPointers = sRowPointers;
-   U8* pBase = (U8*)getBits();
-   for (U32 i = 0; i < height; i++)
-      rowPointers[i] = pBase + (i * rowBytes);
+   if (passCount > 1)
+   {
+      // Interlaced images are filled in over several passes so they have
+      //  to be read in whole before the rows can be handed over.
+      U8* pImage = (U8*)dMalloc(height * rowBytes);
+      png_bytep* rowPointers = (png_bytep*)dMalloc(height * sizeof(png_bytep));
+      for (U32 i = 0; i < height; i++)
+         rowPointers[i] = pImage + (i * rowBytes);
 
-   // And actually read the image!
-   png_read_image(png_ptr, rowPointers);
+      png_read_image(png_ptr, rowPointers);
+
+      for (U32 i = 0; i < height; i++)
+      {
+         dMemcpy(io_rSink.getRow(i), rowPointers[i], rowBytes);
+         io_rSink.endRow(i);
+      }
+
+      dFree(rowPointers);
+      dFree(pImage);
+   }
+   else
+   {
+      // Read each row straight into the sink.
+      for (U32 i = 0; i < height; i++)
+      {
+         png_read_row(png_ptr, io_rSink.getRow(i), NULL);
+         io_rSink.endRow(i);
+      }
+   }
 
    // We're outta here, destroy the png structs, and release the lock
    //  as quickly as possible...
@@ -285,24 +330,14 @@ bool GBitmap::readPNG(Stream& io_rStream)
    png_read_end(png_ptr, NULL);
    png_destroy_read_struct(&png_ptr, &info_ptr, &end_info);
 
-   sg_pStream = NULL;
+   if (mainThread)
+      FrameAllocator::setWaterMark(prevWaterMark);
 
-   // Ok, the image is read in, now we need to finish up the initialization,
-   //  which means: setting up the detailing members, init'ing the palette
-   //  key, etc...
-   //
-   // actually, all of that was handled by allocateBitmap, so we're outta here
-   //
-   FrameAllocator::setWaterMark(prevWaterMark);
+   io_rSink.endImage();
+
+   if (out_pPalettized != NULL)
+      *out_pPalettized = color_type == PNG_COLOR_TYPE_PALETTE;
 
-    //
-   //-Mat if all palleted images are to be converted, set mForce16bit
-   if( color_type == PNG_COLOR_TYPE_PALETTE ) {
-       sgForcePalletedPNGsTo16Bit = dAtob( Con::getVariable("$pref::iPhone::ForcePalletedPNGsTo16Bit") );
-       if( sgForcePalletedPNGsTo16Bit ) {
-           mForce16Bit = true;
-       }
-   }
    return true;
 }
 
@@ -348,8 +383,7 @@ bool GBitmap::_writePNG(Stream&   stream,
       return false;
    }
 
-   sg_pStream = &stream;
-   png_set_write_fn(png_ptr, NULL, pngWriteDataFn, pngFlushDataFn);
+   png_set_write_fn(png_ptr, &stream, pngWriteDataFn, pngFlushDataFn);
 
    // Set the compression level, image filters, and compression strategy...
    png_set_compression_strategy( png_ptr, strategy );
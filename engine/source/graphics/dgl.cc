@@ -23,6 +23,7 @@
 #include "math/mPoint.h"
 #include "graphics/TextureManager.h"
 #include "graphics/dgl.h"
+#include "graphics/renderCommands.h"
 #include "graphics/color.h"
 #include "math/mPoint.h"
 #include "math/mRect.h"
@@ -43,8 +44,23 @@ ColorI sg_textAnchorColor(255, 255, 255, 255);
 ColorI sg_stackColor(255, 255, 255, 255);
 RectI sgCurrentClipRect;
 
+GLRenderCommandExecutor sgGLRenderCommandExecutor;
+RenderCommandExecutor* sgRenderCommandExecutor = &sgGLRenderCommandExecutor;
+RenderCommandBuffer sgRenderCommands;
+
 } // namespace {}
 
+//--------------------------------------------------------------------------
+RenderCommandExecutor* dglGetRenderCommandExecutor()
+{
+   return sgRenderCommandExecutor;
+}
+
+void dglSetRenderCommandExecutor(RenderCommandExecutor* executor)
+{
+   sgRenderCommandExecutor = executor != NULL ? executor : &sgGLRenderCommandExecutor;
+}
+
 
 //--------------------------------------------------------------------------
 void dglSetBitmapModulation(const ColorF& in_rColor)
@@ -92,26 +108,15 @@ void dglDrawBitmapStretchSR(TextureObject* texture,
    AssertFatal(srcRect.isValidRect() == true,
                "GSurface::drawBitmapStretchSR: routines assume normal rects");
 
-   glDisable(GL_LIGHTING);
-
-   glEnable(GL_TEXTURE_2D);
-   glBindTexture(GL_TEXTURE_2D, texture->getGLTextureName());
-   //glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-
+   RenderStateBlock state;
+   state.mTexture = true;
    if (bSilhouette)
    {
-      glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_BLEND);
-   
-      ColorF kModulationColor;
-      dglGetBitmapModulation(&kModulationColor);
-      glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, kModulationColor.address());
-   }
-   else
-   {
-      glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
+      state.mTextureEnvMode = GL_BLEND;
+      dglGetBitmapModulation(&state.mTextureEnvColor);
    }
-   glEnable(GL_BLEND);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+   state.mBlend = true;
+   state.mColor = sg_bitmapModulation;
 
    F32 texLeft   = F32(srcRect.point.x)                    / F32(texture->getTextureWidth());
    F32 texRight  = F32(srcRect.point.x + srcRect.extent.x) / F32(texture->getTextureWidth());
@@ -170,59 +175,27 @@ void dglDrawBitmapStretchSR(TextureObject* texture,
       texBottom = temp;
    }
 
-   glColor4ub(sg_bitmapModulation.red,
-             sg_bitmapModulation.green,
-             sg_bitmapModulation.blue,
-             sg_bitmapModulation.alpha);
-
-#if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
-
-    GLfloat verts[] = {
-        (GLfloat)scrPoints[0].x, (GLfloat)scrPoints[0].y,
-        (GLfloat)scrPoints[1].x, (GLfloat)scrPoints[1].y,
-        (GLfloat)scrPoints[2].x, (GLfloat)scrPoints[2].y,
-        (GLfloat)scrPoints[3].x, (GLfloat)scrPoints[3].y,
-    };
-    GLfloat texVerts[] = {
-        (GLfloat)texLeft, (GLfloat)texTop,
-        (GLfloat)texRight, (GLfloat)texTop,		
-        (GLfloat)texLeft, (GLfloat)texBottom,
-        (GLfloat)texRight, (GLfloat)texBottom,
-    };
-    
-    
-    glDisableClientState(GL_COLOR_ARRAY);
-    //glDisableClientState(GL_POINT_SIZE_ARRAY_OES);
-    glEnableClientState(GL_VERTEX_ARRAY);
-    glEnableClientState(GL_TEXTURE_COORD_ARRAY);
-    
-    glVertexPointer(2, GL_FLOAT, 0, verts);
-    glTexCoordPointer(2, GL_FLOAT, 0, texVerts);
-    
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-
-#else
-   glBegin(GL_TRIANGLE_FAN);
-      glTexCoord2f(texLeft, texBottom);
-      glVertex2f(scrPoints[2].x, scrPoints[2].y);
-
-      glTexCoord2f(texRight, texBottom);
-      glVertex2f(scrPoints[3].x, scrPoints[3].y);
-
-      glTexCoord2f(texRight, texTop);
-      glVertex2f(scrPoints[1].x, scrPoints[1].y);
-
-      glTexCoord2f(texLeft, texTop);
-      glVertex2f(scrPoints[0].x, scrPoints[0].y);
-   glEnd();
-#endif
-   if (bSilhouette)
-   {
-      glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, ColorF(0.0f, 0.0f, 0.0f, 0.0f).address());
-   }
+   GLfloat verts[] = {
+      (GLfloat)scrPoints[0].x, (GLfloat)scrPoints[0].y,
+      (GLfloat)scrPoints[1].x, (GLfloat)scrPoints[1].y,
+      (GLfloat)scrPoints[2].x, (GLfloat)scrPoints[2].y,
+      (GLfloat)scrPoints[3].x, (GLfloat)scrPoints[3].y,
+   };
+   GLfloat texVerts[] = {
+      (GLfloat)texLeft, (GLfloat)texTop,
+      (GLfloat)texRight, (GLfloat)texTop,
+      (GLfloat)texLeft, (GLfloat)texBottom,
+      (GLfloat)texRight, (GLfloat)texBottom,
+   };
 
-   glDisable(GL_BLEND);
-   glDisable(GL_TEXTURE_2D);
+   // Record and replay the draw.
+   sgRenderCommands.setState(state);
+   sgRenderCommands.bindTexture(TextureManager::useTexture(texture));
+   sgRenderCommands.setVertexArrays(verts, texVerts, NULL, sizeof(GLfloat) * 2);
+   sgRenderCommands.draw(GL_TRIANGLE_STRIP, 0, 4);
+   sgRenderCommands.resetState();
+   sgRenderCommandExecutor->execute(sgRenderCommands);
+   sgRenderCommands.clear();
 }
 
 void dglDrawBitmap(TextureObject* texture, const Point2I& in_rAt, const U32 in_flip)
@@ -492,7 +465,7 @@ U32 dglDrawTextN(GFont*          font,
       {
          if(currentPt)
          {
-            glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
+            glBindTexture(GL_TEXTURE_2D, TextureManager::useTexture(lastTexture));
 
             //Luma:	More optimal rendering
             for (S32 i=0; i<currentPt; i+=4) 
@@ -540,7 +513,7 @@ U32 dglDrawTextN(GFont*          font,
    if(currentPt)
    {
        //Luma:	More optimal rendering
-       glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
+       glBindTexture(GL_TEXTURE_2D, TextureManager::useTexture(lastTexture));
        for (S32 i=0; i<currentPt; i+=4) 
        {
             glDrawArrays(GL_TRIANGLE_STRIP, i, 4);
@@ -707,7 +680,7 @@ U32 dglDrawTextN(GFont*          font,
       {
          if(currentPt)
          {
-            glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
+            glBindTexture(GL_TEXTURE_2D, TextureManager::useTexture(lastTexture));
             glDrawArrays( GL_QUADS, 0, currentPt );
             currentPt = 0;
          }
@@ -750,7 +723,7 @@ U32 dglDrawTextN(GFont*          font,
    }
    if(currentPt)
    {
-      glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
+      glBindTexture(GL_TEXTURE_2D, TextureManager::useTexture(lastTexture));
       glDrawArrays( GL_QUADS, 0, currentPt );
    }
 
@@ -848,26 +821,24 @@ void dglDrawRect(const RectI &rect, const ColorI &color, const float &lineWidth)
 
 void dglDrawRectFill(const Point2I &upperL, const Point2I &lowerR, const ColorI &color)
 {
-   glEnable(GL_BLEND);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-   glDisable(GL_TEXTURE_2D);
-
-   glColor4ub(color.red, color.green, color.blue, color.alpha);
-#if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
-    GLfloat vertices[] = {
-        (GLfloat)upperL.x, (GLfloat)upperL.y,
-        (GLfloat)upperL.x, (GLfloat)lowerR.y,
-        (GLfloat)lowerR.x, (GLfloat)upperL.y,
-        (GLfloat)lowerR.x, (GLfloat)lowerR.y,
-    };
-    
-    glVertexPointer(2, GL_FLOAT, 0, vertices);
-    glEnableClientState(GL_VERTEX_ARRAY);
+   RenderStateBlock state;
+   state.mBlend = true;
+   state.mColor = color;
+
+   GLfloat vertices[] = {
+      (GLfloat)upperL.x, (GLfloat)upperL.y,
+      (GLfloat)upperL.x, (GLfloat)lowerR.y,
+      (GLfloat)lowerR.x, (GLfloat)upperL.y,
+      (GLfloat)lowerR.x, (GLfloat)lowerR.y,
+   };
 
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-#else
-   glRecti((S32)upperL.x, (S32)upperL.y, (S32)lowerR.x, (S32)lowerR.y);
-#endif
+   // Record and replay the draw.
+   sgRenderCommands.setState(state);
+   sgRenderCommands.setVertexArrays(vertices, NULL, NULL, sizeof(GLfloat) * 2);
+   sgRenderCommands.draw(GL_TRIANGLE_STRIP, 0, 4);
+   sgRenderCommands.resetState();
+   sgRenderCommandExecutor->execute(sgRenderCommands);
+   sgRenderCommands.clear();
 }
 void dglDrawRectFill(const RectI &rect, const ColorI &color)
 {
@@ -39,6 +39,7 @@ class ColorF;
 class Point2I;
 class Point2F;
 class Point3F;
+class RenderCommandExecutor;
 
 /// @defgroup dgl Cross-Platform OpenGL Support
 /// functions used to map Torque2D calls to OpenGL (or OpenGL ES) calls per platform
@@ -89,6 +90,19 @@ void dglClearBitmapModulation();
 /// Sets the anchor color for text coloring, useful when mixing text colors
 void dglSetTextAnchorColor(const ColorF&);
 
+/// @defgroup dgl_render_commands Render Commands
+/// @ingroup dgl
+/// Bitmaps, filled rectangles and scene batches are recorded as render commands
+/// and replayed by the current executor, OpenGL by default.
+/// @{
+
+/// Gets the executor replaying render commands
+RenderCommandExecutor* dglGetRenderCommandExecutor();
+/// Sets the executor replaying render commands, NULL restores the OpenGL executor
+void dglSetRenderCommandExecutor(RenderCommandExecutor* executor);
+
+/// @}
+
 /// @defgroup dgl_bitmap_draw Bitmap Drawing Functions
 /// @ingroup dgl
 /// These functions allow you to draw a bitmap.
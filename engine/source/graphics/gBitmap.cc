@@ -48,6 +48,8 @@ GBitmap::GBitmap()
    height(0),
    numMipLevels(0),
    bytesPerPixel(0),
+   imageWidth(0),
+   imageHeight(0),
    pPalette(NULL),
    mForce16Bit(false)
 {
@@ -78,6 +80,8 @@ GBitmap::GBitmap(const GBitmap& rCopy)
 
    width        = rCopy.width;
    height       = rCopy.height;
+   imageWidth   = rCopy.imageWidth;
+   imageHeight  = rCopy.imageHeight;
    bytesPerPixel = rCopy.bytesPerPixel;
    numMipLevels = rCopy.numMipLevels;
    dMemcpy(mipLevelOffsets, rCopy.mipLevelOffsets, sizeof(mipLevelOffsets));
@@ -116,6 +120,8 @@ void GBitmap::deleteImage()
 
    width        = 0;
    height       = 0;
+   imageWidth   = 0;
+   imageHeight  = 0;
    numMipLevels = 0;
 
    SAFE_DELETE(pPalette);
@@ -163,6 +169,8 @@ void GBitmap::allocateBitmap(const U32 in_width, const U32 in_height, const bool
    internalFormat = in_format;
    width          = in_width;
    height         = in_height;
+   imageWidth     = in_width;
+   imageHeight    = in_height;
 
    bytesPerPixel = 1;
    switch (internalFormat) {
@@ -849,6 +857,8 @@ bool GBitmap::read(Stream& io_rStream)
 
    io_rStream.read(&width);
    io_rStream.read(&height);
+   imageWidth  = width;
+   imageHeight = height;
 
    io_rStream.read(&numMipLevels);
    for (U32 i = 0; i < c_maxMipLevels; i++)
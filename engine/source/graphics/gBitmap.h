@@ -80,6 +80,29 @@ class GBitmap: public ResourceInstance
       c_maxMipLevels = 12 //(2^(12 + 1) = 2048)
    };
 
+   /// Receives an image a row at a time as it is decoded so that it can be
+   ///  written straight to its final layout without an intermediate bitmap.
+   ///  Rows are delivered once each, top to bottom.
+   class RowSink
+   {
+     public:
+      virtual ~RowSink() {}
+
+      /// Called once the image dimensions and decoded format are known,
+      ///  returning false aborts the decode.
+      virtual bool beginImage(const U32 in_width, const U32 in_height, const BitmapFormat in_format) = 0;
+
+      /// Returns where the decoder should write a row, it must hold a row
+      ///  of the decoded format.
+      virtual U8*  getRow(const U32 in_row) = 0;
+
+      /// Called once the row returned by getRow() has been written.
+      virtual void endRow(const U32 in_row) {}
+
+      /// Called once all the rows have been written.
+      virtual void endImage() {}
+   };
+
   public:
 
    static GBitmap *load(const char *path);
@@ -110,6 +133,8 @@ class GBitmap: public ResourceInstance
    U32          getNumMipLevels() const;
    U32          getWidth(const U32 in_mipLevel  = 0) const;
    U32          getHeight(const U32 in_mipLevel = 0) const;
+   U32          getImageWidth()  const { return imageWidth; }
+   U32          getImageHeight() const { return imageHeight; }
 
    U8*         getAddress(const S32 in_x, const S32 in_y, const U32 mipLevel = U32(0));
    const U8*   getAddress(const S32 in_x, const S32 in_y, const U32 mipLevel = U32(0)) const;
@@ -143,6 +168,9 @@ class GBitmap: public ResourceInstance
    U32 numMipLevels;
    U32 mipLevelOffsets[c_maxMipLevels];
 
+   U32 imageWidth;       ///< Width/height of the image the bitmap holds, these are only
+   U32 imageHeight;      ///  smaller than the bitmap when it was padded as it was decoded.
+
    bool mForce16Bit;//-Mat some paletted images will always be 16bit
    GPalette* pPalette;      ///< Note that this palette pointer is ALWAYS
                             ///  owned by the bitmap, and will be
@@ -152,9 +180,11 @@ class GBitmap: public ResourceInstance
    //-------------------------------------- Input/Output interface
   public:
    bool readJPEG(Stream& io_rStream);              // located in bitmapJpeg.cc
+   static bool readJPEGRows(Stream& io_rStream, RowSink& io_rSink);
    bool writeJPEG(Stream& io_rStream) const;
 
    bool readPNG(Stream& io_rStream);               // located in bitmapPng.cc
+   static bool readPNGRows(Stream& io_rStream, RowSink& io_rSink, bool* out_pPalettized = NULL);
    bool writePNG(Stream& io_rStream, const bool compressHard = false) const;
    bool writePNGUncompressed(Stream& io_rStream) const;
 
@@ -173,6 +203,26 @@ class GBitmap: public ResourceInstance
   private:
    bool _writePNG(Stream&   stream, const U32, const U32, const U32) const;
 
+   /// Decodes rows straight into a bitmap, allocating it once the
+   ///  dimensions are known.
+   class BitmapRowSink : public RowSink
+   {
+     public:
+      BitmapRowSink(GBitmap* pBitmap) : mpBitmap(pBitmap) {}
+
+      virtual bool beginImage(const U32 in_width, const U32 in_height, const BitmapFormat in_format)
+      {
+         mpBitmap->deleteImage();
+         mpBitmap->allocateBitmap(in_width, in_height, false, in_format);
+         return true;
+      }
+
+      virtual U8*  getRow(const U32 in_row) { return mpBitmap->getAddress(0, in_row); }
+
+     private:
+      GBitmap* mpBitmap;
+   };
+
    static const U32 csFileVersion;
 };
 
@@ -0,0 +1,322 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "graphics/renderCommands.h"
+
+//-----------------------------------------------------------------------------
+
+RenderStateBlock::RenderStateBlock() :
+   mTexture(false),
+   mTextureEnvMode(GL_MODULATE),
+   mTextureEnvColor(0.0f, 0.0f, 0.0f, 0.0f),
+   mWireframe(false),
+   mBlend(false),
+   mSrcBlendFactor(GL_SRC_ALPHA),
+   mDstBlendFactor(GL_ONE_MINUS_SRC_ALPHA),
+   mColor(1.0f, 1.0f, 1.0f, 1.0f),
+   mAlphaTest(-1.0f)
+{
+}
+
+//-----------------------------------------------------------------------------
+
+bool RenderStateBlock::operator==(const RenderStateBlock& other) const
+{
+   return mTexture == other.mTexture &&
+          mTextureEnvMode == other.mTextureEnvMode &&
+          mTextureEnvColor == other.mTextureEnvColor &&
+          mWireframe == other.mWireframe &&
+          mBlend == other.mBlend &&
+          mSrcBlendFactor == other.mSrcBlendFactor &&
+          mDstBlendFactor == other.mDstBlendFactor &&
+          mColor == other.mColor &&
+          mAlphaTest == other.mAlphaTest;
+}
+
+//-----------------------------------------------------------------------------
+
+RenderCommandBuffer::RenderCommandBuffer()
+{
+   clear();
+}
+
+//-----------------------------------------------------------------------------
+
+RenderCommand& RenderCommandBuffer::addCommand(const RenderCommand::Type type)
+{
+   mCommands.increment();
+   RenderCommand& command = mCommands.last();
+   command.mType = type;
+   return command;
+}
+
+//-----------------------------------------------------------------------------
+
+void RenderCommandBuffer::setState(const RenderStateBlock& state)
+{
+   // Ignore the state if it is already set.
+   if (mStateSet && mStates.last() == state)
+      return;
+
+   mStates.push_back(state);
+   mStateSet = true;
+   addCommand(RenderCommand::SetState).mStateIndex = mStates.size() - 1;
+}
+
+//-----------------------------------------------------------------------------
+
+void RenderCommandBuffer::bindTexture(const GLuint texture)
+{
+   // Ignore the texture if it is already bound.
+   if (mTextureBound && mBoundTexture == texture)
+      return;
+
+   mBoundTexture = texture;
+   mTextureBound = true;
+   mTextureBindCount++;
+
+   addCommand(RenderCommand::BindTexture).mTexture = texture;
+}
+
+//-----------------------------------------------------------------------------
+
+void RenderCommandBuffer::setVertexArrays(const F32* pPosition, const F32* pTexture, const U8* pColor, const U32 stride)
+{
+   AssertFatal(pPosition != NULL, "RenderCommandBuffer::setVertexArrays() - No vertex positions.");
+
+   RenderCommand& command = addCommand(RenderCommand::SetVertexArrays);
+   command.mVertexArrays.mpPosition = pPosition;
+   command.mVertexArrays.mpTexture = pTexture;
+   command.mVertexArrays.mpColor = pColor;
+   command.mVertexArrays.mStride = stride;
+}
+
+//-----------------------------------------------------------------------------
+
+void RenderCommandBuffer::draw(const GLenum primitive, const U32 first, const U32 count)
+{
+   RenderCommand& command = addCommand(RenderCommand::Draw);
+   command.mDraw.mPrimitive = primitive;
+   command.mDraw.mFirst = first;
+   command.mDraw.mCount = count;
+   command.mDraw.mpIndices = NULL;
+
+   countPrimitives(primitive, count);
+}
+
+//-----------------------------------------------------------------------------
+
+void RenderCommandBuffer::drawIndexed(const GLenum primitive, const U32 count, const U16* pIndices)
+{
+   AssertFatal(pIndices != NULL, "RenderCommandBuffer::drawIndexed() - No indices.");
+
+   RenderCommand& command = addCommand(RenderCommand::Draw);
+   command.mDraw.mPrimitive = primitive;
+   command.mDraw.mFirst = 0;
+   command.mDraw.mCount = count;
+   command.mDraw.mpIndices = pIndices;
+
+   countPrimitives(primitive, count);
+}
+
+//-----------------------------------------------------------------------------
+
+void RenderCommandBuffer::resetState()
+{
+   mStateSet = false;
+   addCommand(RenderCommand::ResetState);
+}
+
+//-----------------------------------------------------------------------------
+
+void RenderCommandBuffer::clear()
+{
+   mCommands.clear();
+   mStates.clear();
+   mStateSet = false;
+
+   mBoundTexture = 0;
+   mTextureBound = false;
+
+   mTextureBindCount = 0;
+   mDrawCallCount = 0;
+   mPrimitiveCount = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void RenderCommandBuffer::countPrimitives(const GLenum primitive, const U32 count)
+{
+   mDrawCallCount++;
+
+   switch (primitive)
+   {
+      case GL_TRIANGLES:
+         mPrimitiveCount += count / 3;
+         break;
+
+      case GL_TRIANGLE_STRIP:
+      case GL_TRIANGLE_FAN:
+         mPrimitiveCount += count > 2 ? count - 2 : 0;
+         break;
+
+      case GL_LINES:
+         mPrimitiveCount += count / 2;
+         break;
+
+      default:
+         mPrimitiveCount += count;
+         break;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void GLRenderCommandExecutor::execute(const RenderCommandBuffer& commands)
+{
+   const U32 commandCount = commands.getCommandCount();
+   for (U32 index = 0; index < commandCount; ++index)
+   {
+      const RenderCommand& command = commands.getCommand(index);
+
+      switch (command.mType)
+      {
+         case RenderCommand::SetState:
+            applyState(commands.getState(command.mStateIndex));
+            break;
+
+         case RenderCommand::BindTexture:
+            glBindTexture(GL_TEXTURE_2D, command.mTexture);
+            break;
+
+         case RenderCommand::SetVertexArrays:
+            glEnableClientState(GL_VERTEX_ARRAY);
+            glVertexPointer(2, GL_FLOAT, command.mVertexArrays.mStride, command.mVertexArrays.mpPosition);
+
+            if (command.mVertexArrays.mpTexture != NULL)
+            {
+               glEnableClientState(GL_TEXTURE_COORD_ARRAY);
+               glTexCoordPointer(2, GL_FLOAT, command.mVertexArrays.mStride, command.mVertexArrays.mpTexture);
+            }
+            else
+            {
+               glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+            }
+
+            if (command.mVertexArrays.mpColor != NULL)
+            {
+               glEnableClientState(GL_COLOR_ARRAY);
+               glColorPointer(4, GL_UNSIGNED_BYTE, command.mVertexArrays.mStride, command.mVertexArrays.mpColor);
+            }
+            else
+            {
+               glDisableClientState(GL_COLOR_ARRAY);
+            }
+            break;
+
+         case RenderCommand::Draw:
+            if (command.mDraw.mpIndices != NULL)
+               glDrawElements(command.mDraw.mPrimitive, command.mDraw.mCount, GL_UNSIGNED_SHORT, command.mDraw.mpIndices);
+            else
+               glDrawArrays(command.mDraw.mPrimitive, command.mDraw.mFirst, command.mDraw.mCount);
+            break;
+
+         case RenderCommand::ResetState:
+            glDisableClientState(GL_VERTEX_ARRAY);
+            glDisableClientState(GL_TEXTURE_COORD_ARRAY);
+            glDisableClientState(GL_COLOR_ARRAY);
+            glDisable(GL_ALPHA_TEST);
+            glDisable(GL_BLEND);
+            glDisable(GL_TEXTURE_2D);
+            glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, ColorF(0.0f, 0.0f, 0.0f, 0.0f).address());
+            glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+            break;
+      }
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void GLRenderCommandExecutor::applyState(const RenderStateBlock& state)
+{
+   glDisable(GL_LIGHTING);
+
+   if (state.mTexture)
+   {
+      glEnable(GL_TEXTURE_2D);
+      glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, state.mTextureEnvMode);
+      if (state.mTextureEnvMode == GL_BLEND)
+         glTexEnvfv(GL_TEXTURE_ENV, GL_TEXTURE_ENV_COLOR, state.mTextureEnvColor.address());
+   }
+   else
+   {
+      glDisable(GL_TEXTURE_2D);
+   }
+
+   glPolygonMode(GL_FRONT_AND_BACK, state.mWireframe ? GL_LINE : GL_FILL);
+
+   if (state.mBlend)
+   {
+      glEnable(GL_BLEND);
+      glBlendFunc(state.mSrcBlendFactor, state.mDstBlendFactor);
+   }
+   else
+   {
+      glDisable(GL_BLEND);
+   }
+
+   glColor4f(state.mColor.red, state.mColor.green, state.mColor.blue, state.mColor.alpha);
+
+   if (state.mAlphaTest >= 0.0f)
+   {
+      glEnable(GL_ALPHA_TEST);
+      glAlphaFunc(GL_GREATER, state.mAlphaTest);
+   }
+   else
+   {
+      glDisable(GL_ALPHA_TEST);
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void NullRenderCommandExecutor::execute(const RenderCommandBuffer& commands)
+{
+   mExecuteCount++;
+   mCommandCount += commands.getCommandCount();
+   mStateChangeCount += commands.getStateChangeCount();
+   mTextureBindCount += commands.getTextureBindCount();
+   mDrawCallCount += commands.getDrawCallCount();
+   mPrimitiveCount += commands.getPrimitiveCount();
+}
+
+//-----------------------------------------------------------------------------
+
+void NullRenderCommandExecutor::reset()
+{
+   mExecuteCount = 0;
+   mCommandCount = 0;
+   mStateChangeCount = 0;
+   mTextureBindCount = 0;
+   mDrawCallCount = 0;
+   mPrimitiveCount = 0;
+}
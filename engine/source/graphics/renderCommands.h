@@ -0,0 +1,220 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _RENDER_COMMANDS_H_
+#define _RENDER_COMMANDS_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _PLATFORMGL_H_
+#include "platform/platformGL.h"
+#endif
+
+#ifndef _COLOR_H_
+#include "graphics/color.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// The fixed-function state used to draw.
+struct RenderStateBlock
+{
+   RenderStateBlock();
+
+   bool operator==(const RenderStateBlock& other) const;
+   bool operator!=(const RenderStateBlock& other) const { return !(*this == other); }
+
+   /// Texturing, using the texture environment mode and color.
+   bool     mTexture;
+   GLint    mTextureEnvMode;
+   ColorF   mTextureEnvColor;
+
+   /// Draws polygons as lines.
+   bool     mWireframe;
+
+   /// Blending with the blend factors.
+   bool     mBlend;
+   GLenum   mSrcBlendFactor;
+   GLenum   mDstBlendFactor;
+
+   /// The current color.
+   ColorF   mColor;
+
+   /// Alpha-test reference value, negative disables the alpha-test.
+   F32      mAlphaTest;
+};
+
+//-----------------------------------------------------------------------------
+
+/// A single recorded render command.
+struct RenderCommand
+{
+   enum Type
+   {
+      SetState,
+      BindTexture,
+      SetVertexArrays,
+      Draw,
+      ResetState,
+   };
+
+   Type mType;
+
+   union
+   {
+      /// Index of the state block in the command buffer.
+      U32 mStateIndex;
+
+      GLuint mTexture;
+
+      /// Two float positions and texture coordinates and RGBA8 colors, the
+      /// texture coordinates and colors are optional.
+      struct
+      {
+         const F32*  mpPosition;
+         const F32*  mpTexture;
+         const U8*   mpColor;
+         U32         mStride;
+      } mVertexArrays;
+
+      /// Draws the vertices from the first vertex or, with indices, the indices.
+      struct
+      {
+         GLenum      mPrimitive;
+         U32         mFirst;
+         U32         mCount;
+         const U16*  mpIndices;
+      } mDraw;
+   };
+};
+
+//-----------------------------------------------------------------------------
+
+/// A flat stream of render commands recorded for later execution.
+///
+/// Redundant state blocks and texture binds are dropped as they are recorded
+/// so the counts reflect the work the executor will do. Vertex and index data
+/// is referenced rather than copied and must remain valid until the buffer
+/// is executed.
+class RenderCommandBuffer
+{
+public:
+   RenderCommandBuffer();
+
+   void setState(const RenderStateBlock& state);
+   void bindTexture(const GLuint texture);
+   void setVertexArrays(const F32* pPosition, const F32* pTexture, const U8* pColor, const U32 stride);
+   void draw(const GLenum primitive, const U32 first, const U32 count);
+   void drawIndexed(const GLenum primitive, const U32 count, const U16* pIndices);
+
+   /// Returns to the canonical state with the vertex arrays, texturing,
+   /// blending and alpha-test disabled.
+   void resetState();
+
+   /// Clears the commands and counts.
+   void clear();
+
+   inline bool isEmpty() const                     { return mCommands.empty(); }
+   inline U32 getCommandCount() const              { return mCommands.size(); }
+   inline const RenderCommand& getCommand(const U32 index) const { return mCommands[index]; }
+   inline const RenderStateBlock& getState(const U32 index) const { return mStates[index]; }
+
+   inline U32 getStateChangeCount() const          { return mStates.size(); }
+   inline U32 getTextureBindCount() const          { return mTextureBindCount; }
+   inline U32 getDrawCallCount() const             { return mDrawCallCount; }
+   inline U32 getPrimitiveCount() const            { return mPrimitiveCount; }
+
+private:
+   RenderCommand& addCommand(const RenderCommand::Type type);
+   void countPrimitives(const GLenum primitive, const U32 count);
+
+   Vector<RenderCommand>      mCommands;
+   Vector<RenderStateBlock>   mStates;
+
+   bool     mStateSet;
+   GLuint   mBoundTexture;
+   bool     mTextureBound;
+
+   U32      mTextureBindCount;
+   U32      mDrawCallCount;
+   U32      mPrimitiveCount;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Replays recorded render commands.
+class RenderCommandExecutor
+{
+public:
+   virtual ~RenderCommandExecutor() {}
+
+   virtual void execute(const RenderCommandBuffer& commands) = 0;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Replays render commands with OpenGL.
+class GLRenderCommandExecutor : public RenderCommandExecutor
+{
+public:
+   virtual void execute(const RenderCommandBuffer& commands);
+
+private:
+   void applyState(const RenderStateBlock& state);
+};
+
+//-----------------------------------------------------------------------------
+
+/// Counts render commands without a rendering context, for headless tests
+/// and benchmarks.
+class NullRenderCommandExecutor : public RenderCommandExecutor
+{
+public:
+   NullRenderCommandExecutor() { reset(); }
+
+   virtual void execute(const RenderCommandBuffer& commands);
+
+   void reset();
+
+   inline U32 getExecuteCount() const              { return mExecuteCount; }
+   inline U32 getCommandCount() const              { return mCommandCount; }
+   inline U32 getStateChangeCount() const          { return mStateChangeCount; }
+   inline U32 getTextureBindCount() const          { return mTextureBindCount; }
+   inline U32 getDrawCallCount() const             { return mDrawCallCount; }
+   inline U32 getPrimitiveCount() const            { return mPrimitiveCount; }
+
+private:
+   U32 mExecuteCount;
+   U32 mCommandCount;
+   U32 mStateChangeCount;
+   U32 mTextureBindCount;
+   U32 mDrawCallCount;
+   U32 mPrimitiveCount;
+};
+
+#endif // _RENDER_COMMANDS_H_
@@ -297,12 +297,13 @@ S32 GuiControlProfile::constructBitmapArray()
     }
 
    //now loop through all the scroll pieces, and find the bounding rectangle for each piece in each state
+   // NOTE: Decoded bitmaps can be padded to a power-of-two so only the image is scanned.
    S32 curY = 0;
 
    // ascertain the height of this row...
    ColorI color;
    mBitmapArrayRects.clear();
-   while(curY < (S32)bmp->getHeight())
+   while(curY < (S32)bmp->getImageHeight())
    {
       // skip any sep colors
       bmp->getColor( 0, curY, color);
@@ -313,7 +314,7 @@ S32 GuiControlProfile::constructBitmapArray()
       }
       // ok, process left to right, grabbing bitmaps as we go...
       S32 curX = 0;
-      while(curX < (S32)bmp->getWidth())
+      while(curX < (S32)bmp->getImageWidth())
       {
          bmp->getColor(curX, curY, color);
          if(color == sepColor)
@@ -322,7 +323,7 @@ S32 GuiControlProfile::constructBitmapArray()
             continue;
          }
          S32 startX = curX;
-         while(curX < (S32)bmp->getWidth())
+         while(curX < (S32)bmp->getImageWidth())
          {
             bmp->getColor(curX, curY, color);
             if(color == sepColor)
@@ -330,7 +331,7 @@ S32 GuiControlProfile::constructBitmapArray()
             curX++;
          }
          S32 stepY = curY;
-         while(stepY < (S32)bmp->getHeight())
+         while(stepY < (S32)bmp->getImageHeight())
          {
             bmp->getColor(startX, stepY, color);
             if(color == sepColor)
@@ -340,7 +341,7 @@ S32 GuiControlProfile::constructBitmapArray()
          mBitmapArrayRects.push_back(RectI(startX, curY, curX - startX, stepY - curY));
       }
       // ok, now skip to the next separation color on column 0
-      while(curY < (S32)bmp->getHeight())
+      while(curY < (S32)bmp->getImageHeight())
       {
          bmp->getColor(0, curY, color);
          if(color == sepColor)
@@ -38,6 +38,10 @@
 #include "console/consoleTypes.h"
 #endif
 
+#ifndef _SCRIPTCACHE_H_
+#include "console/scriptCache.h"
+#endif
+
 // Script bindings.
 #include "moduleManager_ScriptBinding.h"
 
@@ -399,6 +403,10 @@ bool ModuleManager::loadModuleGroup( const char* pModuleGroup )
         // Add the path expando for module.
         Con::addPathExpando( pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getModulePath() );
 
+        // Load the script cache archive for the module if requested.
+        if ( Con::getBoolVariable( "Scripts::cacheArchives" ) && !Con::getBoolVariable( "Scripts::ignoreDSOs" ) )
+            ScriptCache::loadModule( pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getModulePath() );
+
         // Create a scope set.
         SimSet* pScopeSet = new SimSet;
         pScopeSet->registerObject( pLoadReadyModuleDefinition->getModuleId() );
@@ -618,6 +626,9 @@ bool ModuleManager::unloadModuleGroup( const char* pModuleGroup )
             // Remove path expando for module.
             Con::removePathExpando( pLoadReadyModuleDefinition->getModuleId() );
 
+            // Release any script cache archive for the module.
+            ScriptCache::unloadModule( pLoadReadyModuleDefinition->getModuleId() );
+
             // Bump modules unloaded count.
             modulesUnloadedCount++;
 
@@ -762,6 +773,10 @@ bool ModuleManager::loadModuleExplicit( const char* pModuleId, const U32 version
         // Add the path expando for module.
         Con::addPathExpando( pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getModulePath() );
 
+        // Load the script cache archive for the module if requested.
+        if ( Con::getBoolVariable( "Scripts::cacheArchives" ) && !Con::getBoolVariable( "Scripts::ignoreDSOs" ) )
+            ScriptCache::loadModule( pLoadReadyModuleDefinition->getModuleId(), pLoadReadyModuleDefinition->getModulePath() );
+
         // Create a scope set.
         SimSet* pScopeSet = new SimSet;
         pScopeSet->registerObject( pLoadReadyModuleDefinition->getModuleId() );
@@ -969,6 +984,9 @@ bool ModuleManager::unloadModuleExplicit( const char* pModuleId )
             // Remove path expando for module.
             Con::removePathExpando( pLoadReadyModuleDefinition->getModuleId() );
 
+            // Release any script cache archive for the module.
+            ScriptCache::unloadModule( pLoadReadyModuleDefinition->getModuleId() );
+
             // Bump modules unloaded count.
             modulesUnloadedCount++;
 
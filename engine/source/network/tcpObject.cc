@@ -28,6 +28,7 @@
 #include "sim/simBase.h"
 #include "console/consoleInternal.h"
 #include "game/defaultGame.h"
+#include "debug/telemetry.h"
 
 #ifdef TORQUE_OS_IOS
 #include "platformiOS/iOSUtil.h"
@@ -357,6 +358,9 @@ void DefaultGame::processConnectedAcceptEvent( ConnectedAcceptEvent* event )
 
 void DefaultGame::processConnectedNotifyEvent( ConnectedNotifyEvent* event )
 {
+   if(Telemetry::processConnectedNotifyEvent(event))
+      return;
+
    TCPObject *tcpo = TCPObject::find(event->tag);
    if(!tcpo)
       return;
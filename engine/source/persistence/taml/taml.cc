@@ -307,6 +307,41 @@ SimObject* Taml::read( const char* pFilename )
 
 //-----------------------------------------------------------------------------
 
+SimObject* Taml::read( TiXmlDocument& xmlDocument, const char* pFilename )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(Taml_ReadDocument);
+
+    // Sanity!
+    AssertFatal( pFilename != NULL, "Cannot read from a NULL filename." );
+
+    // Expand the file-name into the file-path buffer.
+    Con::expandPath( mFilePathBuffer, sizeof(mFilePathBuffer), pFilename );
+
+    // Reset the compilation.
+    resetCompilation();
+
+    // Create reader.
+    TamlXmlReader reader( this );
+
+    // Read object.
+    SimObject* pSimObject = reader.read( xmlDocument );
+
+    // Reset the compilation.
+    resetCompilation();
+
+    // Did we generate an object?
+    if ( pSimObject == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "Taml::read() - Failed to load an object from the document for file '%s'.", mFilePathBuffer );
+    }
+
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
 bool Taml::write( FileStream& stream, SimObject* pSimObject, const TamlFormatMode formatMode )
 {
     // Sanity!
@@ -748,28 +783,28 @@ void Taml::compileDynamicFields( TamlWriteNode* pTamlWriteNode )
     Vector<SimFieldDictionary::Entry*> dynamicFieldList(__FILE__, __LINE__);
 
     // Ensure the dynamic field doesn't conflict with static field.
-    for( U32 hashIndex = 0; hashIndex < SimFieldDictionary::HashTableSize; ++hashIndex )
+    for( SimFieldDictionaryIterator fieldItr( pFieldDictionary ); *fieldItr; ++fieldItr )
     {
-        for( SimFieldDictionary::Entry* pEntry = pFieldDictionary->mHashTable[hashIndex]; pEntry; pEntry = pEntry->next )
+        // Fetch entry.
+        SimFieldDictionary::Entry* pEntry = *fieldItr;
+
+        // Iterate static fields.
+        U32 fieldIndex;
+        for( fieldIndex = 0; fieldIndex < fieldCount; ++fieldIndex )
         {
-            // Iterate static fields.
-            U32 fieldIndex;
-            for( fieldIndex = 0; fieldIndex < fieldCount; ++fieldIndex )
-            {
-                if( fieldList[fieldIndex].pFieldname == pEntry->slotName)
-                    break;
-            }
+            if( fieldList[fieldIndex].pFieldname == pEntry->slotName)
+                break;
+        }
 
-            // Skip if found.
-            if( fieldIndex != (U32)fieldList.size() )
-                continue;
+        // Skip if found.
+        if( fieldIndex != (U32)fieldList.size() )
+            continue;
 
-            // Skip if not writing field.
-            if ( !pSimObject->writeField( pEntry->slotName, pEntry->value) )
-                continue;
+        // Skip if not writing field.
+        if ( !pSimObject->writeField( pEntry->slotName, pEntry->value) )
+            continue;
 
-            dynamicFieldList.push_back( pEntry );
-        }
+        dynamicFieldList.push_back( pEntry );
     }
 
     // Sort Entries to prevent version control conflicts
@@ -57,6 +57,10 @@
 
 //-----------------------------------------------------------------------------
 
+class TiXmlDocument;
+
+//-----------------------------------------------------------------------------
+
 extern StringTableEntry tamlRefIdName;
 extern StringTableEntry tamlRefToIdName;
 extern StringTableEntry tamlNamedObjectName;
@@ -184,6 +188,21 @@ public:
     }
     SimObject* read( const char* pFilename );
 
+    /// Read from an XML document that has already been parsed (potentially on another thread).
+    /// The filename is only used as the progenitor file.
+    template<typename T> inline T* read( TiXmlDocument& xmlDocument, const char* pFilename )
+    {
+        SimObject* pSimObject = read( xmlDocument, pFilename );
+        if ( pSimObject == NULL )
+            return NULL;
+        T* pObj = dynamic_cast<T*>( pSimObject );
+        if ( pObj != NULL )
+            return pObj;
+        pSimObject->deleteObject();
+        return NULL;
+    }
+    SimObject* read( TiXmlDocument& xmlDocument, const char* pFilename );
+
     /// Parse.
     bool parse( const char* pFilename, TamlVisitor& visitor );
 
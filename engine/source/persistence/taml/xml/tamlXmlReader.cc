@@ -43,6 +43,24 @@ SimObject* TamlXmlReader::read( FileStream& stream )
         return NULL;
     }
 
+    return read( xmlDocument );
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlXmlReader::read( TiXmlDocument& xmlDocument )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlReader_ReadDocument);
+
+    // Finish if there's no root element.
+    if ( xmlDocument.RootElement() == NULL )
+    {
+        // Warn!
+        Con::warnf("Taml: Could not read Taml XML document as it has no root element.");
+        return NULL;
+    }
+
     // Parse root element.
     SimObject* pSimObject = parseElement( xmlDocument.RootElement() );
 
@@ -50,6 +50,7 @@ public:
 
     /// Read.
     SimObject* read( FileStream& stream );
+    SimObject* read( TiXmlDocument& xmlDocument );
 
 private:
     Taml* mpTaml;
@@ -0,0 +1,134 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PLATFORM_THREADS_ATOMIC_H_
+#define _PLATFORM_THREADS_ATOMIC_H_
+
+#include "platform/types.h"
+
+#if defined(TORQUE_COMPILER_VISUALC)
+#include <intrin.h>
+#endif
+
+//-----------------------------------------------------------------------------
+/// Minimal ordered loads and stores for publishing data between threads
+/// without a Mutex.
+///
+/// A value written with dAtomicStoreRelease() guarantees that every write the
+/// storing thread made before it is visible to any thread that reads the value
+/// back with dAtomicLoadAcquire().  These are only intended for pointer-sized
+/// or smaller naturally aligned values.
+///
+/// dAtomicFetchAdd() adds to a 32-bit value and returns the previous value.
+//-----------------------------------------------------------------------------
+
+#if defined(TORQUE_COMPILER_GCC) && ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 7) || defined(__clang__))
+
+template<class T> inline T dAtomicLoadAcquire( T volatile const* pValue )
+{
+   return __atomic_load_n( pValue, __ATOMIC_ACQUIRE );
+}
+
+template<class T> inline void dAtomicStoreRelease( T volatile* pValue, const T value )
+{
+   __atomic_store_n( pValue, value, __ATOMIC_RELEASE );
+}
+
+inline U32 dAtomicFetchAdd( U32 volatile* pValue, const U32 value )
+{
+   return __atomic_fetch_add( pValue, value, __ATOMIC_ACQ_REL );
+}
+
+#elif defined(TORQUE_COMPILER_GCC)
+
+template<class T> inline T dAtomicLoadAcquire( T volatile const* pValue )
+{
+   const T value = *pValue;
+   __sync_synchronize();
+   return value;
+}
+
+template<class T> inline void dAtomicStoreRelease( T volatile* pValue, const T value )
+{
+   __sync_synchronize();
+   *pValue = value;
+}
+
+inline U32 dAtomicFetchAdd( U32 volatile* pValue, const U32 value )
+{
+   return __sync_fetch_and_add( pValue, value );
+}
+
+#elif defined(TORQUE_COMPILER_VISUALC)
+
+// Visual C++ gives volatile accesses acquire/release semantics on x86/x64 so
+// only the compiler needs fencing.  Other CPUs need a full barrier.
+template<class T> inline T dAtomicLoadAcquire( T volatile const* pValue )
+{
+   const T value = *pValue;
+#if defined(_M_IX86) || defined(_M_X64) || defined(_M_AMD64)
+   _ReadWriteBarrier();
+#else
+   __dmb( _ARM_BARRIER_ISH );
+#endif
+   return value;
+}
+
+template<class T> inline void dAtomicStoreRelease( T volatile* pValue, const T value )
+{
+#if defined(_M_IX86) || defined(_M_X64) || defined(_M_AMD64)
+   _ReadWriteBarrier();
+#else
+   __dmb( _ARM_BARRIER_ISH );
+#endif
+   *pValue = value;
+}
+
+inline U32 dAtomicFetchAdd( U32 volatile* pValue, const U32 value )
+{
+   return (U32)_InterlockedExchangeAdd( (volatile long*)pValue, (long)value );
+}
+
+#else
+
+// Unknown compiler so fall back to volatile accesses which are sufficient on
+// strongly ordered CPUs only.
+template<class T> inline T dAtomicLoadAcquire( T volatile const* pValue )
+{
+   return *pValue;
+}
+
+template<class T> inline void dAtomicStoreRelease( T volatile* pValue, const T value )
+{
+   *pValue = value;
+}
+
+inline U32 dAtomicFetchAdd( U32 volatile* pValue, const U32 value )
+{
+   const U32 previous = *pValue;
+   *pValue = previous + value;
+   return previous;
+}
+
+#endif
+
+#endif // _PLATFORM_THREADS_ATOMIC_H_
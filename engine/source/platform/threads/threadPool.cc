@@ -0,0 +1,206 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "platform/platform.h"
+#include "platform/threads/threadPool.h"
+#include "console/console.h"
+#include "math/mMathFn.h"
+
+//-----------------------------------------------------------------------------
+
+ThreadPool* ThreadPool::smGlobalThreadPool = NULL;
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::WorkerThread::run( void* arg )
+{
+   while( true )
+   {
+      // Wait for work.
+      mpThreadPool->mWorkSemaphore.acquire();
+
+      // Finish if the pool is shutting down.
+      if ( checkForStop() || mpThreadPool->mShutdown )
+         return;
+
+      // Help with the current job.
+      mpThreadPool->processChunks();
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+ThreadPool::ThreadPool( const U32 workerCount ) :
+   mWorkSemaphore( 0 ),
+   mCompleteSemaphore( 0 ),
+   mShutdown( false ),
+   mJobActive( false ),
+   mpFunction( NULL ),
+   mpContext( NULL ),
+   mItemCount( 0 ),
+   mChunkSize( 0 ),
+   mChunkCount( 0 ),
+   mNextChunk( 0 ),
+   mPendingChunks( 0 )
+{
+   VECTOR_SET_ASSOCIATION( mWorkers );
+
+   // Start the workers.
+   for ( U32 n = 0; n < workerCount; ++n )
+   {
+      WorkerThread* pWorker = new WorkerThread( this );
+      mWorkers.push_back( pWorker );
+      pWorker->start();
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+ThreadPool::~ThreadPool()
+{
+   AssertFatal( !mJobActive, "ThreadPool::~ThreadPool() - Cannot destroy the pool whilst a job is active." );
+
+   // Flag shutdown and wake all the workers.
+   mShutdown = true;
+   for ( S32 n = 0; n < mWorkers.size(); ++n )
+   {
+      mWorkers[n]->stop();
+      mWorkSemaphore.release();
+   }
+
+   // Wait for the workers to finish.
+   for ( S32 n = 0; n < mWorkers.size(); ++n )
+   {
+      mWorkers[n]->join();
+      delete mWorkers[n];
+   }
+
+   mWorkers.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::parallelFor( const U32 itemCount, const U32 chunkSize, ThreadPoolRangeFunction pFunction, void* pContext )
+{
+   // Sanity!
+   AssertFatal( pFunction != NULL, "ThreadPool::parallelFor() - Invalid range function." );
+   AssertFatal( !mJobActive, "ThreadPool::parallelFor() - Jobs cannot be nested." );
+
+   // Finish if nothing to do.
+   if ( itemCount == 0 )
+      return;
+
+   const U32 clampedChunkSize = chunkSize == 0 ? 1 : chunkSize;
+
+   // Run serially if there are no workers or only a single chunk.
+   if ( mWorkers.size() == 0 || itemCount <= clampedChunkSize )
+   {
+      pFunction( pContext, 0, itemCount );
+      return;
+   }
+
+   // Publish the job.
+   mJobMutex.lock();
+   mJobActive     = true;
+   mpFunction     = pFunction;
+   mpContext      = pContext;
+   mItemCount     = itemCount;
+   mChunkSize     = clampedChunkSize;
+   mChunkCount    = (itemCount + clampedChunkSize - 1) / clampedChunkSize;
+   mNextChunk     = 0;
+   mPendingChunks = mChunkCount;
+   mJobMutex.unlock();
+
+   // Wake enough workers for the chunks (the calling thread takes one share).
+   const U32 wakeCount = getMin( (U32)mWorkers.size(), mChunkCount - 1 );
+   for ( U32 n = 0; n < wakeCount; ++n )
+      mWorkSemaphore.release();
+
+   // Help with the job.
+   processChunks();
+
+   // Wait for the last chunk to complete.
+   mCompleteSemaphore.acquire();
+
+   mJobMutex.lock();
+   mJobActive = false;
+   mpFunction = NULL;
+   mpContext  = NULL;
+   mJobMutex.unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::processChunks( void )
+{
+   while( true )
+   {
+      // Claim the next chunk.
+      mJobMutex.lock();
+
+      if ( !mJobActive || mNextChunk >= mChunkCount )
+      {
+         mJobMutex.unlock();
+         return;
+      }
+
+      const U32 start = mNextChunk++ * mChunkSize;
+      const U32 end = getMin( start + mChunkSize, mItemCount );
+      ThreadPoolRangeFunction pFunction = mpFunction;
+      void* pContext = mpContext;
+
+      mJobMutex.unlock();
+
+      // Process the chunk.
+      pFunction( pContext, start, end );
+
+      // Retire the chunk.
+      mJobMutex.lock();
+      const bool jobComplete = --mPendingChunks == 0;
+      mJobMutex.unlock();
+
+      // Signal the submitter if this was the last chunk.
+      if ( jobComplete )
+         mCompleteSemaphore.release();
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+ThreadPool* ThreadPool::getGlobalThreadPool( void )
+{
+   if ( smGlobalThreadPool == NULL )
+   {
+      const S32 workerCount = Con::getIntVariable( "$pref::ThreadPool::workerCount", 3 );
+      smGlobalThreadPool = new ThreadPool( workerCount > 0 ? (U32)workerCount : 0 );
+   }
+
+   return smGlobalThreadPool;
+}
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::shutdownGlobalThreadPool( void )
+{
+   delete smGlobalThreadPool;
+   smGlobalThreadPool = NULL;
+}
@@ -0,0 +1,109 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#define _PLATFORM_THREADS_THREADPOOL_H_
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Function called for a contiguous range of items [start, end) of a parallel job.
+typedef void (*ThreadPoolRangeFunction)( void* pContext, const U32 start, const U32 end );
+
+//-----------------------------------------------------------------------------
+
+/// A fixed set of worker threads used to split data-parallel loops across cores.
+///
+/// Work is submitted with parallelFor() which splits the item range into chunks
+/// and blocks until every chunk has been processed.  The calling thread takes part
+/// in processing the chunks so a pool with no workers simply runs the job serially.
+///
+/// Only a single job can be in flight at any one time and jobs must be submitted
+/// from the same thread.  The range function is called from worker threads so it
+/// must not touch the console, the simulation or anything else that is not thread-safe.
+///
+/// @code
+/// static void integrateRange( void* pContext, const U32 start, const U32 end )
+/// {
+///    MyItem* pItems = static_cast<MyItem*>( pContext );
+///    for ( U32 i = start; i < end; ++i )
+///       pItems[i].integrate();
+/// }
+///
+/// ThreadPool::getGlobalThreadPool()->parallelFor( itemCount, 64, &integrateRange, pItems );
+/// @endcode
+class ThreadPool
+{
+private:
+   class WorkerThread : public Thread
+   {
+   public:
+      WorkerThread( ThreadPool* pThreadPool ) : Thread( 0, 0, false ), mpThreadPool( pThreadPool ) {}
+      virtual void run( void* arg = 0 );
+
+   private:
+      ThreadPool* mpThreadPool;
+   };
+
+   Vector<WorkerThread*>   mWorkers;
+   Mutex                   mJobMutex;
+   Semaphore               mWorkSemaphore;
+   Semaphore               mCompleteSemaphore;
+   bool                    mShutdown;
+   bool                    mJobActive;
+
+   /// Current job.
+   ThreadPoolRangeFunction mpFunction;
+   void*                   mpContext;
+   U32                     mItemCount;
+   U32                     mChunkSize;
+   U32                     mChunkCount;
+   U32                     mNextChunk;
+   U32                     mPendingChunks;
+
+   void                    processChunks( void );
+
+   static ThreadPool*      smGlobalThreadPool;
+
+public:
+   ThreadPool( const U32 workerCount );
+   ~ThreadPool();
+
+   /// Process items [0, itemCount) in chunks of "chunkSize" items across the pool.
+   /// Returns once all items have been processed.
+   void                    parallelFor( const U32 itemCount, const U32 chunkSize, ThreadPoolRangeFunction pFunction, void* pContext );
+
+   inline U32              getWorkerCount( void ) const { return (U32)mWorkers.size(); }
+
+   /// The global pool is created on first use with "$pref::ThreadPool::workerCount" workers.
+   static ThreadPool*      getGlobalThreadPool( void );
+   static void             shutdownGlobalThreadPool( void );
+};
+
+#endif // _PLATFORM_THREADS_THREADPOOL_H_
@@ -709,12 +709,14 @@ Net::Error Net::setBlocking(NetSocket socket, bool blockingIO)
    return getLastError();
 }
 
-Net::Error Net::send(NetSocket socket, const U8 *buffer, S32 bufferSize)
+Net::Error Net::send(NetSocket socket, const U8 *buffer, S32 bufferSize, S32 *bytesSent)
 {
    S32 error = ::send(socket, (const char*)buffer, bufferSize, 0);
-   if(!error)
-      return NoError;
-   return getLastError();
+   if(error == SOCKET_ERROR)
+      return getLastError();
+   if(bytesSent)
+      *bytesSent = error;
+   return NoError;
 }
 
 Net::Error Net::recv(NetSocket socket, U8 *buffer, S32 bufferSize, S32 *bytesRead)
@@ -780,7 +780,7 @@ Net::Error Net::setBlocking(NetSocket socket, bool blockingIO)
    return getLastError();   
 }
 
-Net::Error Net::send(NetSocket socket, const U8 *buffer, S32 bufferSize)
+Net::Error Net::send(NetSocket socket, const U8 *buffer, S32 bufferSize, S32 *bytesSent)
 {
    // Poll for write status.  this blocks.  should really
    // do this in a separate thread or set it up so that the data can
@@ -790,7 +790,11 @@ Net::Error Net::send(NetSocket socket, const U8 *buffer, S32 bufferSize)
 
    S32 error = ::send(socket, (const char*)buffer, bufferSize, 0);
    if(error != -1)
+   {
+      if(bytesSent)
+         *bytesSent = error;
       return NoError;
+   }
 
    return getLastError();
 }
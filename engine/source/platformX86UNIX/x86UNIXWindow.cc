@@ -44,6 +44,10 @@
 #include "platformX86UNIX/x86UNIXOGLVideo.h"
 #include "platformX86UNIX/x86UNIXState.h"
 
+#ifdef TORQUE_BENCHMARK
+#include "2d/scene/SceneBenchmark.h"
+#endif
+
 #ifndef DEDICATED
 #include "platformX86UNIX/x86UNIXInputManager.h"
 
@@ -649,6 +653,11 @@ int main(S32 argc, const char **argv)
    // init process control stuff 
    ProcessControlInit();
 
+#ifdef TORQUE_BENCHMARK
+   // run the scene benchmark without a window or video device
+   x86UNIXState->setDedicated(true);
+   returnVal = SceneBenchmark::runHeadless(argc, argv);
+#else
    Game->mainInitialize(argc, argv);
   
    // run the game
@@ -658,6 +667,7 @@ int main(S32 argc, const char **argv)
    }
 
    Game->mainShutdown();
+#endif
 
    // dispose of command line
    for(U32 i = 0; i < newCommandLine.size(); i++)
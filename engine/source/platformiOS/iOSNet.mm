@@ -775,12 +775,14 @@ Net::Error Net::setBlocking(NetSocket socket, bool blockingIO)
    return getLastError();
 }
 
-Net::Error Net::send(NetSocket socket, const U8 *buffer, S32 bufferSize)
+Net::Error Net::send(NetSocket socket, const U8 *buffer, S32 bufferSize, S32 *bytesSent)
 {
    errno = 0;
    S32 bytesWritten = ::send(socket, (const char*)buffer, bufferSize, 0);
    if(bytesWritten == -1)
       Con::errorf("Could not write to socket. Error: %s",strerror(errno));
+   else if(bytesSent)
+      *bytesSent = bytesWritten;
    
    return getLastError();
 }
@@ -162,6 +162,10 @@ namespace Sim
 
    SimObject* findObject(SimObjectId);
    SimObject* findObject(const char* name);
+
+   /// Find an object by id only if it is still the registration with the
+   /// given SimObject::getIdGeneration().
+   SimObject* findObject(SimObjectId id, U32 generation);
    template<class T> inline bool findObject(SimObjectId id,T*&t)
    {
       t = dynamic_cast<T*>(findObject(id));
@@ -25,231 +25,363 @@
 
 //----------------------------------------------------------------------------
 //----------------------------------------------------------------------------
-extern U32 HashPointer(StringTableEntry e);
 
-SimNameDictionary::SimNameDictionary()
+#define SIMOBJECTTABLE_EMPTY_KEY       ((SimObjectTable::Key)0)
+#define SIMOBJECTTABLE_TOMBSTONE_KEY   ((SimObjectTable::Key)~(size_t)0)
+
+SimObjectTable::Table* SimObjectTable::smRetiredTables = NULL;
+Mutex SimObjectTable::smRetiredMutex;
+
+SimObjectTable::SimObjectTable()
 {
-   hashTable = NULL;
-   mutex = Mutex::createMutex();
+   mCurrent = NULL;
+   mMigrating = NULL;
+   mMigrateIndex = 0;
+   mItemCount = 0;
+   mUsedCount = 0;
 }
 
-SimNameDictionary::~SimNameDictionary()
+SimObjectTable::~SimObjectTable()
 {
-   delete[] hashTable;
-   Mutex::destroyMutex(mutex);
+   if(mCurrent)
+   {
+      delete [] mCurrent->slots;
+      delete mCurrent;
+   }
+
+   if(mMigrating)
+   {
+      delete [] mMigrating->slots;
+      delete mMigrating;
+   }
 }
 
-void SimNameDictionary::insert(SimObject* obj)
+U32 SimObjectTable::hashKey(Key key)
 {
-   if(!obj->objectName)
-      return;
+   // Mix the bits so sequential ids and aligned pointers spread across the slots.
+   const U64 value = (U64)(size_t)key;
+   U32 hash = U32(value) ^ U32(value >> 32);
+   hash ^= hash >> 16;
+   hash *= 0x85ebca6b;
+   hash ^= hash >> 13;
+   hash *= 0xc2b2ae35;
+   hash ^= hash >> 16;
+   return hash;
+}
+
+SimObjectTable::Table* SimObjectTable::createTable(const U32 slotCount)
+{
+   Table* pTable = new Table;
+   pTable->slots = new Slot[slotCount];
+   pTable->mask = slotCount - 1;
+   pTable->retired = NULL;
 
-   Mutex::lockMutex(mutex);
-   
-   if(!hashTable)
+   for(U32 i = 0; i < slotCount; i++)
    {
-      hashTable = new SimObject *[DefaultTableSize];
-      hashTableSize = DefaultTableSize;
-      hashEntryCount = 0;
-      S32 i;
-      for(i = 0; i < hashTableSize; i++)
-         hashTable[i] = NULL;
+      pTable->slots[i].key = SIMOBJECTTABLE_EMPTY_KEY;
+      pTable->slots[i].object = NULL;
    }
-   S32 idx = HashPointer(obj->objectName) % hashTableSize;
-   obj->nextNameObject = hashTable[idx];
-   hashTable[idx] = obj;
-   hashEntryCount++;
-   if(hashEntryCount > hashTableSize)
+
+   return pTable;
+}
+
+void SimObjectTable::retireTable(Table* pTable)
+{
+   // Lookups may still be searching the table so keep it until reclaim().
+   smRetiredMutex.lock();
+   pTable->retired = smRetiredTables;
+   smRetiredTables = pTable;
+   smRetiredMutex.unlock();
+}
+
+void SimObjectTable::reclaim()
+{
+   smRetiredMutex.lock();
+   Table* pTable = smRetiredTables;
+   smRetiredTables = NULL;
+   smRetiredMutex.unlock();
+
+   while(pTable)
    {
-      // resize the hash table
-      S32 i;
-      SimObject *head = NULL, *walk, *temp;
-   	for(i = 0; i < hashTableSize; i++) {
-   		walk = hashTable[i];
-         while(walk)
-         {
-            temp = walk->nextNameObject;
-            walk->nextNameObject = head;
-            head = walk;
-            walk = temp;
-         }
-   	}
-      delete[] hashTable;
-      hashTableSize = hashTableSize * 2 + 1;
-      hashTable = new SimObject *[hashTableSize];
-
-      for(i = 0; i < hashTableSize;i++)
-         hashTable[i] = NULL;
-      while(head)
-      {
-         temp = head->nextNameObject;
-         idx = HashPointer(head->objectName) % hashTableSize;
-         head->nextNameObject = hashTable[idx];
-         hashTable[idx] = head;
-         head = temp;
-      }
+      Table* pNext = pTable->retired;
+      delete [] pTable->slots;
+      delete pTable;
+      pTable = pNext;
    }
-   Mutex::unlockMutex(mutex);
 }
 
-SimObject* SimNameDictionary::find(StringTableEntry name)
+SimObject* SimObjectTable::findInTable(const Table* pTable, Key key, const U32 hash)
 {
-   // NULL is a valid lookup - it will always return NULL
-   if(!hashTable)
-      return NULL;
-      
-   Mutex::lockMutex(mutex);
-
-   S32 idx = HashPointer(name) % hashTableSize;
-   SimObject *walk = hashTable[idx];
-   while(walk)
+   const U32 mask = pTable->mask;
+   for(U32 probe = 0, index = hash & mask; probe <= mask; probe++, index = (index + 1) & mask)
    {
-      if(walk->objectName == name)
-      {
-         Mutex::unlockMutex(mutex);
-         return walk;
-      }
-      walk = walk->nextNameObject;
+      const Slot& slot = pTable->slots[index];
+      const Key slotKey = dAtomicLoadAcquire(&slot.key);
+
+      if(slotKey == SIMOBJECTTABLE_EMPTY_KEY)
+         return NULL;
+
+      if(slotKey != key)
+         continue;
+
+      // The slot may have been removed and reused while reading the object.
+      SimObject* pObject = dAtomicLoadAcquire(&slot.object);
+      return dAtomicLoadAcquire(&slot.key) == key ? pObject : NULL;
    }
 
-   Mutex::unlockMutex(mutex);
    return NULL;
 }
 
-void SimNameDictionary::remove(SimObject* obj)
+SimObjectTable::Slot* SimObjectTable::findSlot(Table* pTable, Key key, const U32 hash)
 {
-   if(!obj->objectName)
-      return;
+   const U32 mask = pTable->mask;
+   for(U32 probe = 0, index = hash & mask; probe <= mask; probe++, index = (index + 1) & mask)
+   {
+      Slot& slot = pTable->slots[index];
 
-   Mutex::lockMutex(mutex);
+      if(slot.key == SIMOBJECTTABLE_EMPTY_KEY)
+         return NULL;
 
-   SimObject **walk = &hashTable[HashPointer(obj->objectName) % hashTableSize];
-   while(*walk)
+      if(slot.key == key)
+         return &slot;
+   }
+
+   return NULL;
+}
+
+void SimObjectTable::insertSlot(Key key, const U32 hash, SimObject* pObject)
+{
+   const U32 mask = mCurrent->mask;
+   for(U32 index = hash & mask;; index = (index + 1) & mask)
    {
-      if(*walk == obj)
-      {
-         *walk = obj->nextNameObject;
-			obj->nextNameObject = (SimObject*)-1;
-         hashEntryCount--;
+      Slot& slot = mCurrent->slots[index];
 
-         Mutex::unlockMutex(mutex);
-         return;
-      }
-      walk = &((*walk)->nextNameObject);
-   }
+      if(slot.key != SIMOBJECTTABLE_EMPTY_KEY && slot.key != SIMOBJECTTABLE_TOMBSTONE_KEY)
+         continue;
 
-   Mutex::unlockMutex(mutex);
-}	
+      if(slot.key == SIMOBJECTTABLE_EMPTY_KEY)
+         mUsedCount++;
 
-//----------------------------------------------------------------------------
+      // Publish the object before the key.
+      dAtomicStoreRelease(&slot.object, pObject);
+      dAtomicStoreRelease(&slot.key, key);
+      return;
+   }
+}
 
-SimManagerNameDictionary::SimManagerNameDictionary()
+void SimObjectTable::migrateStep(const U32 slotCount)
 {
-   hashTable = new SimObject *[DefaultTableSize];
-   hashTableSize = DefaultTableSize;
-   hashEntryCount = 0;
-   S32 i;
-   for(i = 0; i < hashTableSize; i++)
-      hashTable[i] = NULL;
-   mutex = Mutex::createMutex();
+   Table* pMigrating = mMigrating;
+   if(!pMigrating)
+      return;
+
+   const U32 end = getMin(mMigrateIndex + slotCount, pMigrating->mask + 1);
+   for(; mMigrateIndex < end; mMigrateIndex++)
+   {
+      Slot& slot = pMigrating->slots[mMigrateIndex];
+
+      if(slot.key == SIMOBJECTTABLE_EMPTY_KEY || slot.key == SIMOBJECTTABLE_TOMBSTONE_KEY)
+         continue;
+
+      // Copy the slot before removing it so lookups always find it in one of the tables.
+      insertSlot(slot.key, hashKey(slot.key), slot.object);
+      dAtomicStoreRelease(&slot.key, SIMOBJECTTABLE_TOMBSTONE_KEY);
+   }
+
+   if(mMigrateIndex > pMigrating->mask)
+   {
+      dAtomicStoreRelease(&mMigrating, (Table*)NULL);
+      retireTable(pMigrating);
+   }
 }
 
-SimManagerNameDictionary::~SimManagerNameDictionary()
+void SimObjectTable::insert(Key key, const U32 hash, SimObject* pObject, Link link)
 {
-   delete[] hashTable;
-   Mutex::destroyMutex(mutex);
+   AssertFatal(key != SIMOBJECTTABLE_EMPTY_KEY && key != SIMOBJECTTABLE_TOMBSTONE_KEY, "SimObjectTable::insert - Invalid key.");
+
+   mMutex.lock();
+
+   if(!mCurrent)
+      dAtomicStoreRelease(&mCurrent, createTable(DefaultTableSize));
+
+   migrateStep(MigrateStepSlots);
+
+   // Objects sharing a key are chained behind the newest object.
+   Slot* pSlot = mMigrating ? findSlot(mMigrating, key, hash) : NULL;
+   if(!pSlot)
+      pSlot = findSlot(mCurrent, key, hash);
+
+   if(pSlot)
+   {
+      AssertFatal(pSlot->object != pObject, "SimObjectTable::insert - Creating Infinite Loop linking to self!");
+      pObject->*link = pSlot->object;
+      dAtomicStoreRelease(&pSlot->object, pObject);
+      mMutex.unlock();
+      return;
+   }
+
+   pObject->*link = NULL;
+
+   // Grow once half the slots are used, counting removed slots, to keep probes short.
+   if((mUsedCount + 1) * 2 > mCurrent->mask + 1)
+   {
+      if(mMigrating)
+         migrateStep(mMigrating->mask + 1);
+
+      U32 slotCount = DefaultTableSize;
+      while(slotCount < (mItemCount + 1) * 4)
+         slotCount <<= 1;
+
+      // Lookups see the migrating slots before the new current slots.
+      dAtomicStoreRelease(&mMigrating, mCurrent);
+      mMigrateIndex = 0;
+      mUsedCount = 0;
+      dAtomicStoreRelease(&mCurrent, createTable(slotCount));
+   }
+
+   insertSlot(key, hash, pObject);
+   mItemCount++;
+
+   mMutex.unlock();
 }
 
-void SimManagerNameDictionary::insert(SimObject* obj)
+bool SimObjectTable::remove(Key key, const U32 hash, SimObject* pObject, Link link)
 {
-   if(!obj->objectName)
-      return;
+   mMutex.lock();
+
+   if(!mCurrent)
+   {
+      mMutex.unlock();
+      return false;
+   }
+
+   migrateStep(MigrateStepSlots);
 
-   Mutex::lockMutex(mutex);
+   Slot* pSlot = mMigrating ? findSlot(mMigrating, key, hash) : NULL;
+   if(!pSlot)
+      pSlot = findSlot(mCurrent, key, hash);
 
-   S32 idx = HashPointer(obj->objectName) % hashTableSize;
-   obj->nextManagerNameObject = hashTable[idx];
-   hashTable[idx] = obj;
-   hashEntryCount++;
-   if(hashEntryCount > hashTableSize)
+   bool removed = false;
+   if(pSlot)
    {
-      // resize the hash table
-      S32 i;
-      SimObject *head = NULL, *walk, *temp;
-   	for(i = 0; i < hashTableSize; i++) {
-   		walk = hashTable[i];
-         while(walk)
+      if(pSlot->object == pObject)
+      {
+         // Promote the next newest object sharing the key or remove the slot.
+         SimObject* pNext = pObject->*link;
+         if(pNext)
+            dAtomicStoreRelease(&pSlot->object, pNext);
+         else
          {
-            temp = walk->nextManagerNameObject;
-            walk->nextManagerNameObject = head;
-            head = walk;
-            walk = temp;
+            dAtomicStoreRelease(&pSlot->key, SIMOBJECTTABLE_TOMBSTONE_KEY);
+            mItemCount--;
          }
-   	}
-      delete[] hashTable;
-      hashTableSize = hashTableSize * 2 + 1;
-      hashTable = new SimObject *[hashTableSize];
-
-      for(i = 0; i < hashTableSize;i++)
-         hashTable[i] = NULL;
-      while(head)
+         removed = true;
+      }
+      else
       {
-         temp = head->nextManagerNameObject;
-         idx = HashPointer(head->objectName) % hashTableSize;
-         head->nextManagerNameObject = hashTable[idx];
-         hashTable[idx] = head;
-         head = temp;
+         for(SimObject** pWalk = &(pSlot->object->*link); *pWalk; pWalk = &((*pWalk)->*link))
+         {
+            if(*pWalk == pObject)
+            {
+               *pWalk = pObject->*link;
+               removed = true;
+               break;
+            }
+         }
       }
    }
-   
-   Mutex::unlockMutex(mutex);
+
+   mMutex.unlock();
+   return removed;
 }
 
-SimObject* SimManagerNameDictionary::find(StringTableEntry name)
+SimObject* SimObjectTable::find(Key key, const U32 hash) const
 {
-   // NULL is a valid lookup - it will always return NULL
-
-   Mutex::lockMutex(mutex);
+   if(key == SIMOBJECTTABLE_EMPTY_KEY || key == SIMOBJECTTABLE_TOMBSTONE_KEY)
+      return NULL;
 
-   S32 idx = HashPointer(name) % hashTableSize;
-   SimObject *walk = hashTable[idx];
-   while(walk)
+   for(;;)
    {
-      if(walk->objectName == name)
-      {
-         Mutex::unlockMutex(mutex);
-         return walk;
-      }
-      walk = walk->nextManagerNameObject;
+      Table* pCurrent = dAtomicLoadAcquire(&mCurrent);
+      Table* pMigrating = dAtomicLoadAcquire(&mMigrating);
+
+      if(!pCurrent)
+         return NULL;
+
+      // Slots are copied to the current table before they are removed from
+      // the migrating table, so search the migrating table first.
+      SimObject* pObject = pMigrating ? findInTable(pMigrating, key, hash) : NULL;
+      if(pObject)
+         return pObject;
+
+      pObject = findInTable(pCurrent, key, hash);
+      if(pObject)
+         return pObject;
+
+      // Search again if the table grew while searching.
+      if(dAtomicLoadAcquire(&mCurrent) == pCurrent && dAtomicLoadAcquire(&mMigrating) == pMigrating)
+         return NULL;
    }
+}
 
-   Mutex::unlockMutex(mutex);
-   return NULL;
+//----------------------------------------------------------------------------
+//----------------------------------------------------------------------------
+
+void SimNameDictionary::insert(SimObject* obj)
+{
+   if(!obj->objectName)
+      return;
+
+   mTable.insert(obj->objectName, SimObjectTable::hashKey(obj->objectName), obj, &SimObject::nextNameObject);
 }
 
-void SimManagerNameDictionary::remove(SimObject* obj)
+SimObject* SimNameDictionary::find(StringTableEntry name)
+{
+   // NULL is a valid lookup - it will always return NULL
+   if(!name)
+      return NULL;
+
+   return mTable.find(name, SimObjectTable::hashKey(name));
+}
+
+void SimNameDictionary::remove(SimObject* obj)
 {
    if(!obj->objectName)
       return;
 
-   Mutex::lockMutex(mutex);
+   if(mTable.remove(obj->objectName, SimObjectTable::hashKey(obj->objectName), obj, &SimObject::nextNameObject))
+      obj->nextNameObject = (SimObject*)-1;
+}	
 
-   SimObject **walk = &hashTable[HashPointer(obj->objectName) % hashTableSize];
-   while(*walk)
-   {
-      if(*walk == obj)
-      {
-         *walk = obj->nextManagerNameObject;
-			obj->nextManagerNameObject = (SimObject*)-1;
-         hashEntryCount--;
+//----------------------------------------------------------------------------
 
-         Mutex::unlockMutex(mutex);
-         return;
-      }
-      walk = &((*walk)->nextManagerNameObject);
-   }
+void SimManagerNameDictionary::insert(SimObject* obj)
+{
+   if(!obj->objectName)
+      return;
+
+   const U32 hash = SimObjectTable::hashKey(obj->objectName);
+   mShards[hash >> ShardShift].insert(obj->objectName, hash, obj, &SimObject::nextManagerNameObject);
+}
+
+SimObject* SimManagerNameDictionary::find(StringTableEntry name)
+{
+   // NULL is a valid lookup - it will always return NULL
+   if(!name)
+      return NULL;
+
+   const U32 hash = SimObjectTable::hashKey(name);
+   return mShards[hash >> ShardShift].find(name, hash);
+}
+
+void SimManagerNameDictionary::remove(SimObject* obj)
+{
+   if(!obj->objectName)
+      return;
 
-   Mutex::unlockMutex(mutex);
+   const U32 hash = SimObjectTable::hashKey(obj->objectName);
+   if(mShards[hash >> ShardShift].remove(obj->objectName, hash, obj, &SimObject::nextManagerNameObject))
+      obj->nextManagerNameObject = (SimObject*)-1;
 }	
 
 //---------------------------------------------------------------------------
@@ -257,62 +389,37 @@ void SimManagerNameDictionary::remove(SimObject* obj)
 
 SimIdDictionary::SimIdDictionary()
 {
-   for(S32 i = 0; i < DefaultTableSize; i++)
-      table[i] = NULL;
-   mutex = Mutex::createMutex();
-}
-
-SimIdDictionary::~SimIdDictionary()
-{
-   Mutex::destroyMutex(mutex);
+   mNextGeneration = 1;
 }
 
 void SimIdDictionary::insert(SimObject* obj)
 {
-   Mutex::lockMutex(mutex);
-
-   S32 idx = obj->getId() & TableBitMask;
-   obj->nextIdObject = table[idx];
-   AssertFatal( obj->nextIdObject != obj, "SimIdDictionary::insert - Creating Infinite Loop linking to self!" );
-   table[idx] = obj;
+   const SimObjectTable::Key key = (SimObjectTable::Key)(size_t)obj->getId();
 
-   Mutex::unlockMutex(mutex);
+   obj->mIdGeneration = dAtomicFetchAdd(&mNextGeneration, 1);
+   mShards[obj->getId() & ShardMask].insert(key, SimObjectTable::hashKey(key), obj, &SimObject::nextIdObject);
 }
 
 SimObject* SimIdDictionary::find(S32 id)
 {
-   Mutex::lockMutex(mutex);
+   const SimObjectTable::Key key = (SimObjectTable::Key)(size_t)U32(id);
 
-   S32 idx = id & TableBitMask;
-   SimObject *walk = table[idx];
-   while(walk)
-   {
-      if(walk->getId() == U32(id))
-      {
-         Mutex::unlockMutex(mutex);
-         return walk;
-      }
-      walk = walk->nextIdObject;
-   }
+   return mShards[U32(id) & ShardMask].find(key, SimObjectTable::hashKey(key));
+}
 
-   Mutex::unlockMutex(mutex);
+SimObject* SimIdDictionary::find(S32 id, U32 generation)
+{
+   SimObject* obj = find(id);
 
-   return NULL;
+   return obj && obj->mIdGeneration == generation ? obj : NULL;
 }
 
 void SimIdDictionary::remove(SimObject* obj)
 {
-   Mutex::lockMutex(mutex);
+   const SimObjectTable::Key key = (SimObjectTable::Key)(size_t)obj->getId();
 
-   SimObject **walk = &table[obj->getId() & TableBitMask];
-   while(*walk && *walk != obj)
-      walk = &((*walk)->nextIdObject);
-   if(*walk)
-      *walk = obj->nextIdObject;
-
-   Mutex::unlockMutex(mutex);
+   mShards[obj->getId() & ShardMask].remove(key, SimObjectTable::hashKey(key), obj, &SimObject::nextIdObject);
 }
 
 //---------------------------------------------------------------------------
 //---------------------------------------------------------------------------
-
@@ -33,55 +33,115 @@
 #include "platform/threads/mutex.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_ATOMIC_H_
+#include "platform/threads/atomic.h"
+#endif
+
 class SimObject;
 
 //----------------------------------------------------------------------------
-/// Map of names to SimObjects
+/// Open addressed table of SimObjects used by the Sim dictionaries.
 ///
-/// Provides fast lookup for name->object and
-/// for fast removal of an object given object*
-class SimNameDictionary
+/// Writers hold the table mutex but lookups never lock.  A slot publishes its
+/// object before its key with release stores and a lookup re-checks the key
+/// after reading the object.  Objects sharing a key are chained through a link
+/// on the object, with the newest object in the slot, so lookups never follow
+/// object pointers.
+///
+/// Growing the table allocates a larger slot array and migrates the old slots
+/// into it a few at a time on later writes, with lookups searching both arrays
+/// until the migration completes.  Old arrays are freed by reclaim() which
+/// is called from Sim::advanceToTime(), so lookups from other threads must not
+/// span a Sim time advance.
+class SimObjectTable
 {
+public:
+   typedef const void* Key;
+   typedef SimObject* SimObject::*Link;
+
+private:
+   struct Slot
+   {
+      Key         key;
+      SimObject*  object;
+   };
+
+   struct Table
+   {
+      Slot*    slots;
+      U32      mask;
+      Table*   retired;
+   };
+
    enum
    {
-      DefaultTableSize = 29
+      DefaultTableSize = 16,
+      MigrateStepSlots = 8
    };
 
-   SimObject **hashTable;  // hash the pointers of the names...
-   S32 hashTableSize;
-   S32 hashEntryCount;
+   Table*   mCurrent;
+   Table*   mMigrating;
+   U32      mMigrateIndex;
+   U32      mItemCount;
+   U32      mUsedCount;
+   Mutex    mMutex;
 
-   void *mutex;
+   static Table*  smRetiredTables;
+   static Mutex   smRetiredMutex;
+
+   static Table* createTable( const U32 slotCount );
+   static void retireTable( Table* pTable );
+   static SimObject* findInTable( const Table* pTable, Key key, const U32 hash );
+   static Slot* findSlot( Table* pTable, Key key, const U32 hash );
+   void insertSlot( Key key, const U32 hash, SimObject* pObject );
+   void migrateStep( const U32 slotCount );
+
+public:
+   SimObjectTable();
+   ~SimObjectTable();
+
+   void insert( Key key, const U32 hash, SimObject* pObject, Link link );
+   bool remove( Key key, const U32 hash, SimObject* pObject, Link link );
+   SimObject* find( Key key, const U32 hash ) const;
+
+   inline U32 getItemCount( void ) const { return mItemCount; }
+
+   static U32 hashKey( Key key );
+
+   /// Free the slot arrays left over from growing tables.
+   static void reclaim( void );
+};
+
+//----------------------------------------------------------------------------
+/// Map of names to SimObjects
+///
+/// Provides fast lookup for name->object and
+/// for fast removal of an object given object*
+class SimNameDictionary
+{
+   SimObjectTable mTable;
 
 public:
    void insert(SimObject* obj);
    void remove(SimObject* obj);
    SimObject* find(StringTableEntry name);
-
-   SimNameDictionary();
-   ~SimNameDictionary();
 };
 
+/// Global map of names to SimObjects, split into independently locked shards.
 class SimManagerNameDictionary
 {
    enum
    {
-      DefaultTableSize = 29
+      ShardCount = 16,
+      ShardShift = 28
    };
 
-   SimObject **hashTable;  // hash the pointers of the names...
-   S32 hashTableSize;
-   S32 hashEntryCount;
-
-   void *mutex;
+   SimObjectTable mShards[ShardCount];
 
 public:
    void insert(SimObject* obj);
    void remove(SimObject* obj);
    SimObject* find(StringTableEntry name);
-
-   SimManagerNameDictionary();
-   ~SimManagerNameDictionary();
 };
 
 //----------------------------------------------------------------------------
@@ -89,24 +149,30 @@ public:
 ///
 /// Provides fast lookup for ID->object and
 /// for fast removal of an object given object*
+///
+/// Each insert gives the object a new generation so an id and generation pair
+/// identifies one registration of an object even when an id is reused.
 class SimIdDictionary
 {
    enum
    {
-      DefaultTableSize = 4096,
-      TableBitMask = 4095
+      ShardCount = 16,
+      ShardMask = ShardCount - 1
    };
-   SimObject *table[DefaultTableSize];
 
-   void *mutex;
+   SimObjectTable mShards[ShardCount];
+
+   volatile U32 mNextGeneration;
 
 public:
    void insert(SimObject* obj);
    void remove(SimObject* obj);
    SimObject* find(S32 id);
 
+   /// Find an object only if it still has the given generation.
+   SimObject* find(S32 id, U32 generation);
+
    SimIdDictionary();
-   ~SimIdDictionary();
 };
 
 #endif //_SIMDICTIONARY_H_
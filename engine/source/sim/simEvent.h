@@ -53,14 +53,16 @@ typedef U32 SimTime;
 class SimEvent
 {
   public:
-   SimEvent *nextEvent;     ///< Linked list details - pointer to next item in the list.
+   U32 queueIndex;          ///< Index of this event in the event queue.
+   SimEvent *prevObjectEvent; ///< Previous pending event for the same destination object.
+   SimEvent *nextObjectEvent; ///< Next pending event for the same destination object.
    SimTime startTime;       ///< When the event was posted.
    SimTime time;            ///< When the event is scheduled to occur.
    U32 sequenceCount;       ///< Unique ID. These are assigned sequentially based on order
                             ///  of addition to the list.
    SimObject *destObject;   ///< Object on which this event will be applied.
 
-   SimEvent() { destObject = NULL; }
+   SimEvent() { destObject = NULL; prevObjectEvent = nextObjectEvent = NULL; queueIndex = 0; }
    virtual ~SimEvent() {}   ///< Destructor
                             ///
                             /// A dummy virtual destructor is required
@@ -0,0 +1,219 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "sim/simEventQueue.h"
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+// Script bindings.
+#include "simEventQueue_ScriptBinding.h"
+
+//---------------------------------------------------------------------------
+
+SimEventQueue::SimEventQueue()
+{
+   VECTOR_SET_ASSOCIATION( mHeap );
+}
+
+//---------------------------------------------------------------------------
+
+SimEventQueue::~SimEventQueue()
+{
+   deleteAllEvents();
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::insert( SimEvent* pEvent )
+{
+   AssertFatal( pEvent != NULL, "SimEventQueue::insert - Cannot insert a NULL event." );
+
+   // Grow the lookup geometrically (the table only grows by one otherwise).
+   if ( mSequenceEvents.size() >= mSequenceEvents.tableSize() )
+      mSequenceEvents.resize( getMax( mSequenceEvents.size() * 2, (U32)64 ) );
+
+   // Add to the sequence lookup.
+   mSequenceEvents.insertUnique( pEvent->sequenceCount, pEvent );
+
+   // Add to the front of the destination object events.
+   pEvent->prevObjectEvent = NULL;
+   pEvent->nextObjectEvent = NULL;
+   if ( pEvent->destObject != NULL )
+   {
+      typeObjectHash::iterator objectItr = mObjectEvents.find( pEvent->destObject );
+      if ( objectItr != mObjectEvents.end() )
+      {
+         pEvent->nextObjectEvent = objectItr->value;
+         objectItr->value->prevObjectEvent = pEvent;
+         objectItr->value = pEvent;
+      }
+      else
+      {
+         if ( mObjectEvents.size() >= mObjectEvents.tableSize() )
+            mObjectEvents.resize( getMax( mObjectEvents.size() * 2, (U32)64 ) );
+
+         mObjectEvents.insertUnique( pEvent->destObject, pEvent );
+      }
+   }
+
+   // Add to the heap.
+   mHeap.push_back( pEvent );
+   pEvent->queueIndex = mHeap.size() - 1;
+   siftUp( pEvent->queueIndex );
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::remove( SimEvent* pEvent )
+{
+   AssertFatal( pEvent != NULL && pEvent->queueIndex < (U32)mHeap.size() && mHeap[pEvent->queueIndex] == pEvent, "SimEventQueue::remove - Event is not in the queue." );
+
+   // Remove from the sequence lookup.
+   mSequenceEvents.erase( pEvent->sequenceCount );
+
+   // Remove from the destination object events.
+   if ( pEvent->nextObjectEvent != NULL )
+      pEvent->nextObjectEvent->prevObjectEvent = pEvent->prevObjectEvent;
+
+   if ( pEvent->prevObjectEvent != NULL )
+   {
+      pEvent->prevObjectEvent->nextObjectEvent = pEvent->nextObjectEvent;
+   }
+   else if ( pEvent->destObject != NULL )
+   {
+      // This was the first object event so update or remove the object entry.
+      if ( pEvent->nextObjectEvent != NULL )
+         mObjectEvents.find( pEvent->destObject )->value = pEvent->nextObjectEvent;
+      else
+         mObjectEvents.erase( pEvent->destObject );
+   }
+
+   pEvent->prevObjectEvent = NULL;
+   pEvent->nextObjectEvent = NULL;
+
+   // Remove from the heap by replacing it with the last event.
+   const U32 index = pEvent->queueIndex;
+   SimEvent* pLastEvent = mHeap.last();
+   mHeap.pop_back();
+
+   if ( pLastEvent != pEvent )
+   {
+      setHeapEvent( index, pLastEvent );
+
+      // Restore the heap order.
+      if ( index > 0 && isBefore( pLastEvent, mHeap[(index-1)/2] ) )
+         siftUp( index );
+      else
+         siftDown( index );
+   }
+}
+
+//---------------------------------------------------------------------------
+
+SimEvent* SimEventQueue::pop( void )
+{
+   // Finish if empty.
+   if ( mHeap.size() == 0 )
+      return NULL;
+
+   SimEvent* pEvent = mHeap[0];
+   remove( pEvent );
+   return pEvent;
+}
+
+//---------------------------------------------------------------------------
+
+SimEvent* SimEventQueue::findEvent( const U32 sequenceCount )
+{
+   typeSequenceHash::iterator eventItr = mSequenceEvents.find( sequenceCount );
+   return eventItr != mSequenceEvents.end() ? eventItr->value : NULL;
+}
+
+//---------------------------------------------------------------------------
+
+SimEvent* SimEventQueue::findObjectEvent( SimObject* pObject )
+{
+   typeObjectHash::iterator objectItr = mObjectEvents.find( pObject );
+   return objectItr != mObjectEvents.end() ? objectItr->value : NULL;
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::deleteAllEvents( void )
+{
+   for ( U32 index = 0; index < (U32)mHeap.size(); index++ )
+      delete mHeap[index];
+
+   mHeap.clear();
+   mSequenceEvents.clear();
+   mObjectEvents.clear();
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::siftUp( U32 index )
+{
+   SimEvent* pEvent = mHeap[index];
+
+   while ( index > 0 )
+   {
+      const U32 parentIndex = (index-1) / 2;
+      SimEvent* pParentEvent = mHeap[parentIndex];
+
+      if ( !isBefore( pEvent, pParentEvent ) )
+         break;
+
+      setHeapEvent( index, pParentEvent );
+      index = parentIndex;
+   }
+
+   setHeapEvent( index, pEvent );
+}
+
+//---------------------------------------------------------------------------
+
+void SimEventQueue::siftDown( U32 index )
+{
+   const U32 count = (U32)mHeap.size();
+   SimEvent* pEvent = mHeap[index];
+
+   while ( true )
+   {
+      U32 childIndex = index * 2 + 1;
+      if ( childIndex >= count )
+         break;
+
+      // Choose the earliest child.
+      if ( childIndex + 1 < count && isBefore( mHeap[childIndex+1], mHeap[childIndex] ) )
+         childIndex++;
+
+      if ( !isBefore( mHeap[childIndex], pEvent ) )
+         break;
+
+      setHeapEvent( index, mHeap[childIndex] );
+      index = childIndex;
+   }
+
+   setHeapEvent( index, pEvent );
+}
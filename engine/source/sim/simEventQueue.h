@@ -0,0 +1,87 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SIM_EVENT_QUEUE_H_
+#define _SIM_EVENT_QUEUE_H_
+
+#ifndef _SIM_EVENT_H_
+#include "sim/simEvent.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+//---------------------------------------------------------------------------
+
+/// Indexed priority queue of pending sim events.
+///
+/// Events are ordered by their scheduled time and then by their sequence
+/// count so events scheduled for the same time are dispatched in the order
+/// they were posted.  Insertion and removal are O(log n) and events can be
+/// found by their sequence count or destination object in O(1).
+///
+/// The queue does not own the events; callers are responsible for deleting
+/// any event they remove.
+class SimEventQueue
+{
+private:
+   typedef HashTable<U32, SimEvent*> typeSequenceHash;
+   typedef HashTable<SimObject*, SimEvent*> typeObjectHash;
+
+   Vector<SimEvent*>    mHeap;
+   typeSequenceHash     mSequenceEvents;
+   typeObjectHash       mObjectEvents;
+
+   inline static bool isBefore( const SimEvent* pEventA, const SimEvent* pEventB )
+   {
+      // NOTE: The sequence compare is wrap-safe.
+      return pEventA->time < pEventB->time || ( pEventA->time == pEventB->time && (S32)(pEventA->sequenceCount - pEventB->sequenceCount) < 0 );
+   }
+
+   void siftUp( U32 index );
+   void siftDown( U32 index );
+   inline void setHeapEvent( const U32 index, SimEvent* pEvent ) { mHeap[index] = pEvent; pEvent->queueIndex = index; }
+
+public:
+   SimEventQueue();
+   ~SimEventQueue();
+
+   void insert( SimEvent* pEvent );
+   void remove( SimEvent* pEvent );
+   SimEvent* pop( void );
+
+   inline SimEvent* peek( void ) const { return mHeap.size() > 0 ? mHeap[0] : NULL; }
+   inline U32 size( void ) const { return (U32)mHeap.size(); }
+   inline bool isEmpty( void ) const { return mHeap.size() == 0; }
+
+   SimEvent* findEvent( const U32 sequenceCount );
+   SimEvent* findObjectEvent( SimObject* pObject );
+
+   void deleteAllEvents( void );
+};
+
+#endif // _SIM_EVENT_QUEUE_H_
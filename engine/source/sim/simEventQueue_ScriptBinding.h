@@ -0,0 +1,115 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+ConsoleFunctionGroupBegin( SimEventQueue, "Sim event queue functionality.");
+
+//-----------------------------------------------------------------------------
+
+class SimEventQueueBenchmarkEvent : public SimEvent
+{
+public:
+   virtual void process( SimObject* object ) {}
+};
+
+//-----------------------------------------------------------------------------
+
+/*! Times inserting events into a standalone event queue then cancelling them by sequence and by object and popping the rest.
+    Events are spread over a range of times and destination objects much like scheduled script events.
+    @param events The number of events to insert, defaults to 200000.
+    @return The times taken in milliseconds formatted as "insertTime cancelTime objectCancelTime popTime".
+*/
+ConsoleFunctionWithDocs( runSimEventQueueBenchmark, ConsoleString, 1, 2, ([events]))
+{
+   // Fetch the event count.
+   const U32 eventCount = argc < 2 ? 200000 : getMax( dAtoi(argv[1]), 1 );
+
+   // The destination objects are only used as keys so they do not need to be real objects.
+   const U32 objectCount = 256;
+   U8 objects[objectCount];
+
+   // Create the events up front so only the queue is timed.
+   Vector<SimEvent*> events;
+   events.setSize( eventCount );
+   for ( U32 index = 0; index < eventCount; ++index )
+   {
+      SimEvent* pEvent = new SimEventQueueBenchmarkEvent();
+      pEvent->sequenceCount = index+1;
+      pEvent->startTime = 0;
+      pEvent->time = (index * 7919) % 10000;
+      pEvent->destObject = reinterpret_cast<SimObject*>( &objects[index % objectCount] );
+      events[index] = pEvent;
+   }
+
+   SimEventQueue eventQueue;
+
+   // Time inserting the events.
+   const U32 insertStartTime = Platform::getRealMilliseconds();
+   for ( U32 index = 0; index < eventCount; ++index )
+   {
+      eventQueue.insert( events[index] );
+   }
+   const U32 insertTime = Platform::getRealMilliseconds() - insertStartTime;
+
+   // Time cancelling every third event by sequence.
+   const U32 cancelStartTime = Platform::getRealMilliseconds();
+   for ( U32 sequence = 1; sequence <= eventCount; sequence += 3 )
+   {
+      SimEvent* pEvent = eventQueue.findEvent( sequence );
+      eventQueue.remove( pEvent );
+      delete pEvent;
+   }
+   const U32 cancelTime = Platform::getRealMilliseconds() - cancelStartTime;
+
+   // Time cancelling all the events for a quarter of the objects.
+   const U32 objectCancelStartTime = Platform::getRealMilliseconds();
+   for ( U32 index = 0; index < objectCount; index += 4 )
+   {
+      SimObject* pObject = reinterpret_cast<SimObject*>( &objects[index] );
+      SimEvent* pEvent;
+      while ( (pEvent = eventQueue.findObjectEvent( pObject )) != NULL )
+      {
+         eventQueue.remove( pEvent );
+         delete pEvent;
+      }
+   }
+   const U32 objectCancelTime = Platform::getRealMilliseconds() - objectCancelStartTime;
+
+   // Time popping the remaining events.
+   const U32 remainingCount = eventQueue.size();
+   const U32 popStartTime = Platform::getRealMilliseconds();
+   while ( !eventQueue.isEmpty() )
+   {
+      delete eventQueue.pop();
+   }
+   const U32 popTime = Platform::getRealMilliseconds() - popStartTime;
+
+   // Report.
+   Con::printf( "SimEventQueue benchmark: %d events, insert %dms, cancel by sequence %dms, cancel by object %dms, pop %d events %dms.",
+      eventCount, insertTime, cancelTime, objectCancelTime, remainingCount, popTime );
+
+   char* pBuffer = Con::getReturnBuffer( 64 );
+   dSprintf( pBuffer, 64, "%d %d %d %d", insertTime, cancelTime, objectCancelTime, popTime );
+   return pBuffer;
+}
+
+ConsoleFunctionGroupEnd( SimEventQueue );
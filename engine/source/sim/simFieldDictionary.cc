@@ -51,14 +51,23 @@ void SimFieldDictionary::freeEntry(SimFieldDictionary::Entry *ent)
 
 SimFieldDictionary::SimFieldDictionary()
 {
-   for(U32 i = 0; i < HashTableSize; i++)
-      mHashTable[i] = 0;
-
+   mEntryCount = 0;
+   mHashTable = NULL;
    mVersion = 0;
 }
 
 SimFieldDictionary::~SimFieldDictionary()
 {
+   if(!mHashTable)
+   {
+      for(U32 i = 0; i < mEntryCount; i++)
+      {
+         dFree(mInlineEntries[i]->value);
+         freeEntry(mInlineEntries[i]);
+      }
+      return;
+   }
+
    for(U32 i = 0; i < HashTableSize; i++)
    {
       for(Entry *walk = mHashTable[i]; walk;)
@@ -70,10 +79,80 @@ SimFieldDictionary::~SimFieldDictionary()
          freeEntry(temp);
       }
    }
+
+   delete [] mHashTable;
+}
+
+void SimFieldDictionary::createHashTable()
+{
+   mHashTable = new Entry*[HashTableSize];
+   for(U32 i = 0; i < HashTableSize; i++)
+      mHashTable[i] = NULL;
+
+   for(U32 i = 0; i < mEntryCount; i++)
+   {
+      Entry *field = mInlineEntries[i];
+      U32 bucket = HashPointer(field->slotName) % HashTableSize;
+      field->next = mHashTable[bucket];
+      mHashTable[bucket] = field;
+   }
 }
 
 void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *value)
 {
+   if(!mHashTable)
+   {
+      U32 index = 0;
+      while(index < mEntryCount && mInlineSlots[index] != slotName)
+         index++;
+
+      if(index < mEntryCount)
+      {
+         Entry *field = mInlineEntries[index];
+         dFree(field->value);
+
+         if(*value)
+         {
+            field->value = dStrdup(value);
+            return;
+         }
+
+         mVersion++;
+
+         freeEntry(field);
+
+         // Keep the remaining fields in the order they were added.
+         mEntryCount--;
+         for(U32 i = index; i < mEntryCount; i++)
+         {
+            mInlineSlots[i] = mInlineSlots[i + 1];
+            mInlineEntries[i] = mInlineEntries[i + 1];
+         }
+         return;
+      }
+
+      if(!*value)
+         return;
+
+      if(mEntryCount < InlineEntryCount)
+      {
+         mVersion++;
+
+         Entry *field = allocEntry();
+         field->value = dStrdup(value);
+         field->slotName = slotName;
+         field->next = NULL;
+
+         mInlineSlots[mEntryCount] = slotName;
+         mInlineEntries[mEntryCount] = field;
+         mEntryCount++;
+         return;
+      }
+
+      // The inline fields are full so move them to a hash table.
+      createHashTable();
+   }
+
    U32 bucket = HashPointer(slotName) % HashTableSize;
    Entry **walk = &mHashTable[bucket];
    while(*walk && (*walk)->slotName != slotName)
@@ -85,6 +164,7 @@ void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *va
       if(field)
       {
          mVersion++;
+         mEntryCount--;
 
          dFree(field->value);
          *walk = field->next;
@@ -101,6 +181,7 @@ void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *va
       else
       {
          mVersion++;
+         mEntryCount++;
 
          field = allocEntry();
          field->value = dStrdup(value);
@@ -113,6 +194,15 @@ void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *va
 
 const char *SimFieldDictionary::getFieldValue(StringTableEntry slotName)
 {
+   if(!mHashTable)
+   {
+      for(U32 i = 0; i < mEntryCount; i++)
+         if(mInlineSlots[i] == slotName)
+            return mInlineEntries[i]->value;
+
+      return NULL;
+   }
+
    U32 bucket = HashPointer(slotName) % HashTableSize;
 
    for(Entry *walk = mHashTable[bucket];walk;walk = walk->next)
@@ -127,9 +217,8 @@ void SimFieldDictionary::assignFrom(SimFieldDictionary *dict)
 {
    mVersion++;
 
-   for(U32 i = 0; i < HashTableSize; i++)
-      for(Entry *walk = dict->mHashTable[i];walk; walk = walk->next)
-         setFieldValue(walk->slotName, walk->value);
+   for(SimFieldDictionaryIterator itr(dict); *itr; ++itr)
+      setFieldValue((*itr)->slotName, (*itr)->value);
 }
 
 static S32 QSORT_CALLBACK compareEntries(const void* a,const void* b)
@@ -145,25 +234,23 @@ void SimFieldDictionary::writeFields(SimObject *obj, Stream &stream, U32 tabStop
    const AbstractClassRep::FieldList &list = obj->getFieldList();
    Vector<Entry *> flist(__FILE__, __LINE__);
 
-   for(U32 i = 0; i < HashTableSize; i++)
+   for(SimFieldDictionaryIterator itr(this); *itr; ++itr)
    {
-      for(Entry *walk = mHashTable[i];walk; walk = walk->next)
-      {
-         // make sure we haven't written this out yet:
-         U32 i;
-         for(i = 0; i < (U32)list.size(); i++)
-            if(list[i].pFieldname == walk->slotName)
-               break;
+      Entry *walk = *itr;
+      // make sure we haven't written this out yet:
+      U32 i;
+      for(i = 0; i < (U32)list.size(); i++)
+         if(list[i].pFieldname == walk->slotName)
+            break;
 
-         if(i != list.size())
-            continue;
+      if(i != list.size())
+         continue;
 
 
-         if (!obj->writeField(walk->slotName, walk->value))
-            continue;
+      if (!obj->writeField(walk->slotName, walk->value))
+         continue;
 
-         flist.push_back(walk);
-      }
+      flist.push_back(walk);
    }
 
    // Sort Entries to prevent version control conflicts
@@ -191,21 +278,19 @@ void SimFieldDictionary::printFields(SimObject *obj)
    char expandedBuffer[4096];
    Vector<Entry *> flist(__FILE__, __LINE__);
 
-   for(U32 i = 0; i < HashTableSize; i++)
+   for(SimFieldDictionaryIterator itr(this); *itr; ++itr)
    {
-      for(Entry *walk = mHashTable[i];walk; walk = walk->next)
-      {
-         // make sure we haven't written this out yet:
-         U32 i;
-         for(i = 0; i < (U32)list.size(); i++)
-            if(list[i].pFieldname == walk->slotName)
-               break;
+      Entry *walk = *itr;
+      // make sure we haven't written this out yet:
+      U32 i;
+      for(i = 0; i < (U32)list.size(); i++)
+         if(list[i].pFieldname == walk->slotName)
+            break;
 
-         if(i != list.size())
-            continue;
+      if(i != list.size())
+         continue;
 
-         flist.push_back(walk);
-      }
+      flist.push_back(walk);
    }
    dQsort(flist.address(),flist.size(),sizeof(Entry *),compareEntries);
 
@@ -232,6 +317,13 @@ SimFieldDictionary::Entry* SimFieldDictionaryIterator::operator++()
    if(!mDictionary)
       return(mEntry);
 
+   if(!mDictionary->mHashTable)
+   {
+      mHashIndex++;
+      mEntry = mHashIndex < (S32)mDictionary->mEntryCount ? mDictionary->mInlineEntries[mHashIndex] : NULL;
+      return(mEntry);
+   }
+
    if(mEntry)
       mEntry = mEntry->next;
 
@@ -34,6 +34,11 @@ class SimObject;
 //-----------------------------------------------------------------------------
 
 /// Dictionary to keep track of dynamic fields on SimObject.
+///
+/// Most objects only have a handful of dynamic fields so the first few are
+/// kept in small inline arrays that are searched linearly by slot name.
+/// Once those are full the fields move to a hash table.  Entries come from a
+/// pooled allocator and do not move while they are in the dictionary.
 
 class SimFieldDictionary
 {
@@ -48,15 +53,24 @@ class SimFieldDictionary
    };
    enum
    {
+      InlineEntryCount = 4,
       HashTableSize = 19
    };
-   Entry *mHashTable[HashTableSize];
   private:
+   /// Fields held inline while there is no hash table.
+   U32 mEntryCount;
+   StringTableEntry mInlineSlots[InlineEntryCount];
+   Entry *mInlineEntries[InlineEntryCount];
+
+   /// Hash buckets, allocated once the inline fields are full.
+   Entry **mHashTable;
 
    static Entry *mFreeList;
    static void freeEntry(Entry *entry);
    static Entry *allocEntry();
 
+   void createHashTable();
+
    /// In order to efficiently detect when a dynamic field has been
    /// added or deleted, we increment this every time we add or
    /// remove a field.
@@ -64,6 +78,7 @@ class SimFieldDictionary
 
 public:
    const U32 getVersion() const { return mVersion; }
+   U32 getEntryCount() const { return mEntryCount; }
 
    SimFieldDictionary();
    ~SimFieldDictionary();
@@ -30,6 +30,7 @@
 #include "io/fileObject.h"
 #include "console/consoleInternal.h"
 #include "memory/safeDelete.h"
+#include "sim/simEventQueue.h"
 
 //---------------------------------------------------------------------------
 
@@ -44,7 +45,7 @@ SimTime gCurrentTime;
 SimTime gTargetTime;
 
 void *gEventQueueMutex;
-SimEvent *gEventQueue;
+SimEventQueue *gEventQueue;
 U32 gEventSequence;
 
 //---------------------------------------------------------------------------
@@ -55,7 +56,7 @@ void initEventQueue()
    gCurrentTime = 0;
    gTargetTime = 0;
    gEventSequence = 1;
-   gEventQueue = NULL;
+   gEventQueue = new SimEventQueue;
    gEventQueueMutex = Mutex::createMutex();
 }
 
@@ -63,13 +64,7 @@ void shutdownEventQueue()
 {
    // Delete all pending events
    Mutex::lockMutex(gEventQueueMutex);
-   SimEvent *walk = gEventQueue;
-   while(walk)
-   {
-      SimEvent *temp = walk->nextEvent;
-      delete walk;
-      walk = temp;
-   }
+   SAFE_DELETE(gEventQueue);
    Mutex::unlockMutex(gEventQueueMutex);
    Mutex::destroyMutex(gEventQueueMutex);
 }
@@ -101,19 +96,11 @@ U32 postEvent(SimObject *destObject, SimEvent* event,U32 time)
       return InvalidEventId;
    }
    event->sequenceCount = gEventSequence++;
-   SimEvent **walk = &gEventQueue;
-   SimEvent *current;
-   
-   while((current = *walk) != NULL && (current->time < event->time))
-      walk = &(current->nextEvent);
-   
+
    // [tom, 6/24/2005] This ensures that SimEvents are dispatched in the same order that they are posted.
    // This is needed to ensure Con::threadSafeExecute() executes script code in the correct order.
-   while((current = *walk) != NULL && (current->time == event->time))
-      walk = &(current->nextEvent);
-   
-   event->nextEvent = current;
-   *walk = event;
+   // NOTE: The queue orders events with the same time by their sequence count.
+   gEventQueue->insert(event);
 
    U32 seqCount = event->sequenceCount;
 
@@ -134,20 +121,11 @@ void cancelEvent(U32 eventSequence)
 {
    Mutex::lockMutex(gEventQueueMutex);
 
-   SimEvent **walk = &gEventQueue;
-   SimEvent *current;
-   
-   while((current = *walk) != NULL)
+   SimEvent *current = gEventQueue->findEvent(eventSequence);
+   if(current)
    {
-      if(current->sequenceCount == eventSequence)
-      {
-         *walk = current->nextEvent;
-         delete current;
-         Mutex::unlockMutex(gEventQueueMutex);
-         return;
-      }
-      else
-         walk = &(current->nextEvent);
+      gEventQueue->remove(current);
+      delete current;
    }
 
    Mutex::unlockMutex(gEventQueueMutex);
@@ -157,18 +135,11 @@ void cancelPendingEvents(SimObject *obj)
 {
    Mutex::lockMutex(gEventQueueMutex);
 
-   SimEvent **walk = &gEventQueue;
    SimEvent *current;
-   
-   while((current = *walk) != NULL)
+   while((current = gEventQueue->findObjectEvent(obj)) != NULL)
    {
-      if(current->destObject == obj)
-      {
-         *walk = current->nextEvent;
-         delete current;
-      }
-      else
-         walk = &(current->nextEvent);
+      gEventQueue->remove(current);
+      delete current;
    }
    Mutex::unlockMutex(gEventQueueMutex);
 }
@@ -187,15 +158,9 @@ void cancelPendingEvents(SimObject *obj)
 bool isEventPending(U32 eventSequence)
 {
    Mutex::lockMutex(gEventQueueMutex);
-
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-      {
-         Mutex::unlockMutex(gEventQueueMutex);
-         return true;
-      }
+   const bool pending = gEventQueue->findEvent(eventSequence) != NULL;
    Mutex::unlockMutex(gEventQueueMutex);
-   return false;
+   return pending;
 }
 
 /*!
@@ -209,13 +174,13 @@ U32 getEventTimeLeft(U32 eventSequence)
 {
    Mutex::lockMutex(gEventQueueMutex);
 
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-      {
-         SimTime t = walk->time - getCurrentTime();
-         Mutex::unlockMutex(gEventQueueMutex);
-         return t;
-      }
+   SimEvent *walk = gEventQueue->findEvent(eventSequence);
+   if(walk)
+   {
+      SimTime t = walk->time - getCurrentTime();
+      Mutex::unlockMutex(gEventQueueMutex);
+      return t;
+   }
 
    Mutex::unlockMutex(gEventQueueMutex);
 
@@ -231,10 +196,11 @@ U32 getEventTimeLeft(U32 eventSequence)
 */
 U32 getScheduleDuration(U32 eventSequence)
 {
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-         return (walk->time-walk->startTime);
-   return 0;
+   Mutex::lockMutex(gEventQueueMutex);
+   SimEvent *walk = gEventQueue->findEvent(eventSequence);
+   const U32 duration = walk ? (walk->time-walk->startTime) : 0;
+   Mutex::unlockMutex(gEventQueueMutex);
+   return duration;
 }
 
 /*!
@@ -246,10 +212,11 @@ U32 getScheduleDuration(U32 eventSequence)
 */
 U32 getTimeSinceStart(U32 eventSequence)
 {
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-         return (getCurrentTime()-walk->startTime);
-   return 0;
+   Mutex::lockMutex(gEventQueueMutex);
+   SimEvent *walk = gEventQueue->findEvent(eventSequence);
+   const U32 elapsed = walk ? (getCurrentTime()-walk->startTime) : 0;
+   Mutex::unlockMutex(gEventQueueMutex);
+   return elapsed;
 }
 
 //---------------------------------------------------------------------------
@@ -261,10 +228,10 @@ void advanceToTime(SimTime targetTime)
 
    Mutex::lockMutex(gEventQueueMutex);
    gTargetTime = targetTime;
-   while(gEventQueue && gEventQueue->time <= targetTime)
+   SimEvent *event;
+   while((event = gEventQueue->peek()) != NULL && event->time <= targetTime)
    {
-      SimEvent *event = gEventQueue;
-      gEventQueue = gEventQueue->nextEvent;
+      gEventQueue->remove(event);
       AssertFatal(event->time >= gCurrentTime,
             "SimEventQueue::pop: Cannot go back in time (flux capacitor not installed - BJG).");
       gCurrentTime = event->time;
@@ -276,6 +243,9 @@ void advanceToTime(SimTime targetTime)
    }
     gCurrentTime = targetTime;
    Mutex::unlockMutex(gEventQueueMutex);
+
+   // Free dictionary slots left over from growing, no lookup spans a time advance.
+   SimObjectTable::reclaim();
 }
 
 void advanceTime(SimTime delta)
@@ -333,6 +303,8 @@ void shutdownRoot()
 
    SAFE_DELETE(gNameDictionary);
    SAFE_DELETE(gIdDictionary);
+
+   SimObjectTable::reclaim();
 }
 
 //---------------------------------------------------------------------------
@@ -386,6 +358,11 @@ SimObject* findObject(SimObjectId id)
     return gIdDictionary->find(id);
 }
 
+SimObject* findObject(SimObjectId id, U32 generation)
+{
+    return gIdDictionary->find(id, generation);
+}
+
 SimGroup *getRootGroup()
 {
    return gRootGroup;
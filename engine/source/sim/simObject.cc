@@ -54,6 +54,7 @@ SimObject::SimObject( const U8 namespaceLinkMask ) : mNSLinkMask( namespaceLinkM
     nextNameObject           = (SimObject*)-1;
     nextManagerNameObject    = (SimObject*)-1;
     nextIdObject             = NULL;  
+    mIdGeneration            = 0;
     mId                      = 0;
     mIdString                = StringTable->EmptyString;
     mGroup                   = 0;
@@ -93,7 +94,7 @@ bool SimObject::registerObject()
 
     if( mId == 0 )
     {
-        mId = Sim::gNextObjectId++;
+        mId = dAtomicFetchAdd( &Sim::gNextObjectId, 1 );
 
         char idBuffer[64];
         dSprintf(idBuffer, sizeof(idBuffer), "%d", mId);
@@ -189,7 +190,7 @@ void SimObject::setId(SimObjectId newId)
 
         // Free current Id.
         // Assign new one.
-        mId = newId ? newId : Sim::gNextObjectId++;
+        mId = newId ? newId : dAtomicFetchAdd( &Sim::gNextObjectId, 1 );
         Sim::gIdDictionary->insert(this);
     }
 
@@ -278,6 +278,7 @@ private:
     SimObject*       nextNameObject;
     SimObject*       nextManagerNameObject;
     SimObject*       nextIdObject;
+    U32              mIdGeneration;
 
     SimGroup*   mGroup;  ///< SimGroup we're contained in, if any.
     BitSet32    mFlags;
@@ -603,6 +604,10 @@ public:
     /// @{
     inline SimObjectId getId( void ) const { return mId; }
     inline StringTableEntry getIdString( void ) const { return mIdString; }
+
+    /// The generation given to the object when its id was registered.  Use with
+    /// Sim::findObject( id, generation ) to catch stale references to reused ids.
+    inline U32 getIdGeneration( void ) const { return mIdGeneration; }
     U32 getType() const  { return mTypeMask; }
     const StringTableEntry getName( void ) const { return objectName; };
 
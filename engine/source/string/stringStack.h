@@ -93,6 +93,31 @@ struct StringStack
       mLen = dStrlen(mBuffer + mStart);
    }
 
+   /// Set the top of the stack to be an integer value, formatted without dSprintf.
+   void setIntegralValue(S32 i)
+   {
+      validateBufferSize(mStart + 32);
+
+      // Write the digits in reverse then copy them out in order.
+      char digits[16];
+      U32 digitCount = 0;
+      U32 magnitude = i < 0 ? 0U - (U32)i : (U32)i;
+      do
+      {
+         digits[digitCount++] = (char)('0' + magnitude % 10);
+         magnitude /= 10;
+      } while(magnitude);
+
+      char *pBuffer = mBuffer + mStart;
+      if(i < 0)
+         *pBuffer++ = '-';
+      while(digitCount)
+         *pBuffer++ = digits[--digitCount];
+      *pBuffer = 0;
+
+      mLen = (U32)(pBuffer - (mBuffer + mStart));
+   }
+
    /// Set the top of the stack to be a float value.
    void setFloatValue(F64 v)
    {
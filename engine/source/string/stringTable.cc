@@ -22,9 +22,15 @@
 
 #include "platform/platform.h"
 #include "stringTable.h"
+#include "math/mMathFn.h"
+#include "console/console.h"
+#include "platform/threads/thread.h"
+
+// Script bindings.
+#include "stringTable_ScriptBinding.h"
 
 _StringTable *_gStringTable = NULL;
-const U32 _StringTable::csm_stInitSize = 29;
+const U32 _StringTable::csm_stInitSize = 16;
 StringTableEntry _StringTable::EmptyString;
 
 //---------------------------------------------------------------
@@ -80,14 +86,15 @@ U32 _StringTable::hashStringn(const char* str, S32 len)
 //--------------------------------------
 _StringTable::_StringTable()
 {
-   buckets = (Node **) dMalloc(csm_stInitSize * sizeof(Node *));
-   for(U32 i = 0; i < csm_stInitSize; i++) {
-      buckets[i] = 0;
+   for(U32 i = 0; i < ShardCount; i++) {
+      Shard& shard = mShards[i];
+      shard.current = createTable(csm_stInitSize);
+      shard.migrating = NULL;
+      shard.migrated = NULL;
+      shard.migrateIndex = 0;
+      shard.itemCount = 0;
    }
 
-   numBuckets = csm_stInitSize;
-   itemCount = 0;
-
    // Insert empty string.
    EmptyString = insert("");
 }
@@ -95,7 +102,13 @@ _StringTable::_StringTable()
 //--------------------------------------
 _StringTable::~_StringTable()
 {
-   dFree(buckets);
+   for(U32 i = 0; i < ShardCount; i++) {
+      Shard& shard = mShards[i];
+      destroyTables(shard.current);
+      destroyTables(shard.migrating);
+      if(shard.migrated)
+         dFree(shard.migrated);
+   }
 }
 
 
@@ -118,37 +131,160 @@ void _StringTable::destroy()
 }
 
 //--------------------------------------
-StringTableEntry _StringTable::insert(const char* val, const bool  caseSens)
+_StringTable::Table* _StringTable::createTable(const U32 bucketCount)
 {
-   if ( val == NULL )
-       return StringTable->EmptyString;
+   AssertFatal(isPow2(bucketCount), "StringTable::createTable: Bucket count must be a power of two.");
+
+   Table* table = (Table *) dMalloc(sizeof(Table) + bucketCount * sizeof(Node *));
+   table->buckets = (Node **) (table + 1);
+   table->mask = bucketCount - 1;
+   table->retired = NULL;
+   for(U32 i = 0; i < bucketCount; i++) {
+      table->buckets[i] = 0;
+   }
+   return table;
+}
 
-   MutexHandle mutex;
-   mutex.lock(&mMutex, true);
-
-   Node **walk, *temp;
-   U32 key = hashString(val);
-   walk = &buckets[key % numBuckets];
-   while((temp = *walk) != NULL)   {
-      if(caseSens && !dStrcmp(temp->val, val))
-         return temp->val;
-      else if(!caseSens && !dStricmp(temp->val, val))
-         return temp->val;
-      walk = &(temp->next);
+//--------------------------------------
+void _StringTable::destroyTables(Table* table)
+{
+   while(table) {
+      Table* temp = table->retired;
+      dFree(table);
+      table = temp;
    }
-   char *ret = 0;
-   if(!*walk) {
-      *walk = (Node *) mempool.alloc(sizeof(Node));
-      (*walk)->next = 0;
-      (*walk)->val = (char *) mempool.alloc(dStrlen(val) + 1);
-      dStrcpy((*walk)->val, val);
-      ret = (*walk)->val;
-      itemCount ++;
+}
+
+//--------------------------------------
+U32 _StringTable::mixHash(const U32 hash)
+{
+   // The string hash shifts each character into the low bits so short
+   // strings leave the high bits empty.  Spread it out before the top
+   // bits pick the shard and the bottom bits pick the bucket.
+   const U32 key = hash * 0x9E3779B1;
+   return key ^ (key >> 16);
+}
+
+//--------------------------------------
+bool _StringTable::matchNode(const Node* node, const char* val, const S32 len, const bool caseSens)
+{
+   if(len < 0)
+      return caseSens ? !dStrcmp(node->val, val) : !dStricmp(node->val, val);
+
+   if(caseSens)
+      return !dStrncmp(node->val, val, len) && node->val[len] == 0;
+
+   return !dStrnicmp(node->val, val, len) && node->val[len] == 0;
+}
+
+//--------------------------------------
+_StringTable::Node* _StringTable::findNode(Table* table, const U32 key, const char* val, const S32 len, const bool caseSens)
+{
+   // Nodes are only ever appended and are published with a release store
+   // so this is safe to walk while another thread inserts.
+   Node* walk = dAtomicLoadAcquire(&table->buckets[key & table->mask]);
+   while(walk) {
+      if(walk->key == key && matchNode(walk, val, len, caseSens))
+         return walk;
+      walk = dAtomicLoadAcquire(&walk->next);
    }
-   if(itemCount > 2 * numBuckets) {
-      resize(4 * numBuckets - 1);
+   return NULL;
+}
+
+//--------------------------------------
+_StringTable::Node* _StringTable::findNode(Shard& shard, const U32 key, const char* val, const S32 len, const bool caseSens)
+{
+   for(;;) {
+      // The current table must be read before the migrating one.  A resize
+      // publishes the migrating table before the new current table, and
+      // old tables keep their nodes, so together the two tables hold every
+      // string inserted before they were read.
+      Table* current = dAtomicLoadAcquire(&shard.current);
+      Table* migrating = dAtomicLoadAcquire(&shard.migrating);
+
+      Node* node = migrating ? findNode(migrating, key, val, len, caseSens) : NULL;
+      if(node)
+         return node;
+
+      node = findNode(current, key, val, len, caseSens);
+      if(node)
+         return node;
+
+      // Search again if a resize started or finished while searching.
+      if(dAtomicLoadAcquire(&shard.current) == current && dAtomicLoadAcquire(&shard.migrating) == migrating)
+         return NULL;
    }
-   return ret;
+}
+
+//--------------------------------------
+void _StringTable::appendNode(Table* table, const U32 key, Node* node)
+{
+   // New strings are added at the end of bucket lists so that case sens
+   // strings are always after their corresponding case insens strings.
+   node->next = NULL;
+   Node **walk = &table->buckets[key & table->mask];
+   while(*walk)
+      walk = &((*walk)->next);
+   dAtomicStoreRelease(walk, node);
+}
+
+//--------------------------------------
+StringTableEntry _StringTable::insertKey(const U32 hash, const char* val, const S32 len, const bool caseSens)
+{
+   const U32 key = mixHash(hash);
+   Shard& shard = mShards[key >> ShardShift];
+
+   // Most inserts are for strings that already exist so try without the lock first.
+   Node* node = findNode(shard, key, val, len, caseSens);
+   if(node)
+      return node->val;
+
+   MutexHandle mutex;
+   mutex.lock(&shard.mutex, true);
+
+   // Another thread may have added it before we got the lock.
+   node = findNode(shard, key, val, len, caseSens);
+   if(node)
+      return node->val;
+
+   const U32 length = len < 0 ? dStrlen(val) : len;
+   node = (Node *) shard.mempool.alloc(sizeof(Node));
+   node->key = key;
+   node->val = (char *) shard.mempool.alloc(length + 1);
+   dMemcpy(node->val, val, length);
+   node->val[length] = 0;
+
+   // Copy the old bucket across first so the new string stays behind
+   // any strings that were added before it.
+   if(shard.migrating)
+      migrateBucket(shard, key & shard.migrating->mask);
+
+   appendNode(shard.current, key, node);
+   shard.itemCount++;
+
+   if(shard.migrating)
+      migrateStep(shard, MigrateStepBuckets);
+   else if(shard.itemCount > 2 * (shard.current->mask + 1))
+      beginResize(shard, 4 * (shard.current->mask + 1));
+
+   return node->val;
+}
+
+//--------------------------------------
+StringTableEntry _StringTable::lookupKey(const U32 hash, const char* val, const S32 len, const bool caseSens)
+{
+   const U32 key = mixHash(hash);
+   Node* node = findNode(mShards[key >> ShardShift], key, val, len, caseSens);
+   return node ? node->val : NULL;
+}
+
+//--------------------------------------
+StringTableEntry _StringTable::insert(const char* val, const bool  caseSens)
+{
+   if ( val == NULL )
+       return StringTable->EmptyString;
+
+   return insertKey(hashString(val), val, -1, caseSens);
 }
 
 //--------------------------------------
@@ -157,14 +293,14 @@ StringTableEntry _StringTable::insertn(const char* src, S32 len, const bool  cas
    if ( src == NULL )
        return StringTable->EmptyString;
 
-   MutexHandle mutex;
-   mutex.lock(&mMutex, true);
+   AssertFatal(len < 1024, "Invalid string to insertn");
+
+   // Stop at an embedded terminator the same as copying the string would.
+   S32 length = 0;
+   while(length < len && src[length] != 0)
+      length++;
 
-   char val[1024];
-   AssertFatal(len < sizeof(val), "Invalid string to insertn");
-   dStrncpy(val, src, len);
-   val[len] = 0;
-   return insert(val, caseSens);
+   return insertKey(hashStringn(src, length), src, length, caseSens);
 }
 
 //--------------------------------------
@@ -173,20 +309,7 @@ StringTableEntry _StringTable::lookup(const char* val, const bool  caseSens)
    if ( val == NULL )
        return StringTable->EmptyString;
 
-   MutexHandle mutex;
-   mutex.lock(&mMutex, true);
-
-   Node **walk, *temp;
-   U32 key = hashString(val);
-   walk = &buckets[key % numBuckets];
-   while((temp = *walk) != NULL)   {
-      if(caseSens && !dStrcmp(temp->val, val))
-            return temp->val;
-      else if(!caseSens && !dStricmp(temp->val, val))
-         return temp->val;
-      walk = &(temp->next);
-   }
-   return NULL;
+   return lookupKey(hashString(val), val, -1, caseSens);
 }
 
 //--------------------------------------
@@ -194,57 +317,81 @@ StringTableEntry _StringTable::lookupn(const char* val, S32 len, const bool  cas
 {
    if ( val == NULL )
        return StringTable->EmptyString;
-       
-   MutexHandle mutex;
-   mutex.lock(&mMutex, true);
-
-   Node **walk, *temp;
-   U32 key = hashStringn(val, len);
-   walk = &buckets[key % numBuckets];
-   while((temp = *walk) != NULL) {
-      if(caseSens && !dStrncmp(temp->val, val, len) && temp->val[len] == 0)
-         return temp->val;
-      else if(!caseSens && !dStrnicmp(temp->val, val, len) && temp->val[len] == 0)
-         return temp->val;
-      walk = &(temp->next);
+
+   S32 length = 0;
+   while(length < len && val[length] != 0)
+      length++;
+
+   return lookupKey(hashStringn(val, length), val, length, caseSens);
+}
+
+//--------------------------------------
+void _StringTable::beginResize(Shard& shard, const U32 bucketCount)
+{
+   // Only one migration runs at a time so finish any outstanding one.
+   if(shard.migrating)
+      migrateStep(shard, shard.migrating->mask + 1);
+
+   if(bucketCount <= shard.current->mask + 1)
+      return;
+
+   const U32 oldBucketCount = shard.current->mask + 1;
+   shard.migrated = (U8 *) dMalloc(oldBucketCount);
+   dMemset(shard.migrated, 0, oldBucketCount);
+   shard.migrateIndex = 0;
+
+   // Publish the old table as migrating before the new table becomes current.
+   dAtomicStoreRelease(&shard.migrating, shard.current);
+   dAtomicStoreRelease(&shard.current, createTable(bucketCount));
+}
+
+//--------------------------------------
+void _StringTable::migrateBucket(Shard& shard, const U32 index)
+{
+   if(shard.migrated[index])
+      return;
+
+   shard.migrated[index] = 1;
+
+   // Copy the nodes rather than relinking them so lookups still walking the
+   // old chain see it intact.  The strings themselves never move.
+   for(Node* walk = shard.migrating->buckets[index]; walk; walk = walk->next) {
+      Node* node = (Node *) shard.mempool.alloc(sizeof(Node));
+      node->key = walk->key;
+      node->val = walk->val;
+      appendNode(shard.current, node->key, node);
    }
-   return NULL;
+}
+
+//--------------------------------------
+void _StringTable::migrateStep(Shard& shard, const U32 bucketCount)
+{
+   const U32 oldBucketCount = shard.migrating->mask + 1;
+   for(U32 i = 0; i < bucketCount && shard.migrateIndex < oldBucketCount; i++)
+      migrateBucket(shard, shard.migrateIndex++);
+
+   if(shard.migrateIndex < oldBucketCount)
+      return;
+
+   // Every string is in the current table now.  Lookups may still be walking
+   // the old table so it's kept until the StringTable is destroyed.
+   Table* old = shard.migrating;
+   dAtomicStoreRelease(&shard.migrating, (Table *) NULL);
+   shard.current->retired = old;
+
+   dFree(shard.migrated);
+   shard.migrated = NULL;
 }
 
 //--------------------------------------
 void _StringTable::resize(const U32 newSize)
 {
-   Node *head = NULL, *walk, *temp;
-   U32 i;
-   // reverse individual bucket lists
-   // we do this because new strings are added at the end of bucket
-   // lists so that case sens strings are always after their
-   // corresponding case insens strings
-
-   for(i = 0; i < numBuckets; i++) {
-      walk = buckets[i];
-      while(walk)
-      {
-         temp = walk->next;
-         walk->next = head;
-         head = walk;
-         walk = temp;
-      }
-   }
-   buckets = (Node **) dRealloc(buckets, newSize * sizeof(Node));
-   for(i = 0; i < newSize; i++) {
-      buckets[i] = 0;
-   }
-   numBuckets = newSize;
-   walk = head;
-   while(walk) {
-      U32 key;
-      Node *temp = walk;
+   // Spread the items across the shards at two per bucket.
+   const U32 bucketCount = getNextPow2(getMax(newSize / (2 * ShardCount), csm_stInitSize));
 
-      walk = walk->next;
-      key = hashString(temp->val);
-      temp->next = buckets[key % newSize];
-      buckets[key % newSize] = temp;
+   for(U32 i = 0; i < ShardCount; i++) {
+      MutexHandle mutex;
+      mutex.lock(&mShards[i].mutex, true);
+      beginResize(mShards[i], bucketCount);
    }
 }
-
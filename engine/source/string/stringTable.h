@@ -32,6 +32,9 @@
 #ifndef _DATACHUNKER_H_
 #include "memory/dataChunker.h"
 #endif
+#ifndef _PLATFORM_THREADS_ATOMIC_H_
+#include "platform/threads/atomic.h"
+#endif
 
 //--------------------------------------
 /// A global table for the hashing and tracking of strings.
@@ -72,6 +75,13 @@
 ///  The scripting engine and the resource manager are the primary users of the
 ///  StringTable.
 ///
+/// The table is split into independently locked shards.  Lookups never take a
+/// lock: entries are only ever appended to a bucket chain and are published
+/// with release stores, so readers can walk the chains while another thread
+/// inserts.  Growing a shard allocates a larger bucket array and migrates the
+/// old buckets into it a few at a time on subsequent inserts, with lookups
+/// searching both arrays until the migration completes.
+///
 /// @note Be aware that the StringTable NEVER DEALLOCATES memory, so be careful when you
 ///       add strings to it. If you carelessly add many strings, you will end up wasting
 ///       space.
@@ -86,14 +96,51 @@ private:
    {
       char *val;
       Node *next;
+      U32  key;
+   };
+
+   /// A power-of-two array of bucket chains.
+   struct Table
+   {
+      Node**   buckets;
+      U32      mask;
+      Table*   retired;
+   };
+
+   /// An independently locked slice of the table.
+   struct Shard
+   {
+      Table*      current;
+      Table*      migrating;
+      U8*         migrated;
+      U32         migrateIndex;
+      U32         itemCount;
+      DataChunker mempool;
+      Mutex       mutex;
+   };
+
+   enum
+   {
+      ShardCount = 16,
+      ShardShift = 28,
+      MigrateStepBuckets = 4,
    };
 
-   Node**      buckets;
-   U32         numBuckets;
-   U32         itemCount;
-   DataChunker mempool;
+   Shard mShards[ShardCount];
+
+   static Table* createTable( const U32 bucketCount );
+   static void destroyTables( Table* pTable );
+   static U32 mixHash( const U32 hash );
+   static bool matchNode( const Node* pNode, const char* val, const S32 len, const bool caseSens );
+   static Node* findNode( Table* pTable, const U32 key, const char* val, const S32 len, const bool caseSens );
+   static Node* findNode( Shard& shard, const U32 key, const char* val, const S32 len, const bool caseSens );
+   static void appendNode( Table* pTable, const U32 key, Node* pNode );
 
-   Mutex mMutex;
+   StringTableEntry insertKey( const U32 hash, const char* val, const S32 len, const bool caseSens );
+   StringTableEntry lookupKey( const U32 hash, const char* val, const S32 len, const bool caseSens );
+   void beginResize( Shard& shard, const U32 bucketCount );
+   void migrateBucket( Shard& shard, const U32 index );
+   void migrateStep( Shard& shard, const U32 bucketCount );
 
   protected:
    static const U32 csm_stInitSize;
@@ -146,8 +193,9 @@ private:
 
 
    /// Resize the StringTable to be able to hold newSize items. This
-   /// is called automatically by the StringTable when the table is
-   /// full past a certain threshhold.
+   /// is called automatically by the StringTable when a shard is
+   /// full past a certain threshhold.  The buckets are migrated
+   /// incrementally by later inserts rather than all at once.
    ///
    /// @param newSize   Number of new items to allocate space for.
    void             resize(const U32 newSize);
@@ -0,0 +1,136 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+ConsoleFunctionGroupBegin( StringTable, "String table functionality.");
+
+//-----------------------------------------------------------------------------
+
+struct StringTableBenchmarkWorker
+{
+   U32               mThreadIndex;
+   U32               mStringCount;
+   U32               mPasses;
+   char              (*mStrings)[32];
+   U32               mMisses;
+};
+
+//-----------------------------------------------------------------------------
+
+static void stringTableBenchmarkWorker( void* pData )
+{
+   StringTableBenchmarkWorker* pWorker = static_cast<StringTableBenchmarkWorker*>( pData );
+
+   for ( U32 pass = 0; pass < pWorker->mPasses; ++pass )
+   {
+      for ( U32 index = 0; index < pWorker->mStringCount; ++index )
+      {
+         // Alternate threads walk the strings in opposite directions so they contend on the same inserts.
+         const U32 stringIndex = (pWorker->mThreadIndex & 1) ? pWorker->mStringCount - 1 - index : index;
+         const char* pString = pWorker->mStrings[stringIndex];
+
+         // Insert and look the string back up.
+         if ( StringTable->lookup( pString ) != StringTable->insert( pString ) )
+            pWorker->mMisses++;
+      }
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Times threads inserting and looking up the same strings in the string table concurrently.
+    The run is repeated with the thread count doubling from one up to the maximum, each run using strings that are not yet in the table.
+    @param maxThreads The maximum number of threads to run, defaults to 8.
+    @param strings The number of strings each run uses, defaults to 20000.
+    @param passes The number of times each thread inserts and looks up every string, defaults to 8.
+    @return The throughput of each run in thousands of insert and lookup pairs per second, separated by spaces.
+*/
+ConsoleFunctionWithDocs( runStringTableBenchmark, ConsoleString, 1, 4, ([maxThreads], [strings], [passes]))
+{
+   // Fetch the configuration.
+   const U32 maxThreads = argc < 2 ? 8 : getMax( dAtoi(argv[1]), 1 );
+   const U32 stringCount = argc < 3 ? 20000 : getMax( dAtoi(argv[2]), 1 );
+   const U32 passes = argc < 4 ? 8 : getMax( dAtoi(argv[3]), 1 );
+
+   // Use a unique prefix each time the benchmark runs so that the first pass always inserts.
+   static U32 benchmarkRun = 0;
+   benchmarkRun++;
+
+   char (*pStrings)[32] = new char[stringCount][32];
+   Vector<StringTableBenchmarkWorker> workers;
+   Vector<Thread*> threads;
+   workers.setSize( maxThreads );
+   threads.setSize( maxThreads );
+
+   char* pBuffer = Con::getReturnBuffer( 256 );
+   pBuffer[0] = '\0';
+   U32 bufferLength = 0;
+
+   for ( U32 threadCount = 1; threadCount <= maxThreads; threadCount *= 2 )
+   {
+      // Generate strings that are not in the table.
+      for ( U32 index = 0; index < stringCount; ++index )
+      {
+         dSprintf( pStrings[index], sizeof(pStrings[index]), "StringTableBenchmark_%d_%d_%d", benchmarkRun, threadCount, index );
+      }
+
+      // Run the workers.
+      const U32 startTime = Platform::getRealMilliseconds();
+      for ( U32 threadIndex = 0; threadIndex < threadCount; ++threadIndex )
+      {
+         StringTableBenchmarkWorker& worker = workers[threadIndex];
+         worker.mThreadIndex = threadIndex;
+         worker.mStringCount = stringCount;
+         worker.mPasses = passes;
+         worker.mStrings = pStrings;
+         worker.mMisses = 0;
+         threads[threadIndex] = new Thread( stringTableBenchmarkWorker, &worker );
+      }
+
+      // Wait for the workers.
+      U32 misses = 0;
+      for ( U32 threadIndex = 0; threadIndex < threadCount; ++threadIndex )
+      {
+         threads[threadIndex]->join();
+         delete threads[threadIndex];
+         misses += workers[threadIndex].mMisses;
+      }
+      const U32 elapsedTime = getMax( Platform::getRealMilliseconds() - startTime, (U32)1 );
+
+      // Report.
+      const U32 operations = threadCount * stringCount * passes;
+      const U32 throughput = operations / elapsedTime;
+      Con::printf( "StringTable benchmark: %d threads, %d inserts and lookups in %dms, %d thousand per second, %d thousand per second per thread.",
+         threadCount, operations, elapsedTime, throughput, throughput / threadCount );
+
+      if ( misses > 0 )
+         Con::warnf( "StringTable benchmark: %d lookups did not return the inserted entry.", misses );
+
+      bufferLength += dSprintf( pBuffer + bufferLength, 256 - bufferLength, bufferLength == 0 ? "%d" : " %d", throughput );
+   }
+
+   delete [] pStrings;
+
+   return pBuffer;
+}
+
+ConsoleFunctionGroupEnd( StringTable );
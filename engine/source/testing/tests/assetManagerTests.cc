@@ -0,0 +1,102 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _ASSET_MANAGER_H_
+#include "assets/assetManager.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class AssetManagerTestCallback : public AssetLoadCallback
+{
+public:
+   AssetManagerTestCallback() : mLoadedCount( 0 ), mFailedCount( 0 ), mGroupCompleteCount( 0 ), mCompletedGroupId( 0 ) {}
+
+   virtual void onAssetLoaded( StringTableEntry assetId, const bool success )
+   {
+      if ( success )
+         mLoadedCount++;
+      else
+         mFailedCount++;
+   }
+
+   virtual void onAssetLoadGroupComplete( const U32 groupId )
+   {
+      mGroupCompleteCount++;
+      mCompletedGroupId = groupId;
+   }
+
+   U32 mLoadedCount;
+   U32 mFailedCount;
+   U32 mGroupCompleteCount;
+   U32 mCompletedGroupId;
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetManagerTests, AsyncLoadGroupTest )
+{
+   AssetManager assetManager;
+   Vector<StringTableEntry> assetIds;
+
+   // An empty group completes when the loads are next processed rather than before its Id is returned.
+   AssetManagerTestCallback emptyCallback;
+   const U32 emptyGroupId = assetManager.loadAssetGroupAsync( assetIds, &emptyCallback );
+   ASSERT_EQ( (U32)0, emptyCallback.mGroupCompleteCount ) << "An empty group completed before its Id was returned.";
+   ASSERT_FALSE( assetManager.isAsyncLoadGroupComplete( emptyGroupId ) ) << "An empty group completed before the loads were processed.";
+   ASSERT_FLOAT_EQ( 1.0f, assetManager.getAsyncLoadGroupProgress( emptyGroupId ) ) << "An empty group has something left to load.";
+
+   // Wait for the empty group.
+   assetManager.finishAsyncLoads();
+   ASSERT_EQ( (U32)1, emptyCallback.mGroupCompleteCount ) << "An empty group did not complete.";
+   ASSERT_EQ( emptyGroupId, emptyCallback.mCompletedGroupId ) << "The wrong group completed.";
+   ASSERT_TRUE( assetManager.isAsyncLoadGroupComplete( emptyGroupId ) ) << "An empty group is still pending.";
+
+   // Queue a group of assets that are not declared, including one twice.
+   AssetManagerTestCallback groupCallback;
+   assetIds.push_back( StringTable->insert( "AssetManagerTests:MissingA" ) );
+   assetIds.push_back( StringTable->insert( "AssetManagerTests:MissingB" ) );
+   assetIds.push_back( StringTable->insert( "AssetManagerTests:MissingA" ) );
+   const U32 groupId = assetManager.loadAssetGroupAsync( assetIds, &groupCallback );
+   ASSERT_NE( emptyGroupId, groupId ) << "Groups were given the same Id.";
+   ASSERT_EQ( (U32)2, assetManager.getPendingAsyncLoadCount() ) << "Each asset in the group should be queued once.";
+
+   // Wait for the group.
+   assetManager.finishAsyncLoads();
+   ASSERT_EQ( (U32)0, assetManager.getPendingAsyncLoadCount() ) << "Loads are still pending.";
+   ASSERT_EQ( (U32)0, groupCallback.mLoadedCount ) << "Assets that are not declared were loaded.";
+   ASSERT_EQ( (U32)2, groupCallback.mFailedCount ) << "Each asset should fail to load once.";
+   ASSERT_EQ( (U32)1, groupCallback.mGroupCompleteCount ) << "The group did not complete once.";
+   ASSERT_EQ( groupId, groupCallback.mCompletedGroupId ) << "The wrong group completed.";
+   ASSERT_TRUE( assetManager.isAsyncLoadGroupComplete( groupId ) ) << "The group is still pending.";
+   ASSERT_EQ( (U32)1, emptyCallback.mGroupCompleteCount ) << "The empty group completed again.";
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,326 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _BATCH_RENDER_H_
+#include "2d/core/BatchRender.h"
+#endif
+
+#ifndef _DGL_H_
+#include "graphics/dgl.h"
+#endif
+
+#ifndef _MRECT_H_
+#include "math/mRect.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define BATCHRENDER_UNITTEST_QUADS      1024
+
+//-----------------------------------------------------------------------------
+
+static void submitBatchRenderTestQuad( BatchRender& batchRender, TextureHandle& texture, const F32 offset, const ColorF& color = ColorF(-1.0f, -1.0f, -1.0f) )
+{
+    batchRender.SubmitQuad(
+        Vector2( offset, 0.0f ), Vector2( offset + 1.0f, 0.0f ), Vector2( offset + 1.0f, 1.0f ), Vector2( offset, 1.0f ),
+        Vector2( 0.0f, 1.0f ), Vector2( 1.0f, 1.0f ), Vector2( 1.0f, 0.0f ), Vector2( 0.0f, 0.0f ),
+        texture, color );
+}
+
+//-----------------------------------------------------------------------------
+
+static U32 packBatchRenderTestColor( const U8 red, const U8 green, const U8 blue, const U8 alpha )
+{
+    const U8 packed[4] = { red, green, blue, alpha };
+    U32 packedColor;
+    dMemcpy( &packedColor, packed, sizeof(packedColor) );
+    return packedColor;
+}
+
+//-----------------------------------------------------------------------------
+
+/// Captures the vertices each draw reads, in draw order, so the batched data can be checked.
+class BatchRenderTestExecutor : public RenderCommandExecutor
+{
+public:
+    struct DrawnVertex
+    {
+        U32     mIndex;
+        Vector2 mPosition;
+        U32     mColor;
+    };
+
+    BatchRenderTestExecutor() { reset(); }
+
+    virtual void execute( const RenderCommandBuffer& commands )
+    {
+        const RenderCommand* pVertexArrays = NULL;
+
+        for ( U32 commandIndex = 0; commandIndex < commands.getCommandCount(); ++commandIndex )
+        {
+            const RenderCommand& command = commands.getCommand( commandIndex );
+
+            if ( command.mType == RenderCommand::SetVertexArrays )
+            {
+                pVertexArrays = &command;
+                mStride = command.mVertexArrays.mStride;
+                mColored = command.mVertexArrays.mpColor != NULL;
+            }
+            else if ( command.mType == RenderCommand::Draw && pVertexArrays != NULL )
+            {
+                // Read each vertex through the arrays as the draw would.
+                for ( U32 n = 0; n < command.mDraw.mCount; ++n )
+                {
+                    DrawnVertex vertex;
+                    vertex.mIndex = command.mDraw.mpIndices != NULL ? command.mDraw.mpIndices[n] : command.mDraw.mFirst + n;
+
+                    const U32 offset = vertex.mIndex * pVertexArrays->mVertexArrays.mStride;
+                    const F32* pPosition = (const F32*)((const U8*)pVertexArrays->mVertexArrays.mpPosition + offset);
+                    vertex.mPosition.Set( pPosition[0], pPosition[1] );
+
+                    vertex.mColor = 0xFFFFFFFF;
+                    if ( pVertexArrays->mVertexArrays.mpColor != NULL )
+                        dMemcpy( &vertex.mColor, pVertexArrays->mVertexArrays.mpColor + offset, sizeof(vertex.mColor) );
+
+                    mVertices.push_back( vertex );
+                }
+            }
+        }
+    }
+
+    void reset()
+    {
+        mVertices.clear();
+        mStride = 0;
+        mColored = false;
+    }
+
+    Vector<DrawnVertex> mVertices;
+    U32 mStride;
+    bool mColored;
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( BatchRenderTests, TriangleRunTest )
+{
+    // Batch capturing the drawn vertices.
+    BatchRenderTestExecutor executor;
+    BatchRender* pBatchRender = new BatchRender();
+    DebugStats debugStats;
+    TextureHandle texture;
+    pBatchRender->setDebugStats( &debugStats );
+    pBatchRender->setRenderCommandExecutor( &executor );
+
+    // Contiguous quads are drawn as a single run.
+    for ( U32 index = 0; index < 100; ++index )
+        submitBatchRenderTestQuad( *pBatchRender, texture, (F32)index );
+    pBatchRender->flush();
+    ASSERT_EQ( (U32)1, debugStats.batchDrawCallsSorted ) << "Quads were not drawn in a single call.";
+    ASSERT_EQ( (U32)200, debugStats.batchMaxTriangleDrawn ) << "Wrong triangle count drawn.";
+    ASSERT_EQ( (U32)400, debugStats.batchMaxVertexBuffer ) << "Quads should use four vertices each.";
+
+    // The positions, texture coordinates and colors are interleaved.
+    ASSERT_EQ( (U32)(sizeof(Vector2) * 2 + sizeof(U32)), executor.mStride ) << "The vertices were not interleaved.";
+    ASSERT_FALSE( executor.mColored ) << "Uncolored quads used colors.";
+    ASSERT_EQ( 600, executor.mVertices.size() ) << "Wrong quad index count.";
+
+    // Each quad is two triangles over its four vertices, the top vertices being swapped.
+    const U32 quadIndices[6] = { 0, 1, 2, 3, 2, 1 };
+    const Vector2 quadCorners[4] = { Vector2( 0.0f, 0.0f ), Vector2( 1.0f, 0.0f ), Vector2( 0.0f, 1.0f ), Vector2( 1.0f, 1.0f ) };
+    for ( U32 index = 0; index < 600; ++index )
+    {
+        const U32 quad = index / 6;
+        const U32 corner = quadIndices[index % 6];
+        const BatchRenderTestExecutor::DrawnVertex& vertex = executor.mVertices[index];
+        ASSERT_EQ( quad * 4 + corner, vertex.mIndex ) << "Wrong quad index.";
+        ASSERT_EQ( quadCorners[corner].x + quad, vertex.mPosition.x ) << "Wrong quad vertex position.";
+        ASSERT_EQ( quadCorners[corner].y, vertex.mPosition.y ) << "Wrong quad vertex position.";
+    }
+
+    // Mixed quads and triangles are drawn as a single call in strict order.
+    const Vector2 triangleVertices[6] = { Vector2( 0.0f, 0.0f ), Vector2( 1.0f, 0.0f ), Vector2( 0.0f, 1.0f ), Vector2( 1.0f, 0.0f ), Vector2( 1.0f, 1.0f ), Vector2( 0.0f, 1.0f ) };
+    debugStats.reset();
+    pBatchRender->setStrictOrderMode( true );
+    submitBatchRenderTestQuad( *pBatchRender, texture, 0.0f );
+    pBatchRender->SubmitTriangles( 6, triangleVertices, triangleVertices, texture );
+    submitBatchRenderTestQuad( *pBatchRender, texture, 1.0f );
+    pBatchRender->flush();
+    ASSERT_EQ( (U32)1, debugStats.batchDrawCallsStrict ) << "Mixed primitives were not drawn in a single call.";
+    ASSERT_EQ( (U32)6, debugStats.batchMaxTriangleDrawn ) << "Wrong mixed triangle count drawn.";
+    ASSERT_EQ( (U32)14, debugStats.batchMaxVertexBuffer ) << "Wrong mixed vertex count.";
+    pBatchRender->setStrictOrderMode( false );
+
+    // The merged runs index the quads and triangles in the order submitted.
+    const U32 mixedIndices[18] = { 0, 1, 2, 3, 2, 1, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 12, 11 };
+    ASSERT_EQ( 600 + 18, executor.mVertices.size() ) << "Wrong mixed index count.";
+    for ( U32 index = 0; index < 18; ++index )
+        ASSERT_EQ( mixedIndices[index], executor.mVertices[600 + index].mIndex ) << "Wrong mixed index.";
+    for ( U32 index = 0; index < 6; ++index )
+    {
+        ASSERT_EQ( triangleVertices[index].x, executor.mVertices[606 + index].mPosition.x ) << "Wrong triangle vertex position.";
+        ASSERT_EQ( triangleVertices[index].y, executor.mVertices[606 + index].mPosition.y ) << "Wrong triangle vertex position.";
+    }
+    ASSERT_EQ( 2.0f, executor.mVertices[613].mPosition.x ) << "Wrong quad vertex position after the triangles.";
+
+    // Changing between colored and uncolored vertices flushes.
+    executor.reset();
+    debugStats.reset();
+    submitBatchRenderTestQuad( *pBatchRender, texture, 0.0f );
+    submitBatchRenderTestQuad( *pBatchRender, texture, 1.0f, ColorF( 1.0f, 0.5f, 0.25f, 1.0f ) );
+    submitBatchRenderTestQuad( *pBatchRender, texture, 2.0f, ColorF( 0.0f, 0.0f, 0.0f, 0.5f ) );
+    pBatchRender->flush();
+    ASSERT_EQ( (U32)1, debugStats.batchColorStateFlush ) << "Color changes were not flushed.";
+    ASSERT_EQ( (U32)2, debugStats.batchDrawCallsSorted ) << "Colored quads were not batched.";
+
+    // Colors are packed as RGBA8 and uncolored vertices are drawn white.
+    ASSERT_TRUE( executor.mColored ) << "Colored quads did not use colors.";
+    ASSERT_EQ( 18, executor.mVertices.size() ) << "Wrong colored index count.";
+    for ( U32 index = 0; index < 18; ++index )
+    {
+        const U32 expectedColor = index < 6 ? 0xFFFFFFFF : (index < 12 ? packBatchRenderTestColor( 255, 128, 64, 255 ) : packBatchRenderTestColor( 0, 0, 0, 128 ));
+        ASSERT_EQ( expectedColor, executor.mVertices[index].mColor ) << "Wrong packed color.";
+    }
+
+    // Filling the buffer flushes.
+    debugStats.reset();
+    for ( U32 index = 0; index <= BATCHRENDER_MAXQUADS; ++index )
+        submitBatchRenderTestQuad( *pBatchRender, texture, (F32)index );
+    pBatchRender->flush();
+    ASSERT_EQ( (U32)1, debugStats.batchBufferFullFlush ) << "A full buffer was not flushed.";
+    ASSERT_EQ( (U32)(BATCHRENDER_MAXQUADS * 2), debugStats.batchMaxTriangleDrawn ) << "A full buffer was not drawn in a single call.";
+
+    // Colored quads are drawn as a single run too.
+    debugStats.reset();
+    for ( U32 index = 0; index < 100; ++index )
+        submitBatchRenderTestQuad( *pBatchRender, texture, (F32)index, ColorF( 1.0f, 1.0f, 1.0f, 1.0f ) );
+    pBatchRender->flush();
+    ASSERT_EQ( (U32)0, debugStats.batchColorStateFlush ) << "Colored quads were flushed.";
+    ASSERT_EQ( (U32)1, debugStats.batchDrawCallsSorted ) << "Colored quads were not drawn in a single call.";
+    ASSERT_EQ( (U32)200, debugStats.batchMaxTriangleDrawn ) << "Wrong colored triangle count drawn.";
+
+    delete pBatchRender;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BatchRenderTests, RenderCommandTest )
+{
+    // Redundant state and texture binds are not recorded.
+    RenderCommandBuffer commands;
+    RenderStateBlock state;
+    commands.setState( state );
+    commands.bindTexture( 1 );
+    commands.setState( state );
+    commands.bindTexture( 1 );
+    ASSERT_EQ( (U32)1, commands.getStateChangeCount() ) << "A redundant state was recorded.";
+    ASSERT_EQ( (U32)1, commands.getTextureBindCount() ) << "A redundant texture bind was recorded.";
+    commands.resetState();
+    commands.setState( state );
+    commands.bindTexture( 2 );
+    ASSERT_EQ( (U32)2, commands.getStateChangeCount() ) << "A state after a reset was not recorded.";
+    ASSERT_EQ( (U32)2, commands.getTextureBindCount() ) << "A texture change was not recorded.";
+
+    // Batch replaying the commands without a rendering context.
+    NullRenderCommandExecutor executor;
+    BatchRender* pBatchRender = new BatchRender();
+    DebugStats debugStats;
+    TextureHandle texture;
+    pBatchRender->setDebugStats( &debugStats );
+    pBatchRender->setRenderCommandExecutor( &executor );
+
+    // Contiguous quads are a single state, texture bind and draw.
+    for ( U32 index = 0; index < 100; ++index )
+        submitBatchRenderTestQuad( *pBatchRender, texture, (F32)index );
+    pBatchRender->flush();
+    ASSERT_EQ( (U32)1, executor.getExecuteCount() ) << "The commands were not executed once.";
+    ASSERT_EQ( (U32)1, executor.getStateChangeCount() ) << "Wrong state change count.";
+    ASSERT_EQ( (U32)1, executor.getTextureBindCount() ) << "Wrong texture bind count.";
+    ASSERT_EQ( (U32)1, executor.getDrawCallCount() ) << "Wrong draw call count.";
+    ASSERT_EQ( (U32)200, executor.getPrimitiveCount() ) << "Wrong triangle count.";
+
+    // Mixed runs are a single indexed draw.
+    const Vector2 triangleVertices[3] = { Vector2( 0.0f, 0.0f ), Vector2( 1.0f, 0.0f ), Vector2( 0.0f, 1.0f ) };
+    executor.reset();
+    submitBatchRenderTestQuad( *pBatchRender, texture, 0.0f );
+    pBatchRender->SubmitTriangles( 3, triangleVertices, triangleVertices, texture );
+    submitBatchRenderTestQuad( *pBatchRender, texture, 1.0f );
+    pBatchRender->flush();
+    ASSERT_EQ( (U32)1, executor.getDrawCallCount() ) << "Mixed runs were not drawn in a single call.";
+    ASSERT_EQ( (U32)5, executor.getPrimitiveCount() ) << "Wrong mixed triangle count.";
+
+    // Wireframe does not bind textures.
+    executor.reset();
+    pBatchRender->setWireframeMode( true );
+    submitBatchRenderTestQuad( *pBatchRender, texture, 0.0f );
+    pBatchRender->flush();
+    pBatchRender->setWireframeMode( false );
+    ASSERT_EQ( (U32)0, executor.getTextureBindCount() ) << "A texture was bound in wireframe mode.";
+
+    // Null render records but does not execute.
+    executor.reset();
+    pBatchRender->setNullRender( true );
+    submitBatchRenderTestQuad( *pBatchRender, texture, 0.0f );
+    pBatchRender->flush();
+    ASSERT_EQ( (U32)0, executor.getExecuteCount() ) << "A null render was executed.";
+    pBatchRender->setNullRender( false );
+
+    // Blend changes flush and replay a state change and draw each.
+    executor.reset();
+    debugStats.reset();
+    for ( U32 index = 0; index < BATCHRENDER_UNITTEST_QUADS; ++index )
+    {
+        if ( (index & 255) == 0 )
+            pBatchRender->setBlendMode( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, ColorF( 1.0f, 1.0f, 1.0f, (index & 256) ? 1.0f : 0.5f ) );
+
+        submitBatchRenderTestQuad( *pBatchRender, texture, (F32)(index & 255) );
+    }
+    pBatchRender->flush();
+    ASSERT_EQ( (U32)(BATCHRENDER_UNITTEST_QUADS / 256 - 1), debugStats.batchBlendStateFlush ) << "Wrong blend flush count.";
+    ASSERT_EQ( (U32)(BATCHRENDER_UNITTEST_QUADS / 256), executor.getExecuteCount() ) << "Wrong replay count.";
+    ASSERT_EQ( (U32)(BATCHRENDER_UNITTEST_QUADS / 256), executor.getStateChangeCount() ) << "Wrong replayed state change count.";
+    ASSERT_EQ( (U32)(BATCHRENDER_UNITTEST_QUADS / 256), executor.getDrawCallCount() ) << "Wrong replayed draw call count.";
+    ASSERT_EQ( (U32)(BATCHRENDER_UNITTEST_QUADS * 2), executor.getPrimitiveCount() ) << "Wrong replayed triangle count.";
+
+    delete pBatchRender;
+
+    // The dgl draws replay through the current executor.
+    executor.reset();
+    dglSetRenderCommandExecutor( &executor );
+    dglDrawRectFill( RectI( 0, 0, 10, 10 ), ColorI( 255, 0, 0, 255 ) );
+    dglSetRenderCommandExecutor( NULL );
+    ASSERT_EQ( (U32)1, executor.getDrawCallCount() ) << "A filled rectangle was not recorded.";
+    ASSERT_EQ( (U32)2, executor.getPrimitiveCount() ) << "Wrong filled rectangle triangle count.";
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,227 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _GBITMAP_H_
+#include "graphics/gBitmap.h"
+#endif
+
+#ifndef _BITMAP_DECODER_H_
+#include "graphics/bitmapDecoder.h"
+#endif
+
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
+#ifndef _MEMSTREAM_H_
+#include "io/memstream.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define BITMAPDECODER_UNITTEST_BUFFER_SIZE     65536
+#define BITMAPDECODER_UNITTEST_PATH            "modules/ToyAssets"
+
+//-----------------------------------------------------------------------------
+
+TEST( BitmapDecoderTests, LayoutTest )
+{
+   // Create an RGB bitmap that is not a power-of-two.
+   GBitmap sourceBitmap( 5, 3, false, GBitmap::RGB );
+   for ( U32 y = 0; y < sourceBitmap.getHeight(); ++y )
+   {
+      for ( U32 x = 0; x < sourceBitmap.getWidth(); ++x )
+      {
+         U8* pPixel = sourceBitmap.getAddress( x, y );
+         pPixel[0] = (U8)(x * 40);
+         pPixel[1] = (U8)(y * 80);
+         pPixel[2] = (U8)(x * y * 10);
+      }
+   }
+
+   // Write it as a PNG.
+   U8* pBuffer = new U8[BITMAPDECODER_UNITTEST_BUFFER_SIZE];
+   MemStream writeStream( BITMAPDECODER_UNITTEST_BUFFER_SIZE, pBuffer, false, true );
+   ASSERT_TRUE( sourceBitmap.writePNG( writeStream ) ) << "Failed to write the PNG.";
+   const U32 pngSize = writeStream.getPosition();
+
+   // Check reading the whole bitmap still works.
+   MemStream readStream( pngSize, pBuffer, true, false );
+   GBitmap readBitmap;
+   ASSERT_TRUE( readBitmap.readPNG( readStream ) ) << "Failed to read the PNG.";
+   ASSERT_EQ( sourceBitmap.byteSize, readBitmap.byteSize ) << "The PNG was read with the wrong size.";
+   ASSERT_EQ( 0, dMemcmp( sourceBitmap.getBits(), readBitmap.getBits(), sourceBitmap.byteSize ) ) << "The PNG was read incorrectly.";
+
+   // Check decoding to a power-of-two matches padding the bitmap.
+   MemStream decodeStream( pngSize, pBuffer, true, false );
+   GBitmap* pDecodedBitmap = BitmapDecoder::decode( decodeStream, true, BitmapDecoder::PowerOfTwo );
+   ASSERT_TRUE( pDecodedBitmap != NULL ) << "Failed to decode the PNG.";
+   ASSERT_EQ( (U32)8, pDecodedBitmap->getWidth() ) << "The bitmap was not padded.";
+   ASSERT_EQ( (U32)4, pDecodedBitmap->getHeight() ) << "The bitmap was not padded.";
+   ASSERT_EQ( sourceBitmap.getWidth(), pDecodedBitmap->getImageWidth() ) << "The image size was not kept.";
+   ASSERT_EQ( sourceBitmap.getHeight(), pDecodedBitmap->getImageHeight() ) << "The image size was not kept.";
+
+   GBitmap* pPaddedBitmap = sourceBitmap.createPowerOfTwoBitmap();
+   ASSERT_EQ( 0, dMemcmp( pPaddedBitmap->getBits(), pDecodedBitmap->getBits(), pPaddedBitmap->byteSize ) ) << "The decoded padding is incorrect.";
+   delete pPaddedBitmap;
+   delete pDecodedBitmap;
+
+   // Check decoding to 16-bit.
+   MemStream convertStream( pngSize, pBuffer, true, false );
+   pDecodedBitmap = BitmapDecoder::decode( convertStream, true, BitmapDecoder::PowerOfTwo | BitmapDecoder::Force16Bit );
+   ASSERT_TRUE( pDecodedBitmap != NULL ) << "Failed to decode the PNG to 16-bit.";
+   ASSERT_EQ( GBitmap::RGB565, pDecodedBitmap->getFormat() ) << "The bitmap was not converted.";
+   const U8* pSourcePixel = sourceBitmap.getAddress( 4, 2 );
+   const U16 expectedPixel = (U16)(((pSourcePixel[0] & 0xF8) << 8) | ((pSourcePixel[1] & 0xFC) << 3) | ((pSourcePixel[2] & 0xF8) >> 3));
+   ASSERT_EQ( expectedPixel, *(const U16*)pDecodedBitmap->getAddress( 7, 3 ) ) << "The bitmap was converted incorrectly.";
+   delete pDecodedBitmap;
+
+   // Check decoding a JPEG.
+   MemStream jpegWriteStream( BITMAPDECODER_UNITTEST_BUFFER_SIZE, pBuffer, false, true );
+   ASSERT_TRUE( sourceBitmap.writeJPEG( jpegWriteStream ) ) << "Failed to write the JPEG.";
+   MemStream jpegReadStream( jpegWriteStream.getPosition(), pBuffer, true, false );
+   pDecodedBitmap = BitmapDecoder::decode( jpegReadStream, false, BitmapDecoder::PowerOfTwo );
+   ASSERT_TRUE( pDecodedBitmap != NULL ) << "Failed to decode the JPEG.";
+   ASSERT_EQ( (U32)8, pDecodedBitmap->getWidth() ) << "The JPEG was not padded.";
+   ASSERT_EQ( sourceBitmap.getWidth(), pDecodedBitmap->getImageWidth() ) << "The JPEG image size was not kept.";
+   delete pDecodedBitmap;
+
+   delete [] pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BitmapDecoderTests, PreloadTest )
+{
+   // Register textures without uploading them.
+   const bool dglRender = TextureManager::mDGLRender;
+   TextureManager::mDGLRender = false;
+
+   // Preload a bitmap for a file that does not exist using an unexpanded path as loose files and asset folders can be.
+   GBitmap* pPreloadedBitmap = new GBitmap( 4, 4, false, GBitmap::RGBA );
+   TextureManager::addPreloadedBitmap( "bitmapDecoderTests/preloaded.png", pPreloadedBitmap );
+
+   // Check loading the texture takes the preloaded bitmap rather than reading the file.
+   {
+      TextureHandle texture( "bitmapDecoderTests/preloaded.png", TextureHandle::BitmapKeepTexture );
+      ASSERT_FALSE( texture.IsNull() ) << "The preloaded bitmap was not found.";
+      ASSERT_TRUE( texture.getBitmap() == pPreloadedBitmap ) << "The texture did not use the preloaded bitmap.";
+   }
+
+   // Check flushing discards preloaded bitmaps that were not used.
+   TextureManager::addPreloadedBitmap( "bitmapDecoderTests/flushed.png", new GBitmap( 4, 4, false, GBitmap::RGBA ) );
+   TextureManager::flushPreloadedBitmaps();
+   {
+      TextureHandle texture( "bitmapDecoderTests/flushed.png", TextureHandle::BitmapKeepTexture );
+      ASSERT_TRUE( texture.IsNull() ) << "The flushed bitmap was still used.";
+   }
+
+   TextureManager::mDGLRender = dglRender;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BitmapDecoderTests, ToyAssetsTest )
+{
+   // Find the images.
+   char pathBuffer[1024];
+   Platform::makeFullPathName( BITMAPDECODER_UNITTEST_PATH, pathBuffer, sizeof(pathBuffer) );
+   Vector<StringTableEntry> bitmapFiles;
+   BitmapDecoder::findBitmapFiles( pathBuffer, true, bitmapFiles );
+
+   // The images ship with the repository so there should always be some.
+   ASSERT_GT( bitmapFiles.size(), 0 ) << "No images were found in '" << pathBuffer << "'.";
+
+   // Decode the bitmaps across the thread pool.
+   Vector<BitmapDecoder::Request> requests;
+   for ( S32 index = 0; index < bitmapFiles.size(); ++index )
+   {
+      BitmapDecoder::Request request;
+      request.mBitmapFile = bitmapFiles[index];
+      request.mFlags = BitmapDecoder::PowerOfTwo;
+      request.mpBitmap = NULL;
+      requests.push_back( request );
+   }
+   BitmapDecoder::decode( requests.address(), requests.size() );
+
+   // Check each bitmap matches reading it and padding it as the texture manager used to.
+   for ( S32 index = 0; index < bitmapFiles.size(); ++index )
+   {
+      FileStream stream;
+      ASSERT_TRUE( stream.open( bitmapFiles[index], FileStream::Read ) ) << "Failed to open an image.";
+
+      GBitmap* pBitmap = new GBitmap();
+      const bool png = dStricmp( dStrrchr( bitmapFiles[index], '.' ), ".png" ) == 0;
+      ASSERT_TRUE( png ? pBitmap->readPNG( stream ) : pBitmap->readJPEG( stream ) ) << "Failed to read an image.";
+      stream.close();
+
+      // Check the header matches the image.
+      U32 headerWidth, headerHeight;
+      GBitmap::BitmapFormat headerFormat;
+      ASSERT_TRUE( BitmapDecoder::readImageInfo( bitmapFiles[index], headerWidth, headerHeight, headerFormat ) ) << "Failed to read an image header.";
+      ASSERT_EQ( pBitmap->getWidth(), headerWidth ) << "An image header has the wrong width.";
+      ASSERT_EQ( pBitmap->getHeight(), headerHeight ) << "An image header has the wrong height.";
+      ASSERT_EQ( pBitmap->getFormat(), headerFormat ) << "An image header has the wrong format.";
+
+      GBitmap* pPaddedBitmap = pBitmap->createPowerOfTwoBitmap();
+      const GBitmap* pExpectedBitmap = pPaddedBitmap != NULL ? pPaddedBitmap : pBitmap;
+
+      GBitmap* pDecodedBitmap = BitmapDecoder::decode( bitmapFiles[index] );
+      ASSERT_TRUE( pDecodedBitmap != NULL ) << "Failed to decode an image.";
+      ASSERT_TRUE( requests[index].mpBitmap != NULL ) << "Failed to decode an image on the thread pool.";
+
+      const GBitmap* pDecodedBitmaps[2] = { pDecodedBitmap, requests[index].mpBitmap };
+      for ( U32 decodedIndex = 0; decodedIndex < 2; ++decodedIndex )
+      {
+         const GBitmap* pDecoded = pDecodedBitmaps[decodedIndex];
+         ASSERT_EQ( pExpectedBitmap->getFormat(), pDecoded->getFormat() ) << "An image was decoded with the wrong format.";
+         ASSERT_EQ( pBitmap->getWidth(), pDecoded->getImageWidth() ) << "An image size was not kept.";
+         ASSERT_EQ( pBitmap->getHeight(), pDecoded->getImageHeight() ) << "An image size was not kept.";
+         ASSERT_EQ( pExpectedBitmap->byteSize, pDecoded->byteSize ) << "An image was decoded with the wrong size.";
+         ASSERT_EQ( 0, dMemcmp( pExpectedBitmap->getBits(), pDecoded->getBits(), pExpectedBitmap->byteSize ) ) << "An image was decoded incorrectly.";
+      }
+
+      delete pDecodedBitmap;
+      delete pPaddedBitmap;
+      delete pBitmap;
+   }
+
+   for ( S32 index = 0; index < requests.size(); ++index )
+      delete requests[index].mpBitmap;
+}
+
+#endif // TORQUE_SHIPPING
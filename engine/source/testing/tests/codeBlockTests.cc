@@ -0,0 +1,281 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _COMPILER_H_
+#include "console/compiler.h"
+#endif
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+#ifndef _BITSTREAM_H_
+#include "io/bitStream.h"
+#endif
+
+#ifndef _MEMSTREAM_H_
+#include "io/memstream.h"
+#endif
+
+#ifndef _PLATFORM_FILEIO_H_
+#include "platform/platformFileIO.h"
+#endif
+
+#ifndef _SCRIPTCACHE_H_
+#include "console/scriptCache.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define CODEBLOCK_UNITTEST_SCRIPTCACHE_PATH     "_unitTestScriptCache_RemoveMe"
+#define CODEBLOCK_UNITTEST_SCRIPTCACHE_MODULE   "CodeBlockTests"
+
+//-----------------------------------------------------------------------------
+
+static U32 sCodeBlockTestFormatCount = 0;
+
+static const char* formatCodeBlockTestArg( const void* pData, char* pBuffer, const U32 bufferSize )
+{
+   sCodeBlockTestFormatCount++;
+   dSprintf( pBuffer, bufferSize, "formatted %d", *(const S32*)pData );
+   return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( CodeBlockTests, CallSiteCacheTest )
+{
+   // Define a method on two namespaces and a loop calling it on objects of both.
+   Con::evaluate(
+      "function CodeBlockTestA::value(%this) { return 1; }"
+      "function CodeBlockTestB::value(%this) { return 10; }"
+      "function codeBlockTestSum(%a, %b, %count)"
+      "{"
+      "   %sum = 0;"
+      "   for (%i = 0; %i < %count; %i++)"
+      "      %sum += %a.value() + %b.value();"
+      "   return %sum;"
+      "}"
+      "$CodeBlockTestA = new ScriptObject() { class = CodeBlockTestA; };"
+      "$CodeBlockTestB = new ScriptObject() { class = CodeBlockTestB; };" );
+
+   // Check the cached calls resolve the same methods.
+   CodeBlock::smCallSiteNamespaceHits = 0;
+   CodeBlock::smCallSiteObjectHits = 0;
+   ASSERT_EQ( 1100, dAtoi( Con::evaluate( "codeBlockTestSum($CodeBlockTestA, $CodeBlockTestB, 100);" ) ) ) << "Cached calls returned the wrong result.";
+   ASSERT_GT( CodeBlock::smCallSiteNamespaceHits, (U32)0 ) << "Namespace lookups were not cached.";
+   ASSERT_GT( CodeBlock::smCallSiteObjectHits, (U32)0 ) << "Object lookups were not cached.";
+
+   // Redefining the method must invalidate the caches.
+   Con::evaluate( "function CodeBlockTestA::value(%this) { return 2; }" );
+   ASSERT_EQ( 1200, dAtoi( Con::evaluate( "codeBlockTestSum($CodeBlockTestA, $CodeBlockTestB, 100);" ) ) ) << "Cached calls were not invalidated.";
+
+   // Replacing an object must not reuse the cached object.
+   Con::evaluate( "$CodeBlockTestA.delete(); $CodeBlockTestA = new ScriptObject() { class = CodeBlockTestB; };" );
+   ASSERT_EQ( 2000, dAtoi( Con::evaluate( "codeBlockTestSum($CodeBlockTestA, $CodeBlockTestB, 100);" ) ) ) << "A deleted object was called.";
+
+   // Calls through warm call sites must not look anything up.
+   CodeBlock::smCallSiteNamespaceHits = 0;
+   CodeBlock::smCallSiteNamespaceMisses = 0;
+   CodeBlock::smCallSiteObjectHits = 0;
+   CodeBlock::smCallSiteObjectMisses = 0;
+   ASSERT_EQ( 2000, dAtoi( Con::evaluate( "codeBlockTestSum($CodeBlockTestA, $CodeBlockTestB, 100);" ) ) ) << "Cached calls returned the wrong result.";
+   ASSERT_EQ( (U32)200, CodeBlock::smCallSiteNamespaceHits ) << "Namespace lookups were not cached.";
+   ASSERT_EQ( (U32)0, CodeBlock::smCallSiteNamespaceMisses ) << "Namespace lookups missed a warm cache.";
+   ASSERT_EQ( (U32)200, CodeBlock::smCallSiteObjectHits ) << "Object lookups were not cached.";
+   ASSERT_EQ( (U32)0, CodeBlock::smCallSiteObjectMisses ) << "Object lookups missed a warm cache.";
+
+   Con::evaluate( "$CodeBlockTestA.delete(); $CodeBlockTestB.delete();" );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( CodeBlockTests, TypedArgumentTest )
+{
+   // Define a method that formats its arguments.
+   Con::evaluate(
+      "function CodeBlockTestTyped::format(%this, %object, %int, %negative, %float, %vector, %string)"
+      "{"
+      "   return %this.getId() SPC %object.getId() SPC %int SPC %negative SPC %float SPC getWord(%vector, 1) SPC %string;"
+      "}"
+      "function CodeBlockTestTyped::add(%this, %a, %b) { return %a + %b; }"
+      "function CodeBlockTestTyped::first(%this, %a) { return %a; }"
+      "function CodeBlockTestTyped::second(%this, %a, %b) { return %b; }"
+      "$CodeBlockTestTyped = new ScriptObject() { class = CodeBlockTestTyped; };" );
+
+   SimObject* pObject = Sim::findObject( Con::getVariable( "$CodeBlockTestTyped" ) );
+   ASSERT_TRUE( pObject != NULL ) << "Could not find the test object.";
+
+   // Check typed arguments arrive as they would have been formatted.
+   Con::TypedArg formatArgs[6] = { pObject, 42, -7, 0.5f, Con::TypedArg( 1.5f, -2.25f ), "text" };
+   char expected[128];
+   dSprintf( expected, sizeof(expected), "%d %d 42 -7 0.5 -2.25 text", pObject->getId(), pObject->getId() );
+   ASSERT_STREQ( expected, Con::executeTyped( pObject, "format", 6, formatArgs ) ) << "Typed arguments were passed incorrectly.";
+
+   // Check typed arguments match formatted arguments.
+   Con::TypedArg addArgs[2] = { 3, 0.25f };
+   const F32 formattedResult = dAtof( Con::executef( pObject, 3, "add", "3", "0.25" ) );
+   ASSERT_EQ( formattedResult, dAtof( Con::executeTyped( pObject, "add", 2, addArgs ) ) ) << "Typed arguments differ from formatted arguments.";
+
+   // Check formatted arguments are only formatted when the callback takes them.
+   const S32 formatData = 7;
+   Con::TypedArg lazyArgs[2] = { 1, Con::TypedArg( &formatCodeBlockTestArg, &formatData ) };
+   sCodeBlockTestFormatCount = 0;
+   ASSERT_STREQ( "1", Con::executeTyped( pObject, "first", 2, lazyArgs ) ) << "Formatted arguments were passed incorrectly.";
+   ASSERT_EQ( (U32)0, sCodeBlockTestFormatCount ) << "An argument the callback does not take was formatted.";
+   ASSERT_STREQ( "formatted 7", Con::executeTyped( pObject, "second", 2, lazyArgs ) ) << "Formatted arguments were passed incorrectly.";
+   ASSERT_EQ( (U32)1, sCodeBlockTestFormatCount ) << "An argument the callback takes was not formatted.";
+
+   Con::evaluate( "$CodeBlockTestTyped.delete();" );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( CodeBlockTests, CompileToStreamTest )
+{
+   // Compile a script to memory as the script cache archives do.
+   InfiniteBitStream compiledStream;
+   CodeBlock* pCompileBlock = new CodeBlock();
+   const bool compiled = pCompileBlock->compileToStream( compiledStream, StringTable->insert( "codeBlockStreamTest.cs" ),
+      "function codeBlockStreamTest(%a, %b) { return %a * %b SPC \"streamed\"; }" );
+   delete pCompileBlock;
+   ASSERT_TRUE( compiled ) << "The script failed to compile.";
+   ASSERT_GT( compiledStream.getPosition(), (U32)0 ) << "No code was written.";
+
+   // Syntax errors must not produce code.
+   InfiniteBitStream invalidStream;
+   pCompileBlock = new CodeBlock();
+   ASSERT_FALSE( pCompileBlock->compileToStream( invalidStream, StringTable->insert( "codeBlockStreamInvalid.cs" ), "function {" ) ) << "An invalid script compiled.";
+   delete pCompileBlock;
+
+   // Read the code back from memory and run it.
+   MemStream memoryStream( compiledStream.getPosition(), compiledStream.getBuffer(), true, false );
+   CodeBlock* pCodeBlock = new CodeBlock();
+   ASSERT_TRUE( pCodeBlock->read( StringTable->insert( "codeBlockStreamTest.cs" ), memoryStream ) ) << "The code could not be read.";
+   pCodeBlock->exec( 0, StringTable->insert( "codeBlockStreamTest.cs" ), NULL, 0, NULL, false, NULL, 0 );
+
+   ASSERT_STREQ( "42 streamed", Con::evaluate( "codeBlockStreamTest(6, 7);" ) ) << "The streamed code returned the wrong result.";
+}
+
+//-----------------------------------------------------------------------------
+
+static bool writeScriptCacheTestFile( const char* pScriptFile, const char* pScript )
+{
+   File file;
+   if ( file.open( pScriptFile, File::Write ) != File::Ok )
+      return false;
+
+   const bool written = file.write( dStrlen( pScript ), pScript ) == File::Ok;
+   file.close();
+   return written;
+}
+
+//-----------------------------------------------------------------------------
+
+// Removes the module and its files however the test exits.
+struct ScriptCacheTestCleanup
+{
+   ScriptCacheTestCleanup( StringTableEntry moduleId, StringTableEntry modulePath, StringTableEntry scriptFile, StringTableEntry archiveFile ) :
+      mModuleId( moduleId ), mModulePath( modulePath ), mScriptFile( scriptFile ), mArchiveFile( archiveFile ) {}
+
+   ~ScriptCacheTestCleanup()
+   {
+      ScriptCache::unloadModule( mModuleId );
+      Platform::fileDelete( mScriptFile );
+      Platform::fileDelete( mArchiveFile );
+      Platform::deleteDirectory( mModulePath );
+   }
+
+   StringTableEntry mModuleId;
+   StringTableEntry mModulePath;
+   StringTableEntry mScriptFile;
+   StringTableEntry mArchiveFile;
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( CodeBlockTests, ScriptCacheTest )
+{
+   // Create a module path holding a script.
+   char pathBuffer[1024];
+   Platform::makeFullPathName( CODEBLOCK_UNITTEST_SCRIPTCACHE_PATH, pathBuffer, sizeof(pathBuffer) );
+   StringTableEntry modulePath = StringTable->insert( pathBuffer );
+   StringTableEntry moduleId = StringTable->insert( CODEBLOCK_UNITTEST_SCRIPTCACHE_MODULE );
+
+   char fileBuffer[1024];
+   dSprintf( fileBuffer, sizeof(fileBuffer), "%s/scriptCacheTest.cs", modulePath );
+   StringTableEntry scriptFile = StringTable->insert( fileBuffer );
+   dSprintf( fileBuffer, sizeof(fileBuffer), "%s/%s.dsa", modulePath, moduleId );
+   StringTableEntry archiveFile = StringTable->insert( fileBuffer );
+
+   ScriptCacheTestCleanup cleanup( moduleId, modulePath, scriptFile, archiveFile );
+
+   ASSERT_TRUE( Platform::createPath( scriptFile ) ) << "Could not create the module path.";
+   ASSERT_TRUE( writeScriptCacheTestFile( scriptFile, "function scriptCacheTest() { return \"first\"; }" ) ) << "Could not write the script.";
+
+   // Check loading the module compiles the script and writes the archive.
+   ScriptCache* pScriptCache = ScriptCache::loadModule( moduleId, modulePath );
+   ASSERT_TRUE( pScriptCache != NULL ) << "Could not load the module archive.";
+   ASSERT_EQ( (U32)1, pScriptCache->getEntryCount() ) << "The script was not cached.";
+   ASSERT_TRUE( Platform::isFile( archiveFile ) ) << "The archive was not written.";
+
+   // Check exec runs the cached script.
+   ASSERT_TRUE( dAtob( Con::executef( 2, "exec", scriptFile ) ) ) << "The cached script could not be executed.";
+   ASSERT_STREQ( "first", Con::evaluate( "scriptCacheTest();" ) ) << "The cached script returned the wrong result.";
+
+   // Check the archive is read back.
+   ScriptCache::unloadModule( moduleId );
+   pScriptCache = ScriptCache::loadModule( moduleId, modulePath );
+   ASSERT_TRUE( pScriptCache != NULL ) << "Could not reload the module archive.";
+   ASSERT_EQ( (U32)1, pScriptCache->getEntryCount() ) << "The archive was not read.";
+   MemStream* pCachedStream = ScriptCache::openScript( scriptFile );
+   ASSERT_TRUE( pCachedStream != NULL ) << "The script was not found in the archive.";
+   delete pCachedStream;
+
+   // Check a changed script is recompiled.
+   ScriptCache::unloadModule( moduleId );
+   ASSERT_TRUE( writeScriptCacheTestFile( scriptFile, "function scriptCacheTest() { return \"second\"; }" ) ) << "Could not write the script.";
+   pScriptCache = ScriptCache::loadModule( moduleId, modulePath );
+   ASSERT_TRUE( dAtob( Con::executef( 2, "exec", scriptFile ) ) ) << "The changed script could not be executed.";
+   ASSERT_STREQ( "second", Con::evaluate( "scriptCacheTest();" ) ) << "The stale script was executed.";
+
+   // Check a removed script is dropped.
+   ScriptCache::unloadModule( moduleId );
+   Platform::fileDelete( scriptFile );
+   pScriptCache = ScriptCache::loadModule( moduleId, modulePath );
+   ASSERT_TRUE( pScriptCache != NULL ) << "Could not reload the module archive.";
+   ASSERT_EQ( (U32)0, pScriptCache->getEntryCount() ) << "The removed script was still cached.";
+   ASSERT_TRUE( ScriptCache::openScript( scriptFile ) == NULL ) << "The removed script was still found.";
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,115 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLEOBJECT_H_
+#include "console/consoleObject.h"
+#endif
+
+#ifndef _SPRITE_H_
+#include "2d/sceneobject/Sprite.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define CONSOLEOBJECT_UNITTEST_TAML_FILE        "_unitTestTaml_RemoveMe.taml"
+
+//-----------------------------------------------------------------------------
+
+static const AbstractClassRep::Field* findFieldLinear( const AbstractClassRep* pClassRep, StringTableEntry fieldName )
+{
+   for ( S32 index = 0; index < pClassRep->mFieldList.size(); ++index )
+   {
+      if ( pClassRep->mFieldList[index].pFieldname == fieldName )
+         return &pClassRep->mFieldList[index];
+   }
+
+   return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleObjectTests, FieldLookupTest )
+{
+   // Check every class resolves its fields as a linear scan would.
+   for ( AbstractClassRep* pClassRep = AbstractClassRep::getClassList(); pClassRep != NULL; pClassRep = pClassRep->getNextClass() )
+   {
+      const AbstractClassRep::FieldList& fields = pClassRep->mFieldList;
+
+      for ( S32 index = 0; index < fields.size(); ++index )
+      {
+         StringTableEntry fieldName = fields[index].pFieldname;
+         ASSERT_EQ( findFieldLinear( pClassRep, fieldName ), pClassRep->findField( fieldName ) ) << "Field '" << fieldName << "' on class '" << pClassRep->getClassName() << "' resolved incorrectly.";
+      }
+
+      ASSERT_TRUE( pClassRep->findField( StringTable->insert( "ConsoleObjectTestsMissingField" ) ) == NULL ) << "Class '" << pClassRep->getClassName() << "' found a missing field.";
+   }
+
+   // Check lookups are case insensitive.
+   AbstractClassRep* pSpriteClassRep = AbstractClassRep::findClassRep( "Sprite" );
+   ASSERT_TRUE( pSpriteClassRep != NULL ) << "Could not find the Sprite class.";
+   ASSERT_TRUE( pSpriteClassRep->findField( StringTable->insert( "position" ) ) != NULL ) << "Field lookup was case sensitive.";
+   ASSERT_EQ( pSpriteClassRep->findField( StringTable->insert( "Position" ) ), pSpriteClassRep->findField( StringTable->insert( "POSITION" ) ) ) << "Field lookup was case sensitive.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleObjectTests, FieldAccessTest )
+{
+   // Set fields through the field lookup.
+   Sprite* pSprite = new Sprite();
+   ASSERT_TRUE( pSprite->registerObject() ) << "Could not register the sprite.";
+   pSprite->setDataField( StringTable->insert( "Size" ), NULL, "2 3" );
+   pSprite->setDataField( StringTable->insert( "FlipX" ), NULL, "1" );
+   ASSERT_TRUE( pSprite->getSize() == Vector2( 2.0f, 3.0f ) ) << "The size field was not set.";
+   ASSERT_TRUE( pSprite->getFlipX() ) << "The flip field was not set.";
+   ASSERT_STREQ( "1", pSprite->getDataField( StringTable->insert( "flipx" ), NULL ) ) << "Field access was case sensitive.";
+
+   // Check fields that are not members become dynamic fields.
+   pSprite->setDataField( StringTable->insert( "ConsoleObjectTestsDynamicField" ), NULL, "dynamic" );
+   ASSERT_STREQ( "dynamic", pSprite->getDataField( StringTable->insert( "ConsoleObjectTestsDynamicField" ), NULL ) ) << "The dynamic field was not set.";
+
+   // Check TAML reads the fields back.
+   Taml taml;
+   ASSERT_TRUE( taml.write( pSprite, CONSOLEOBJECT_UNITTEST_TAML_FILE ) ) << "Could not write the sprite.";
+   pSprite->deleteObject();
+
+   Sprite* pReadSprite = taml.read<Sprite>( CONSOLEOBJECT_UNITTEST_TAML_FILE );
+   Platform::fileDelete( CONSOLEOBJECT_UNITTEST_TAML_FILE );
+   ASSERT_TRUE( pReadSprite != NULL ) << "Could not read the sprite.";
+   ASSERT_TRUE( pReadSprite->getSize() == Vector2( 2.0f, 3.0f ) ) << "The size field was not read.";
+   ASSERT_TRUE( pReadSprite->getFlipX() ) << "The flip field was not read.";
+   ASSERT_STREQ( "dynamic", pReadSprite->getDataField( StringTable->insert( "ConsoleObjectTestsDynamicField" ), NULL ) ) << "The dynamic field was not read.";
+   pReadSprite->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
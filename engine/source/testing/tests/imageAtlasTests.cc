@@ -0,0 +1,105 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _MRECT_H_
+#include "math/mRect.h"
+#endif
+
+#ifndef _ATLAS_PACKER_H_
+#include "2d/core/AtlasPacker.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define ATLASPACKER_UNITTEST_SIZE       1024
+#define ATLASPACKER_UNITTEST_RECTS      4000
+
+//-----------------------------------------------------------------------------
+
+TEST( ImageAtlasTests, AtlasPackerTest )
+{
+    AtlasPacker packer;
+    packer.reset( ATLASPACKER_UNITTEST_SIZE, ATLASPACKER_UNITTEST_SIZE );
+
+    // Invalid rectangles are not packed.
+    Point2I position;
+    ASSERT_FALSE( packer.pack( 0, 16, position ) ) << "An empty rectangle was packed.";
+    ASSERT_FALSE( packer.pack( ATLASPACKER_UNITTEST_SIZE + 1, 16, position ) ) << "A rectangle wider than the area was packed.";
+
+    // The first rectangle is placed at the origin.
+    ASSERT_TRUE( packer.pack( 32, 32, position ) ) << "A rectangle was not packed.";
+    ASSERT_TRUE( position == Point2I( 0, 0 ) ) << "The first rectangle was not placed at the origin.";
+
+    // Pack pseudo-random rectangles until the area is full.
+    Vector<RectI> packedRects;
+    packedRects.push_back( RectI( position, Point2I( 32, 32 ) ) );
+    U32 seed = 1;
+    for ( U32 index = 0; index < ATLASPACKER_UNITTEST_RECTS; ++index )
+    {
+        seed = seed * 1664525 + 1013904223;
+        const S32 width = 4 + (S32)((seed >> 8) % 120);
+        seed = seed * 1664525 + 1013904223;
+        const S32 height = 4 + (S32)((seed >> 8) % 120);
+
+        if ( packer.pack( width, height, position ) )
+            packedRects.push_back( RectI( position, Point2I( width, height ) ) );
+    }
+
+    // Check the rectangles are within the area and do not overlap.
+    const RectI area( 0, 0, ATLASPACKER_UNITTEST_SIZE, ATLASPACKER_UNITTEST_SIZE );
+    for ( S32 index = 0; index < packedRects.size(); ++index )
+    {
+        const RectI& rect = packedRects[index];
+        ASSERT_TRUE( area.contains( rect ) ) << "A rectangle was packed outside the area.";
+
+        for ( S32 otherIndex = index + 1; otherIndex < packedRects.size(); ++otherIndex )
+        {
+            const RectI& other = packedRects[otherIndex];
+            const bool overlaps = rect.point.x < other.point.x + other.extent.x && other.point.x < rect.point.x + rect.extent.x &&
+                                  rect.point.y < other.point.y + other.extent.y && other.point.y < rect.point.y + rect.extent.y;
+            ASSERT_FALSE( overlaps ) << "Packed rectangles overlap.";
+        }
+    }
+
+    // The skyline should fill most of the area.
+    ASSERT_GT( packer.getOccupancy(), 0.75f ) << "The area was poorly packed.";
+
+    // A full area rejects a rectangle of its own size until it is reset.
+    ASSERT_FALSE( packer.pack( ATLASPACKER_UNITTEST_SIZE, ATLASPACKER_UNITTEST_SIZE, position ) ) << "A rectangle was packed into a full area.";
+    packer.reset( ATLASPACKER_UNITTEST_SIZE, ATLASPACKER_UNITTEST_SIZE );
+    ASSERT_EQ( 0.0f, packer.getOccupancy() ) << "A reset area is not empty.";
+    ASSERT_TRUE( packer.pack( ATLASPACKER_UNITTEST_SIZE, ATLASPACKER_UNITTEST_SIZE, position ) ) << "A rectangle the size of an empty area was not packed.";
+    ASSERT_EQ( 1.0f, packer.getOccupancy() ) << "A filled area is not fully occupied.";
+}
+
+#endif // TORQUE_SHIPPING
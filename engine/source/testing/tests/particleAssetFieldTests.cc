@@ -0,0 +1,139 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _PARTICLE_ASSET_FIELD_H_
+#include "2d/assets/ParticleAssetField.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define PARTICLE_UNITTEST_FIELD_SAMPLES         10000
+
+//-----------------------------------------------------------------------------
+
+static void configureTestField( ParticleAssetField& field )
+{
+    // Initialize the field.
+    field.initialize( 1.0f, 0.0f, 100.0f, 1.0f );
+
+    // Add some data keys.
+    field.addDataKey( 0.0f, 10.0f );
+    field.addDataKey( 0.1f, 80.0f );
+    field.addDataKey( 0.25f, 35.0f );
+    field.addDataKey( 0.5f, 60.0f );
+    field.addDataKey( 0.6f, 5.0f );
+    field.addDataKey( 0.9f, 95.0f );
+    field.addDataKey( 1.0f, 0.0f );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, LookupAccuracyTest )
+{
+    ParticleAssetField field;
+    configureTestField( field );
+
+    // Compile the lookup.
+    field.compileLookup();
+
+    // Check we've got a lookup.
+    ASSERT_GT( field.getLookupResolution(), (U32)0 ) << "Lookup was not compiled.";
+
+    // Calculate the allowed error.
+    const F32 maxError = Con::getFloatVariable( PARTICLE_ASSET_FIELD_LOOKUP_TOLERANCE, 0.001f ) * (field.getMaxValue() - field.getMinValue()) + 0.0001f;
+
+    // Check the lookup against the exact evaluation.
+    for ( U32 index = 0; index <= PARTICLE_UNITTEST_FIELD_SAMPLES; ++index )
+    {
+        const F32 time = (F32)index / PARTICLE_UNITTEST_FIELD_SAMPLES;
+        ASSERT_NEAR( field.getFieldValueExact( time ), field.getFieldValue( time ), maxError ) << "Lookup is out of tolerance at time " << time;
+    }
+
+    // Change a data key.
+    field.setDataKeyValue( 3, 20.0f );
+
+    // Check the lookup was rebuilt.
+    ASSERT_NEAR( 20.0f, field.getFieldValue( 0.5f ), maxError ) << "Lookup was not rebuilt after a data key change.";
+
+    // Check repeat time.
+    field.setRepeatTime( 2.0f );
+    ASSERT_NEAR( field.getFieldValueExact( 0.3f ), field.getFieldValue( 0.3f ), maxError ) << "Lookup does not respect repeat time.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, LookupResolutionTest )
+{
+    // A straight line needs the lowest resolution.
+    ParticleAssetField field;
+    field.initialize( 1.0f, 0.0f, 100.0f, 1.0f );
+    field.addDataKey( 0.0f, 0.0f );
+    field.addDataKey( 1.0f, 100.0f );
+    field.compileLookup();
+    ASSERT_EQ( (U32)1, field.getLookupResolution() ) << "A linear field did not use the lowest resolution.";
+    ASSERT_NEAR( 50.0f, field.getFieldValue( 0.5f ), 0.01f ) << "A linear field was sampled incorrectly.";
+
+    // Changing the value scale must rebuild the lookup.
+    field.setValueScale( 2.0f );
+    ASSERT_NEAR( field.getFieldValueExact( 0.5f ), field.getFieldValue( 0.5f ), 0.01f ) << "Lookup was not rebuilt after a value scale change.";
+
+    // A single data key has nothing to interpolate.
+    ParticleAssetField singleField;
+    singleField.initialize( 1.0f, 0.0f, 100.0f, 1.0f );
+    singleField.setSingleDataKey( 42.0f );
+    singleField.compileLookup();
+    ASSERT_EQ( (U32)0, singleField.getLookupResolution() ) << "A single data key compiled a lookup.";
+    ASSERT_NEAR( 42.0f, singleField.getFieldValue( 0.5f ), 0.0001f ) << "A single data key returned the wrong value.";
+
+    // A tolerance of zero disables the lookup.
+    const F32 tolerance = Con::getFloatVariable( PARTICLE_ASSET_FIELD_LOOKUP_TOLERANCE, 0.001f );
+    Con::setFloatVariable( PARTICLE_ASSET_FIELD_LOOKUP_TOLERANCE, 0.0f );
+
+    ParticleAssetField exactField;
+    configureTestField( exactField );
+    exactField.compileLookup();
+    ASSERT_EQ( (U32)0, exactField.getLookupResolution() ) << "A zero tolerance compiled a lookup.";
+    for ( U32 index = 0; index <= 100; ++index )
+    {
+        const F32 time = (F32)index / 100;
+        ASSERT_EQ( exactField.getFieldValueExact( time ), exactField.getFieldValue( time ) ) << "A zero tolerance did not use the exact evaluation at time " << time;
+    }
+
+    Con::setFloatVariable( PARTICLE_ASSET_FIELD_LOOKUP_TOLERANCE, tolerance );
+}
+
+#endif // TORQUE_SHIPPING
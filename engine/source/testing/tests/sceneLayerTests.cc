@@ -0,0 +1,372 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+#ifndef _SCENE_RENDER_QUEUE_H_
+#include "2d/scene/SceneRenderQueue.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCENE_UNITTEST_LAYER_OBJECTS        64
+#define SCENE_UNITTEST_LAYER_OPERATIONS     2000
+#define SCENE_UNITTEST_RENDER_REQUESTS      200
+#define SCENE_UNITTEST_RENDER_FRAMES        5
+
+//-----------------------------------------------------------------------------
+
+static bool isSceneLayerSorted( Scene* pScene, const U32 sceneLayer )
+{
+    // Fetch layer objects.
+    typeSceneObjectVector layerObjects;
+    pScene->getSceneObjects( layerObjects, sceneLayer );
+
+    // Check the layer is ordered back to front with ties ordered by serial Id.
+    for ( S32 index = 1; index < layerObjects.size(); ++index )
+    {
+        const SceneObject* pBack = layerObjects[index-1];
+        const SceneObject* pFront = layerObjects[index];
+
+        if ( pBack->getSceneLayer() != sceneLayer || pFront->getSceneLayer() != sceneLayer )
+            return false;
+
+        if ( pBack->getSceneLayerDepth() < pFront->getSceneLayerDepth() )
+            return false;
+
+        if ( pBack->getSceneLayerDepth() == pFront->getSceneLayerDepth() && pBack->getSerialId() > pFront->getSerialId() )
+            return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneLayerTests, DepthOrderTest )
+{
+    // Create a scene.
+    Scene* pScene = new Scene();
+    ASSERT_TRUE( pScene->registerObject() ) << "Could not register the scene.";
+
+    // Add objects to a couple of layers with repeated depths.
+    Vector<SceneObject*> sceneObjects;
+    for ( U32 index = 0; index < SCENE_UNITTEST_LAYER_OBJECTS; ++index )
+    {
+        SceneObject* pSceneObject = new SceneObject();
+        pSceneObject->setSceneLayer( index & 1 );
+        pSceneObject->setSceneLayerDepth( (F32)(index % 5) );
+        ASSERT_TRUE( pSceneObject->registerObject() ) << "Could not register the scene object.";
+        pScene->addToScene( pSceneObject );
+        sceneObjects.push_back( pSceneObject );
+    }
+
+    ASSERT_EQ( (U32)(SCENE_UNITTEST_LAYER_OBJECTS / 2), (U32)pScene->getSceneLayerObjects( 0 ).size() ) << "Scene layer has the wrong object count.";
+    ASSERT_TRUE( isSceneLayerSorted( pScene, 0 ) && isSceneLayerSorted( pScene, 1 ) ) << "Scene layers are not sorted.";
+
+    // Reorder the objects.
+    U32 seed = 1;
+    for ( U32 operation = 0; operation < SCENE_UNITTEST_LAYER_OPERATIONS; ++operation )
+    {
+        seed = seed * 1103515245 + 12345;
+        SceneObject* pSceneObject = sceneObjects[(seed >> 16) % SCENE_UNITTEST_LAYER_OBJECTS];
+        const S32 layerIndex = pScene->findSceneLayerIndex( pSceneObject );
+        const S32 layerCount = pScene->getSceneLayerObjects( pSceneObject->getSceneLayer() ).size();
+        ASSERT_NE( -1, layerIndex ) << "Could not find the object in its scene layer.";
+
+        switch( operation % 6 )
+        {
+        case 0:
+            pSceneObject->setSceneLayerDepthFront();
+            ASSERT_EQ( layerCount - 1, pScene->findSceneLayerIndex( pSceneObject ) ) << "Object was not moved to the front.";
+            break;
+
+        case 1:
+            pSceneObject->setSceneLayerDepthBack();
+            ASSERT_EQ( 0, pScene->findSceneLayerIndex( pSceneObject ) ) << "Object was not moved to the back.";
+            break;
+
+        case 2:
+            pSceneObject->setSceneLayerDepthForward();
+            ASSERT_EQ( getMin( layerIndex + 1, layerCount - 1 ), pScene->findSceneLayerIndex( pSceneObject ) ) << "Object was not moved forward.";
+            break;
+
+        case 3:
+            pSceneObject->setSceneLayerDepthBackward();
+            ASSERT_EQ( getMax( layerIndex - 1, 0 ), pScene->findSceneLayerIndex( pSceneObject ) ) << "Object was not moved backward.";
+            break;
+
+        case 4:
+            pSceneObject->setSceneLayerDepth( (F32)((seed >> 8) % 7) );
+            break;
+
+        default:
+            pSceneObject->setSceneLayer( (seed >> 8) % 3 );
+            break;
+        }
+
+        ASSERT_TRUE( isSceneLayerSorted( pScene, 0 ) && isSceneLayerSorted( pScene, 1 ) && isSceneLayerSorted( pScene, 2 ) ) << "Scene layers are not sorted.";
+    }
+
+    // Remove the objects.
+    pScene->clearScene( false );
+    for ( U32 layer = 0; layer < MAX_LAYERS_SUPPORTED; ++layer )
+        ASSERT_EQ( 0, pScene->getSceneLayerObjects( layer ).size() ) << "Scene layer was not cleared.";
+
+    for ( S32 index = 0; index < sceneObjects.size(); ++index )
+        sceneObjects[index]->deleteObject();
+
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 compareRenderRequests( const SceneRenderQueue::RenderSort sortMode, const SceneRenderRequest* pRequestA, const SceneRenderRequest* pRequestB )
+{
+    // These are the comparisons the render queue sorted with before it used sort keys.
+    const S32 serialOrder = pRequestA->mSerialId - pRequestB->mSerialId;
+
+    switch( sortMode )
+    {
+    case SceneRenderQueue::RENDER_SORT_NEWEST:
+        return serialOrder;
+
+    case SceneRenderQueue::RENDER_SORT_OLDEST:
+        return -serialOrder;
+
+    case SceneRenderQueue::RENDER_SORT_BATCH:
+        {
+            const bool renderIsolatedA = pRequestA->mpSceneRenderObject->getBatchIsolated();
+            const bool renderIsolatedB = pRequestB->mpSceneRenderObject->getBatchIsolated();
+            return renderIsolatedA == renderIsolatedB ? serialOrder : renderIsolatedA ? -1 : 1;
+        }
+
+    case SceneRenderQueue::RENDER_SORT_XAXIS:
+    case SceneRenderQueue::RENDER_SORT_INVERSE_XAXIS:
+        {
+            const F32 x1 = pRequestA->mWorldPosition.x + pRequestA->mSortPoint.x;
+            const F32 x2 = pRequestB->mWorldPosition.x + pRequestB->mSortPoint.x;
+            const S32 order = x1 < x2 ? -1 : x1 > x2 ? 1 : 0;
+            return order == 0 ? serialOrder : sortMode == SceneRenderQueue::RENDER_SORT_XAXIS ? order : -order;
+        }
+
+    case SceneRenderQueue::RENDER_SORT_YAXIS:
+    case SceneRenderQueue::RENDER_SORT_INVERSE_YAXIS:
+        {
+            const F32 y1 = pRequestA->mWorldPosition.y + pRequestA->mSortPoint.y;
+            const F32 y2 = pRequestB->mWorldPosition.y + pRequestB->mSortPoint.y;
+            const S32 order = y1 < y2 ? -1 : y1 > y2 ? 1 : 0;
+            return order == 0 ? serialOrder : sortMode == SceneRenderQueue::RENDER_SORT_YAXIS ? order : -order;
+        }
+
+    case SceneRenderQueue::RENDER_SORT_ZAXIS:
+    case SceneRenderQueue::RENDER_SORT_INVERSE_ZAXIS:
+        {
+            const F32 depthA = pRequestA->mDepth;
+            const F32 depthB = pRequestB->mDepth;
+            const S32 order = depthA < depthB ? 1 : depthA > depthB ? -1 : 0;
+            return order == 0 ? serialOrder : sortMode == SceneRenderQueue::RENDER_SORT_ZAXIS ? order : -order;
+        }
+
+    default:
+        return 0;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static bool isRenderQueueSorted( const SceneRenderQueue::RenderSort sortMode, const Vector<SceneRenderRequest*>& submittedRequests, const Vector<SceneRenderRequest*>& sortedRequests )
+{
+    // Sort the submitted requests with a stable insertion sort so ties keep their submission order.
+    Vector<SceneRenderRequest*> expectedRequests;
+    for ( S32 index = 0; index < submittedRequests.size(); ++index )
+    {
+        SceneRenderRequest* pRequest = submittedRequests[index];
+        expectedRequests.push_back( pRequest );
+
+        S32 insertIndex = index;
+        while ( insertIndex > 0 && compareRenderRequests( sortMode, pRequest, expectedRequests[insertIndex-1] ) < 0 )
+        {
+            expectedRequests[insertIndex] = expectedRequests[insertIndex-1];
+            insertIndex--;
+        }
+        expectedRequests[insertIndex] = pRequest;
+    }
+
+    if ( sortedRequests.size() != expectedRequests.size() )
+        return false;
+
+    for ( S32 index = 0; index < expectedRequests.size(); ++index )
+    {
+        if ( sortedRequests[index] != expectedRequests[index] )
+            return false;
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+static void randomizeRenderRequest( SceneRenderRequest* pRequest, U32& seed, const bool uniqueSerialIds, const S32 index )
+{
+    // Use a few values so there are many ties, including negative zero.
+    static const F32 values[] = { -2.5f, -1.0f, -0.0f, 0.0f, 1.0f, 2.5f };
+    const U32 valueCount = sizeof(values) / sizeof(F32);
+
+    seed = seed * 1103515245 + 12345;
+    pRequest->mWorldPosition.Set( values[(seed >> 8) % valueCount], values[(seed >> 12) % valueCount] );
+    pRequest->mSortPoint.Set( 0.0f, (seed >> 16) & 1 ? 1.5f : 0.0f );
+    pRequest->mDepth = values[(seed >> 20) % valueCount];
+
+    // Serial Ids are unique and signed unless checking ties.
+    pRequest->mSerialId = uniqueSerialIds ? (index * 7919) % SCENE_UNITTEST_RENDER_REQUESTS - SCENE_UNITTEST_RENDER_REQUESTS / 2 : index % 3;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneLayerTests, RenderSortTest )
+{
+    static const SceneRenderQueue::RenderSort sortModes[] =
+    {
+        SceneRenderQueue::RENDER_SORT_NEWEST,
+        SceneRenderQueue::RENDER_SORT_OLDEST,
+        SceneRenderQueue::RENDER_SORT_BATCH,
+        SceneRenderQueue::RENDER_SORT_XAXIS,
+        SceneRenderQueue::RENDER_SORT_YAXIS,
+        SceneRenderQueue::RENDER_SORT_ZAXIS,
+        SceneRenderQueue::RENDER_SORT_INVERSE_XAXIS,
+        SceneRenderQueue::RENDER_SORT_INVERSE_YAXIS,
+        SceneRenderQueue::RENDER_SORT_INVERSE_ZAXIS,
+    };
+    const U32 sortModeCount = sizeof(sortModes) / sizeof(SceneRenderQueue::RenderSort);
+
+    // Create a batch isolated and a batched object to render.
+    SceneObject* pIsolatedObject = new SceneObject();
+    pIsolatedObject->setBatchIsolated( true );
+    ASSERT_TRUE( pIsolatedObject->registerObject() ) << "Could not register the scene object.";
+    SceneObject* pBatchedObject = new SceneObject();
+    ASSERT_TRUE( pBatchedObject->registerObject() ) << "Could not register the scene object.";
+
+    U32 seed = 1;
+    for ( U32 sortModeIndex = 0; sortModeIndex < sortModeCount; ++sortModeIndex )
+    {
+        const SceneRenderQueue::RenderSort sortMode = sortModes[sortModeIndex];
+
+        // Check insertion and radix sorted queues with unique and with tied serial Ids.
+        for ( U32 pass = 0; pass < 4; ++pass )
+        {
+            const U32 requestCount = pass & 1 ? SCENE_UNITTEST_RENDER_REQUESTS : 20;
+            const bool uniqueSerialIds = pass < 2;
+
+            // Create the requests.
+            SceneRenderQueue* pRenderQueue = SceneRenderQueueFactory.createObject();
+            pRenderQueue->setSortMode( sortMode );
+            Vector<SceneRenderRequest*> submittedRequests;
+            for ( U32 index = 0; index < requestCount; ++index )
+            {
+                SceneRenderRequest* pRequest = pRenderQueue->createRenderRequest();
+                pRequest->set( index & 1 ? pIsolatedObject : pBatchedObject, Vector2::getZero(), 0.0f );
+                randomizeRenderRequest( pRequest, seed, uniqueSerialIds, index );
+                submittedRequests.push_back( pRequest );
+            }
+
+            // Sort over several frames, reusing the previous order.
+            SceneRenderQueue::SortHistory sortHistory;
+            for ( U32 frame = 0; frame < SCENE_UNITTEST_RENDER_FRAMES; ++frame )
+            {
+                switch( frame )
+                {
+                case 2:
+                    // Move a few requests.
+                    for ( U32 move = 0; move < 4; ++move )
+                    {
+                        seed = seed * 1103515245 + 12345;
+                        const U32 index = (seed >> 8) % submittedRequests.size();
+                        randomizeRenderRequest( submittedRequests[index], seed, uniqueSerialIds, index );
+                    }
+                    break;
+
+                case 3:
+                    // Change the submission order.
+                    for ( S32 index = submittedRequests.size() - 1; index > 0; --index )
+                    {
+                        seed = seed * 1103515245 + 12345;
+                        const S32 swapIndex = (seed >> 8) % (index + 1);
+                        SceneRenderRequest* pRequest = submittedRequests[index];
+                        submittedRequests[index] = submittedRequests[swapIndex];
+                        submittedRequests[swapIndex] = pRequest;
+                    }
+                    break;
+
+                case 4:
+                    // Move every request.
+                    for ( S32 index = 0; index < submittedRequests.size(); ++index )
+                        randomizeRenderRequest( submittedRequests[index], seed, uniqueSerialIds, index );
+                    break;
+
+                default:
+                    break;
+                }
+
+                // Submit the requests.
+                SceneRenderQueue::typeRenderRequestVector& renderRequests = pRenderQueue->getRenderRequests();
+                for ( S32 index = 0; index < submittedRequests.size(); ++index )
+                    renderRequests[index] = submittedRequests[index];
+
+                pRenderQueue->sort( &sortHistory );
+                ASSERT_TRUE( isRenderQueueSorted( sortMode, submittedRequests, renderRequests ) ) << "Render requests were not sorted in the same order as the comparison sort.";
+            }
+
+            // Check sorting without a history.
+            SceneRenderQueue::typeRenderRequestVector& renderRequests = pRenderQueue->getRenderRequests();
+            for ( S32 index = 0; index < submittedRequests.size(); ++index )
+                renderRequests[index] = submittedRequests[index];
+
+            pRenderQueue->sort();
+            ASSERT_TRUE( isRenderQueueSorted( sortMode, submittedRequests, renderRequests ) ) << "Render requests were not sorted in the same order as the comparison sort.";
+
+            SceneRenderQueueFactory.cacheObject( pRenderQueue );
+        }
+    }
+
+    pIsolatedObject->deleteObject();
+    pBatchedObject->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,172 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _COMPILER_H_
+#include "console/compiler.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCRIPTTIER_UNITTEST_ITERATIONS  1000
+#define SCRIPTTIER_UNITTEST_RESULT_SIZE 256
+
+//-----------------------------------------------------------------------------
+
+// Scripts covering loops, string concatenation, method calls and field access.
+static const char* scriptTierTestFunctions =
+   "function ScriptTierTestObject::value(%this, %index) { return %index % 7; }"
+   "function scriptTierLoop(%count)"
+   "{"
+   "   %sum = 0;"
+   "   for (%i = 0; %i < %count; %i++)"
+   "   {"
+   "      %sum += %i * 2;"
+   "      if (%sum >= 1000000)"
+   "         %sum -= 1000000;"
+   "   }"
+   "   return %sum;"
+   "}"
+   "function scriptTierConcat(%count)"
+   "{"
+   "   %text = \"\";"
+   "   for (%i = 0; %i < %count; %i++)"
+   "   {"
+   "      %text = %text @ %i SPC (%i * 0.5) SPC (0 - %i);"
+   "      if (strlen(%text) > 200)"
+   "         %text = \"\";"
+   "   }"
+   "   return %text;"
+   "}"
+   "function scriptTierMethod(%object, %count)"
+   "{"
+   "   %sum = 0;"
+   "   for (%i = 0; %i < %count; %i++)"
+   "      %sum += %object.value(%i);"
+   "   return %sum;"
+   "}"
+   "function scriptTierField(%object, %count)"
+   "{"
+   "   %sum = 0;"
+   "   for (%i = 0; %i < %count; %i++)"
+   "   {"
+   "      %object.counter = %i;"
+   "      %sum += %object.counter % 3;"
+   "   }"
+   "   return %sum;"
+   "}"
+   "function scriptTierFormat(%value)"
+   "{"
+   "   %negative = 0 - %value;"
+   "   %zero = %value * 0;"
+   "   %negativeZero = %zero * -1;"
+   "   %fraction = %value / 3;"
+   "   %large = %value * 1000000000;"
+   "   return %value SPC %negative SPC %zero SPC %negativeZero SPC %fraction SPC %large SPC %undefined;"
+   "}";
+
+static const char* scriptTierTestNames[] = { "loops", "concatenation", "method calls", "field access" };
+
+static const char* scriptTierTestCalls[] =
+{
+   "scriptTierLoop(%d);",
+   "scriptTierConcat(%d);",
+   "scriptTierMethod($ScriptTierTestObject, %d);",
+   "scriptTierField($ScriptTierTestObject, %d);"
+};
+
+static const U32 scriptTierTestCount = sizeof(scriptTierTestCalls) / sizeof(scriptTierTestCalls[0]);
+
+//-----------------------------------------------------------------------------
+
+static void runScriptTierTests( const S32 tierThreshold, const U32 iterations, char results[][SCRIPTTIER_UNITTEST_RESULT_SIZE] )
+{
+   // Define the functions again so they start in the first tier.
+   CodeBlock::smTierThreshold = tierThreshold;
+   Con::evaluate( scriptTierTestFunctions );
+
+   for ( U32 index = 0; index < scriptTierTestCount; ++index )
+   {
+      const char* pResult = Con::evaluatef( scriptTierTestCalls[index], iterations );
+      dStrncpy( results[index], pResult, SCRIPTTIER_UNITTEST_RESULT_SIZE - 1 );
+      results[index][SCRIPTTIER_UNITTEST_RESULT_SIZE - 1] = 0;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ScriptTierTests, FormatTest )
+{
+   const S32 tierThreshold = CodeBlock::smTierThreshold;
+
+   // Format numbers in the first tier.
+   CodeBlock::smTierThreshold = 0;
+   Con::evaluate( scriptTierTestFunctions );
+   char expected[SCRIPTTIER_UNITTEST_RESULT_SIZE];
+   dStrcpy( expected, Con::evaluate( "scriptTierFormat(12);" ) );
+
+   // Format numbers in the second tier.
+   CodeBlock::smTierThreshold = 1;
+   Con::evaluate( scriptTierTestFunctions );
+   const U32 tierFunctionCount = CodeBlock::smTierFunctionCount;
+   ASSERT_STREQ( expected, Con::evaluate( "scriptTierFormat(12);" ) ) << "Local variables were formatted differently in the second tier.";
+   ASSERT_GT( CodeBlock::smTierFunctionCount, tierFunctionCount ) << "The function was not optimized.";
+
+   CodeBlock::smTierThreshold = tierThreshold;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ScriptTierTests, ResultTest )
+{
+   const S32 tierThreshold = CodeBlock::smTierThreshold;
+
+   Con::evaluate( "$ScriptTierTestObject = new ScriptObject() { class = ScriptTierTestObject; };" );
+
+   // Run the scripts in each tier.
+   char firstResults[scriptTierTestCount][SCRIPTTIER_UNITTEST_RESULT_SIZE];
+   char secondResults[scriptTierTestCount][SCRIPTTIER_UNITTEST_RESULT_SIZE];
+   runScriptTierTests( 0, SCRIPTTIER_UNITTEST_ITERATIONS, firstResults );
+   const U32 tierFunctionCount = CodeBlock::smTierFunctionCount;
+   runScriptTierTests( 1, SCRIPTTIER_UNITTEST_ITERATIONS, secondResults );
+   const U32 optimizedCount = CodeBlock::smTierFunctionCount - tierFunctionCount;
+
+   Con::evaluate( "$ScriptTierTestObject.delete();" );
+   CodeBlock::smTierThreshold = tierThreshold;
+
+   // Check each script.
+   ASSERT_GT( optimizedCount, (U32)0 ) << "The functions were not optimized.";
+   for ( U32 index = 0; index < scriptTierTestCount; ++index )
+      ASSERT_STREQ( firstResults[index], secondResults[index] ) << "The tiers returned different results for " << scriptTierTestNames[index] << ".";
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,196 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SIMDICTIONARY_UNITTEST_OBJECTS      20000
+#define SIMDICTIONARY_UNITTEST_FIRSTID      1000000
+#define SIMDICTIONARY_UNITTEST_THREADS      4
+#define SIMDICTIONARY_UNITTEST_LOOKUPS      200000
+#define SIMDICTIONARY_UNITTEST_CHURN        50000
+
+//-----------------------------------------------------------------------------
+
+struct SimDictionaryTestWorker
+{
+   SimIdDictionary*  mDictionary;
+   U32               mThreadIndex;
+   U32               mMismatches;
+};
+
+//-----------------------------------------------------------------------------
+
+static void simDictionaryTestWorker( void* pData )
+{
+   SimDictionaryTestWorker* pWorker = static_cast<SimDictionaryTestWorker*>( pData );
+
+   for ( U32 index = 0; index < SIMDICTIONARY_UNITTEST_LOOKUPS; ++index )
+   {
+      // Look up the stable objects while the main thread churns other ids.
+      const U32 id = SIMDICTIONARY_UNITTEST_FIRSTID + ((index * 7 + pWorker->mThreadIndex) % SIMDICTIONARY_UNITTEST_OBJECTS);
+      SimObject* pObject = pWorker->mDictionary->find( id );
+
+      if ( pObject == NULL || pObject->getId() != id )
+         pWorker->mMismatches++;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimDictionaryTests, IdDictionaryTest )
+{
+   SimIdDictionary* pDictionary = new SimIdDictionary;
+   SimObject** pObjects = new SimObject*[SIMDICTIONARY_UNITTEST_OBJECTS];
+
+   // Insert enough objects to grow the tables several times.
+   for ( U32 index = 0; index < SIMDICTIONARY_UNITTEST_OBJECTS; ++index )
+   {
+      pObjects[index] = new SimObject();
+      pObjects[index]->setId( SIMDICTIONARY_UNITTEST_FIRSTID + index );
+      pDictionary->insert( pObjects[index] );
+   }
+
+   for ( U32 index = 0; index < SIMDICTIONARY_UNITTEST_OBJECTS; ++index )
+      ASSERT_EQ( pObjects[index], pDictionary->find( SIMDICTIONARY_UNITTEST_FIRSTID + index ) ) << "An object was not found.";
+
+   ASSERT_TRUE( pDictionary->find( SIMDICTIONARY_UNITTEST_FIRSTID - 1 ) == NULL ) << "An unknown id was found.";
+   ASSERT_TRUE( pDictionary->find( 0 ) == NULL ) << "The invalid id was found.";
+   ASSERT_TRUE( pDictionary->find( -1 ) == NULL ) << "The invalid id was found.";
+
+   // Remove half of the objects.
+   for ( U32 index = 0; index < SIMDICTIONARY_UNITTEST_OBJECTS; index += 2 )
+      pDictionary->remove( pObjects[index] );
+
+   for ( U32 index = 0; index < SIMDICTIONARY_UNITTEST_OBJECTS; ++index )
+   {
+      SimObject* pExpected = (index & 1) ? pObjects[index] : NULL;
+      ASSERT_EQ( pExpected, pDictionary->find( SIMDICTIONARY_UNITTEST_FIRSTID + index ) ) << "Removing objects broke lookups.";
+   }
+
+   // A reused id must hide the older object and catch stale generations.
+   SimObject* pOriginal = pObjects[1];
+   const U32 originalGeneration = pOriginal->getIdGeneration();
+   SimObject* pReuse = new SimObject();
+   pReuse->setId( pOriginal->getId() );
+   pDictionary->insert( pReuse );
+   ASSERT_EQ( pReuse, pDictionary->find( pOriginal->getId() ) ) << "The newest object with an id was not found.";
+   ASSERT_TRUE( pDictionary->find( pOriginal->getId(), originalGeneration ) == NULL ) << "A stale generation was found.";
+   ASSERT_EQ( pReuse, pDictionary->find( pOriginal->getId(), pReuse->getIdGeneration() ) ) << "The current generation was not found.";
+   pDictionary->remove( pReuse );
+   ASSERT_EQ( pOriginal, pDictionary->find( pOriginal->getId(), originalGeneration ) ) << "The older object was lost.";
+   delete pReuse;
+
+   for ( U32 index = 1; index < SIMDICTIONARY_UNITTEST_OBJECTS; index += 2 )
+      pDictionary->remove( pObjects[index] );
+
+   for ( U32 index = 0; index < SIMDICTIONARY_UNITTEST_OBJECTS; ++index )
+      delete pObjects[index];
+   delete [] pObjects;
+   delete pDictionary;
+
+   SimObjectTable::reclaim();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimDictionaryTests, ContentionTest )
+{
+   SimIdDictionary* pDictionary = new SimIdDictionary;
+
+   // Stable objects looked up by the workers.
+   SimObject** pObjects = new SimObject*[SIMDICTIONARY_UNITTEST_OBJECTS];
+   for ( U32 index = 0; index < SIMDICTIONARY_UNITTEST_OBJECTS; ++index )
+   {
+      pObjects[index] = new SimObject();
+      pObjects[index]->setId( SIMDICTIONARY_UNITTEST_FIRSTID + index );
+      pDictionary->insert( pObjects[index] );
+   }
+
+   SimDictionaryTestWorker workers[SIMDICTIONARY_UNITTEST_THREADS];
+   Thread* threads[SIMDICTIONARY_UNITTEST_THREADS];
+
+   for ( U32 threadIndex = 0; threadIndex < SIMDICTIONARY_UNITTEST_THREADS; ++threadIndex )
+   {
+      SimDictionaryTestWorker& worker = workers[threadIndex];
+      worker.mDictionary = pDictionary;
+      worker.mThreadIndex = threadIndex;
+      worker.mMismatches = 0;
+      threads[threadIndex] = new Thread( simDictionaryTestWorker, &worker );
+   }
+
+   // Create and destroy objects with new ids while the workers look up, growing the tables.
+   SimObject* pChurn = new SimObject();
+   for ( U32 index = 0; index < SIMDICTIONARY_UNITTEST_CHURN; ++index )
+   {
+      pChurn->setId( SIMDICTIONARY_UNITTEST_FIRSTID + SIMDICTIONARY_UNITTEST_OBJECTS + index );
+      pDictionary->insert( pChurn );
+      pDictionary->remove( pChurn );
+   }
+
+   for ( U32 threadIndex = 0; threadIndex < SIMDICTIONARY_UNITTEST_THREADS; ++threadIndex )
+   {
+      threads[threadIndex]->join();
+      delete threads[threadIndex];
+   }
+
+   for ( U32 threadIndex = 0; threadIndex < SIMDICTIONARY_UNITTEST_THREADS; ++threadIndex )
+      ASSERT_EQ( (U32)0, workers[threadIndex].mMismatches ) << "A lookup failed while the dictionary was changing.";
+
+   // The churned ids must be gone and the stable objects must remain.
+   for ( U32 index = 0; index < SIMDICTIONARY_UNITTEST_CHURN; index += 97 )
+      ASSERT_TRUE( pDictionary->find( SIMDICTIONARY_UNITTEST_FIRSTID + SIMDICTIONARY_UNITTEST_OBJECTS + index ) == NULL ) << "A removed object was found.";
+
+   for ( U32 index = 0; index < SIMDICTIONARY_UNITTEST_OBJECTS; ++index )
+      ASSERT_EQ( pObjects[index], pDictionary->find( SIMDICTIONARY_UNITTEST_FIRSTID + index ) ) << "An object was lost while the dictionary was changing.";
+
+   for ( U32 index = 0; index < SIMDICTIONARY_UNITTEST_OBJECTS; ++index )
+   {
+      pDictionary->remove( pObjects[index] );
+      delete pObjects[index];
+   }
+   delete [] pObjects;
+   delete pChurn;
+   delete pDictionary;
+
+   SimObjectTable::reclaim();
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,172 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _SIM_EVENT_QUEUE_H_
+#include "sim/simEventQueue.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SIM_UNITTEST_EVENTQUEUE_EVENTS      50000
+#define SIM_UNITTEST_EVENTQUEUE_OBJECTS     64
+
+//-----------------------------------------------------------------------------
+
+class SimEventQueueTestEvent : public SimEvent
+{
+public:
+   virtual void process( SimObject* object ) {}
+};
+
+//-----------------------------------------------------------------------------
+
+static SimEventQueueTestEvent* createTestEvent( const U32 sequenceCount, const SimTime time, SimObject* pObject )
+{
+   SimEventQueueTestEvent* pEvent = new SimEventQueueTestEvent();
+   pEvent->sequenceCount = sequenceCount;
+   pEvent->startTime = 0;
+   pEvent->time = time;
+   pEvent->destObject = pObject;
+   return pEvent;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimEventQueueTests, OrderTest )
+{
+   SimEventQueue eventQueue;
+
+   // Post events with times out of order and some times repeated.
+   const SimTime times[] = { 50, 10, 30, 10, 50, 20, 10, 40 };
+   const U32 eventCount = sizeof(times) / sizeof(times[0]);
+   for ( U32 index = 0; index < eventCount; ++index )
+      eventQueue.insert( createTestEvent( index+1, times[index], NULL ) );
+
+   ASSERT_EQ( eventCount, eventQueue.size() ) << "Event queue size is incorrect.";
+
+   // Check events are popped by time and then by sequence.
+   SimTime lastTime = 0;
+   U32 lastSequence = 0;
+   while ( !eventQueue.isEmpty() )
+   {
+      SimEvent* pEvent = eventQueue.pop();
+      ASSERT_TRUE( pEvent->time > lastTime || ( pEvent->time == lastTime && pEvent->sequenceCount > lastSequence ) ) << "Events were popped out of order.";
+      lastTime = pEvent->time;
+      lastSequence = pEvent->sequenceCount;
+      delete pEvent;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimEventQueueTests, CancelTest )
+{
+   SimEventQueue eventQueue;
+   U8 objects[2];
+   SimObject* pObjectA = reinterpret_cast<SimObject*>( &objects[0] );
+   SimObject* pObjectB = reinterpret_cast<SimObject*>( &objects[1] );
+
+   // Post events for two objects.
+   for ( U32 index = 0; index < 10; ++index )
+      eventQueue.insert( createTestEvent( index+1, 100 - index, (index & 1) ? pObjectA : pObjectB ) );
+
+   // Cancel by sequence.
+   SimEvent* pEvent = eventQueue.findEvent( 5 );
+   ASSERT_TRUE( pEvent != NULL ) << "Could not find event by sequence.";
+   eventQueue.remove( pEvent );
+   delete pEvent;
+   ASSERT_TRUE( eventQueue.findEvent( 5 ) == NULL ) << "Cancelled event is still pending.";
+
+   // Cancel by object.
+   while ( (pEvent = eventQueue.findObjectEvent( pObjectA )) != NULL )
+   {
+      eventQueue.remove( pEvent );
+      delete pEvent;
+   }
+
+   // Check only the remaining object events are pending.
+   ASSERT_EQ( (U32)4, eventQueue.size() ) << "Object events were not cancelled.";
+   while ( !eventQueue.isEmpty() )
+   {
+      pEvent = eventQueue.pop();
+      ASSERT_EQ( pObjectB, pEvent->destObject ) << "Wrong object event remained.";
+      delete pEvent;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimEventQueueTests, StressTest )
+{
+   SimEventQueue eventQueue;
+   U8 objects[SIM_UNITTEST_EVENTQUEUE_OBJECTS];
+
+   // Post events.
+   for ( U32 index = 0; index < SIM_UNITTEST_EVENTQUEUE_EVENTS; ++index )
+      eventQueue.insert( createTestEvent( index+1, (index * 7919) % 10000, reinterpret_cast<SimObject*>( &objects[index % SIM_UNITTEST_EVENTQUEUE_OBJECTS] ) ) );
+
+   // Cancel every third event.
+   for ( U32 sequence = 1; sequence <= SIM_UNITTEST_EVENTQUEUE_EVENTS; sequence += 3 )
+   {
+      SimEvent* pEvent = eventQueue.findEvent( sequence );
+      ASSERT_TRUE( pEvent != NULL ) << "Could not find event by sequence.";
+      eventQueue.remove( pEvent );
+      delete pEvent;
+   }
+
+   // Check only the cancelled events are gone.
+   for ( U32 sequence = 1; sequence <= SIM_UNITTEST_EVENTQUEUE_EVENTS; ++sequence )
+      ASSERT_EQ( (sequence % 3) != 1, eventQueue.findEvent( sequence ) != NULL ) << "Cancellation changed the wrong event " << sequence;
+
+   // Pop all events checking the order.
+   SimTime lastTime = 0;
+   U32 lastSequence = 0;
+   U32 popCount = 0;
+   while ( !eventQueue.isEmpty() )
+   {
+      SimEvent* pEvent = eventQueue.pop();
+      ASSERT_TRUE( pEvent->time > lastTime || ( pEvent->time == lastTime && pEvent->sequenceCount > lastSequence ) ) << "Events were popped out of order.";
+      lastTime = pEvent->time;
+      lastSequence = pEvent->sequenceCount;
+      popCount++;
+      delete pEvent;
+   }
+
+   ASSERT_EQ( SIM_UNITTEST_EVENTQUEUE_EVENTS - (SIM_UNITTEST_EVENTQUEUE_EVENTS + 2) / 3, popCount ) << "Incorrect number of events were popped.";
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,153 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _SIM_FIELD_DICTIONARY_H_
+#include "sim/simFieldDictionary.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SIMFIELDDICTIONARY_UNITTEST_FIELDS          32
+#define SIMFIELDDICTIONARY_UNITTEST_DICTIONARIES    1000
+
+//-----------------------------------------------------------------------------
+
+static U32 countFields( SimFieldDictionary* pDictionary )
+{
+   U32 count = 0;
+   for ( SimFieldDictionaryIterator itr( pDictionary ); *itr; ++itr )
+      count++;
+
+   return count;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimFieldDictionaryTests, InlineAndHashTest )
+{
+   StringTableEntry slotNames[SIMFIELDDICTIONARY_UNITTEST_FIELDS];
+   char buffer[64];
+   for ( U32 index = 0; index < SIMFIELDDICTIONARY_UNITTEST_FIELDS; ++index )
+   {
+      dSprintf( buffer, sizeof(buffer), "simFieldDictionaryTest%d", index );
+      slotNames[index] = StringTable->insert( buffer );
+   }
+
+   SimFieldDictionary dictionary;
+
+   // Add fields through the inline entries and into the hash table.
+   for ( U32 index = 0; index < SIMFIELDDICTIONARY_UNITTEST_FIELDS; ++index )
+   {
+      dSprintf( buffer, sizeof(buffer), "%d", index );
+      dictionary.setFieldValue( slotNames[index], buffer );
+
+      ASSERT_EQ( index + 1, dictionary.getEntryCount() ) << "The field count is wrong after adding a field.";
+      ASSERT_EQ( index + 1, countFields( &dictionary ) ) << "Iteration missed a field after adding a field.";
+
+      for ( U32 check = 0; check <= index; ++check )
+         ASSERT_EQ( (S32)check, dAtoi( dictionary.getFieldValue( slotNames[check] ) ) ) << "A field has the wrong value.";
+   }
+
+   // Update and remove fields.
+   dictionary.setFieldValue( slotNames[0], "updated" );
+   ASSERT_STREQ( "updated", dictionary.getFieldValue( slotNames[0] ) ) << "A field was not updated.";
+
+   for ( U32 index = 0; index < SIMFIELDDICTIONARY_UNITTEST_FIELDS; index += 2 )
+      dictionary.setFieldValue( slotNames[index], "" );
+
+   ASSERT_EQ( (U32)SIMFIELDDICTIONARY_UNITTEST_FIELDS / 2, countFields( &dictionary ) ) << "Iteration found removed fields.";
+   ASSERT_TRUE( dictionary.getFieldValue( slotNames[0] ) == NULL ) << "A removed field was found.";
+   ASSERT_EQ( 1, dAtoi( dictionary.getFieldValue( slotNames[1] ) ) ) << "A field was lost removing other fields.";
+
+   // Removing inline fields must keep the others.
+   SimFieldDictionary smallDictionary;
+   smallDictionary.setFieldValue( slotNames[0], "a" );
+   smallDictionary.setFieldValue( slotNames[1], "b" );
+   smallDictionary.setFieldValue( slotNames[2], "c" );
+   smallDictionary.setFieldValue( slotNames[1], "" );
+   ASSERT_EQ( (U32)2, countFields( &smallDictionary ) ) << "An inline field was not removed.";
+   ASSERT_STREQ( "a", smallDictionary.getFieldValue( slotNames[0] ) ) << "An inline field was lost.";
+   ASSERT_STREQ( "c", smallDictionary.getFieldValue( slotNames[2] ) ) << "An inline field was lost.";
+
+   // Copying fields must copy both representations.
+   SimFieldDictionary copyDictionary;
+   copyDictionary.assignFrom( &dictionary );
+   ASSERT_EQ( (U32)SIMFIELDDICTIONARY_UNITTEST_FIELDS / 2, countFields( &copyDictionary ) ) << "Fields were not copied.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimFieldDictionaryTests, ManyDictionariesTest )
+{
+   StringTableEntry slotNames[3] =
+   {
+      StringTable->insert( "simFieldDictionaryHealth" ),
+      StringTable->insert( "simFieldDictionaryTeam" ),
+      StringTable->insert( "simFieldDictionaryState" )
+   };
+
+   // Create many objects with a few fields each.
+   SimFieldDictionary** pDictionaries = new SimFieldDictionary*[SIMFIELDDICTIONARY_UNITTEST_DICTIONARIES];
+   for ( U32 index = 0; index < SIMFIELDDICTIONARY_UNITTEST_DICTIONARIES; ++index )
+   {
+      pDictionaries[index] = new SimFieldDictionary;
+      pDictionaries[index]->setFieldValue( slotNames[0], "100" );
+      pDictionaries[index]->setFieldValue( slotNames[1], "1" );
+      pDictionaries[index]->setFieldValue( slotNames[2], "idle" );
+   }
+
+   // Changing one dictionary must not change the others.
+   pDictionaries[0]->setFieldValue( slotNames[0], "50" );
+   pDictionaries[0]->setFieldValue( slotNames[2], "" );
+
+   ASSERT_EQ( (U32)2, countFields( pDictionaries[0] ) ) << "A field was not removed.";
+   ASSERT_EQ( 50, dAtoi( pDictionaries[0]->getFieldValue( slotNames[0] ) ) ) << "A field was not updated.";
+
+   for ( U32 index = 1; index < SIMFIELDDICTIONARY_UNITTEST_DICTIONARIES; ++index )
+   {
+      ASSERT_EQ( (U32)3, countFields( pDictionaries[index] ) ) << "A dictionary has the wrong field count.";
+      ASSERT_EQ( 100, dAtoi( pDictionaries[index]->getFieldValue( slotNames[0] ) ) ) << "A field has the wrong value.";
+      ASSERT_EQ( 1, dAtoi( pDictionaries[index]->getFieldValue( slotNames[1] ) ) ) << "A field has the wrong value.";
+      ASSERT_STREQ( "idle", pDictionaries[index]->getFieldValue( slotNames[2] ) ) << "A field has the wrong value.";
+   }
+
+   for ( U32 index = 0; index < SIMFIELDDICTIONARY_UNITTEST_DICTIONARIES; ++index )
+      delete pDictionaries[index];
+   delete [] pDictionaries;
+}
+
+#endif // TORQUE_SHIPPING
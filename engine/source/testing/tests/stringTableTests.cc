@@ -0,0 +1,219 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define STRINGTABLE_UNITTEST_STRINGS        20000
+#define STRINGTABLE_UNITTEST_THREADS        4
+#define STRINGTABLE_UNITTEST_PASSES         8
+
+//-----------------------------------------------------------------------------
+
+struct StringTableTestWorker
+{
+   U32               mThreadIndex;
+   char              (*mStrings)[32];
+   StringTableEntry* mEntries;
+   U32               mMismatches;
+};
+
+//-----------------------------------------------------------------------------
+
+static void stringTableTestWorker( void* pData )
+{
+   StringTableTestWorker* pWorker = static_cast<StringTableTestWorker*>( pData );
+
+   for ( U32 pass = 0; pass < STRINGTABLE_UNITTEST_PASSES; ++pass )
+   {
+      for ( U32 index = 0; index < STRINGTABLE_UNITTEST_STRINGS; ++index )
+      {
+         // Alternate threads walk the strings in opposite directions so they race on the same inserts.
+         const U32 stringIndex = (pWorker->mThreadIndex & 1) ? STRINGTABLE_UNITTEST_STRINGS - 1 - index : index;
+         const char* pString = pWorker->mStrings[stringIndex];
+
+         // Insert and look the string back up.
+         StringTableEntry entry = StringTable->insert( pString );
+         if ( StringTable->lookup( pString ) != entry )
+            pWorker->mMismatches++;
+
+         // The entry must never change.
+         if ( pWorker->mEntries[stringIndex] == NULL )
+            pWorker->mEntries[stringIndex] = entry;
+         else if ( pWorker->mEntries[stringIndex] != entry )
+            pWorker->mMismatches++;
+      }
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+struct StringTableTestReader
+{
+   char              (*mStrings)[32];
+   volatile bool     mStop;
+   U32               mMisses;
+};
+
+//-----------------------------------------------------------------------------
+
+static void stringTableTestReader( void* pData )
+{
+   StringTableTestReader* pReader = static_cast<StringTableTestReader*>( pData );
+
+   // Strings inserted before the reader started must always be found, even while the shards resize.
+   while ( !pReader->mStop )
+   {
+      for ( U32 index = 0; index < STRINGTABLE_UNITTEST_STRINGS; ++index )
+      {
+         if ( StringTable->lookup( pReader->mStrings[index] ) == NULL )
+            pReader->mMisses++;
+      }
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( StringTableTests, CaseTest )
+{
+   // Case insensitive inserts return the first string inserted.
+   StringTableEntry insensitive = StringTable->insert( "StringTableCaseTest" );
+   ASSERT_EQ( insensitive, StringTable->insert( "STRINGTABLECASETEST" ) ) << "Case insensitive insert returned a new entry.";
+
+   // Case sensitive inserts add a new string.
+   StringTableEntry sensitive = StringTable->insert( "STRINGTABLECASETEST", true );
+   ASSERT_NE( insensitive, sensitive ) << "Case sensitive insert did not return a new entry.";
+   ASSERT_EQ( sensitive, StringTable->lookup( "STRINGTABLECASETEST", true ) ) << "Case sensitive lookup failed.";
+   ASSERT_EQ( insensitive, StringTable->lookup( "stringtablecasetest" ) ) << "Case insensitive lookup did not find the first entry.";
+
+   // Length limited inserts and lookups.
+   ASSERT_EQ( insensitive, StringTable->insertn( "StringTableCaseTestSuffix", 19 ) ) << "Length limited insert failed.";
+   ASSERT_EQ( insensitive, StringTable->lookupn( "StringTableCaseTestSuffix", 19 ) ) << "Length limited lookup failed.";
+   ASSERT_TRUE( StringTable->lookup( "StringTableCaseTestMissing" ) == NULL ) << "Lookup found a string that was never inserted.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( StringTableTests, ContentionTest )
+{
+   // Generate the strings.
+   char (*pStrings)[32] = new char[STRINGTABLE_UNITTEST_STRINGS][32];
+   for ( U32 index = 0; index < STRINGTABLE_UNITTEST_STRINGS; ++index )
+      dSprintf( pStrings[index], sizeof(pStrings[index]), "StringTableTest_%d", index );
+
+   // Start the workers.
+   StringTableTestWorker workers[STRINGTABLE_UNITTEST_THREADS];
+   Thread* threads[STRINGTABLE_UNITTEST_THREADS];
+   for ( U32 threadIndex = 0; threadIndex < STRINGTABLE_UNITTEST_THREADS; ++threadIndex )
+   {
+      StringTableTestWorker& worker = workers[threadIndex];
+      worker.mThreadIndex = threadIndex;
+      worker.mStrings = pStrings;
+      worker.mEntries = new StringTableEntry[STRINGTABLE_UNITTEST_STRINGS];
+      worker.mMismatches = 0;
+      dMemset( worker.mEntries, 0, sizeof(StringTableEntry) * STRINGTABLE_UNITTEST_STRINGS );
+      threads[threadIndex] = new Thread( stringTableTestWorker, &worker );
+   }
+
+   // Wait for the workers.
+   for ( U32 threadIndex = 0; threadIndex < STRINGTABLE_UNITTEST_THREADS; ++threadIndex )
+   {
+      threads[threadIndex]->join();
+      delete threads[threadIndex];
+   }
+
+   // Check every thread saw the same entries.
+   for ( U32 threadIndex = 0; threadIndex < STRINGTABLE_UNITTEST_THREADS; ++threadIndex )
+   {
+      ASSERT_EQ( (U32)0, workers[threadIndex].mMismatches ) << "StringTable entries were unstable.";
+
+      for ( U32 index = 0; index < STRINGTABLE_UNITTEST_STRINGS; ++index )
+      {
+         ASSERT_EQ( workers[0].mEntries[index], workers[threadIndex].mEntries[index] ) << "Threads were given different entries for the same string.";
+      }
+   }
+
+   for ( U32 threadIndex = 0; threadIndex < STRINGTABLE_UNITTEST_THREADS; ++threadIndex )
+      delete [] workers[threadIndex].mEntries;
+   delete [] pStrings;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( StringTableTests, LookupDuringResizeTest )
+{
+   // Insert the strings the reader looks up.
+   char (*pStrings)[32] = new char[STRINGTABLE_UNITTEST_STRINGS][32];
+   for ( U32 index = 0; index < STRINGTABLE_UNITTEST_STRINGS; ++index )
+   {
+      dSprintf( pStrings[index], sizeof(pStrings[index]), "StringTableResizeTest_%d", index );
+      StringTable->insert( pStrings[index] );
+   }
+
+   // Start the reader.
+   StringTableTestReader reader;
+   reader.mStrings = pStrings;
+   reader.mStop = false;
+   reader.mMisses = 0;
+   Thread* pThread = new Thread( stringTableTestReader, &reader );
+
+   // Insert enough new strings to resize every shard a few times.
+   char buffer[32];
+   for ( U32 index = 0; index < STRINGTABLE_UNITTEST_STRINGS * 8; ++index )
+   {
+      dSprintf( buffer, sizeof(buffer), "StringTableResizeGrow_%d", index );
+      StringTable->insert( buffer );
+   }
+
+   // Stop the reader.
+   reader.mStop = true;
+   pThread->join();
+   delete pThread;
+
+   ASSERT_EQ( (U32)0, reader.mMisses ) << "Lookups missed strings that were already inserted.";
+
+   delete [] pStrings;
+}
+
+#endif // TORQUE_SHIPPING
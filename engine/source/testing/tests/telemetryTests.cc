@@ -0,0 +1,171 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _TELEMETRY_H_
+#include "debug/telemetry.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define TELEMETRY_UNITTEST_FILE         "_unitTestTelemetry_RemoveMe.bin"
+
+static TelemetryCounter sTelemetryTestGauge( "telemetryTestGauge", TelemetryCounter::Gauge );
+static TelemetryCounter sTelemetryTestSum( "telemetryTestSum" );
+static TelemetryHistogram sTelemetryTestHistogram( "telemetryTestHistogram", 1.0f );
+
+//-----------------------------------------------------------------------------
+
+TEST( TelemetryTests, WindowTest )
+{
+   // The first frame only starts the frame timer.
+   Telemetry::endFrame();
+   Telemetry::reset();
+
+   // Record frames with known values.
+   for ( U32 frame = 1; frame <= 100; ++frame )
+   {
+      sTelemetryTestGauge.set( (F32)frame );
+      sTelemetryTestSum.add( 2.0f );
+      sTelemetryTestSum.add( 2.0f );
+      Telemetry::endFrame();
+   }
+
+   ASSERT_EQ( (U32)100, Telemetry::getFrameCount() ) << "Frames were not recorded.";
+   ASSERT_EQ( 99.0f, Telemetry::getWindowPercentile( &sTelemetryTestGauge, 99.0f ) ) << "Wrong window percentile.";
+   ASSERT_EQ( 95.0f, Telemetry::getWindowPercentile( &sTelemetryTestGauge, 50.0f, 10 ) ) << "Wrong percentile of the recent frames.";
+   ASSERT_EQ( 50.5f, Telemetry::getWindowAverage( &sTelemetryTestGauge ) ) << "Wrong window average.";
+   ASSERT_EQ( 100.0f, Telemetry::getWindowMax( &sTelemetryTestGauge ) ) << "Wrong window maximum.";
+   ASSERT_EQ( 4.0f, Telemetry::getWindowMax( &sTelemetryTestSum ) ) << "Sum counters were not reset each frame.";
+   ASSERT_TRUE( TelemetryCounter::find( "frameTime" ) != NULL ) << "The frame time is not recorded.";
+
+   // The window only keeps the most recent frames.
+   for ( U32 frame = 0; frame < Telemetry::WindowFrames; ++frame )
+   {
+      sTelemetryTestGauge.set( 1.0f );
+      Telemetry::endFrame();
+   }
+   ASSERT_EQ( (U32)Telemetry::WindowFrames, Telemetry::getWindowFrameCount() ) << "Wrong window frame count.";
+   ASSERT_EQ( 1.0f, Telemetry::getWindowMax( &sTelemetryTestGauge ) ) << "Old frames were not discarded.";
+
+   // Resetting empties the window and the histograms.
+   Telemetry::reset();
+   ASSERT_EQ( (U32)0, Telemetry::getFrameCount() ) << "The frames were not reset.";
+   ASSERT_EQ( (U32)0, Telemetry::getWindowFrameCount() ) << "The window was not reset.";
+   ASSERT_EQ( 0.0f, Telemetry::getWindowMax( &sTelemetryTestGauge ) ) << "An empty window has a maximum.";
+   ASSERT_EQ( (U32)0, TelemetryHistogram::find( "frameTime" )->getSampleCount() ) << "The frame time histogram was not reset.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TelemetryTests, HistogramTest )
+{
+   sTelemetryTestHistogram.reset();
+   for ( U32 value = 1; value <= 1000; ++value )
+      sTelemetryTestHistogram.record( (F32)value );
+
+   // Percentiles are the upper bounds of buckets a quarter of a doubling wide.
+   ASSERT_EQ( (U32)1000, sTelemetryTestHistogram.getSampleCount() ) << "Samples were not counted.";
+   ASSERT_GE( sTelemetryTestHistogram.getPercentile( 50.0f ), 500.0f ) << "The median is too low.";
+   ASSERT_LE( sTelemetryTestHistogram.getPercentile( 50.0f ), 500.0f * 1.19f ) << "The median is too high.";
+   ASSERT_GE( sTelemetryTestHistogram.getPercentile( 99.0f ), 990.0f ) << "The 99th percentile is too low.";
+   ASSERT_EQ( 1.0f, sTelemetryTestHistogram.getPercentile( 0.0f ) ) << "The minimum is wrong.";
+   ASSERT_TRUE( TelemetryHistogram::find( "telemetryTestHistogram" ) == &sTelemetryTestHistogram ) << "The histogram was not found.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TelemetryTests, StreamTest )
+{
+   char filePath[1024];
+   Con::expandPath( filePath, sizeof(filePath), TELEMETRY_UNITTEST_FILE );
+
+   // Stream some frames to a file.
+   Telemetry::endFrame();
+   ASSERT_TRUE( Telemetry::streamToFile( TELEMETRY_UNITTEST_FILE ) ) << "The stream file could not be opened.";
+   ASSERT_TRUE( Telemetry::isStreaming() ) << "The stream did not open.";
+   for ( U32 frame = 0; frame < 10; ++frame )
+   {
+      sTelemetryTestGauge.set( (F32)frame );
+      Telemetry::endFrame();
+   }
+   Telemetry::closeStream();
+   ASSERT_FALSE( Telemetry::isStreaming() ) << "The stream did not close.";
+
+   // Read the block back.
+   FileStream stream;
+   ASSERT_TRUE( stream.open( filePath, FileStream::Read ) ) << "The stream file could not be read.";
+
+   char magic[5] = { 0 };
+   U16 version;
+   U16 blockSize;
+   stream.read( 4, magic );
+   stream.read( &version );
+   stream.read( &blockSize );
+   ASSERT_STREQ( "T2TM", magic ) << "The block has no signature.";
+   ASSERT_EQ( (U16)Telemetry::StreamVersion, version ) << "Wrong stream version.";
+   ASSERT_EQ( stream.getStreamSize(), (U32)blockSize ) << "Frames were not written in a single block.";
+
+   // The names come first.
+   U8 recordType;
+   U16 counterCount;
+   stream.read( &recordType );
+   stream.read( &counterCount );
+   ASSERT_EQ( 'N', recordType ) << "The names were not written first.";
+   ASSERT_EQ( TelemetryCounter::getCount(), (U32)counterCount ) << "Wrong counter count.";
+
+   // Skip to the last frame.
+   const U32 frameSize = sizeof(U8) + sizeof(U32) + sizeof(U16) + counterCount * sizeof(F32);
+   stream.setPosition( blockSize - frameSize );
+   U32 frameNumber;
+   stream.read( &recordType );
+   stream.read( &frameNumber );
+   stream.read( &counterCount );
+   ASSERT_EQ( 'F', recordType ) << "The last record is not a frame.";
+   ASSERT_EQ( Telemetry::getFrameCount() - 1, frameNumber ) << "Wrong frame number.";
+
+   F32 value = 0.0f;
+   stream.setPosition( stream.getPosition() + sTelemetryTestGauge.getIndex() * sizeof(F32) );
+   stream.read( &value );
+   ASSERT_EQ( 9.0f, value ) << "Wrong counter value streamed.";
+
+   stream.close();
+   Telemetry::reset();
+
+   ASSERT_TRUE( Platform::fileDelete( filePath ) ) << "The stream file could not be deleted.";
+}
+
+#endif // TORQUE_SHIPPING
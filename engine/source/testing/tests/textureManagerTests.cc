@@ -0,0 +1,111 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
+#ifndef _TEXTURE_DICTIONARY_H_
+#include "graphics/TextureDictionary.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define TEXTUREMANAGER_UNITTEST_TEXTURES     3
+
+//-----------------------------------------------------------------------------
+
+static TextureObject* findTextureManagerTestTexture( const char* pTextureKey )
+{
+   return TextureDictionary::find( StringTable->insert( pTextureKey ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TextureManagerTests, EvictionTest )
+{
+   // Register textures without uploading them.
+   const bool dglRender = TextureManager::mDGLRender;
+   const S32 residentBudget = TextureManager::getResidentBudget();
+   TextureManager::mDGLRender = false;
+
+   // Free any unreferenced textures kept by an earlier budget.
+   TextureManager::setResidentBudget( 0 );
+   TextureManager::endFrame();
+
+   // Keep a bitmap so there is resident memory to budget.
+   TextureHandle keepTexture( "textureManagerTests/keep", new GBitmap( 4, 4, false, GBitmap::RGBA ), TextureHandle::BitmapKeepTexture );
+   ASSERT_GT( TextureManager::getBitmapResidentSize(), 0 ) << "The kept bitmap is not resident.";
+
+   // Without a budget a released texture is freed straight away.
+   {
+      TextureHandle texture( "textureManagerTests/unbudgeted", new GBitmap( 4, 4, false, GBitmap::RGBA ), TextureHandle::BitmapTexture );
+   }
+   ASSERT_TRUE( findTextureManagerTestTexture( "textureManagerTests/unbudgeted" ) == NULL ) << "A released texture was kept without a budget.";
+
+   // Within the budget released textures are kept, each idle for one frame less than the last.
+   const char* pTextureKeys[TEXTUREMANAGER_UNITTEST_TEXTURES] = { "textureManagerTests/first", "textureManagerTests/second", "textureManagerTests/third" };
+   TextureManager::setResidentBudget( S32_MAX );
+   for ( U32 index = 0; index < TEXTUREMANAGER_UNITTEST_TEXTURES; ++index )
+   {
+      {
+         TextureHandle texture( pTextureKeys[index], new GBitmap( 4, 4, false, GBitmap::RGBA ), TextureHandle::BitmapTexture );
+      }
+      TextureManager::endFrame();
+      ASSERT_TRUE( findTextureManagerTestTexture( pTextureKeys[index] ) != NULL ) << "A released texture was not kept within the budget.";
+   }
+
+   // A kept texture is reused rather than loaded again.
+   TextureObject* pKeptTexture = findTextureManagerTestTexture( pTextureKeys[0] );
+   {
+      TextureHandle texture( pTextureKeys[0], TextureHandle::BitmapTexture );
+      ASSERT_TRUE( (TextureObject*)texture == pKeptTexture ) << "A kept texture was not reused.";
+   }
+
+   // A referenced texture is not freed.
+   TextureHandle referencedTexture( "textureManagerTests/referenced", new GBitmap( 4, 4, false, GBitmap::RGBA ), TextureHandle::BitmapTexture );
+
+   // Over the budget the unreferenced textures are freed least recently used first.
+   const U32 freedCount = TextureManager::getFreedCount();
+   TextureManager::setResidentBudget( 1 );
+   TextureManager::endFrame();
+   ASSERT_EQ( freedCount + TEXTUREMANAGER_UNITTEST_TEXTURES, TextureManager::getFreedCount() ) << "Wrong freed texture count.";
+   for ( U32 index = 0; index < TEXTUREMANAGER_UNITTEST_TEXTURES; ++index )
+   {
+      ASSERT_TRUE( findTextureManagerTestTexture( pTextureKeys[index] ) == NULL ) << "An unreferenced texture was not freed over the budget.";
+      ASSERT_STREQ( pTextureKeys[index], TextureManager::getEvictionRecordKey( TEXTUREMANAGER_UNITTEST_TEXTURES - 1 - index ) ) << "Textures were not freed least recently used first.";
+   }
+   ASSERT_TRUE( findTextureManagerTestTexture( "textureManagerTests/referenced" ) != NULL ) << "A referenced texture was freed.";
+   ASSERT_TRUE( keepTexture.getBitmap() != NULL ) << "A kept bitmap was freed.";
+
+   TextureManager::setResidentBudget( residentBudget );
+   TextureManager::mDGLRender = dglRender;
+}
+
+#endif // TORQUE_SHIPPING